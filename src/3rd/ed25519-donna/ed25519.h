@@ -17,6 +17,11 @@ void ed25519_publickey(const ed25519_secret_key sk, ed25519_public_key pk);
 int ed25519_sign_open(const unsigned char *m, size_t mlen, const ed25519_public_key pk, const ed25519_signature RS);
 void ed25519_sign(const unsigned char *m, size_t mlen, const ed25519_secret_key sk, const ed25519_public_key pk, ed25519_signature RS);
 
+/* Same as ed25519_sign_open with pk unpacked once by ed25519_prepare_public_key into ed25519_prepared_size() bytes */
+size_t ed25519_prepared_size(void);
+int ed25519_prepare_public_key(const ed25519_public_key pk, unsigned char *prepared);
+int ed25519_sign_open_prepared(const unsigned char *m, size_t mlen, const ed25519_public_key pk, const unsigned char *prepared, const ed25519_signature RS);
+
 int ed25519_sign_open_batch(const unsigned char **m, size_t *mlen, const unsigned char **pk, const unsigned char **RS, size_t num, int *valid);
 
 void ed25519_randombytes_unsafe(void *out, size_t count);
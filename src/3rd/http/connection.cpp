@@ -13,6 +13,7 @@
 #include <vector>
 #include "connection_manager.hpp"
 #include "server.hpp"
+#include <utils/timestamp.h>
 
 namespace http
 {
@@ -24,6 +25,10 @@ connection::connection(asio::ip::tcp::socket* socket,
     : connection_manager_(manager)
     , request_handler_(handler)
 	, ssl_(false)
+	, keep_alive_(false)
+	, request_count_(0)
+	, last_active_(utils::Timestamp::HighResolution())
+	, busy_(false)
 {
 	socket_ = socket;
 	sslsocket_ = NULL;
@@ -37,6 +42,10 @@ connection::connection(SslSocket *socket,
 	: connection_manager_(manager)
 	, request_handler_(handler)
 	, ssl_(true)
+	, keep_alive_(false)
+	, request_count_(0)
+	, last_active_(utils::Timestamp::HighResolution())
+	, busy_(false)
 {
 	sslsocket_ = socket;
 	socket_ = NULL;
@@ -86,6 +95,18 @@ connection::stop()
 	}
 }
 
+bool
+connection::is_idle(int64_t now, int64_t timeout) const
+{
+	return !busy_ && now - last_active_ > timeout;
+}
+
+asio::io_service &
+connection::get_io_service()
+{
+	return ssl_ ? sslsocket_->get_io_service() : socket_->get_io_service();
+}
+
 void
 connection::do_shakehand(){
 	auto self(shared_from_this());
@@ -105,111 +126,195 @@ connection::do_shakehand(){
 void
 connection::do_read()
 {
-    auto self(shared_from_this());
+	auto self(shared_from_this());
+	auto read_handler = [this, self](asio::error_code ec, std::size_t bytes_transferred)
+	{
+		if (!ec)
+		{
+			handle_read(bytes_transferred);
+		}
+		else if (ec != asio::error::operation_aborted)
+		{
+			connection_manager_.stop(shared_from_this());
+		}
+	};
+
 	if (ssl_){
-	 sslsocket_->async_read_some(asio::buffer(buffer_),
-			[this, self](asio::error_code ec,
-			std::size_t bytes_transferred)
+		sslsocket_->async_read_some(asio::buffer(buffer_), read_handler);
+	}
+	else
+	{
+		socket_->async_read_some(asio::buffer(buffer_), read_handler);
+	}
+}
+
+void
+connection::handle_read(std::size_t bytes_transferred)
+{
+	busy_ = true;
+	last_active_ = utils::Timestamp::HighResolution();
+
+	// Every complete request in the data is answered before the next read,
+	// a partial one stays in the parser until more data arrives.
+	char *begin = buffer_.data();
+	char *end = begin + bytes_transferred;
+	while (begin != end)
+	{
+		request_parser::result_type result;
+		std::tie(result, begin) = request_parser_.parse(request_, begin, end);
+		if (result == request_parser::indeterminate)
 		{
-			if (!ec)
-			{
-				request_parser::result_type result;
-				std::tie(result, std::ignore) = request_parser_.parse(
-					request_, buffer_.data(), buffer_.data() + bytes_transferred);
-
-				if (result == request_parser::good)
-				{
-					request_handler_.handle_request(request_, reply_);
-					do_write();
-				}
-				else if (result == request_parser::bad)
-				{
-					reply_ = reply::stock_reply(reply::bad_request);
-					do_write();
-				}
-				else
-				{
-					do_read();
-				}
-			}
-			else if (ec != asio::error::operation_aborted)
-			{
-				connection_manager_.stop(shared_from_this());
-			}
-		});
+			break;
+		}
+
+		replies_.push_back(reply());
+		reply &rep = replies_.back();
+		if (result == request_parser::good)
+		{
+			request_handler_.handle_request(request_, rep);
+			keep_alive_ = prepare_reply(request_, rep, true);
+		}
+		else
+		{
+			rep = reply::stock_reply(reply::bad_request);
+			keep_alive_ = prepare_reply(request_, rep, false);
+		}
+
+		if (request_count_++ > 0)
+		{
+			connection_manager_.count_reused_request();
+		}
+		next_request();
+
+		// The rest of the data is dropped with the connection
+		if (!keep_alive_)
+		{
+			break;
+		}
+	}
+
+	if (replies_.empty())
+	{
+		busy_ = false;
+		do_read();
 	}
 	else
 	{
-		socket_->async_read_some(asio::buffer(buffer_),
-								[this, self](asio::error_code ec,
-											 std::size_t bytes_transferred)
-								{
-			if (!ec)
-			{
-				request_parser::result_type result;
-				std::tie(result, std::ignore) = request_parser_.parse(
-					request_, buffer_.data(), buffer_.data() + bytes_transferred);
-
-				if (result == request_parser::good)
-				{
-					request_handler_.handle_request(request_, reply_);
-					do_write();
-				}
-				else if (result == request_parser::bad)
-				{
-					reply_ = reply::stock_reply(reply::bad_request);
-					do_write();
-				}
-				else
-				{
-					do_read();
-				}
-			}
-			else if (ec != asio::error::operation_aborted)
-			{
-				connection_manager_.stop(shared_from_this());
-			}
-		});
+		do_write();
 	}
 }
 
+bool
+connection::prepare_reply(const request &req, reply &rep, bool keep_alive)
+{
+	// HTTP/1.1 keeps the connection by default, HTTP/1.0 only when asked
+	std::string connection_value = ToLower(req.GetHeaderValue("connection"));
+	keep_alive = keep_alive && request_handler_.GetKeepAliveTimeout() > 0;
+	if (req.http_version_major == 1 && req.http_version_minor == 0)
+	{
+		keep_alive = keep_alive && connection_value.find("keep-alive") != std::string::npos;
+	}
+	else
+	{
+		keep_alive = keep_alive && connection_value.find("close") == std::string::npos;
+	}
+
+	bool has_length = false;
+	bool has_connection = false;
+	for (std::size_t i = 0; i < rep.headers.size(); i++)
+	{
+		std::string name = ToLower(rep.headers[i].name);
+		if (name == "content-length")
+		{
+			has_length = true;
+		}
+		else if (name == "connection")
+		{
+			rep.headers[i].value = keep_alive ? "keep-alive" : "close";
+			has_connection = true;
+		}
+	}
+
+	// The client finds the end of the reply by its length
+	if (!has_length && rep.status != reply::not_modified)
+	{
+		header content_length = { "Content-Length", std::to_string(rep.content.size()) };
+		rep.headers.push_back(content_length);
+	}
+
+	if (!has_connection)
+	{
+		header connection = { "Connection", keep_alive ? "keep-alive" : "close" };
+		rep.headers.push_back(connection);
+	}
+
+	if (keep_alive)
+	{
+		header keep_alive_header = { "Keep-Alive", "timeout=" + std::to_string(request_handler_.GetKeepAliveTimeout()) };
+		rep.headers.push_back(keep_alive_header);
+	}
+	return keep_alive;
+}
+
+void
+connection::next_request()
+{
+	request next;
+	next.peer_address_ = request_.peer_address_;
+	next.local_address_ = request_.local_address_;
+	std::swap(request_, next);
+	request_parser_.reset();
+}
+
 void
 connection::do_write()
 {
-    auto self(shared_from_this());
-	if (ssl_){
-		asio::async_write(*sslsocket_, reply_.to_buffers(),
-			[this, self](asio::error_code ec, std::size_t)
+	auto self(shared_from_this());
+	last_active_ = utils::Timestamp::HighResolution();
+
+	std::vector<asio::const_buffer> buffers;
+	for (std::size_t i = 0; i < replies_.size(); i++)
+	{
+		std::vector<asio::const_buffer> reply_buffers = replies_[i].to_buffers();
+		buffers.insert(buffers.end(), reply_buffers.begin(), reply_buffers.end());
+	}
+
+	auto write_handler = [this, self](asio::error_code ec, std::size_t)
+	{
+		replies_.clear();
+		last_active_ = utils::Timestamp::HighResolution();
+		if (!ec && keep_alive_)
 		{
-			if (!ec)
+			busy_ = false;
+			do_read();
+			return;
+		}
+
+		if (!ec)
+		{
+			// Initiate graceful connection closure.
+			asio::error_code ignored_ec;
+			if (ssl_)
 			{
-				// Initiate graceful connection closure.
-				asio::error_code ignored_ec;
 				sslsocket_->lowest_layer().shutdown(asio::ip::tcp::socket::shutdown_both, ignored_ec);
 			}
-
-			if (ec != asio::error::operation_aborted)
+			else
 			{
-				connection_manager_.stop(shared_from_this());
-			}
-		});
-	}
-	else{
-		asio::async_write(*socket_, reply_.to_buffers(),
-			[this, self](asio::error_code ec, std::size_t)
-		{
-			if (!ec)
-			{
-				// Initiate graceful connection closure.
-				asio::error_code ignored_ec;
 				socket_->shutdown(asio::ip::tcp::socket::shutdown_both, ignored_ec);
 			}
+		}
 
-			if (ec != asio::error::operation_aborted)
-			{
-				connection_manager_.stop(shared_from_this());
-			}
-		});
+		if (ec != asio::error::operation_aborted)
+		{
+			connection_manager_.stop(shared_from_this());
+		}
+	};
+
+	if (ssl_){
+		asio::async_write(*sslsocket_, buffers, write_handler);
+	}
+	else{
+		asio::async_write(*socket_, buffers, write_handler);
 	}
 }
 
@@ -17,7 +17,9 @@
 #include <asio/ssl.hpp>
 
 #include <array>
+#include <atomic>
 #include <memory>
+#include <vector>
 #include "reply.hpp"
 #include "request.hpp"
 #include "request_parser.hpp"
@@ -54,10 +56,25 @@ public:
   /// Stop all asynchronous operations associated with the connection.
   void stop();
 
+  /// Whether no request is being served and nothing was read or written for longer than the timeout.
+  bool is_idle(int64_t now, int64_t timeout) const;
+
+  /// The io_service that runs the handlers of the connection.
+  asio::io_service &get_io_service();
+
 private:
   /// Perform an asynchronous read operation.
 	void do_read();
 
+	/// Answer the requests parsed from the data read, in the order they came.
+	void handle_read(std::size_t bytes_transferred);
+
+	/// Set the connection headers of the reply and tell whether it stays open.
+	bool prepare_reply(const request &req, reply &rep, bool keep_alive);
+
+	/// Start parsing the next request of the connection.
+	void next_request();
+
 	/// Perform an asynchronous read operation.
 	void do_shakehand();
 
@@ -83,10 +100,22 @@ private:
   /// The parser for the incoming request.
   request_parser request_parser_;
 
-  /// The reply to be sent back to the client.
-  reply reply_;
+  /// The replies to be sent back to the client, pipelined requests are answered together.
+  std::vector<reply> replies_;
 
   bool ssl_;
+
+  /// Whether the connection stays open after the replies are written.
+  bool keep_alive_;
+
+  /// The number of requests answered on the connection.
+  int64_t request_count_;
+
+  /// The time of the last read or write, checked by the connection manager.
+  std::atomic<int64_t> last_active_;
+
+  /// Set from the read of a request until its reply is written, the connection is never idle meanwhile.
+  std::atomic<bool> busy_;
 };
 
 typedef std::shared_ptr<connection> connection_ptr;
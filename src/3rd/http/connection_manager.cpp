@@ -9,6 +9,7 @@
 //
 
 #include "connection_manager.hpp"
+#include <utils/timestamp.h>
 
 namespace http
 {
@@ -16,6 +17,9 @@ namespace server
 {
 
 connection_manager::connection_manager()
+	: accepted_count_(0)
+	, reused_request_count_(0)
+	, idle_stopped_count_(0)
 {
 }
 
@@ -26,6 +30,7 @@ connection_manager::start(connection_ptr c)
     connections_.insert(c);
 	c->start();
 	mutex_.unlock();
+	accepted_count_++;
 }
 
 void
@@ -45,5 +50,64 @@ connection_manager::stop_all()
     connections_.clear();
 }
 
+void
+connection_manager::stop_idle(int64_t now, int64_t timeout)
+{
+	mutex_.lock();
+	for (auto c : connections_)
+	{
+		if (!c->is_idle(now, timeout))
+			continue;
+
+		// The handlers of the connection may be running on its thread, stop it there.
+		// It may have been stopped or taken a request since, and may be posted by several sweeps.
+		c->get_io_service().post([this, c, timeout]()
+		{
+			mutex_.lock();
+			bool idle = connections_.count(c) > 0 && c->is_idle(utils::Timestamp::HighResolution(), timeout);
+			mutex_.unlock();
+			if (!idle)
+				return;
+
+			idle_stopped_count_++;
+			stop(c);
+		});
+	}
+	mutex_.unlock();
+}
+
+void
+connection_manager::count_reused_request()
+{
+	reused_request_count_++;
+}
+
+std::size_t
+connection_manager::size()
+{
+	mutex_.lock();
+	std::size_t count = connections_.size();
+	mutex_.unlock();
+	return count;
+}
+
+int64_t
+connection_manager::accepted_count() const
+{
+	return accepted_count_;
+}
+
+int64_t
+connection_manager::reused_request_count() const
+{
+	return reused_request_count_;
+}
+
+int64_t
+connection_manager::idle_stopped_count() const
+{
+	return idle_stopped_count_;
+}
+
 } // namespace server
 } // namespace http
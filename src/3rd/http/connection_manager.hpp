@@ -11,6 +11,7 @@
 #ifndef HTTP_CONNECTION_MANAGER_HPP
 #define HTTP_CONNECTION_MANAGER_HPP
 
+#include <atomic>
 #include <mutex>
 #include <set>
 #include "connection.hpp"
@@ -38,10 +39,26 @@ public:
   /// Stop all connections.
   void stop_all();
 
+  /// Stop the connections idle for longer than the timeout, each on its own thread.
+  void stop_idle(int64_t now, int64_t timeout);
+
+  /// Count a request answered on a connection kept open by an earlier one.
+  void count_reused_request();
+
+  /// Counters for the status of the server.
+  std::size_t size();
+  int64_t accepted_count() const;
+  int64_t reused_request_count() const;
+  int64_t idle_stopped_count() const;
+
 private:
   /// The managed connections.
   std::set<connection_ptr> connections_;
   std::mutex mutex_;
+
+  std::atomic<int64_t> accepted_count_;
+  std::atomic<int64_t> reused_request_count_;
+  std::atomic<int64_t> idle_stopped_count_;
 };
 
 } // namespace server
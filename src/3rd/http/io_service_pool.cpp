@@ -18,7 +18,7 @@ namespace http {
 namespace server {
 
 io_service_pool::io_service_pool(std::size_t pool_size)
-  : next_io_service_(2)
+  : next_io_service_(2), next_post_service_(0)
 {
   if (pool_size < 2)
     throw std::runtime_error("io_service_pool size is less 2");
@@ -83,5 +83,17 @@ asio::io_service& io_service_pool::get_first_service()
 	return *io_services_[0];
 }
 
+void io_service_pool::post(const std::function<void()>& func)
+{
+  // The first io_service accepts connections, the others take turns.
+  std::size_t index = 1 + next_post_service_++ % (io_services_.size() - 1);
+  io_services_[index]->post(func);
+}
+
+std::size_t io_service_pool::size() const
+{
+  return io_services_.size();
+}
+
 } // namespace server2
 } // namespace http
@@ -13,6 +13,8 @@
 
 #include <asio.hpp>
 #include <vector>
+#include <atomic>
+#include <functional>
 namespace http {
 namespace server {
 
@@ -33,6 +35,11 @@ public:
   asio::io_service& get_other_service();
   asio::io_service& get_first_service();
 
+  /// Run a function on one of the connection threads, safe to call from any thread.
+  void post(const std::function<void()>& func);
+
+  std::size_t size() const;
+
 private:
   typedef std::shared_ptr<asio::io_service> io_service_ptr;
   typedef std::shared_ptr<asio::io_service::work> work_ptr;
@@ -47,6 +54,9 @@ private:
 
   /// The next io_service to use for a connection.
   std::size_t next_io_service_;
+
+  /// The next io_service to post a function to.
+  std::atomic<std::size_t> next_post_service_;
 };
 
 } // namespace server2
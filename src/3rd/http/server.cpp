@@ -37,6 +37,8 @@ server::server(const std::string& address,
 	, socket_ptr_(NULL)
 	, sslsocket_ptr_(NULL)
 	, context_(context)
+	, keep_alive_timeout_(0)
+	, idle_timer_(io_server_pool_.get_first_service())
 {
     asio::ip::tcp::endpoint endpoint(asio::ip::address::from_string(address),
                                      port);
@@ -81,6 +83,20 @@ server::addRoute(const std::string& routeName, routeHandler callback)
     mRoutes[routeName] = callback;
 }
 
+void server::addReplyRoute(const std::string& routeName, replyHandler callback)
+{
+	mReplyRoutes[routeName] = callback;
+}
+
+server::replyHandler *server::getReplyRoute(const std::string& routeName){
+	std::map<std::string, replyHandler>::iterator iter = mReplyRoutes.find(routeName);
+	if (iter != mReplyRoutes.end()){
+		return &iter->second;
+	} else{
+		return NULL;
+	}
+}
+
 server::routeHandler *server::getRoute(const std::string& routeName){
 	std::map<std::string, routeHandler>::iterator iter = mRoutes.find(routeName);
 	if (iter != mRoutes.end()){
@@ -151,13 +167,37 @@ server::~server()
 }
 
 void server::Run(){
+	if (keep_alive_timeout_ > 0) {
+		do_check_idle();
+	}
 	io_server_pool_.run();
 }
 
+void server::do_check_idle(){
+	idle_timer_.expires_from_now(std::chrono::seconds(1));
+	idle_timer_.async_wait([this](asio::error_code ec)
+	{
+		if (ec) {
+			return;
+		}
+
+		connection_manager_.stop_idle(utils::Timestamp::HighResolution(), keep_alive_timeout_ * utils::MICRO_UNITS_PER_SEC);
+		do_check_idle();
+	});
+}
+
 void server::Stop(){
 	io_server_pool_.stop();
 }
 
+void server::Post(const std::function<void()> &func){
+	io_server_pool_.post(func);
+}
+
+size_t server::GetThreadCount() const{
+	return io_server_pool_.size();
+}
+
 unsigned short server::GetServerPort() const {
     asio::ip::tcp::endpoint local_ep =acceptor_.local_endpoint();
     return local_ep.port();
@@ -412,7 +452,26 @@ server::handle_request(const request& req, reply& rep)
 	bool req_origin = !req.GetHeaderValue("origin").empty();
 
 	std::string command = req.command;
-    if (mRoutes.find(command) != mRoutes.end())
+	std::map<std::string, replyHandler>::iterator reply_iter = mReplyRoutes.find(command);
+	if (reply_iter != mReplyRoutes.end())
+	{
+		rep.status = reply::ok;
+		reply_iter->second(req, rep);
+
+		header content_length = { "Content-Length", std::to_string(rep.content.size()) };
+		rep.headers.push_back(content_length);
+		bool has_content_type = false;
+		for (size_t i = 0; i < rep.headers.size(); i++) {
+			if (rep.headers[i].name == "Content-Type") has_content_type = true;
+		}
+		if (rep.status == reply::ok && !has_content_type) {
+			header content_type = { "Content-Type", "application/json" };
+			rep.headers.push_back(content_type);
+		}
+		header connection = { "Connection", "close" };
+		rep.headers.push_back(connection);
+	}
+    else if (mRoutes.find(command) != mRoutes.end())
     {
 		mRoutes[command](req, rep.content);
 
@@ -616,6 +675,18 @@ void server::SetIndexName(const std::string &index_name){
 	index_file_ = index_name;
 }
 
+void server::SetKeepAliveTimeout(int64_t timeout) {
+	keep_alive_timeout_ = timeout;
+}
+
+int64_t server::GetKeepAliveTimeout() const {
+	return keep_alive_timeout_;
+}
+
+connection_manager &server::GetConnectionManager() {
+	return connection_manager_;
+}
+
 void server::SetAllowOrigin(const std::string &allow_origin) {
 	allow_origin_ = allow_origin;
 }
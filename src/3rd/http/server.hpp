@@ -18,6 +18,7 @@
 #include <string>
 #include <map>
 #include <functional>
+#include <asio/steady_timer.hpp>
 #include "io_service_pool.hpp"
 #include "connection.hpp"
 #include "connection_manager.hpp"
@@ -49,6 +50,7 @@ class server
     
 public:
     typedef std::function<void(const request&, std::string&)> routeHandler;
+    typedef std::function<void(const request&, reply&)> replyHandler;
     server(const server&) = delete;
     server& operator=(const server&) = delete;
 
@@ -60,6 +62,9 @@ public:
 
 	void addRoute(const std::string& routeName, routeHandler callback);
 	routeHandler *getRoute(const std::string& routeName);
+	//The handler sets the status and its own headers, it is tried before the plain route of the same name
+	void addReplyRoute(const std::string& routeName, replyHandler callback);
+	replyHandler *getReplyRoute(const std::string& routeName);
     void add404(routeHandler callback);
 
     void handle_request(const request& req, reply& rep);
@@ -72,9 +77,18 @@ public:
 	void SetIndexName(const std::string &index_name);
 	void SetAllowOrigin(const std::string &allow_origin);
 
+	//Seconds an idle connection is kept open for further requests, 0 closes it after each reply
+	void SetKeepAliveTimeout(int64_t timeout);
+	int64_t GetKeepAliveTimeout() const;
+	connection_manager &GetConnectionManager();
+
 	void Run();
 	void Stop();
 
+	//Run func on one of the connection threads
+	void Post(const std::function<void()> &func);
+	size_t GetThreadCount() const;
+
     unsigned short GetServerPort() const;
 
 	int64_t start_count_;
@@ -84,6 +98,9 @@ private:
     /// Perform an asynchronous accept operation.
     void do_accept();
 
+    /// Close the connections idle for longer than the keep-alive timeout, once a second.
+    void do_check_idle();
+
     /// Perform URL-decoding on a string. Returns false if the encoding was
     /// invalid.
    // static bool url_decode(const std::string& in, std::string& out);
@@ -106,10 +123,13 @@ private:
 	asio::ssl::context *context_;
 
     std::map<std::string, routeHandler> mRoutes;
+    std::map<std::string, replyHandler> mReplyRoutes;
 
 	std::string web_home_;
 	std::string index_file_;
 	std::string allow_origin_;
+	int64_t keep_alive_timeout_;
+	asio::steady_timer idle_timer_;
 
 	std::map<std::string, std::string> compress_type_;
 	std::map<std::string, std::string> content_type_;
@@ -0,0 +1,138 @@
+/*
+	bumo is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	bumo is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with bumo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "event_index.h"
+
+namespace bumo {
+
+	EventIndex::Filter::Filter() :
+		all_txs_(false),
+		ledger_close_(false) {}
+
+	EventIndex::EventIndex() {}
+
+	EventIndex::~EventIndex() {}
+
+	void EventIndex::Set(int64_t conn_id, const Filter &filter) {
+		Remove(conn_id);
+
+		filters_[conn_id] = filter;
+		if (filter.all_txs_) all_txs_.insert(conn_id);
+		if (filter.ledger_close_) ledger_close_.insert(conn_id);
+		AddKeys(accounts_, filter.accounts_, conn_id);
+		AddKeys(contracts_, filter.contracts_, conn_id);
+		AddKeys(topics_, filter.topics_, conn_id);
+	}
+
+	void EventIndex::Remove(int64_t conn_id) {
+		auto iter = filters_.find(conn_id);
+		if (iter == filters_.end()) {
+			return;
+		}
+
+		const Filter &filter = iter->second;
+		all_txs_.erase(conn_id);
+		ledger_close_.erase(conn_id);
+		RemoveKeys(accounts_, filter.accounts_, conn_id);
+		RemoveKeys(contracts_, filter.contracts_, conn_id);
+		RemoveKeys(topics_, filter.topics_, conn_id);
+		filters_.erase(iter);
+	}
+
+	void EventIndex::MatchTransaction(const protocol::TransactionEnvStore &tx_store, std::set<int64_t> &conn_ids) const {
+		conn_ids.insert(all_txs_.begin(), all_txs_.end());
+
+		//The contracts are the source of the transactions they emit
+		const protocol::Transaction &trans = tx_store.transaction_env().transaction();
+		MatchKey(accounts_, trans.source_address(), conn_ids);
+		MatchKey(contracts_, trans.source_address(), conn_ids);
+
+		for (int32_t i = 0; i < trans.operations_size(); i++) {
+			const protocol::Operation &ope = trans.operations(i);
+			if (!ope.source_address().empty()) {
+				MatchKey(accounts_, ope.source_address(), conn_ids);
+			}
+
+			const std::string *dest_address = NULL;
+			switch (ope.type()) {
+			case protocol::Operation_Type_CREATE_ACCOUNT:
+				dest_address = &ope.create_account().dest_address();
+				break;
+			case protocol::Operation_Type_PAY_COIN:
+				dest_address = &ope.pay_coin().dest_address();
+				break;
+			case protocol::Operation_Type_PAY_ASSET:
+				dest_address = &ope.pay_asset().dest_address();
+				break;
+			case protocol::Operation_Type_LOG:
+				MatchKey(topics_, ope.log().topic(), conn_ids);
+				break;
+			default:
+				break;
+			}
+
+			//Paying to a contract calls it
+			if (dest_address != NULL) {
+				MatchKey(accounts_, *dest_address, conn_ids);
+				MatchKey(contracts_, *dest_address, conn_ids);
+			}
+		}
+	}
+
+	void EventIndex::MatchAccount(const std::string &address, std::set<int64_t> &conn_ids) const {
+		conn_ids.insert(all_txs_.begin(), all_txs_.end());
+		MatchKey(accounts_, address, conn_ids);
+	}
+
+	const std::set<int64_t> &EventIndex::GetLedgerCloseSubscribers() const {
+		return ledger_close_;
+	}
+
+	void EventIndex::GetModuleStatus(Json::Value &data) const {
+		data["subscriptions"] = (Json::UInt64)filters_.size();
+		data["all_txs"] = (Json::UInt64)all_txs_.size();
+		data["ledger_close"] = (Json::UInt64)ledger_close_.size();
+		data["accounts"] = (Json::UInt64)accounts_.size();
+		data["contracts"] = (Json::UInt64)contracts_.size();
+		data["topics"] = (Json::UInt64)topics_.size();
+	}
+
+	void EventIndex::AddKeys(KeyIndex &index, const std::set<std::string> &keys, int64_t conn_id) {
+		for (const auto &key : keys) {
+			index[key].insert(conn_id);
+		}
+	}
+
+	void EventIndex::RemoveKeys(KeyIndex &index, const std::set<std::string> &keys, int64_t conn_id) {
+		for (const auto &key : keys) {
+			auto iter = index.find(key);
+			if (iter == index.end()) {
+				continue;
+			}
+
+			iter->second.erase(conn_id);
+			if (iter->second.empty()) {
+				index.erase(iter);
+			}
+		}
+	}
+
+	void EventIndex::MatchKey(const KeyIndex &index, const std::string &key, std::set<int64_t> &conn_ids) {
+		auto iter = index.find(key);
+		if (iter != index.end()) {
+			conn_ids.insert(iter->second.begin(), iter->second.end());
+		}
+	}
+}
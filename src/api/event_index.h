@@ -0,0 +1,70 @@
+/*
+	bumo is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	bumo is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with bumo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef EVENT_INDEX_H_
+#define EVENT_INDEX_H_
+
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <json/json.h>
+#include <proto/cpp/overlay.pb.h>
+
+namespace bumo {
+
+	//Subscriptions of the websocket connections, indexed by the filter keys so an event is matched without visiting every connection
+	class EventIndex {
+	public:
+		struct Filter {
+			//Receive every transaction, as the connections which have never subscribed do
+			bool all_txs_;
+			bool ledger_close_;
+			std::set<std::string> accounts_;
+			std::set<std::string> contracts_;
+			std::set<std::string> topics_;
+
+			Filter();
+		};
+
+		EventIndex();
+		~EventIndex();
+
+		void Set(int64_t conn_id, const Filter &filter);
+		void Remove(int64_t conn_id);
+
+		//Adds the connections subscribed to the transaction
+		void MatchTransaction(const protocol::TransactionEnvStore &tx_store, std::set<int64_t> &conn_ids) const;
+		//Adds the connections subscribed to the transactions of the account
+		void MatchAccount(const std::string &address, std::set<int64_t> &conn_ids) const;
+		const std::set<int64_t> &GetLedgerCloseSubscribers() const;
+
+		void GetModuleStatus(Json::Value &data) const;
+	private:
+		typedef std::unordered_map<std::string, std::unordered_set<int64_t>> KeyIndex;
+
+		static void AddKeys(KeyIndex &index, const std::set<std::string> &keys, int64_t conn_id);
+		static void RemoveKeys(KeyIndex &index, const std::set<std::string> &keys, int64_t conn_id);
+		static void MatchKey(const KeyIndex &index, const std::string &key, std::set<int64_t> &conn_ids);
+
+		std::unordered_map<int64_t, Filter> filters_;
+		std::set<int64_t> all_txs_;
+		std::set<int64_t> ledger_close_;
+		KeyIndex accounts_;
+		KeyIndex contracts_;
+		KeyIndex topics_;
+	};
+}
+
+#endif
@@ -0,0 +1,95 @@
+/*
+	bumo is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	bumo is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with bumo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <utils/crypto.h>
+#include <utils/strings.h>
+#include "response_cache.h"
+
+namespace bumo {
+
+	ResponseCache::ResponseCache(size_t max_bytes) :
+		bytes_(0),
+		max_bytes_(max_bytes),
+		hit_count_(0),
+		miss_count_(0) {}
+
+	ResponseCache::~ResponseCache() {}
+
+	ResponseCache::EntryPointer ResponseCache::Get(const std::string &key) {
+		utils::MutexGuard guard(mutex_);
+		auto iter = index_.find(key);
+		if (iter == index_.end()) {
+			miss_count_++;
+			return NULL;
+		}
+
+		hit_count_++;
+		entries_.splice(entries_.begin(), entries_, iter->second);
+		return iter->second->second;
+	}
+
+	ResponseCache::EntryPointer ResponseCache::Put(const std::string &key, const std::string &content) {
+		//A strong tag, the content of an immutable query never changes
+		std::shared_ptr<Entry> entry = std::make_shared<Entry>();
+		entry->content = content;
+		entry->etag = "\"" + utils::String::BinToHexString(utils::Sha256::Crypto(content).substr(0, 16)) + "\"";
+
+		size_t entry_bytes = key.size() + content.size();
+		if (entry_bytes > max_bytes_) {
+			return entry;
+		}
+
+		utils::MutexGuard guard(mutex_);
+		auto iter = index_.find(key);
+		if (iter != index_.end()) {
+			bytes_ -= iter->first.size() + iter->second->second->content.size();
+			entries_.erase(iter->second);
+			index_.erase(iter);
+		}
+
+		entries_.push_front(std::make_pair(key, entry));
+		index_[key] = entries_.begin();
+		bytes_ += entry_bytes;
+
+		while (bytes_ > max_bytes_) {
+			const std::pair<std::string, EntryPointer> &last = entries_.back();
+			bytes_ -= last.first.size() + last.second->content.size();
+			index_.erase(last.first);
+			entries_.pop_back();
+		}
+		return entry;
+	}
+
+	bool ResponseCache::MatchETag(const std::string &if_none_match, const std::string &etag) {
+		utils::StringVector tags = utils::String::Strtok(if_none_match, ',');
+		for (size_t i = 0; i < tags.size(); i++) {
+			//If-None-Match uses the weak comparison
+			std::string tag = utils::String::Trim(tags[i]);
+			if (tag == "*") return true;
+			if (tag.compare(0, 2, "W/") == 0) tag = tag.substr(2);
+			if (tag == etag) return true;
+		}
+		return false;
+	}
+
+	void ResponseCache::GetModuleStatus(Json::Value &data) {
+		utils::MutexGuard guard(mutex_);
+		data["count"] = (Json::UInt64)index_.size();
+		data["bytes"] = (Json::UInt64)bytes_;
+		data["max_bytes"] = (Json::UInt64)max_bytes_;
+		data["hit_count"] = hit_count_;
+		data["miss_count"] = miss_count_;
+	}
+}
@@ -0,0 +1,59 @@
+/*
+	bumo is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	bumo is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with bumo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef RESPONSE_CACHE_H_
+#define RESPONSE_CACHE_H_
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <json/json.h>
+#include <utils/thread.h>
+
+namespace bumo {
+
+	//Replies of immutable queries, least recently used first out once the bytes exceed the limit
+	class ResponseCache {
+	public:
+		struct Entry {
+			std::string content;
+			std::string etag;
+		};
+		typedef std::shared_ptr<const Entry> EntryPointer;
+
+		ResponseCache(size_t max_bytes);
+		~ResponseCache();
+
+		EntryPointer Get(const std::string &key);
+		EntryPointer Put(const std::string &key, const std::string &content);
+
+		//Whether the If-None-Match header of the request names the entity tag
+		static bool MatchETag(const std::string &if_none_match, const std::string &etag);
+
+		void GetModuleStatus(Json::Value &data);
+	private:
+		typedef std::list<std::pair<std::string, EntryPointer>> EntryList;
+
+		utils::Mutex mutex_;
+		EntryList entries_;
+		std::unordered_map<std::string, EntryList::iterator> index_;
+		size_t bytes_;
+		size_t max_bytes_;
+		int64_t hit_count_;
+		int64_t miss_count_;
+	};
+}
+
+#endif
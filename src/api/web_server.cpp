@@ -25,12 +25,15 @@
 
 namespace bumo {
 
+	static const char *PROTOBUF_CONTENT_TYPE = "application/x-protobuf";
+
 	WebServer::WebServer() :
 		server_ptr_(NULL),
 		context_(NULL),
 		running(NULL),
 		thread_count_(0),
-        port_(0)
+        port_(0),
+		response_cache_(NULL)
 	{
 	}
 
@@ -76,6 +79,7 @@ namespace bumo {
         port_ =server_ptr_->GetServerPort();
 
 		server_ptr_->SetAllowOrigin(webserver_config.allow_origin_);
+		server_ptr_->SetKeepAliveTimeout(webserver_config.keep_alive_timeout_);
 		server_ptr_->SetHome(utils::File::GetBinHome() + "/" + webserver_config.directory_);
 
 		server_ptr_->add404(std::bind(&WebServer::FileNotFound, this, std::placeholders::_1, std::placeholders::_2));
@@ -113,6 +117,41 @@ namespace bumo {
 		server_ptr_->addRoute("callContract", std::bind(&WebServer::CallContract, this, std::placeholders::_1, std::placeholders::_2));
 		server_ptr_->addRoute("testTransaction", std::bind(&WebServer::TestTransaction, this, std::placeholders::_1, std::placeholders::_2));
 
+		if (webserver_config.response_cache_size_ > 0) {
+			response_cache_ = new ResponseCache(webserver_config.response_cache_size_);
+
+			//The plain routes stay for multiQuery, requests from the clients go through the cache
+			std::map<std::string, ImmutableFunction> cached_routes;
+			cached_routes["getLedger"] = std::bind(&WebServer::IsClosedLedgerQuery, this, std::placeholders::_1);
+			cached_routes["getTransactionHistory"] = std::bind(&WebServer::IsCommittedTransactionQuery, this, std::placeholders::_1);
+			cached_routes["getTransactionBlob"] = [](const http::server::request &request) { return true; };
+			for (auto iter = cached_routes.begin(); iter != cached_routes.end(); iter++) {
+				http::server::server::routeHandler handler = *server_ptr_->getRoute(iter->first);
+				server_ptr_->addReplyRoute(iter->first, std::bind(&WebServer::CachedQuery, this, handler, iter->second, std::placeholders::_1, std::placeholders::_2));
+			}
+		}
+
+		std::map<std::string, http::server::server::routeHandler> proto_routes;
+		proto_routes["getAccount"] = std::bind(&WebServer::GetAccountProto, this, std::placeholders::_1, std::placeholders::_2);
+		proto_routes["getLedger"] = std::bind(&WebServer::GetLedgerProto, this, std::placeholders::_1, std::placeholders::_2);
+		proto_routes["getTransactionHistory"] = std::bind(&WebServer::GetTransactionHistoryProto, this, std::placeholders::_1, std::placeholders::_2);
+		proto_routes["submitTransaction"] = std::bind(&WebServer::SubmitTransactionProto, this, std::placeholders::_1, std::placeholders::_2);
+		for (auto iter = proto_routes.begin(); iter != proto_routes.end(); iter++) {
+			//Json requests keep going through the cache if there is one
+			http::server::server::replyHandler json_handler;
+			http::server::server::replyHandler *cached = server_ptr_->getReplyRoute(iter->first);
+			if (cached) {
+				json_handler = *cached;
+			}
+			else {
+				http::server::server::routeHandler handler = *server_ptr_->getRoute(iter->first);
+				json_handler = [handler](const http::server::request &request, http::server::reply &reply) {
+					handler(request, reply.content);
+				};
+			}
+			server_ptr_->addReplyRoute(iter->first, std::bind(&WebServer::NegotiatedQuery, this, json_handler, iter->second, std::placeholders::_1, std::placeholders::_2));
+		}
+
 		server_ptr_->Run();
 		running = true;
 
@@ -134,6 +173,11 @@ namespace bumo {
 			delete context_;
 			context_ = NULL;
 		}
+
+		if (response_cache_) {
+			delete response_cache_;
+			response_cache_ = NULL;
+		}
 		LOG_INFO("WebServer stop [OK]");
 		return true;
 	}
@@ -160,7 +204,7 @@ namespace bumo {
 	void WebServer::MultiQuery(const http::server::request &request, std::string &reply){
 		WebServerConfigure &web_config = Configure::Instance().webserver_configure_;
 		Json::Value reply_json = Json::Value(Json::objectValue);
-		Json::Value &results = reply_json["results"];
+		reply_json["results"] = Json::Value(Json::nullValue);
 
 		do {
 			Json::Value req;
@@ -178,12 +222,15 @@ namespace bumo {
 				break;
 			}
 
-			for (uint32_t i = 0; i < items.size(); i++){
-				const Json::Value &item = items[i];
-				Json::Value &result = results[i];
-				std::string url = item["url"].asString();
-				std::string method = item["method"].asString();
+			if (items.size() == 0){
+				reply_json["error_code"] = 0;
+				break;
+			}
 
+			//The sub requests run on the http threads, the calling thread takes its share
+			std::vector<std::string> replies(items.size());
+			std::function<void(size_t)> query_func = [this, &items, &replies](size_t i){
+				const Json::Value &item = items[(Json::UInt)i];
 				http::server::request request_inner;
 				if (item.isMember("jsonData"))
 				{
@@ -198,23 +245,135 @@ namespace bumo {
 					}
 				}
 
-				std::string reply_inner;
-				request_inner.uri = url;
-				request_inner.method = method;
+				request_inner.uri = item["url"].asString();
+				request_inner.method = item["method"].asString();
 				request_inner.Update();
 
 				http::server::server::routeHandler *handle = server_ptr_->getRoute(request_inner.command);
 				if (handle) {
-					(*handle)(request_inner, reply_inner);
+					(*handle)(request_inner, replies[i]);
+				}
+			};
+			ParallelFor(items.size(), server_ptr_->GetThreadCount() - 1, [this](const std::function<void()> &drain){
+				server_ptr_->Post(drain);
+			}, query_func);
+
+			//The replies are already json, they are spliced in as they are instead of parsed and written again
+			reply = "{\"error_code\":0,\"results\":[";
+			for (size_t i = 0; i < replies.size(); i++){
+				if (i > 0){
+					reply += ",";
 				}
+				AppendJsonFragment(replies[i], reply);
+			}
+			reply += "]}";
+			return;
+		} while (false);
+
+		reply = reply_json.toFastString();
+	}
+
+	void WebServer::AppendJsonFragment(const std::string &fragment, std::string &out){
+		size_t begin = fragment.find_first_not_of(" \t\r\n");
+		if (begin != std::string::npos && (fragment[begin] == '{' || fragment[begin] == '[')){
+			out += fragment;
+			return;
+		}
+
+		//Not a handler reply in json, keep what parsing it used to give
+		Json::Value value;
+		value.fromString(fragment);
+		out += value.toFastString();
+	}
 
-				result.fromString(reply_inner);
+	void WebServer::CachedQuery(const http::server::server::routeHandler &handler, const ImmutableFunction &immutable,
+		const http::server::request &request, http::server::reply &reply) {
+		if (!immutable(request)) {
+			handler(request, reply.content);
+			return;
+		}
+
+		//Every part is prefixed with its length so that no two requests share a key
+		std::string key = utils::String::Format(FMT_SIZE ":%s", request.command.size(), request.command.c_str());
+		for (auto iter = request.parameter.begin(); iter != request.parameter.end(); iter++) {
+			key += utils::String::Format(FMT_SIZE ":", iter->first.size()) + iter->first;
+			key += utils::String::Format(FMT_SIZE ":", iter->second.size()) + iter->second;
+		}
+		key += utils::String::Format(FMT_SIZE ":", request.body.size()) + request.body;
+
+		ResponseCache::EntryPointer entry = response_cache_->Get(key);
+		if (!entry) {
+			std::string content;
+			handler(request, content);
+			if (!IsSuccessReply(content)) {
+				//Errors such as a transaction not found yet may change later
+				reply.content.swap(content);
+				return;
 			}
+			entry = response_cache_->Put(key, content);
+		}
 
-			reply_json["error_code"] = 0;
-		} while (false);
+		http::server::header etag = { "ETag", entry->etag };
+		reply.headers.push_back(etag);
+		if (ResponseCache::MatchETag(request.GetHeaderValue("if-none-match"), entry->etag)) {
+			reply.status = http::server::reply::not_modified;
+			return;
+		}
+		reply.content = entry->content;
+	}
+
+	void WebServer::NegotiatedQuery(const http::server::server::replyHandler &json_handler, const http::server::server::routeHandler &proto_handler,
+		const http::server::request &request, http::server::reply &reply) {
+		//The same url gives either format, shared caches keep them apart by the Accept header
+		http::server::header vary = { "Vary", "Accept" };
+		reply.headers.push_back(vary);
+		if (!IsProtobufRequest(request)) {
+			json_handler(request, reply);
+			return;
+		}
+
+		proto_handler(request, reply.content);
+		http::server::header content_type = { "Content-Type", PROTOBUF_CONTENT_TYPE };
+		reply.headers.push_back(content_type);
+	}
+
+	bool WebServer::IsProtobufRequest(const http::server::request &request) {
+		//A protobuf body is answered in protobuf as well
+		return request.GetHeaderValue("accept").find(PROTOBUF_CONTENT_TYPE) != std::string::npos ||
+			request.GetHeaderValue("content-type").find(PROTOBUF_CONTENT_TYPE) == 0;
+	}
+
+	bool WebServer::IsClosedLedgerQuery(const http::server::request &request) {
+		//Without a seq the last closed ledger is queried, which moves on
+		std::string seq = request.GetParamValue("seq");
+		if (seq.empty()) {
+			return false;
+		}
+
+		int64_t seq_int = utils::String::Stoi64(seq);
+		return seq_int > 0 && seq_int <= LedgerManager::Instance().GetLastClosedLedger().seq();
+	}
+
+	bool WebServer::IsCommittedTransactionQuery(const http::server::request &request) {
+		std::string seq = request.GetParamValue("ledger_seq");
+		if (!seq.empty()) {
+			int64_t seq_int = utils::String::Stoi64(seq);
+			return seq_int > 0 && seq_int <= LedgerManager::Instance().GetLastClosedLedger().seq();
+		}
+
+		//Only found transactions are cached and those are committed, without a hash the latest ones are queried
+		return !request.GetParamValue("hash").empty();
+	}
+
+	bool WebServer::IsSuccessReply(const std::string &reply) {
+		//The members are sorted by name, so the first error_code is the one of the reply
+		size_t pos = reply.find("\"error_code\"");
+		if (pos == std::string::npos) {
+			return false;
+		}
 
-		reply = reply_json.toStyledString();
+		pos = reply.find_first_not_of(" \t\r\n:", pos + strlen("\"error_code\""));
+		return pos != std::string::npos && reply[pos] == '0';
 	}
 
 	void WebServer::GetModuleStatus(Json::Value &data) {
@@ -224,6 +383,15 @@ namespace bumo {
 		data["end_request_count"] = server_ptr_->end_count_;
 		data["expire_request_count"] = server_ptr_->expire_count_;
 		data["thread_count"] = (Json::Int64)thread_count_;
+
+		http::server::connection_manager &connections = server_ptr_->GetConnectionManager();
+		data["connection_count"] = (Json::UInt64)connections.size();
+		data["accepted_connection_count"] = connections.accepted_count();
+		data["reused_connection_request_count"] = connections.reused_request_count();
+		data["idle_closed_connection_count"] = connections.idle_stopped_count();
+		if (response_cache_) {
+			response_cache_->GetModuleStatus(data["response_cache"]);
+		}
 	}
 
 	uint16_t WebServer::GetListenPort(){
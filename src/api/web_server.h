@@ -22,9 +22,12 @@ limitations under the License.
 #include <utils/singleton.h>
 #include <utils/net.h>
 #include <main/configure.h>
+#include "response_cache.h"
 
 namespace bumo {
 
+	class TransactionFrm;
+
 	class WebServer :public utils::Singleton<bumo::WebServer>, public bumo::StatusModule
 	{
 		friend class utils::Singleton<bumo::WebServer>;
@@ -37,12 +40,14 @@ namespace bumo {
 		bool running;
 		size_t thread_count_;
         unsigned short port_;
+		ResponseCache *response_cache_;
 
 		void FileNotFound(const http::server::request &request, std::string &reply);
 		void Hello(const http::server::request &request, std::string &reply);
 		void CreateKeyPair(const http::server::request &request, std::string &reply);
 		void GetAccountBase(const http::server::request &request, std::string &reply);
 		void GetAccount(const http::server::request &request, std::string &reply);
+		void GetAccountProto(const http::server::request &request, std::string &reply);
 		void GetGenesisAccount(const http::server::request &request, std::string &reply);
 		void GetAccountMetaData(const http::server::request &request, std::string &reply);
 		void GetAccountAssets(const http::server::request &request, std::string &reply);
@@ -54,6 +59,7 @@ namespace bumo {
 		void UpdateLogLevel(const http::server::request &request, std::string &reply);
 
 		void GetTransactionHistory(const http::server::request &request, std::string &reply);
+		void GetTransactionHistoryProto(const http::server::request &request, std::string &reply);
 		void GetTransactionCache(const http::server::request &request, std::string &reply);
 		void GetContractTx(const http::server::request &request, std::string &reply);
 
@@ -61,6 +67,7 @@ namespace bumo {
 		void GetStatus(const http::server::request &request, std::string &reply);
 		void GetModulesStatus(const http::server::request &request, std::string &reply);
 		void GetLedger(const http::server::request &request, std::string &reply);
+		void GetLedgerProto(const http::server::request &request, std::string &reply);
 		void GetLedgerValidators(const http::server::request &request, std::string &reply);
 		void GetAddress(const http::server::request &request, std::string &reply);
 		void GetPeerNodeAddress(const http::server::request &request, std::string &reply);
@@ -72,7 +79,24 @@ namespace bumo {
 		std::string GetCertPassword(std::size_t, asio::ssl::context_base::password_purpose purpose);
 
 		void MultiQuery(const http::server::request &request, std::string &reply);
+		static void AppendJsonFragment(const std::string &fragment, std::string &out);
+
+		//Replies that can never change are served from the response cache with an ETag
+		typedef std::function<bool(const http::server::request &request)> ImmutableFunction;
+		void CachedQuery(const http::server::server::routeHandler &handler, const ImmutableFunction &immutable,
+			const http::server::request &request, http::server::reply &reply);
+		bool IsClosedLedgerQuery(const http::server::request &request);
+		bool IsCommittedTransactionQuery(const http::server::request &request);
+		static bool IsSuccessReply(const std::string &reply);
 		void SubmitTransaction(const http::server::request &request, std::string &reply);
+		void SubmitTransactionProto(const http::server::request &request, std::string &reply);
+		//Verifies the signatures in parallel and admits the transactions as one batch
+		std::vector<std::shared_ptr<TransactionFrm>> AdmitTransactions(const std::vector<const protocol::TransactionEnv *> &tran_envs, std::vector<Result> &results);
+
+		//Clients with the bindings of src/proto ask for application/x-protobuf instead of json
+		void NegotiatedQuery(const http::server::server::replyHandler &json_handler, const http::server::server::routeHandler &proto_handler,
+			const http::server::request &request, http::server::reply &reply);
+		static bool IsProtobufRequest(const http::server::request &request);
 
 		void CallContract(const http::server::request &request, std::string &reply);
 		void TestTransaction(const http::server::request &request, std::string &reply);
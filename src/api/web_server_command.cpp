@@ -44,16 +44,17 @@ namespace bumo {
 
 		int64_t begin_time = utils::Timestamp::HighResolution();
 		const Json::Value &json_items = body["items"];
+		//The items are decoded first and the well formed ones are admitted together
+		std::vector<protocol::TransactionEnv> tran_envs(json_items.size());
+		std::vector<Result> item_results(json_items.size());
+		std::vector<const protocol::TransactionEnv *> admit_envs;
+		std::vector<size_t> admit_indexes;
 		for (size_t j = 0; j < json_items.size() && running; j++) {
 			const Json::Value &json_item = json_items[j];
 			Json::Value &result_item = results[results.size()];
 
-			int64_t active_time = utils::Timestamp::HighResolution();
-			Result result;
-			result.set_code(protocol::ERRCODE_SUCCESS);
-			result.set_desc("");
-
-			protocol::TransactionEnv tran_env;
+			Result &result = item_results[j];
+			protocol::TransactionEnv &tran_env = tran_envs[j];
 			do {
 				if (json_item.isMember("transaction_blob")) {
 					if (!json_item.isMember("signatures")) {
@@ -137,24 +138,24 @@ namespace bumo {
 					result_item["hash"] = utils::String::BinToHexString(HashWrapper::Crypto(content));
 				}
 
-				TransactionFrm::pointer ptr = std::make_shared<TransactionFrm>(tran_env);
-				GlueManager::Instance().OnTransaction(ptr, result);
-
-				// do not broadcast if OnTransaction failed
-				if (result.code() == protocol::ERRCODE_SUCCESS) {
-					PeerManager::Instance().Broadcast(protocol::OVERLAY_MSGTYPE_TRANSACTION, ptr->GetFullData());
-				}
-
+				admit_envs.push_back(&tran_env);
+				admit_indexes.push_back(j);
 			} while (false);
+		}
 
-			//Force to exit successfully
-			if (result.code() == protocol::ERRCODE_SUCCESS || result.code() == protocol::ERRCODE_ALREADY_EXIST) {
-				result.set_code(protocol::ERRCODE_SUCCESS);
+		std::vector<Result> admit_results;
+		AdmitTransactions(admit_envs, admit_results);
+		for (size_t i = 0; i < admit_indexes.size(); i++) {
+			item_results[admit_indexes[i]] = admit_results[i];
+		}
+
+		for (Json::UInt j = 0; j < results.size(); j++) {
+			if (item_results[j].code() == protocol::ERRCODE_SUCCESS) {
 				success_count++;
 			}
 
-			result_item["error_code"] = result.code();
-			result_item["error_desc"] = result.desc();
+			results[j]["error_code"] = item_results[j].code();
+			results[j]["error_desc"] = item_results[j].desc();
 		}
 		LOG_TRACE("Created %u transactions use " FMT_I64 "(ms)", json_items.size(),
 			(utils::Timestamp::HighResolution() - begin_time) / utils::MICRO_UNITS_PER_MILLI);
@@ -164,6 +165,81 @@ namespace bumo {
 		reply = reply_json.toStyledString();
 	}
 
+	void WebServer::SubmitTransactionProto(const http::server::request &request, std::string &reply) {
+		protocol::SubmitTransactionResponse response;
+		protocol::TransactionEnvSet set;
+		if (!set.ParseFromString(request.body)) {
+			LOG_ERROR("Failed to parse the protobuf content of the request");
+			protocol::SubmitTransactionResponse::Result *result_item = response.add_results();
+			result_item->set_error_code(protocol::ERRCODE_INVALID_PARAMETER);
+			result_item->set_error_desc("request must be a serialized TransactionEnvSet");
+			response.SerializeToString(&reply);
+			return;
+		}
+
+		int32_t success_count = 0;
+		int64_t begin_time = utils::Timestamp::HighResolution();
+		std::vector<const protocol::TransactionEnv *> envs;
+		for (int32_t i = 0; i < set.txs_size(); i++) {
+			envs.push_back(&set.txs(i));
+		}
+
+		std::vector<Result> results;
+		std::vector<TransactionFrm::pointer> txs = AdmitTransactions(envs, results);
+		for (size_t i = 0; i < txs.size(); i++) {
+			if (results[i].code() == protocol::ERRCODE_SUCCESS) {
+				success_count++;
+			}
+
+			protocol::SubmitTransactionResponse::Result *result_item = response.add_results();
+			result_item->set_hash(txs[i]->GetContentHash());
+			result_item->set_error_code(results[i].code());
+			result_item->set_error_desc(results[i].desc());
+		}
+		LOG_TRACE("Created %d transactions use " FMT_I64 "(ms)", set.txs_size(),
+			(utils::Timestamp::HighResolution() - begin_time) / utils::MICRO_UNITS_PER_MILLI);
+
+		response.set_success_count(success_count);
+		response.SerializeToString(&reply);
+	}
+
+	std::vector<TransactionFrm::pointer> WebServer::AdmitTransactions(const std::vector<const protocol::TransactionEnv *> &tran_envs, std::vector<Result> &results) {
+		//The signatures are verified while the frames are built, on the worker threads
+		std::vector<TransactionFrm::pointer> txs(tran_envs.size());
+		std::function<void(size_t)> build_func = [&tran_envs, &txs](size_t i) {
+			txs[i] = std::make_shared<TransactionFrm>(*tran_envs[i]);
+		};
+
+		ParallelWorker *worker = ParallelWorker::GetInstance();
+		if (worker != NULL) {
+			worker->ParallelFor(txs.size(), build_func);
+		}
+		else {
+			for (size_t i = 0; i < txs.size(); i++) {
+				build_func(i);
+			}
+		}
+
+		GlueManager::Instance().OnTransactions(txs, results);
+
+		// do not broadcast the ones failed, the accepted ones are gossiped as one batch
+		std::vector<std::string> datas;
+		for (size_t i = 0; i < txs.size(); i++) {
+			if (results[i].code() == protocol::ERRCODE_SUCCESS) {
+				datas.push_back(txs[i]->GetFullData());
+			}
+			//Force to exit successfully
+			else if (results[i].code() == protocol::ERRCODE_ALREADY_EXIST) {
+				results[i].set_code(protocol::ERRCODE_SUCCESS);
+			}
+		}
+
+		if (!datas.empty()) {
+			PeerManager::Instance().Broadcast(protocol::OVERLAY_MSGTYPE_TRANSACTION, datas);
+		}
+		return txs;
+	}
+
 	void WebServer::CreateKeyPair(const http::server::request &request, std::string &reply) {
 		std::string error_desc;
 		int32_t error_code = protocol::ERRCODE_SUCCESS;
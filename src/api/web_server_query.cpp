@@ -21,36 +21,94 @@
 #include <contract/contract_manager.h>
 #include <consensus/consensus_manager.h>
 #include <glue/glue_manager.h>
+#include <google/protobuf/wire_format_lite_inl.h>
 #include "web_server.h"
 #include <ledger/kv_trie.h>
 
 namespace bumo {
-	void WebServer::GetAccountBase(const http::server::request &request, std::string &reply) {
-		std::string address = request.GetParamValue("address");
+	template<typename T>
+	static void WriteJsonArray(const std::vector<T> &messages, std::string &out) {
+		//An empty list stays null as it was in the Json::Value replies
+		if (messages.empty()) {
+			out += "null";
+			return;
+		}
 
-		int32_t error_code = protocol::ERRCODE_SUCCESS;
-		AccountFrm::pointer acc = NULL;
-		int64_t balance = 0;
-		Json::Value reply_json = Json::Value(Json::objectValue);
-		Json::Value record = Json::Value(Json::arrayValue);
-		Json::Value &result = reply_json["result"];
+		out += '[';
+		for (size_t i = 0; i < messages.size(); i++) {
+			if (i > 0) out += ',';
+			Proto2JsonWrite(messages[i], out);
+		}
+		out += ']';
+	}
 
-		if (!Environment::AccountFromDB(address, acc)) {
-			error_code = protocol::ERRCODE_NOT_EXIST;
-			LOG_TRACE("Failed to get account, account(%s) not exist", address.c_str());
+	static void ProtoWriteInt64(int field_number, int64_t value, std::string &out) {
+		//Zero is the default and left out, as the generated serializer does
+		if (value == 0) return;
+		google::protobuf::uint8 buffer[16];
+		google::protobuf::uint8 *end = google::protobuf::internal::WireFormatLite::WriteInt64ToArray(field_number, value, buffer);
+		out.append((const char *)buffer, end - buffer);
+	}
+
+	//Starts a length delimited field, a message stored in the db is already in the wire format and follows as it is
+	static void ProtoWriteLength(int field_number, size_t size, std::string &out) {
+		using google::protobuf::internal::WireFormatLite;
+		google::protobuf::uint8 buffer[16];
+		google::protobuf::uint8 *end = WireFormatLite::WriteTagToArray(field_number, WireFormatLite::WIRETYPE_LENGTH_DELIMITED, buffer);
+		end = google::protobuf::io::CodedOutputStream::WriteVarint32ToArray((google::protobuf::uint32)size, end);
+		out.append((const char *)buffer, end - buffer);
+	}
+
+	static void ProtoWriteBytes(int field_number, const std::string &value, std::string &out) {
+		if (value.empty()) return;
+		ProtoWriteLength(field_number, value.size(), out);
+		out += value;
+	}
+
+	//Writes the stored transactions of the hashes, returns false if one is missing
+	static bool ProtoWriteTransactions(int field_number, const protocol::EntryList &list, int32_t start, int32_t limit, std::string &out) {
+		bumo::KeyValueDb *db = bumo::Storage::Instance().ledger_db();
+		for (int32_t i = start; i < list.entry_size() && i - start < limit; i++) {
+			std::string store;
+			if (db->Get(ComposePrefix(General::TRANSACTION_PREFIX, list.entry(i)), store) <= 0) {
+				LOG_TRACE("Transaction(%s) does not exist.", utils::String::BinToHexString(list.entry(i)).c_str());
+				return false;
+			}
+
+			//Only the triggered transactions are stored with their hash, another hash field appended is the same value
+			std::string hash;
+			ProtoWriteBytes(protocol::TransactionEnvStore::kHashFieldNumber, list.entry(i), hash);
+			ProtoWriteLength(field_number, store.size() + hash.size(), out);
+			out += store;
+			out += hash;
 		}
-		else {
-			acc->ToJson(result);
+		return true;
+	}
+
+	//The hashes of the transactions in a ledger, of one transaction or of the latest ones
+	static int32_t LoadTransactionHashes(const std::string &seq, const std::string &hash, protocol::EntryList &list) {
+		bumo::KeyValueDb *db = bumo::Storage::Instance().ledger_db();
+		if (!hash.empty() && seq.empty()) {
+			list.add_entry(utils::String::HexStringToBin(hash));
+			return protocol::ERRCODE_SUCCESS;
 		}
 
-		reply_json["error_code"] = error_code;
-		reply = reply_json.toStyledString();
+		std::string hashlist;
+		if (db->Get(seq.empty() ? General::LAST_TX_HASHS : ComposePrefix(General::LEDGER_TRANSACTION_PREFIX, seq), hashlist) <= 0) {
+			return protocol::ERRCODE_NOT_EXIST;
+		}
+
+		list.ParseFromString(hashlist);
+		if (list.entry_size() == 0) {
+			return protocol::ERRCODE_NOT_EXIST;
+		}
+		return protocol::ERRCODE_SUCCESS;
 	}
 
-	void WebServer::GetAccount(const http::server::request &request, std::string &reply) {
-		std::string address = request.GetParamValue("address");
+	//The assets and metadatas of an account, only the one named if the request has a key
+	static void LoadAccountEntries(const http::server::request &request, AccountFrm::pointer acc,
+		std::vector<protocol::AssetStore> &assets, std::vector<protocol::KeyPair> &metadata) {
 		std::string storagekey = request.GetParamValue("key");
-
 		std::string issuer = request.GetParamValue("issuer");
 		std::string code = request.GetParamValue("code");
 		std::string asset_type_str = request.GetParamValue("type");
@@ -61,6 +119,34 @@ namespace bumo {
 			if (*p) asset_type = 0;
 		}
 
+		if (!issuer.empty() && !code.empty()) {
+			protocol::AssetKey p;
+			p.set_issuer(issuer);
+			p.set_code(code);
+			p.set_type(asset_type);
+			protocol::AssetStore asset;
+			if (acc->GetAsset(p, asset)) {
+				assets.push_back(asset);
+			}
+		}
+		else {
+			acc->GetAllAssets(assets);
+		}
+
+		if (!storagekey.empty()) {
+			protocol::KeyPair value_ptr;
+			if (acc->GetMetaData(storagekey, value_ptr)) {
+				metadata.push_back(value_ptr);
+			}
+		}
+		else {
+			acc->GetAllMetaData(metadata);
+		}
+	}
+
+	void WebServer::GetAccountBase(const http::server::request &request, std::string &reply) {
+		std::string address = request.GetParamValue("address");
+
 		int32_t error_code = protocol::ERRCODE_SUCCESS;
 		AccountFrm::pointer acc = NULL;
 		int64_t balance = 0;
@@ -68,54 +154,73 @@ namespace bumo {
 		Json::Value record = Json::Value(Json::arrayValue);
 		Json::Value &result = reply_json["result"];
 
-		utils::ReadLockGuard guard(Storage::Instance().account_ledger_lock_);
-
 		if (!Environment::AccountFromDB(address, acc)) {
 			error_code = protocol::ERRCODE_NOT_EXIST;
 			LOG_TRACE("Failed to get account, account(%s) not exist", address.c_str());
 		}
 		else {
 			acc->ToJson(result);
-			Json::Value& metadatas = result["metadatas"];
-			if (!storagekey.empty()) {
-				protocol::KeyPair value_ptr;
-				if (acc->GetMetaData(storagekey, value_ptr)) {
-					metadatas[(Json::UInt)0] = bumo::Proto2Json(value_ptr);
-				}
-			}
-			else {
-				std::vector<protocol::KeyPair> metadata;
-				acc->GetAllMetaData(metadata);
-
-				for (size_t i = 0; i < metadata.size(); i++) {
-					metadatas[i] = Proto2Json(metadata[i]);
-				}
-			}
-
-			Json::Value& jsonassets = result["assets"];
-			if (!issuer.empty() && !code.empty()) {
-				protocol::AssetKey p;
-				p.set_issuer(issuer);
-				p.set_code(code);
-				p.set_type(asset_type);
-				protocol::AssetStore asset;
-				if (acc->GetAsset(p, asset)) {
-					jsonassets[(Json::UInt)0] = Proto2Json(asset);
-				}
-			}
-			else {
-				std::vector<protocol::AssetStore> assets;
-				acc->GetAllAssets(assets);
-				for (size_t i = 0; i < assets.size(); i++) {
-					jsonassets[i] = Proto2Json(assets[i]);
-				}
-			}
 		}
 
 		reply_json["error_code"] = error_code;
 		reply = reply_json.toStyledString();
 	}
 
+	void WebServer::GetAccount(const http::server::request &request, std::string &reply) {
+		std::string address = request.GetParamValue("address");
+
+		AccountFrm::pointer acc = NULL;
+		utils::ReadLockGuard guard(Storage::Instance().account_ledger_lock_);
+
+		reply = "{\"error_code\":";
+		if (!Environment::AccountFromDB(address, acc)) {
+			LOG_TRACE("Failed to get account, account(%s) not exist", address.c_str());
+			JsonWriteInt64(protocol::ERRCODE_NOT_EXIST, reply);
+			reply += ",\"result\":null}";
+			return;
+		}
+
+		//Accounts with many assets are written straight into the reply
+		JsonWriteInt64(protocol::ERRCODE_SUCCESS, reply);
+		reply += ",\"result\":{";
+		if (Proto2JsonWriteMembers(acc->ProtocolAccount(), reply) > 0) reply += ',';
+
+		std::vector<protocol::AssetStore> assets;
+		std::vector<protocol::KeyPair> metadata;
+		LoadAccountEntries(request, acc, assets, metadata);
+		reply += "\"assets\":";
+		WriteJsonArray(assets, reply);
+		reply += ",\"metadatas\":";
+		WriteJsonArray(metadata, reply);
+		reply += "}}";
+	}
+
+	void WebServer::GetAccountProto(const http::server::request &request, std::string &reply) {
+		std::string address = request.GetParamValue("address");
+
+		AccountFrm::pointer acc = NULL;
+		utils::ReadLockGuard guard(Storage::Instance().account_ledger_lock_);
+
+		protocol::AccountResponse response;
+		if (!Environment::AccountFromDB(address, acc)) {
+			LOG_TRACE("Failed to get account, account(%s) not exist", address.c_str());
+			response.set_error_code(protocol::ERRCODE_NOT_EXIST);
+			response.SerializeToString(&reply);
+			return;
+		}
+
+		*response.mutable_account() = acc->ProtocolAccount();
+		std::vector<protocol::AssetStore> assets;
+		std::vector<protocol::KeyPair> metadata;
+		LoadAccountEntries(request, acc, assets, metadata);
+		for (size_t i = 0; i < assets.size(); i++) {
+			*response.add_assets() = assets[i];
+		}
+		for (size_t i = 0; i < metadata.size(); i++) {
+			*response.add_metadatas() = metadata[i];
+		}
+		response.SerializeToString(&reply);
+	}
 
 	void WebServer::GetGenesisAccount(const http::server::request &request, std::string &reply) {
 		std::string address;
@@ -165,7 +270,11 @@ namespace bumo {
 		std::string key = request.GetParamValue("key");
 		auto location = utils::String::HexStringToBin(key);
 		std::vector<std::string> values;
-		auto x = LedgerManager::Instance().tree_->GetNode(location);
+		protocol::Node x;
+		{
+			utils::ReadLockGuard guard(LedgerManager::Instance().GetTreeMutex());
+			x = LedgerManager::Instance().tree_->ReadOnlyGetNode(location);
+		}
 		Json::Value ret;
 		ret["ret"] = bumo::Proto2Json(x);
 		ret["NEW"] = NodeFrm::NEWCOUNT;
@@ -309,7 +418,6 @@ namespace bumo {
 
 	void WebServer::GetTransactionHistory(const http::server::request &request, std::string &reply) {
 		WebServerConfigure &web_config = Configure::Instance().webserver_configure_;
-		bumo::KeyValueDb *db = bumo::Storage::Instance().ledger_db();
 
 		std::string seq = request.GetParamValue("ledger_seq");
 		std::string hash = request.GetParamValue("hash");
@@ -323,53 +431,22 @@ namespace bumo {
 		if (limit_int <= 0) limit_int = 1000;
 
 		int32_t error_code = protocol::ERRCODE_SUCCESS;
-		Json::Value reply_json = Json::Value(Json::objectValue);
-
-		Json::Value &result = reply_json["result"];
-		Json::Value &txs = result["transactions"];
-		txs = Json::Value(Json::arrayValue);
-		result["total_count"] = 0;
+		int32_t total_count = 0;
+		//The transactions are written straight into text, the reply is spliced around them
+		std::string txs;
 
+		//The transactions are only served after their ledger is durable, a hash may belong to the last closed ledger
+		LedgerManager::Instance().writer_.WaitWritten(seq.empty() ? LedgerManager::Instance().GetLastClosedLedger().seq() : utils::String::Stoi64(seq));
 		do {
 			utils::ReadLockGuard guard(Storage::Instance().account_ledger_lock_);
 
-			protocol::EntryList list;
 			//Use block height (seq) or transaction hash to search for transaction(s).
-			protocol::LedgerHeader header = LedgerManager::Instance().GetLastClosedLedger();
-			if (!seq.empty()) {
-				std::string hashlist;
-				if (db->Get(ComposePrefix(General::LEDGER_TRANSACTION_PREFIX, seq), hashlist) <= 0) {
-					error_code = protocol::ERRCODE_NOT_EXIST;
-					break;
-				}
-
-				list.ParseFromString(hashlist);
-				if (list.entry_size() == 0) {
-					error_code = protocol::ERRCODE_NOT_EXIST;
-					break;
-				}
-
-				result["total_count"] = list.entry_size();
-			}
-			else if (!hash.empty()) {
-				result["total_count"] = 1;
-				list.add_entry(utils::String::HexStringToBin(hash));
-			}
-			else {
-				std::string hashlist;
-				if (db->Get(General::LAST_TX_HASHS, hashlist) <= 0) {
-					error_code = protocol::ERRCODE_NOT_EXIST;
-					break;
-				}
-
-				list.ParseFromString(hashlist);
-				if (list.entry_size() == 0) {
-					error_code = protocol::ERRCODE_NOT_EXIST;
-					break;
-				}
-
-				result["total_count"] = list.entry_size();
+			protocol::EntryList list;
+			error_code = LoadTransactionHashes(seq, hash, list);
+			if (error_code != protocol::ERRCODE_SUCCESS) {
+				break;
 			}
+			total_count = list.entry_size();
 
 			for (int32_t i = start_int;
 				i < list.entry_size() &&
@@ -378,21 +455,67 @@ namespace bumo {
 			i++) {
 				TransactionFrm txfrm;
 				if (txfrm.LoadFromDb(list.entry(i)) > 0) {
-					result["total_count"] = 0;
+					total_count = 0;
 					error_code = protocol::ERRCODE_NOT_EXIST;
 					break;
 				}
-				Json::Value m;
-				txfrm.ToJson(m);
-				txs[txs.size()] = m;
+				if (!txs.empty()) txs += ',';
+				txfrm.ToJson(txs);
 			}
 		} while (false);
 
-		reply_json["error_code"] = error_code;
+		reply.clear();
+		reply.reserve(txs.size() + 128);
+		reply += "{\"error_code\":";
+		JsonWriteInt64(error_code, reply);
 		if (error_code == protocol::ERRCODE_NOT_EXIST){
-			reply_json["error_desc"] = "query result not exist";
+			reply += ",\"error_desc\":\"query result not exist\"";
 		}
-		reply = reply_json.toFastString();
+		reply += ",\"result\":{\"total_count\":";
+		JsonWriteInt64(total_count, reply);
+		reply += ",\"transactions\":[";
+		reply += txs;
+		reply += "]}}";
+	}
+
+	void WebServer::GetTransactionHistoryProto(const http::server::request &request, std::string &reply) {
+		std::string seq = request.GetParamValue("ledger_seq");
+		std::string hash = request.GetParamValue("hash");
+		int32_t start_int = utils::String::Stoi(request.GetParamValue("start"));
+		int32_t limit_int = utils::String::Stoi(request.GetParamValue("limit"));
+
+		if (start_int < 0) start_int = 0;
+		if (limit_int <= 0) limit_int = 1000;
+
+		int32_t error_code = protocol::ERRCODE_SUCCESS;
+		protocol::EntryList list;
+		//The stored transactions are copied into the reply without being parsed
+		std::string txs;
+		LedgerManager::Instance().writer_.WaitWritten(seq.empty() ? LedgerManager::Instance().GetLastClosedLedger().seq() : utils::String::Stoi64(seq));
+		do {
+			utils::ReadLockGuard guard(Storage::Instance().account_ledger_lock_);
+			error_code = LoadTransactionHashes(seq, hash, list);
+			if (error_code != protocol::ERRCODE_SUCCESS) {
+				break;
+			}
+
+			if (!ProtoWriteTransactions(protocol::TransactionResponse::kTransactionsFieldNumber, list, start_int, limit_int, txs)) {
+				error_code = protocol::ERRCODE_NOT_EXIST;
+			}
+		} while (false);
+
+		reply.clear();
+		if (error_code != protocol::ERRCODE_SUCCESS) {
+			protocol::TransactionResponse response;
+			response.set_error_code(error_code);
+			response.set_error_desc("query result not exist");
+			response.SerializeToString(&reply);
+			return;
+		}
+
+		reply.reserve(txs.size() + 16);
+		ProtoWriteInt64(protocol::TransactionResponse::kTotalCountFieldNumber, list.entry_size(), reply);
+		reply += txs;
 	}
 
 	void WebServer::GetTransactionCache(const http::server::request &request, std::string &reply) {
@@ -594,9 +717,16 @@ namespace bumo {
 		Json::Value &result = reply_json["result"];
 
 		LedgerFrm frm;
+		//The consensus value holds the whole txset, so it is written straight into the reply
+		protocol::ConsensusValue cons;
+		protocol::PbftProof pbft_evidence;
+		bool with_cons = false;
+		bool with_proof = false;
+		int64_t seq = utils::String::Stoi64(ledger_seq);
+		//The ledger and its proof are only served after they are durable
+		LedgerManager::Instance().writer_.WaitWritten(seq);
 		do {
 			utils::ReadLockGuard guard(Storage::Instance().account_ledger_lock_);
-			int64_t seq = utils::String::Stoi64(ledger_seq);
 			if (!frm.LoadFromDb(seq)) {
 				error_code = protocol::ERRCODE_NOT_EXIST;
 				break;
@@ -628,23 +758,19 @@ namespace bumo {
 			}
 
 			if (with_consvalue == "true") {
-				protocol::ConsensusValue cons;
 				if (LedgerManager::Instance().ConsensusValueFromDB(seq, cons)) {
-					result["consensus_value"] = Proto2Json(cons);
+					with_cons = result.isObject() && result.size() > 0;
 				}
 				else {
 					error_code = protocol::ERRCODE_NOT_EXIST;
 					break;
 				}
 
-				Json::Value &json_cons = result["consensus_value"];
-				protocol::PbftProof pbft_evidence;
 				if (!pbft_evidence.ParseFromString(cons.previous_proof())) {
 					error_code = protocol::ERRCODE_INTERNAL_ERROR;
 					break;
 				}
-
-				json_cons["previous_proof_plain"] = Proto2Json(pbft_evidence);
+				with_proof = true;
 			}
 
 			if (with_block_reward == "true"){
@@ -686,7 +812,62 @@ namespace bumo {
 
 
 		reply_json["error_code"] = error_code;
-		reply = reply_json.toStyledString();
+		reply = reply_json.toFastString();
+		if (!with_cons) {
+			return;
+		}
+
+		//Reopen the result object, which is the last member of the reply
+		reply.resize(reply.size() - 2);
+		reply += ",\"consensus_value\":{";
+		size_t members = Proto2JsonWriteMembers(cons, reply);
+		if (with_proof) {
+			if (members > 0) reply += ',';
+			reply += "\"previous_proof_plain\":";
+			Proto2JsonWrite(pbft_evidence, reply);
+		}
+		reply += "}}}";
+	}
+
+	void WebServer::GetLedgerProto(const http::server::request &request, std::string &reply) {
+		std::string ledger_seq = request.GetParamValue("seq");
+		int64_t seq = ledger_seq.empty() ? LedgerManager::Instance().GetLastClosedLedger().seq() : utils::String::Stoi64(ledger_seq);
+		bumo::KeyValueDb *db = bumo::Storage::Instance().ledger_db();
+
+		int32_t error_code = protocol::ERRCODE_SUCCESS;
+		//The header and the transactions are copied into the reply as they are stored
+		std::string header;
+		std::string txs;
+		LedgerManager::Instance().writer_.WaitWritten(seq);
+		do {
+			utils::ReadLockGuard guard(Storage::Instance().account_ledger_lock_);
+			if (db->Get(ComposePrefix(General::LEDGER_PREFIX, seq), header) <= 0) {
+				error_code = protocol::ERRCODE_NOT_EXIST;
+				break;
+			}
+
+			std::string hashlist;
+			protocol::EntryList list;
+			if (db->Get(ComposePrefix(General::LEDGER_TRANSACTION_PREFIX, seq), hashlist) > 0) {
+				list.ParseFromString(hashlist);
+			}
+
+			if (!ProtoWriteTransactions(protocol::LedgerResponse::kTransactionsFieldNumber, list, 0, list.entry_size(), txs)) {
+				error_code = protocol::ERRCODE_NOT_EXIST;
+			}
+		} while (false);
+
+		reply.clear();
+		if (error_code != protocol::ERRCODE_SUCCESS) {
+			protocol::LedgerResponse response;
+			response.set_error_code(error_code);
+			response.SerializeToString(&reply);
+			return;
+		}
+
+		reply.reserve(header.size() + txs.size() + 16);
+		ProtoWriteBytes(protocol::LedgerResponse::kHeaderFieldNumber, header, reply);
+		reply += txs;
 	}
 
 	void WebServer::GetConsensusInfo(const http::server::request &request, std::string &reply) {
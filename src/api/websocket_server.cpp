@@ -25,72 +25,58 @@
 #include "websocket_server.h"
 
 namespace bumo {
-	WsPeer::WsPeer(server *server_h, client *client_h, tls_server *tls_server_h, tls_client *tls_client_h, connection_hdl con, const std::string &uri, int64_t id) :
-		Connection(server_h, client_h, tls_server_h, tls_client_h, con, uri, id) {
+	WsPeer::WsPeer(server *server_h, client *client_h, tls_server *tls_server_h, tls_client *tls_client_h, connection_hdl con, const std::string &uri, int64_t id,
+		size_t send_queue_limit, size_t send_buffer_limit) :
+		Connection(server_h, client_h, tls_server_h, tls_client_h, con, uri, id),
+		send_queue_limit_(send_queue_limit),
+		send_buffer_limit_(send_buffer_limit),
+		dropped_count_(0) {
 	}
 
 	WsPeer::~WsPeer() {}
 
-	bool WsPeer::Set(const protocol::ChainSubscribeTx &sub) {
-		if (sub.address_size() > 100) {
-			LOG_ERROR("Failed to subscribe address, size large than 100");
-			return false;
-		}
-
-		tx_filter_address_.clear();
-		for (int32_t i = 0; i < sub.address_size(); i++) {
-			if (!PublicKey::IsAddressValid(sub.address(i))) {
-				LOG_ERROR("Failed to subscribe address, address(%s) not valid", sub.address(i).c_str());
-				return false;
-			} 
-			tx_filter_address_.insert(sub.address(i));
+	int64_t WsPeer::Push(int64_t type, const std::string &data) {
+		//Sent at once while the socket keeps up, otherwise behind the waiting ones to keep the order
+		if (send_queue_.empty() && GetBufferedAmount() < send_buffer_limit_) {
+			std::error_code ec;
+			SendRequest(type, data, ec);
+			return 0;
 		}
 
-		return true;
-	}
-
-	bool WsPeer::Filter(const protocol::TransactionEnvStore &tx_msg) {
-		if (tx_filter_address_.empty()) {
-			return true;
+		send_queue_.push_back(std::make_pair(type, data));
+		int64_t dropped = 0;
+		while (send_queue_.size() > send_queue_limit_) {
+			send_queue_.pop_front();
+			dropped++;
 		}
 
-		const protocol::Transaction &trans = tx_msg.transaction_env().transaction();
-		if (tx_filter_address_.find(trans.source_address()) != tx_filter_address_.end()) {
-			return true;
+		if (dropped > 0) {
+			dropped_count_ += dropped;
+			LOG_TRACE("Dropped " FMT_I64 " events of the slow websocket client(%s), " FMT_I64 " dropped in total",
+				dropped, GetPeerAddress().ToIpPort().c_str(), dropped_count_);
 		}
 
-		for (int32_t i = 0; i < trans.operations_size(); i++) {
-			const protocol::Operation &ope = trans.operations(i);
-			if (!ope.source_address().empty() && tx_filter_address_.find(ope.source_address()) != tx_filter_address_.end()) {
-				return true;
-			}
+		Flush();
+		return dropped;
+	}
 
-			switch (ope.type()) {
-			case protocol::Operation_Type_CREATE_ACCOUNT:{
-				if (tx_filter_address_.find(ope.create_account().dest_address()) != tx_filter_address_.end()) {
-					return true;
-				}
-				break;
-			}
-			case protocol::Operation_Type_PAY_COIN:{
-				if (tx_filter_address_.find(ope.pay_coin().dest_address()) != tx_filter_address_.end()) {
-					return true;
-				}
-				break;
-			}
-			case protocol::Operation_Type_PAY_ASSET:{
-				if (tx_filter_address_.find(ope.pay_asset().dest_address()) != tx_filter_address_.end()) {
-					return true;
-				}
-				break;
-			}
-	
-			default:
-				break;
-			}
+	bool WsPeer::Flush() {
+		while (!send_queue_.empty() && GetBufferedAmount() < send_buffer_limit_) {
+			std::error_code ec;
+			SendRequest(send_queue_.front().first, send_queue_.front().second, ec);
+			send_queue_.pop_front();
 		}
+		return !send_queue_.empty();
+	}
 
-		return false;
+	bool WsPeer::HasBacklog() const {
+		return !send_queue_.empty();
+	}
+
+	void WsPeer::ToJson(Json::Value &status) const {
+		Connection::ToJson(status);
+		status["send_queue_size"] = (Json::UInt64)send_queue_.size();
+		status["dropped_count"] = dropped_count_;
 	}
 
 	WebSocketServer::WebSocketServer() : Network(SslParameter()) {
@@ -101,7 +87,10 @@ namespace bumo {
 		request_methods_[protocol::CHAIN_PEER_MESSAGE] = std::bind(&WebSocketServer::OnChainPeerMessage, this, std::placeholders::_1, std::placeholders::_2);
 		request_methods_[protocol::CHAIN_SUBMITTRANSACTION] = std::bind(&WebSocketServer::OnSubmitTransaction, this, std::placeholders::_1, std::placeholders::_2);
 		request_methods_[protocol::CHAIN_SUBSCRIBE_TX] = std::bind(&WebSocketServer::OnSubscribeTx, this, std::placeholders::_1, std::placeholders::_2);
+		request_methods_[protocol::CHAIN_SUBSCRIBE_EVENT] = std::bind(&WebSocketServer::OnSubscribeEvent, this, std::placeholders::_1, std::placeholders::_2);
 		thread_ptr_ = NULL;
+		event_dropped_count_ = 0;
+		has_backlog_ = false;
 	}
 
 	WebSocketServer::~WebSocketServer() {
@@ -175,24 +164,55 @@ namespace bumo {
 		for (ConnectionMap::iterator iter = connections_.begin();
 			iter != connections_.end();
 			iter++) {
-			std::error_code ec;
-			iter->second->SendRequest(type, data, ec);
+			PushEvent((WsPeer *)iter->second, type, data);
 		}
 	}
 
 	void WebSocketServer::BroadcastChainTxMsg(const protocol::TransactionEnvStore& tx_msg) {
 		utils::MutexGuard guard(conns_list_lock_);
 
-		for (auto iter = connections_.begin(); iter != connections_.end(); iter++) {
-			WsPeer *peer = (WsPeer *)iter->second;
-			if (peer->Filter(tx_msg)) {
-				std::error_code ec;
-				std::string str = tx_msg.SerializeAsString();
-				peer->SendRequest(protocol::CHAIN_TX_ENV_STORE, str, ec);
+		std::set<int64_t> conn_ids;
+		event_index_.MatchTransaction(tx_msg, conn_ids);
+		if (!conn_ids.empty()) {
+			PushEvent(conn_ids, protocol::CHAIN_TX_ENV_STORE, tx_msg.SerializeAsString());
+		}
+	}
+
+	void WebSocketServer::BroadcastLedgerClose(const protocol::ChainLedgerClose &ledger_close) {
+		utils::MutexGuard guard(conns_list_lock_);
+
+		//Each message is serialized once, and only when someone subscribes to it
+		for (int32_t i = 0; i < ledger_close.transactions_size(); i++) {
+			std::set<int64_t> conn_ids;
+			event_index_.MatchTransaction(ledger_close.transactions(i), conn_ids);
+			if (!conn_ids.empty()) {
+				PushEvent(conn_ids, protocol::CHAIN_TX_ENV_STORE, ledger_close.transactions(i).SerializeAsString());
+			}
+		}
+
+		const std::set<int64_t> &conn_ids = event_index_.GetLedgerCloseSubscribers();
+		if (!conn_ids.empty()) {
+			PushEvent(conn_ids, protocol::CHAIN_LEDGER_CLOSE, ledger_close.SerializeAsString());
+		}
+	}
+
+	void WebSocketServer::PushEvent(const std::set<int64_t> &conn_ids, int64_t type, const std::string &data) {
+		for (const auto conn_id : conn_ids) {
+			WsPeer *peer = (WsPeer *)GetConnection(conn_id);
+			if (peer) {
+				PushEvent(peer, type, data);
 			}
 		}
 	}
 
+	void WebSocketServer::PushEvent(WsPeer *peer, int64_t type, const std::string &data) {
+		event_dropped_count_ += peer->Push(type, data);
+		if (peer->HasBacklog()) {
+			backlog_conns_.insert(peer->GetId());
+			has_backlog_ = true;
+		}
+	}
+
 	bool WebSocketServer::OnSubmitTransaction(protocol::WsMessage &message, int64_t conn_id) {
 		utils::MutexGuard guard_(conns_list_lock_);
 		Connection *conn = GetConnection(conn_id);
@@ -231,9 +251,12 @@ namespace bumo {
 		cts.set_status(result.code() == protocol::ERRCODE_SUCCESS ? protocol::ChainTxStatus_TxStatus_CONFIRMED : protocol::ChainTxStatus_TxStatus_FAILURE);
 		cts.set_error_desc(result.desc());
 		cts.set_timestamp(utils::Timestamp::Now().timestamp());
-		std::string str = cts.SerializeAsString();
-			
-		BroadcastMsg(protocol::CHAIN_TX_STATUS, str);
+
+		//The submitter and the subscribers of the source account are told
+		std::set<int64_t> conn_ids;
+		conn_ids.insert(conn_id);
+		event_index_.MatchAccount(tran_env.transaction().source_address(), conn_ids);
+		PushEvent(conn_ids, protocol::CHAIN_TX_STATUS, cts.SerializeAsString());
 		
 		return true;
 	}
@@ -256,13 +279,17 @@ namespace bumo {
 				break;
 			}
 
-			bool ret = conn->Set(subs);
-			if (!ret) {
+			//No address means all the transactions, as before
+			EventIndex::Filter filter;
+			std::string error_desc;
+			if (!LoadKeys(subs.address(), true, filter.accounts_, error_desc)) {
 				default_response.set_error_code(protocol::ERRCODE_INVALID_PARAMETER);
 				default_response.set_error_desc("Incorrect peer setting");
-				LOG_ERROR("Failed to set the subscription message.%s", default_response.error_desc().c_str());
+				LOG_ERROR("Failed to set the subscription message.%s", error_desc.c_str());
 				break;
-			} 
+			}
+			filter.all_txs_ = filter.accounts_.empty();
+			event_index_.Set(conn_id, filter);
 		} while (false);
 
 		std::error_code ec;
@@ -270,6 +297,89 @@ namespace bumo {
 		return default_response.error_code() == protocol::ERRCODE_SUCCESS;
 	}
 
+	bool WebSocketServer::OnSubscribeEvent(protocol::WsMessage &message, int64_t conn_id) {
+		utils::MutexGuard guard_(conns_list_lock_);
+		WsPeer *conn = (WsPeer *)GetConnection(conn_id);
+		if (!conn) {
+			return false;
+		}
+
+		protocol::ChainResponse default_response;
+		do {
+			LOG_INFO("Received an event subscription message from ip(%s)", conn->GetPeerAddress().ToIpPort().c_str());
+			protocol::ChainSubscribeEvent subs;
+			if (!subs.ParseFromString(message.data())) {
+				default_response.set_error_code(protocol::ERRCODE_INVALID_PARAMETER);
+				default_response.set_error_desc("Invalid chain subscribe event message");
+				LOG_ERROR("Failed to parse the websocket message.%s", default_response.error_desc().c_str());
+				break;
+			}
+
+			EventIndex::Filter filter;
+			std::string error_desc;
+			if (!LoadKeys(subs.accounts(), true, filter.accounts_, error_desc) ||
+				!LoadKeys(subs.contracts(), true, filter.contracts_, error_desc) ||
+				!LoadKeys(subs.topics(), false, filter.topics_, error_desc)) {
+				default_response.set_error_code(protocol::ERRCODE_INVALID_PARAMETER);
+				default_response.set_error_desc(error_desc);
+				LOG_ERROR("Failed to set the event subscription.%s", error_desc.c_str());
+				break;
+			}
+			filter.ledger_close_ = subs.ledger_close();
+			event_index_.Set(conn_id, filter);
+		} while (false);
+
+		std::error_code ec;
+		conn->SendResponse(message, default_response.SerializeAsString(), ec);
+		return default_response.error_code() == protocol::ERRCODE_SUCCESS;
+	}
+
+	bool WebSocketServer::LoadKeys(const google::protobuf::RepeatedPtrField<std::string> &keys, bool is_address, std::set<std::string> &key_set, std::string &error_desc) {
+		if (keys.size() > 100) {
+			error_desc = utils::String::Format("Subscribed to %d keys, more than 100", keys.size());
+			return false;
+		}
+
+		for (int32_t i = 0; i < keys.size(); i++) {
+			if (is_address ? !PublicKey::IsAddressValid(keys.Get(i)) : keys.Get(i).empty()) {
+				error_desc = utils::String::Format("Subscribed key(%s) is not valid", keys.Get(i).c_str());
+				return false;
+			}
+			key_set.insert(keys.Get(i));
+		}
+		return true;
+	}
+
+	bool WebSocketServer::OnConnectOpen(Connection *conn) {
+		//The clients which have never subscribed receive all the transactions
+		EventIndex::Filter filter;
+		filter.all_txs_ = true;
+		event_index_.Set(conn->GetId(), filter);
+		return true;
+	}
+
+	void WebSocketServer::OnDisconnect(Connection *conn) {
+		event_index_.Remove(conn->GetId());
+	}
+
+	void WebSocketServer::OnPoll() {
+		if (!has_backlog_) {
+			return;
+		}
+
+		utils::MutexGuard guard(conns_list_lock_);
+		for (auto iter = backlog_conns_.begin(); iter != backlog_conns_.end();) {
+			WsPeer *peer = (WsPeer *)GetConnection(*iter);
+			if (peer && peer->Flush()) {
+				iter++;
+			}
+			else {
+				iter = backlog_conns_.erase(iter);
+			}
+		}
+		has_backlog_ = !backlog_conns_.empty();
+	}
+
 	void WebSocketServer::GetModuleStatus(Json::Value &data) {
 		data["name"] = "websocket_server";
 		data["listen_port"] = GetListenPort();
@@ -279,11 +389,15 @@ namespace bumo {
 		for (auto &item : connections_) {
 			item.second->ToJson(peers[peers.size()]);
 		}
+		event_index_.GetModuleStatus(data["subscription"]);
+		data["event_dropped_count"] = event_dropped_count_;
 	}
 
 	Connection *WebSocketServer::CreateConnectObject(server *server_h, client *client_,
 		tls_server *tls_server_h, tls_client *tls_client_h,
 		connection_hdl con, const std::string &uri, int64_t id) {
-		return new WsPeer(server_h, client_, tls_server_h, tls_client_h, con, uri, id);
+		const WsServerConfigure &configure = Configure::Instance().wsserver_configure_;
+		return new WsPeer(server_h, client_, tls_server_h, tls_client_h, con, uri, id,
+			configure.send_queue_limit_, configure.send_buffer_limit_);
 	}
 }
@@ -16,23 +16,35 @@
 #ifndef WEBSOCKET_SERVER_H_
 #define WEBSOCKET_SERVER_H_
 
+#include <deque>
+#include <atomic>
 #include <proto/cpp/chain.pb.h>
 #include <common/network.h>
 #include <monitor/system_manager.h>
+#include "event_index.h"
 
 namespace bumo {
 
 	class WsPeer : public Connection {
 	private:
 
-		//Peer infomation
-		std::set<std::string> tx_filter_address_;
+		//Events waiting for the socket to drain, the oldest is dropped once the queue is full
+		std::deque<std::pair<int64_t, std::string>> send_queue_;
+		size_t send_queue_limit_;
+		size_t send_buffer_limit_;
+		int64_t dropped_count_;
 	public:
-		WsPeer(server *server_h, client *client_h, tls_server *tls_server_h, tls_client *tls_client_h, connection_hdl con, const std::string &uri, int64_t id);
+		WsPeer(server *server_h, client *client_h, tls_server *tls_server_h, tls_client *tls_client_h, connection_hdl con, const std::string &uri, int64_t id,
+			size_t send_queue_limit, size_t send_buffer_limit);
 		virtual ~WsPeer();
 
-		bool Set(const protocol::ChainSubscribeTx &sub);
-		bool Filter(const protocol::TransactionEnvStore &tx_msg);
+		//Returns the number of events dropped
+		int64_t Push(int64_t type, const std::string &data);
+		//Returns true if events are still waiting
+		bool Flush();
+		bool HasBacklog() const;
+
+		virtual void ToJson(Json::Value &status) const;
 	};
 
 	class WebSocketServer :public utils::Singleton<WebSocketServer>,
@@ -55,9 +67,12 @@ namespace bumo {
 		bool OnChainPeerMessage(protocol::WsMessage &message, int64_t conn_id);
 		bool OnSubmitTransaction(protocol::WsMessage &message, int64_t conn_id);
 		bool OnSubscribeTx(protocol::WsMessage &message, int64_t conn_id);
+		bool OnSubscribeEvent(protocol::WsMessage &message, int64_t conn_id);
 
 		void BroadcastMsg(int64_t type, const std::string &data);
 		void BroadcastChainTxMsg(const protocol::TransactionEnvStore& txMsg);
+		//Pushes the transactions to their subscribers and the whole ledger to the ledger close subscribers
+		void BroadcastLedgerClose(const protocol::ChainLedgerClose &ledger_close);
 
 		virtual Connection *CreateConnectObject(server *server_h, client *client_,
 			tls_server *tls_server_h, tls_client *tls_client_h,
@@ -66,10 +81,24 @@ namespace bumo {
 		virtual void GetModuleStatus(Json::Value &data);
 	protected:
 		virtual void Run(utils::Thread *thread) override;
+		virtual bool OnConnectOpen(Connection *conn);
+		virtual void OnDisconnect(Connection *conn);
+		virtual void OnPoll();
 
 	private:
+		void PushEvent(const std::set<int64_t> &conn_ids, int64_t type, const std::string &data);
+		void PushEvent(WsPeer *peer, int64_t type, const std::string &data);
+		static bool LoadKeys(const google::protobuf::RepeatedPtrField<std::string> &keys, bool is_address, std::set<std::string> &key_set, std::string &error_desc);
+
 		utils::Thread *thread_ptr_;
 
+		//Guarded by the connection list lock
+		EventIndex event_index_;
+		int64_t event_dropped_count_;
+		//The connections with queued events, flushed after each poll as their sockets drain
+		std::set<int64_t> backlog_conns_;
+		std::atomic<bool> has_backlog_;
+
 		uint64_t last_connect_time_;
 		uint64_t connect_interval_;
 	};
@@ -13,15 +13,18 @@
 	along with bumo.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <atomic>
 #include <utils/logger.h>
 #include <utils/sm3.h>
+#include <utils/hash_batch.h>
 #include "general.h"
 #include "utils/strings.h"
 #include "proto/cpp/common.pb.h"
 
 namespace bumo {
-	const uint32_t General::OVERLAY_VERSION = 1000;
+	const uint32_t General::OVERLAY_VERSION = 1001;
 	const uint32_t General::OVERLAY_MIN_VERSION = 1000;
+	const uint32_t General::OVERLAY_VERSION_TX_INVENTORY = 1001;
 	/*
 		Based on ledger 1000, the following changes have been modified.
 		1.Create a common or contract account without signers.
@@ -82,6 +85,10 @@ namespace bumo {
 	const char *General::ACCOUNT_PREFIX = "acc";
 	const char *General::ASSET_PREFIX = "ast";
 	const char *General::METADATA_PREFIX = "meta";
+	const char *General::FLAT_ACCOUNT_PREFIX = "flat_acc";
+	const char *General::FLAT_ASSET_PREFIX = "flat_ast";
+	const char *General::FLAT_METADATA_PREFIX = "flat_meta";
+	const char *General::KEY_FLAT_INDEX = "flat_index";
 
 	const char *General::CHECK_TIME_FUNCTION = "internal_check_time";
 
@@ -212,6 +219,106 @@ namespace bumo {
 		}
 	}
 
+	ParallelWorker::ParallelWorker(){
+	}
+
+	ParallelWorker::~ParallelWorker(){}
+
+	bool ParallelWorker::Initialize(size_t thread_count){
+		for (size_t i = 0; i < thread_count; i++){
+			utils::Thread *thread_p = new utils::Thread(this);
+			if (!thread_p->Start(utils::String::Format("parallel-%d", i))){
+				delete thread_p;
+				return false;
+			}
+
+			thread_ptrs_.push_back(thread_p);
+		}
+
+		return true;
+	}
+
+	bool ParallelWorker::Exit(){
+		LOG_INFO("ParallelWorker stoping...");
+		io_service_.stop();
+		for (size_t i = 0; i < thread_ptrs_.size(); i++){
+			utils::Thread *thread_p = thread_ptrs_[i];
+			if (thread_p){
+				thread_p->JoinWithStop();
+				delete thread_p;
+			}
+		}
+		thread_ptrs_.clear();
+		LOG_INFO("ParallelWorker stop [OK]");
+		return true;
+	}
+
+	void ParallelWorker::Run(utils::Thread *thread){
+		asio::io_service::work work(io_service_);
+		asio::error_code err;
+		io_service_.run(err);
+	}
+
+	size_t ParallelWorker::GetThreadCount() const{
+		return thread_ptrs_.size();
+	}
+
+	void ParallelWorker::ParallelFor(size_t count, const std::function<void(size_t)> &func){
+		bumo::ParallelFor(count, thread_ptrs_.size(), [this](const std::function<void()> &drain){
+			io_service_.post(drain);
+		}, func);
+	}
+
+	void ParallelFor(size_t count, size_t helper_count, const std::function<void(const std::function<void()> &)> &post, const std::function<void(size_t)> &func){
+		helper_count = count > 1 ? std::min(helper_count, count - 1) : 0;
+		if (helper_count == 0){
+			for (size_t i = 0; i < count; i++){
+				func(i);
+			}
+			return;
+		}
+
+		//Items are claimed one by one, the helpers posted after all items are claimed return at once
+		struct Job {
+			std::atomic<size_t> next_;
+			std::atomic<size_t> done_;
+			size_t count_;
+			std::function<void(size_t)> func_;
+			utils::Semaphore finished_;
+		};
+		std::shared_ptr<Job> job = std::make_shared<Job>();
+		job->next_ = 0;
+		job->done_ = 0;
+		job->count_ = count;
+		job->func_ = func;
+
+		std::function<void()> drain = [job](){
+			size_t finished = 0;
+			for (size_t i = job->next_++; i < job->count_; i = job->next_++){
+				job->func_(i);
+				finished++;
+			}
+
+			if (finished > 0 && job->done_.fetch_add(finished) + finished == job->count_){
+				job->finished_.Signal();
+			}
+		};
+
+		for (size_t i = 0; i < helper_count; i++){
+			post(drain);
+		}
+		drain();
+		job->finished_.Wait();
+	}
+
+	bool ParallelWorker::Post(const std::function<void()> &func){
+		if (thread_ptrs_.empty()){
+			return false;
+		}
+		io_service_.post(func);
+		return true;
+	}
+
 	Global::Global() : work_(io_service_), main_thread_id_(0){
 	}
 
@@ -320,6 +427,10 @@ namespace bumo {
 		}
 	}
 
+	void HashWrapper::Crypto(const std::vector<const std::string *> &inputs, std::vector<std::string> &outputs){
+		utils::HashBatch::Crypto(ledger_type_ == HASH_TYPE_SM3 ? utils::HashBatch::ALGORITHM_SM3 : utils::HashBatch::ALGORITHM_SHA256, inputs, outputs);
+	}
+
 	std::string ComposePrefix(const std::string &prefix, const std::string &value) {
 		std::string result = prefix;
 		result += "_";
@@ -27,6 +27,7 @@ namespace bumo {
 	public:
 		const static uint32_t OVERLAY_VERSION;
 		const static uint32_t OVERLAY_MIN_VERSION;
+		const static uint32_t OVERLAY_VERSION_TX_INVENTORY;
 		const static uint32_t LEDGER_VERSION_HISTORY_1000;
 		const static uint32_t LEDGER_VERSION_HISTORY_1001;
 		const static uint32_t LEDGER_VERSION;
@@ -93,6 +94,12 @@ namespace bumo {
 		const static char *ASSET_PREFIX;
 		const static char *METADATA_PREFIX;
 
+		//Flat index of the leaves of the account, asset and metadata tries, read without walking the tries
+		const static char *FLAT_ACCOUNT_PREFIX;
+		const static char *FLAT_ASSET_PREFIX;
+		const static char *FLAT_METADATA_PREFIX;
+		const static char *KEY_FLAT_INDEX;
+
 		const static char *CHECK_TIME_FUNCTION;
 
 		const static char *CONTRACT_VALIDATOR_ADDRESS;
@@ -105,6 +112,10 @@ namespace bumo {
 		const static int TRANSACTION_LOG_DATA_MAXSIZE = 1024;
 
 		const static int PEER_DB_COUNT = 5000;
+		const static int TX_INVENTORY_LIMIT = 1024;
+		const static int PBFT_VERIFIED_SIGN_CACHE_SIZE = 10000;
+		const static int ACCOUNT_STATE_CACHE_SIZE = 10000;
+		const static int VERIFY_KEY_CACHE_SIZE = 10000;
 
 		const static int64_t REWARD_PERIOD = (5 * 365 * 24 * 60 * 60) / 10;
 		const static int64_t REWARD_INIT_VALUE = 8 * 100000000;
@@ -248,6 +259,31 @@ namespace bumo {
 		void Stop();
 	};
 
+	//Call func(0) ... func(count - 1) on up to helper_count threads reached through post, and on the calling thread,
+	//and return after all calls finish. The calling thread claims items as well, so the call cannot wait on helpers
+	//that never get scheduled because their threads are blocked.
+	void ParallelFor(size_t count, size_t helper_count, const std::function<void(const std::function<void()> &)> &post, const std::function<void(size_t)> &func);
+
+	//Fixed thread pool for cpu bound work, such as verifying a quorum of signatures
+	class ParallelWorker : public utils::Singleton<bumo::ParallelWorker>, public utils::Runnable {
+		asio::io_service io_service_;
+		std::vector<utils::Thread *> thread_ptrs_;
+	public:
+		ParallelWorker();
+		~ParallelWorker();
+
+		bool Initialize(size_t thread_count);
+		bool Exit();
+		virtual void Run(utils::Thread *thread) override;
+
+		//Call func(0) ... func(count - 1) on the worker threads and the calling thread, and return after all calls finish.
+		//It falls back to a serial loop if no worker is running, so it is safe to use before initialization.
+		void ParallelFor(size_t count, const std::function<void(size_t)> &func);
+		//Run func on a worker thread without waiting, return false if no worker is running.
+		bool Post(const std::function<void()> &func);
+		size_t GetThreadCount() const;
+	};
+
 	class Global : public utils::Singleton<bumo::Global>, public TimerNotify {
 		asio::io_service io_service_;
 		asio::io_service::work work_;
@@ -289,6 +325,8 @@ namespace bumo {
 		static std::string Crypto(const std::string &input);
 		static void Crypto(unsigned char* str, int len, unsigned char *buf);
 		static void Crypto(const std::string &input, std::string &str);
+		//outputs[i] is the hash of *inputs[i]; independent messages are hashed several at a time where the CPU allows
+		static void Crypto(const std::vector<const std::string *> &inputs, std::vector<std::string> &outputs);
 	};
 
 	std::string GetDataSecuretKey();
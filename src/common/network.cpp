@@ -15,6 +15,7 @@
 
 #include <utils/timestamp.h>
 #include <utils/logger.h>
+#include <utils/compress.h>
 #include "general.h"
 #include "network.h"
 
@@ -31,6 +32,7 @@ namespace bumo {
 		handle_(con),
 		uri_(uri), 
 		id_(id), 
+		compress_threshold_(0),
 		sequence_(0){
 		connect_start_time_ = 0;
 		connect_end_time_ = 0;
@@ -130,6 +132,10 @@ namespace bumo {
 		return in_bound_;
 	}
 
+	void Connection::SetCompressThreshold(size_t compress_threshold) {
+		compress_threshold_ = compress_threshold;
+	}
+
 	bool Connection::SendByteMessage(const std::string &message, std::error_code &ec) {
 		std::error_code ec1;
 		if (in_bound_){
@@ -156,6 +162,30 @@ namespace bumo {
 		}
 	}
 
+	size_t Connection::GetBufferedAmount() const {
+		std::error_code ec;
+		if (in_bound_) {
+			if (server_) {
+				server::connection_ptr con = server_->get_con_from_hdl(handle_, ec);
+				return ec ? 0 : con->get_buffered_amount();
+			}
+			else {
+				tls_server::connection_ptr con = tls_server_->get_con_from_hdl(handle_, ec);
+				return ec ? 0 : con->get_buffered_amount();
+			}
+		}
+		else {
+			if (client_) {
+				client::connection_ptr con = client_->get_con_from_hdl(handle_, ec);
+				return ec ? 0 : con->get_buffered_amount();
+			}
+			else {
+				tls_client::connection_ptr con = tls_client_->get_con_from_hdl(handle_, ec);
+				return ec ? 0 : con->get_buffered_amount();
+			}
+		}
+	}
+
 	bool Connection::Ping(std::error_code &ec) {
 		do {
 			std::error_code ec1;
@@ -201,13 +231,25 @@ namespace bumo {
 		return !ec;
 	}
 
+	bool Connection::SendWsMessage(protocol::WsMessage &message, std::error_code &ec) {
+		if (compress_threshold_ > 0 && !message.compressed() && message.data().size() >= compress_threshold_) {
+			std::string compressed_data;
+			if (utils::ZlibCompress(message.data(), compressed_data) && compressed_data.size() < message.data().size()) {
+				message.set_data(compressed_data);
+				message.set_compressed(true);
+			}
+		}
+
+		return SendByteMessage(message.SerializeAsString(), ec);
+	}
+
 	bool Connection::SendMsg(int64_t type, bool request, int64_t sequence, const std::string &data, std::error_code &ec) {
 		protocol::WsMessage message;
 		message.set_type(type);
 		message.set_request(request);
 		message.set_sequence(sequence);
 		message.set_data(data);
-		return SendByteMessage(message.SerializeAsString(), ec);
+		return SendWsMessage(message, ec);
 	}
 
 	bool Connection::SendRequest(int64_t type, const std::string &data, std::error_code &ec) {
@@ -216,7 +258,7 @@ namespace bumo {
 		message.set_request(true);
 		message.set_sequence(sequence_++);
 		message.set_data(data);
-		return SendByteMessage(message.SerializeAsString(), ec);
+		return SendWsMessage(message, ec);
 	}
 
 	bool Connection::SendResponse(const protocol::WsMessage &req_message, const std::string &data, std::error_code &ec) {
@@ -261,6 +303,7 @@ namespace bumo {
 		status["in_bound"] = in_bound_;
 		status["peer_address"] = GetPeerAddress().ToIpPort();
 		status["last_receive_time"] = last_receive_time_;
+		status["compress_threshold"] = (Json::UInt64)compress_threshold_;
 	}
 
 	bool Connection::OnNetworkTimer(int64_t current_time) { return true; }
@@ -386,6 +429,18 @@ namespace bumo {
 			return;
 		}
 
+		if (message.compressed()) {
+			//The uncompressed data is limited by the size that an uncompressed frame could carry
+			std::string data;
+			if (!utils::ZlibUncompress(message.data(), data, websocketpp::config::asio::max_message_size)) {
+				LOG_ERROR("Failed to uncompress websocket message, type(" FMT_I64 "), compressed size(" FMT_SIZE ")",
+					message.type(), message.data().size());
+				return;
+			}
+			message.set_data(data);
+			message.set_compressed(false);
+		}
+
 		int64_t conn_id = -1;
 		do {
 			utils::MutexGuard guard(conns_list_lock_);
@@ -457,6 +512,7 @@ namespace bumo {
 			int64_t last_check_time = 0;
 			while (enabled_) {
 				io_.poll();
+				OnPoll();
 
 				utils::Sleep(1);
 
@@ -65,6 +65,9 @@ namespace bumo {
 		bool in_bound_;
 		utils::InetAddress peer_address_;
 
+		//Compress the data which is not smaller than it, 0 means the remote does not accept compressed data
+		size_t compress_threshold_;
+
 	protected:
 		int64_t connect_start_time_;
 		int64_t sequence_;
@@ -77,9 +80,12 @@ namespace bumo {
 		virtual ~Connection();
 		
 		bool SendByteMessage(const std::string &message, std::error_code &ec);
+		bool SendWsMessage(protocol::WsMessage &message, std::error_code &ec);
 		bool SendMsg(int64_t type, bool request, int64_t sequence, const std::string &data, std::error_code &ec);
 		bool SendRequest(int64_t type, const std::string &data, std::error_code &ec);
 		bool SendResponse(const protocol::WsMessage &req_message, const std::string &data, std::error_code &ec);
+		//Bytes written but not yet sent by the socket
+		size_t GetBufferedAmount() const;
 		bool Ping(std::error_code &ec);
 		virtual bool PingCustom(std::error_code &ec);
 		bool Close(const std::string &reason);
@@ -92,6 +98,7 @@ namespace bumo {
 		connection_hdl GetHandle() const;
 		websocketpp::lib::error_code GetErrorCode() const;
 		bool InBound() const;
+		void SetCompressThreshold(size_t compress_threshold);
 
 		//Get status
 		bool IsConnectExpired(int64_t time_out) const;
@@ -197,6 +204,8 @@ namespace bumo {
 			connection_hdl con, const std::string &uri, int64_t id);
 		virtual void OnDisconnect(Connection *conn) {};
 		virtual bool OnConnectOpen(Connection *conn) { return true; };
+		//Called on the network thread after each poll, once the completed writes have released their buffers
+		virtual void OnPoll() {};
 	};
 
 }
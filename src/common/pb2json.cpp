@@ -47,6 +47,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "pb2json.h"
 
 #include <sstream>
+#include <algorithm>
 #include <stdexcept>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/repeated_field.h>
@@ -288,6 +289,178 @@ namespace  bumo {
 		return va;
 	}
 
+	static const std::string &_field_json_name(const FieldDescriptor *field) {
+		return field->is_extension() ? field->full_name() : field->name();
+	}
+
+	static bool _field_name_less(const FieldDescriptor *left, const FieldDescriptor *right) {
+		return _field_json_name(left) < _field_json_name(right);
+	}
+
+	void JsonWriteString(const std::string& value, std::string& out) {
+		//Escapes as Json::valueToQuotedString does, which also stops at the first NUL
+		static const char hex[] = "0123456789ABCDEF";
+		out += '"';
+		const char *c = value.c_str();
+		const char *span = c;
+		for (; *c != 0; c++) {
+			unsigned char ch = (unsigned char)*c;
+			if (ch >= 0x20 && ch != '"' && ch != '\\') continue;
+
+			out.append(span, c - span);
+			span = c + 1;
+			switch (ch) {
+			case '"': out += "\\\""; break;
+			case '\\': out += "\\\\"; break;
+			case '\b': out += "\\b"; break;
+			case '\f': out += "\\f"; break;
+			case '\n': out += "\\n"; break;
+			case '\r': out += "\\r"; break;
+			case '\t': out += "\\t"; break;
+			default:
+				out += "\\u00";
+				out += hex[ch >> 4];
+				out += hex[ch & 0x0F];
+				break;
+			}
+		}
+		out.append(span, c - span);
+		out += '"';
+	}
+
+	void JsonWriteHex(const std::string& value, std::string& out) {
+		static const char hex[] = "0123456789abcdef";
+		size_t offset = out.size();
+		out.resize(offset + value.size() * 2 + 2);
+		char *current = &out[offset];
+		*current++ = '"';
+		for (size_t i = 0; i < value.size(); i++) {
+			uint8_t item = value[i];
+			*current++ = hex[item >> 4];
+			*current++ = hex[item & 0x0F];
+		}
+		*current = '"';
+	}
+
+	void JsonWriteUInt64(uint64_t value, std::string& out) {
+		char buffer[24];
+		char *current = buffer + sizeof(buffer);
+		do {
+			*--current = (char)('0' + value % 10);
+			value /= 10;
+		} while (value != 0);
+		out.append(current, buffer + sizeof(buffer) - current);
+	}
+
+	void JsonWriteInt64(int64_t value, std::string& out) {
+		if (value < 0) {
+			out += '-';
+			JsonWriteUInt64(0 - (uint64_t)value, out);
+		}
+		else
+			JsonWriteUInt64((uint64_t)value, out);
+	}
+
+	static void _field2stream(const Message& msg, const FieldDescriptor *field, int index, std::string& out) {
+		const Reflection *ref = msg.GetReflection();
+		const bool repeated = field->is_repeated();
+		switch (field->cpp_type()) {
+			case FieldDescriptor::CPPTYPE_BOOL:
+				out += (repeated ? ref->GetRepeatedBool(msg, field, index) : ref->GetBool(msg, field)) ? "true" : "false";
+				break;
+			case FieldDescriptor::CPPTYPE_DOUBLE:
+				out += Json::valueToString(repeated ? ref->GetRepeatedDouble(msg, field, index) : ref->GetDouble(msg, field));
+				break;
+			case FieldDescriptor::CPPTYPE_FLOAT:
+				out += Json::valueToString((double)(repeated ? ref->GetRepeatedFloat(msg, field, index) : ref->GetFloat(msg, field)));
+				break;
+			case FieldDescriptor::CPPTYPE_INT32:
+				JsonWriteInt64(repeated ? ref->GetRepeatedInt32(msg, field, index) : ref->GetInt32(msg, field), out);
+				break;
+			case FieldDescriptor::CPPTYPE_UINT32:
+				JsonWriteUInt64(repeated ? ref->GetRepeatedUInt32(msg, field, index) : ref->GetUInt32(msg, field), out);
+				break;
+			case FieldDescriptor::CPPTYPE_INT64:
+				JsonWriteInt64(repeated ? ref->GetRepeatedInt64(msg, field, index) : ref->GetInt64(msg, field), out);
+				break;
+			case FieldDescriptor::CPPTYPE_UINT64:
+				JsonWriteUInt64(repeated ? ref->GetRepeatedUInt64(msg, field, index) : ref->GetUInt64(msg, field), out);
+				break;
+			case FieldDescriptor::CPPTYPE_STRING: {
+				std::string scratch;
+				const std::string &v = (repeated) ?
+					ref->GetRepeatedStringReference(msg, field, index, &scratch) :
+					ref->GetStringReference(msg, field, &scratch);
+				if (field->type() == FieldDescriptor::TYPE_BYTES)
+					JsonWriteHex(v, out);
+				else
+					JsonWriteString(v, out);
+				break;
+			}
+			case FieldDescriptor::CPPTYPE_MESSAGE:
+				Proto2JsonWrite((repeated) ? ref->GetRepeatedMessage(msg, field, index) : ref->GetMessage(msg, field), out);
+				break;
+			case FieldDescriptor::CPPTYPE_ENUM:
+				JsonWriteInt64(((repeated) ? ref->GetRepeatedEnum(msg, field, index) : ref->GetEnum(msg, field))->number(), out);
+				break;
+			default:
+				out += "null";
+				break;
+		}
+	}
+
+	size_t Proto2JsonWriteMembers(const Message& msg, std::string& out) {
+		const Descriptor *d = msg.GetDescriptor();
+		const Reflection *ref = msg.GetReflection();
+		if (!d || !ref)
+		{
+			throw j2pb_error("Descriptor or Reflection");
+		}
+
+		//Json::Value keeps its members sorted by name, so do the same
+		std::vector<const FieldDescriptor *> fields;
+		ref->ListFields(msg, &fields);
+		std::sort(fields.begin(), fields.end(), _field_name_less);
+
+		for (size_t i = 0; i != fields.size(); i++) {
+			const FieldDescriptor *field = fields[i];
+			if (i > 0) out += ',';
+			JsonWriteString(_field_json_name(field), out);
+			out += ':';
+
+			if (!field->is_repeated()) {
+				_field2stream(msg, field, 0, out);
+				continue;
+			}
+
+			int count = ref->FieldSize(msg, field);
+			if (count == 0) {
+				out += "null";
+				continue;
+			}
+			out += '[';
+			for (int j = 0; j < count; j++) {
+				if (j > 0) out += ',';
+				_field2stream(msg, field, j, out);
+			}
+			out += ']';
+		}
+		return fields.size();
+	}
+
+	void Proto2JsonWrite(const Message& msg, std::string& out) {
+		size_t begin = out.size();
+		out += '{';
+		if (Proto2JsonWriteMembers(msg, out) > 0) {
+			out += '}';
+			return;
+		}
+
+		//A message without members is a null value in Proto2Json
+		out.resize(begin);
+		out += "null";
+	}
+
 
 	bool Json2Proto(const Json::Value& root, Message& msg, std::string& errorMsg) {
 
@@ -49,6 +49,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 namespace bumo {
 	bool Json2Proto(const Json::Value& root, google::protobuf::Message& msg, std::string& errorMsg);
 	Json::Value Proto2Json(const google::protobuf::Message& message);
+
+	//Streaming writers, append to the output the same text as Proto2Json(message).toFastString()
+	void Proto2JsonWrite(const google::protobuf::Message& message, std::string& out);
+	//Writes the members without braces so that the caller can add its own, returns the number written
+	size_t Proto2JsonWriteMembers(const google::protobuf::Message& message, std::string& out);
+	void JsonWriteString(const std::string& value, std::string& out);
+	void JsonWriteHex(const std::string& value, std::string& out);
+	void JsonWriteInt64(int64_t value, std::string& out);
+	void JsonWriteUInt64(uint64_t value, std::string& out);
 } // namespace json_protobuf
 
 #endif // __JSON_PROTOBUF_H__
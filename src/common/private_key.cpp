@@ -272,27 +272,70 @@ namespace bumo {
 		return EncodePublicKey(str_result);
 	}
 	//not modify
-	bool PublicKey::Verify(const std::string &data, const std::string &signature, const std::string &encode_public_key) {
+	VerifyKey::VerifyKey(SignatureType type, const std::string &raw_pub_key) :
+		type_(type), raw_pub_key_(raw_pub_key), ed25519_valid_(false) {
+		if (type_ == SIGNTYPE_ED25519) {
+			ed25519_point_.resize(ed25519_prepared_size());
+			ed25519_valid_ = ed25519_prepare_public_key((const unsigned char *)raw_pub_key_.c_str(), (unsigned char *)&ed25519_point_[0]) == 0;
+		}
+		else if (type_ == SIGNTYPE_CFCASM2) {
+			sm2_key_.reset(new utils::EccSm2::VerifyKey(utils::EccSm2::GetCFCAGroup(), raw_pub_key_, "1234567812345678"));
+		}
+	}
+
+	VerifyKey::~VerifyKey() {}
+
+	bool VerifyKey::Verify(const std::string &data, const std::string &signature) const {
+		if (type_ == SIGNTYPE_ED25519) {
+			//A point that does not unpack fails like ed25519_sign_open does
+			return ed25519_valid_ && ed25519_sign_open_prepared((unsigned char *)data.c_str(), data.size(), (unsigned char *)raw_pub_key_.c_str(),
+				(const unsigned char *)ed25519_point_.c_str(), (unsigned char *)signature.c_str()) == 0;
+		}
+		else if (type_ == SIGNTYPE_CFCASM2) {
+			return sm2_key_->Verify(data, signature) == 1;
+		}
+		else{
+			LOG_ERROR("Failed to verify. Unknown signature type(%d)", type_);
+		}
+		return false;
+	}
+
+	utils::Mutex PublicKey::verify_key_lock_;
+	cache::lru_cache<std::string, std::shared_ptr<VerifyKey>> PublicKey::verify_keys_(General::VERIFY_KEY_CACHE_SIZE);
+
+	std::shared_ptr<VerifyKey> PublicKey::GetVerifyKey(const std::string &encode_public_key) {
+		std::shared_ptr<VerifyKey> key;
+		do {
+			utils::MutexGuard guard(verify_key_lock_);
+			if (verify_keys_.get(encode_public_key, key)) {
+				return key;
+			}
+		} while (false);
+
 		PrivateKeyPrefix prefix;
 		SignatureType sign_type;
 		std::string raw_pubkey;
 		bool valid = GetPublicKeyElement(encode_public_key, prefix, sign_type, raw_pubkey);
 		if (!valid || prefix != PUBLICKEY_PREFIX) {
+			return nullptr;
+		}
+
+		//Prepared outside the lock, two threads may both prepare a new key and the last one is kept
+		key = std::make_shared<VerifyKey>(sign_type, raw_pubkey);
+		utils::MutexGuard guard(verify_key_lock_);
+		verify_keys_.put(encode_public_key, key);
+		return key;
+	}
+
+	bool PublicKey::Verify(const std::string &data, const std::string &signature, const std::string &encode_public_key) {
+		std::shared_ptr<VerifyKey> key = GetVerifyKey(encode_public_key);
+		if (key == nullptr) {
 			return false;
 		}
 
 		if (signature.size() != 64) { return false; }
 
-		if (sign_type == SIGNTYPE_ED25519 ) {
-			return ed25519_sign_open((unsigned char *)data.c_str(), data.size(), (unsigned char *)raw_pubkey.c_str(), (unsigned char *)signature.c_str()) == 0;
-		}
-		else if (sign_type == SIGNTYPE_CFCASM2) {
-			return utils::EccSm2::verify(utils::EccSm2::GetCFCAGroup(), raw_pubkey, "1234567812345678", data, signature) == 1;
-		}
-		else{
-			LOG_ERROR("Failed to verify. Unknown signature type(%d)", sign_type);
-		}
-		return false;
+		return key->Verify(data, signature);
 	}
 
 	//Generate keypair according to signature type.
@@ -19,6 +19,7 @@
 #include <utils/headers.h>
 #include <3rd/ed25519-donna/ed25519.h>
 #include <utils/ecc_sm2.h>
+#include <utils/lrucache.hpp>
 
 namespace bumo {
 	typedef unsigned char sm2_public_key[65];
@@ -62,6 +63,24 @@ namespace bumo {
 	SignatureType GetSignTypeByDesc(const std::string &desc);
 	
 
+	//What verifying needs from a public key, computed once: the unpacked point for ed25519,
+	//the point and the ZA digest of the fixed user ID for SM2
+	class VerifyKey {
+		DISALLOW_COPY_AND_ASSIGN(VerifyKey);
+	public:
+		VerifyKey(SignatureType type, const std::string &raw_pub_key);
+		~VerifyKey();
+
+		bool Verify(const std::string &data, const std::string &signature) const;
+
+	private:
+		SignatureType type_;
+		std::string raw_pub_key_;
+		std::string ed25519_point_;
+		bool ed25519_valid_;
+		std::unique_ptr<utils::EccSm2::VerifyKey> sm2_key_;
+	};
+
 	class PublicKey {
 		DISALLOW_COPY_AND_ASSIGN(PublicKey);
 		friend class PrivateKey;
@@ -89,6 +108,11 @@ namespace bumo {
 		std::string raw_pub_key_;
 		bool valid_;
 		SignatureType type_;
+
+		//Decoded keys with their verification state prepared, by encoded public key
+		static utils::Mutex verify_key_lock_;
+		static cache::lru_cache<std::string, std::shared_ptr<VerifyKey>> verify_keys_;
+		static std::shared_ptr<VerifyKey> GetVerifyKey(const std::string &encode_public_key);
 	};
 
 	class PrivateKey {
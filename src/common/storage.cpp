@@ -26,6 +26,47 @@ namespace bumo {
 
 	KeyValueDb::~KeyValueDb() {}
 
+	bool KeyValueDb::GetPending(const std::string &key, std::string &value, int32_t &ret) {
+		utils::ReadLockGuard guard(pending_mutex_);
+		for (auto it = pending_batches_.rbegin(); it != pending_batches_.rend(); it++) {
+			auto iter = (*it)->find(key);
+			if (iter != (*it)->end()) {
+				ret = iter->second.first ? 0 : 1;
+				if (ret > 0) value = iter->second.second;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void KeyValueDb::AddPending(const WRITE_BATCH &values) {
+		class PendingHandler : public WRITE_BATCH::Handler {
+		public:
+			PendingBatch *batch_;
+			virtual void Put(const SLICE& key, const SLICE& value) {
+				(*batch_)[key.ToString()] = std::make_pair(false, value.ToString());
+			}
+			virtual void Delete(const SLICE& key) {
+				(*batch_)[key.ToString()] = std::make_pair(true, std::string());
+			}
+		};
+
+		std::shared_ptr<PendingBatch> batch = std::make_shared<PendingBatch>();
+		PendingHandler handler;
+		handler.batch_ = batch.get();
+		values.Iterate(&handler);
+
+		utils::WriteLockGuard guard(pending_mutex_);
+		pending_batches_.push_back(batch);
+	}
+
+	void KeyValueDb::RemovePending() {
+		utils::WriteLockGuard guard(pending_mutex_);
+		if (!pending_batches_.empty()) {
+			pending_batches_.pop_front();
+		}
+	}
+
 #ifdef WIN32
 	LevelDbDriver::LevelDbDriver() {
 		db_ = NULL;
@@ -61,6 +102,10 @@ namespace bumo {
 
 	int32_t LevelDbDriver::Get(const std::string &key, std::string &value) {
 		assert(db_ != NULL);
+		int32_t pending_ret = 0;
+		if (GetPending(key, value, pending_ret)) {
+			return pending_ret;
+		}
 
 		//Retry 10 times. Interval is 0.1 second.
 		size_t timers = 0;
@@ -167,6 +212,10 @@ namespace bumo {
 
 	int32_t RocksDbDriver::Get(const std::string &key, std::string &value) {
 		assert(db_ != NULL);
+		int32_t pending_ret = 0;
+		if (GetPending(key, value, pending_ret)) {
+			return pending_ret;
+		}
 		rocksdb::Status status = db_->Get(rocksdb::ReadOptions(), key, &value);
 		if (status.ok()) {
 			return 1;
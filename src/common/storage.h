@@ -17,6 +17,7 @@
 #define STORAGE_H_
 
 #include <unordered_map>
+#include <deque>
 #include <utils/headers.h>
 #include <json/json.h>
 #include "general.h"
@@ -46,6 +47,12 @@ namespace bumo {
 	protected:
 		utils::Mutex mutex_;
 		std::string error_desc_;
+
+		//Batches queued for the ledger writer, oldest first, as key -> (deleted, value). Get reads them before the db until they are written.
+		typedef std::unordered_map<std::string, std::pair<bool, std::string>> PendingBatch;
+		utils::ReadWriteLock pending_mutex_;
+		std::deque<std::shared_ptr<PendingBatch>> pending_batches_;
+		bool GetPending(const std::string &key, std::string &value, int32_t &ret);
 	public:
 		KeyValueDb();
 		~KeyValueDb();
@@ -60,6 +67,10 @@ namespace bumo {
 		}
 		virtual bool WriteBatch(WRITE_BATCH &values) = 0;
 
+		//Make the batch readable before it is written, and drop the oldest one after it is written
+		void AddPending(const WRITE_BATCH &values);
+		void RemovePending();
+
 		virtual void* NewIterator() = 0;
 	};
 
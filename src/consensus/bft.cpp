@@ -18,6 +18,9 @@
 #include "bft.h"
 
 namespace bumo {
+	utils::Mutex Pbft::verified_sign_lock_;
+	cache::lru_cache<std::string, bool> Pbft::verified_signs_(General::PBFT_VERIFIED_SIGN_CACHE_SIZE);
+
 	Pbft::Pbft() :view_number_(0),
 		last_exe_seq_(1),
 		fault_number_(0),
@@ -110,10 +113,9 @@ namespace bumo {
 				//For message buffer
 				const Json::Value &msg_buffer_json = item["msg_buffer"];
 				for (uint32_t m = 0; m < msg_buffer_json.size(); m++) {
-					PbftPhaseVector pv;
 					const Json::Value &msg_item_json = msg_buffer_json[m];
-					protocol::PbftEnv env;
-					if (!env.ParseFromString(utils::String::HexStringToBin(msg_item_json.asString()))) {
+					PbftEnvPointer env = std::make_shared<protocol::PbftEnv>();
+					if (!env->ParseFromString(utils::String::HexStringToBin(msg_item_json.asString()))) {
 						LOG_ERROR("Failed to parse message buffer string when Consensus load view-change.");
 						continue;
 					}
@@ -210,7 +212,7 @@ namespace bumo {
 			//For message buffer
 			Json::Value &msg_buffer_json = item["msg_buffer"];
 			for (PbftPhaseVector::const_iterator iter_msg = instance.msg_buf_.begin(); iter_msg != instance.msg_buf_.end(); iter_msg++) {
-				msg_buffer_json[msg_buffer_json.size()] = utils::String::BinToHexString(iter_msg->SerializeAsString());
+				msg_buffer_json[msg_buffer_json.size()] = utils::String::BinToHexString((*iter_msg)->SerializeAsString());
 			}
 
 			//For view changes
@@ -253,7 +255,7 @@ namespace bumo {
 			//Check if we should send the prepare again
 			if (iter->second.NeedSendAgain(current_time) &&
 				view_active_ &&
-				iter->second.pre_prepare_msg_.has_pbft()) {
+				iter->second.pre_prepare_msg_ != NULL) {
 				iter->second.SendPrepareAgain(this, current_time);
 				LOG_INFO("Send pre-prepare message again actively: view-number(" FMT_I64 "), sequence(" FMT_I64 "), round number(%u)",
 					iter->first.view_number_, iter->first.sequence_, iter->second.pre_prepare_round_);
@@ -339,10 +341,10 @@ namespace bumo {
 
 		//Insert the instance to map
 		PbftInstance pinstance;
-		pinstance.pre_prepare_msg_ = *env;
+		pinstance.pre_prepare_msg_ = env;
 		pinstance.phase_ = PBFT_PHASE_PREPREPARED;
 		pinstance.pre_prepare_ = env->pbft().pre_prepare();
-		pinstance.msg_buf_[env->pbft().type()].push_back(*env);
+		pinstance.msg_buf_[env->pbft().type()].push_back(env);
 		instances_[index] = pinstance;
 
 		LOG_INFO("Send pre-prepare message: view number(" FMT_I64 "), sequence(" FMT_I64 "), consensus value(%s)", 
@@ -361,6 +363,11 @@ namespace bumo {
 	}
 
 	bool Pbft::CheckMessageItem(const protocol::PbftEnv &env, const ValidatorMap &validators) {
+		PbftEnvRefVector sign_envs;
+		return CheckMessageItem(env, validators, sign_envs) && CheckSignatures(sign_envs);
+	}
+
+	bool Pbft::CheckMessageItem(const protocol::PbftEnv &env, const ValidatorMap &validators, PbftEnvRefVector &sign_envs) {
 		//This function should output the error log
 		const protocol::Pbft &pbft = env.pbft();
 		const protocol::Signature &sig = env.signature();
@@ -428,7 +435,7 @@ namespace bumo {
 				return false;
 			}
 
-			if (!CheckViewChangeWithRawValue(pbft.view_change_with_rawvalue(), validators)) {
+			if (!CheckViewChangeWithRawValue(pbft.view_change_with_rawvalue(), validators, sign_envs)) {
 				return false;
 			}
 
@@ -458,15 +465,72 @@ namespace bumo {
 			return false;
 		}
 
-		//Check the signature
-		if (!PublicKey::Verify(pbft.SerializeAsString(), sig.sign_data(), sig.public_key())) {
-			LOG_ERROR("Failed to check received message's signature, desc(%s)", PbftDesc::GetPbft(pbft).c_str());
+		//The signature is verified later with the others in the batch
+		sign_envs.push_back(&env);
+		return true;
+	}
+
+	bool Pbft::CheckSignature(const protocol::PbftEnv &env) {
+		return CheckSignature(env, env.pbft().SerializeAsString());
+	}
+
+	bool Pbft::CheckSignature(const protocol::PbftEnv &env, const std::string &pbft_data) {
+		const protocol::Signature &sig = env.signature();
+
+		//Include the lengths so that different (signature, public key) splits never share a key
+		std::string cache_key = utils::Sha256::Crypto(pbft_data);
+		cache_key += utils::String::Format(FMT_SIZE ":" FMT_SIZE ":", sig.sign_data().size(), sig.public_key().size());
+		cache_key += sig.sign_data();
+		cache_key += sig.public_key();
+		do {
+			utils::MutexGuard guard(verified_sign_lock_);
+			bool verified = false;
+			if (verified_signs_.get(cache_key, verified)) {
+				return verified;
+			}
+		} while (false);
+
+		if (!PublicKey::Verify(pbft_data, sig.sign_data(), sig.public_key())) {
 			return false;
 		}
+
+		utils::MutexGuard guard(verified_sign_lock_);
+		verified_signs_.put(cache_key, true);
+		return true;
+	}
+
+	bool Pbft::CheckSignatures(const PbftEnvRefVector &sign_envs) {
+		//Not std::vector<bool>, the workers write the elements concurrently
+		std::vector<uint8_t> results(sign_envs.size(), 0);
+		std::function<void(size_t)> check_func = [&sign_envs, &results](size_t i) {
+			results[i] = CheckSignature(*sign_envs[i]) ? 1 : 0;
+		};
+
+		ParallelWorker *worker = ParallelWorker::GetInstance();
+		if (worker != NULL) {
+			worker->ParallelFor(sign_envs.size(), check_func);
+		}
+		else {
+			for (size_t i = 0; i < sign_envs.size(); i++) {
+				check_func(i);
+			}
+		}
+
+		for (size_t i = 0; i < sign_envs.size(); i++) {
+			if (results[i] == 0) {
+				LOG_ERROR("Failed to check received message's signature, desc(%s)", PbftDesc::GetPbft(sign_envs[i]->pbft()).c_str());
+				return false;
+			}
+		}
 		return true;
 	}
 
 	bool Pbft::CheckViewChangeWithRawValue(const protocol::PbftViewChangeWithRawValue &view_change_raw, const ValidatorMap &validators) {
+		PbftEnvRefVector sign_envs;
+		return CheckViewChangeWithRawValue(view_change_raw, validators, sign_envs) && CheckSignatures(sign_envs);
+	}
+
+	bool Pbft::CheckViewChangeWithRawValue(const protocol::PbftViewChangeWithRawValue &view_change_raw, const ValidatorMap &validators, PbftEnvRefVector &sign_envs) {
 
 		if (!view_change_raw.has_view_change_env()) {
 			LOG_ERROR("Failed to check raw view-change, thers is no view change env, desc(%s)", PbftDesc::GetViewChangeRawValue(view_change_raw).c_str());
@@ -474,7 +538,7 @@ namespace bumo {
 		}
 
 		if (GetMessageType(view_change_raw.view_change_env()) != protocol::PBFT_TYPE_VIEWCHANGE ||
-			!CheckMessageItem(view_change_raw.view_change_env(), validators)) {
+			!CheckMessageItem(view_change_raw.view_change_env(), validators, sign_envs)) {
 			LOG_ERROR("Failed to check raw view-change, desc(%s)", PbftDesc::GetViewChangeRawValue(view_change_raw).c_str());
 			return false;
 		}
@@ -488,7 +552,7 @@ namespace bumo {
 			//Check the pre-prepared message
 			const protocol::PbftEnv &pre_prepare_env = prepared_set.pre_prepare();
 			const protocol::PbftPrePrepare &pre_prepare = pre_prepare_env.pbft().pre_prepare();
-			if (!CheckMessageItem(pre_prepare_env, validators)) {
+			if (!CheckMessageItem(pre_prepare_env, validators, sign_envs)) {
 				return false;
 			}
 			value_digest = pre_prepare.value_digest();
@@ -497,7 +561,7 @@ namespace bumo {
 			//Check the prepared message
 			for (int32_t m = 0; m < prepared_set.prepare_size(); m++) {
 				const protocol::PbftEnv &prepare_env = prepared_set.prepare(m);
-				if (!CheckMessageItem(prepare_env, validators)) {
+				if (!CheckMessageItem(prepare_env, validators, sign_envs)) {
 					LOG_ERROR("Failed to check view-change prepared set, desc(%s)", PbftDesc::GetViewChangeRawValue(view_change_raw).c_str());
 					return false;
 				}
@@ -626,7 +690,8 @@ namespace bumo {
 		}
 	}
 
-	PbftInstance *Pbft::CreateInstanceIfNotExist(const protocol::PbftEnv &env) {
+	PbftInstance *Pbft::CreateInstanceIfNotExist(const PbftEnvPointer &env_pointer) {
+		const protocol::PbftEnv &env = *env_pointer;
 		const protocol::Pbft &pbft = env.pbft();
 		int64_t view_number = 0;
 		int64_t sequence = 0;
@@ -704,7 +769,7 @@ namespace bumo {
 		}
 
 		PbftInstance &instace = instances_[index];
-		instace.msg_buf_[pbft.type()].push_back(env);
+		instace.msg_buf_[pbft.type()].push_back(env_pointer);
 
 		return &instace;
 	}
@@ -714,12 +779,19 @@ namespace bumo {
 			LOG_ERROR("The received consensus message may be error, and its type is not pbft");
 			return false;
 		}
-		protocol::PbftEnv env = message.GetPbft();
+		const protocol::PbftEnv &env = message.GetPbft();
 		const protocol::Pbft &pbft = env.pbft();
-		const protocol::Signature &sig = env.signature();
 
-		//Check the message item. 
-		if (!CheckMessageItem(env)) {
+		//Check the message item, the signature is verified with the bytes serialized on receiving
+		PbftEnvRefVector sign_envs;
+		if (!CheckMessageItem(env, validators_, sign_envs)) {
+			return false;
+		}
+
+		//The env itself is the last one appended
+		sign_envs.pop_back();
+		if (!CheckSignatures(sign_envs) || !CheckSignature(env, message.GetSignedData())) {
+			LOG_ERROR("Failed to check received message's signature, desc(%s)", PbftDesc::GetPbft(pbft).c_str());
 			return false;
 		}
 
@@ -736,7 +808,7 @@ namespace bumo {
 			}
 
 			utils::MutexGuard lock_guad(lock_);
-			PbftInstance *pinstance = CreateInstanceIfNotExist(env);
+			PbftInstance *pinstance = CreateInstanceIfNotExist(message.GetPbftPointer());
 			if (pinstance) doret = pinstance->Go(env, this, ret);
 			break;
 		}
@@ -945,7 +1017,7 @@ namespace bumo {
 
 		PbftViewChangeMap::iterator iter_v = vc_instance.viewchanges_.find(view_change.replica_id());
 		if (iter_v == vc_instance.viewchanges_.end()) {
-			vc_instance.msg_buf_.push_back(pbft_env);
+			vc_instance.msg_buf_.push_back(std::make_shared<protocol::PbftEnv>(pbft_env));
 			vc_instance.viewchanges_.insert(std::make_pair(view_change.replica_id(), view_change));
 		}
 
@@ -1005,10 +1077,12 @@ namespace bumo {
 
 		bool check_ret = true;
 		std::set<int64_t> replica_set;
+		PbftEnvRefVector sign_envs;
 		for (int32_t i = 0; i < new_view.view_changes_size(); i++) {
 			const protocol::PbftEnv &view_change_env = new_view.view_changes(i);
-			vc_instance_tmp.msg_buf_.push_back(view_change_env);
-			if (!CheckMessageItem(pbft_env)) {
+			vc_instance_tmp.msg_buf_.push_back(std::make_shared<protocol::PbftEnv>(view_change_env));
+			if (GetMessageType(view_change_env) != protocol::PBFT_TYPE_VIEWCHANGE || 
+				!CheckMessageItem(view_change_env, validators_, sign_envs)) {
 				check_ret = false;
 				break;
 			}
@@ -1026,7 +1100,7 @@ namespace bumo {
 			replica_set.insert(view_change.replica_id());
 		}
 
-		if (!check_ret) {
+		if (!check_ret || !CheckSignatures(sign_envs)) {
 			return false;
 		}
 
@@ -1163,6 +1237,7 @@ namespace bumo {
 	}
 
 	bool Pbft::TryExecuteValue() {
+		bool executed = false;
 		for (PbftInstanceMap::iterator iter = instances_.begin(); iter != instances_.end(); iter++) {
 			PbftInstance &instance = iter->second;
 			const PbftInstanceIndex &index = iter->first;
@@ -1182,7 +1257,7 @@ namespace bumo {
 			const PbftPhaseVector &vec = instance.msg_buf_[protocol::PBFT_TYPE_COMMIT];
 			std::set<std::string> commit_node;
 			for (size_t i = 0; i < vec.size(); i++) {
-				const protocol::PbftEnv &env = vec[i];
+				const protocol::PbftEnv &env = *vec[i];
 				const protocol::Signature &sign = env.signature();
 				if (commit_node.find(sign.public_key()) == commit_node.end()) {
 					*proof.add_commits() = env;
@@ -1204,10 +1279,50 @@ namespace bumo {
 					iter++;
 				}
 			}
+			executed = true;
+		}
+
+		if (executed) {
+			RecheckNextValue();
 		}
 		return true;
 	}
 
+	void Pbft::RecheckNextValue() {
+		//The pre-prepare of the next sequence may arrive before the previous value is closed here, so it was parked
+		//without a prepare. Check it again against the new ledger at once instead of waiting for the primary to resend it.
+		for (PbftInstanceMap::iterator iter = instances_.begin(); iter != instances_.end(); iter++) {
+			PbftInstance &instance = iter->second;
+			const PbftInstanceIndex &index = iter->first;
+			if (index.sequence_ != last_exe_seq_ + 1 ||
+				index.view_number_ != view_number_ ||
+				instance.phase_ == PBFT_PHASE_NONE ||
+				instance.phase_ >= PBFT_PHASE_COMMITED ||
+				instance.check_value_result_ == Consensus::CHECK_VALUE_VALID) {
+				continue;
+			}
+
+			//A value that still does not extend the closed ledger is never prepared, the view change timer aborts it
+			int32_t check_value_ret = CheckValue(instance.pre_prepare_.value());
+			if (check_value_ret != Consensus::CHECK_VALUE_VALID) {
+				LOG_INFO("Failed to recheck the value(view number:" FMT_I64 ", sequence:" FMT_I64 "), so don't send prepare message", 
+					index.view_number_, index.sequence_);
+				continue;
+			}
+
+			instance.check_value_result_ = check_value_ret;
+			LOG_INFO("Send prepare message after recheck: view number(" FMT_I64 "), replica id(" FMT_I64 "), sequence(" FMT_I64 ")",
+				index.view_number_, replica_id_, index.sequence_);
+			SendMessage(NewPrepare(instance.pre_prepare_, 1));
+
+			if (instance.phase_ >= PBFT_PHASE_PREPARED && !instance.prepares_.empty()) {
+				LOG_INFO("Send commit message after recheck: view number(" FMT_I64 "), sequence(" FMT_I64 ")", index.view_number_, index.sequence_);
+				SendMessage(NewCommit(instance.prepares_.begin()->second, 1));
+				instance.SetLastCommitSendTime(utils::Timestamp::HighResolution());
+			}
+		}
+	}
+
 	PbftEnvPointer Pbft::NewPrePrepare(const std::string &value, int64_t sequence) {
 		PbftEnvPointer env = std::make_shared<protocol::PbftEnv>();
 
@@ -1320,11 +1435,11 @@ namespace bumo {
 					protocol::PbftPreparedSet *prepared_set_inner = vc_raw->mutable_prepared_set();
 
 					//Add prepared message and pre-prepared message
-					*prepared_set_inner->mutable_pre_prepare() = instance.msg_buf_[0][0];//Add prepreared message
+					*prepared_set_inner->mutable_pre_prepare() = *instance.msg_buf_[0][0];//Add prepreared message
 
 					//Add prepared message
 					for (size_t i = 0; i < instance.msg_buf_[1].size(); i++) {
-						*prepared_set_inner->add_prepare() = instance.msg_buf_[1][i];
+						*prepared_set_inner->add_prepare() = *instance.msg_buf_[1][i];
 					}
 
 					LOG_INFO("Got prepared value, desc(%s)", PbftDesc::GetPbft(prepared_set_inner->pre_prepare().pbft()).c_str());
@@ -1369,7 +1484,7 @@ namespace bumo {
 		pnewview->set_sequence(vc_instance.seq);
 
 		for (PbftPhaseVector::iterator iter = vc_instance.msg_buf_.begin(); iter != vc_instance.msg_buf_.end(); iter++) {
-			const protocol::PbftEnv &env_out = *iter;
+			const protocol::PbftEnv &env_out = **iter;
 
 			//Get the inner view change env
 			*pnewview->add_view_changes() = env_out.pbft().view_change_with_rawvalue().view_change_env();
@@ -1744,10 +1859,12 @@ namespace bumo {
 			return false;
 		}
 
+		//Check the commits first, then verify all of their signatures as one batch
+		PbftEnvRefVector sign_envs;
 		for (int32_t i = 0; i < pbft_evidence.commits_size(); i++) {
 			const protocol::PbftEnv &env = pbft_evidence.commits(i);
 			const protocol::Pbft &pbft = env.pbft();
-			if (!CheckMessageItem(env, temp_vs)) {
+			if (!CheckMessageItem(env, temp_vs, sign_envs)) {
 				LOG_ERROR("Failed to check proof message item: validators:(%s), hash(%s), proof(%s), total_size(" FMT_SIZE "), qsize(" FMT_SIZE "), counter(" FMT_I64 ")", 
 					Proto2Json(validators).toFastString().c_str(), utils::String::BinToHexString(previous_value_hash).c_str(), 
 					Proto2Json(pbft_evidence).toFastString().c_str(),
@@ -1779,6 +1896,12 @@ namespace bumo {
 			temp_vs.erase(address);
 		}
 
+		if (!CheckSignatures(sign_envs)) {
+			LOG_ERROR("Failed to check proof signatures: hash(%s), total_size(" FMT_SIZE "), qsize(" FMT_SIZE ")",
+				utils::String::BinToHexString(previous_value_hash).c_str(), total_size, qsize);
+			return false;
+		}
+
 		if (total_size - temp_vs.size() >= qsize) {
 			return true;
 		}
@@ -16,15 +16,22 @@
 #ifndef PBFT_H_
 #define PBFT_H_
 
+#include <utils/lrucache.hpp>
 #include "consensus.h"
 #include "bft_instance.h"
 
 namespace bumo {
 
+	typedef std::vector<const protocol::PbftEnv *> PbftEnvRefVector;
+
 	class Pbft : public Consensus {
 		friend class PbftInstance;
 		friend class PbftVcInstance;
 	private:
+		//Signatures that have been verified, keyed by message hash, signature and public key
+		static utils::Mutex verified_sign_lock_;
+		static cache::lru_cache<std::string, bool> verified_signs_;
+
 		//For pbft instance
 		PbftInstanceMap instances_;
 		int64_t view_number_;
@@ -65,15 +72,23 @@ namespace bumo {
 		bool OnNewView(const protocol::PbftEnv &pbft);
 
 		static bool CheckViewChangeWithRawValue(const protocol::PbftViewChangeWithRawValue &view_change, const ValidatorMap &validators);
+		static bool CheckViewChangeWithRawValue(const protocol::PbftViewChangeWithRawValue &view_change, const ValidatorMap &validators, PbftEnvRefVector &sign_envs);
 		bool CreateViewChangeParam(const PbftVcInstance &vc_instance, std::map<int64_t, protocol::PbftEnv> &pre_prepares);
 		bool ProcessQuorumViewChange(PbftVcInstance &vc_instance);
 
-		PbftInstance *CreateInstanceIfNotExist(const protocol::PbftEnv &env);
+		PbftInstance *CreateInstanceIfNotExist(const PbftEnvPointer &env_pointer);
 		bool InWaterMark(int64_t seq);
 		bool TryExecuteValue();
+		void RecheckNextValue();
 		static protocol::PbftMessageType GetMessageType(const protocol::PbftEnv &env);
 		bool CheckMessageItem(const protocol::PbftEnv &env);
 		static bool CheckMessageItem(const protocol::PbftEnv &env, const ValidatorMap &validators);
+		//Check the message without its signature, and append the envs whose signatures should be verified to sign_envs
+		static bool CheckMessageItem(const protocol::PbftEnv &env, const ValidatorMap &validators, PbftEnvRefVector &sign_envs);
+		//Verify the signatures of the envs in parallel, the verified ones are cached
+		static bool CheckSignatures(const PbftEnvRefVector &sign_envs);
+		static bool CheckSignature(const protocol::PbftEnv &env);
+		static bool CheckSignature(const protocol::PbftEnv &env, const std::string &pbft_data);
 		bool TraceOutPbftCommit(const protocol::PbftEnv &env);
 		bool TraceOutPbftPrePrepare(const protocol::PbftEnv &env);
 		void TryDoTraceOut(const PbftInstanceIndex &index, const PbftInstance &instance);
@@ -83,7 +83,7 @@ namespace bumo {
 
 		bool doret = false;
 		while (msg_buf_[phase_].size() > phase_item_) {
-			const protocol::PbftEnv &env = msg_buf_[phase_][phase_item_++];
+			const protocol::PbftEnv &env = *msg_buf_[phase_][phase_item_++];
 			const protocol::Pbft &pbft = env.pbft();
 
 			switch (pbft.type()) {
@@ -115,7 +115,7 @@ namespace bumo {
 	}
 
 	bool PbftInstance::SendPrepareAgain(Pbft *pbft, int64_t current_time) {
-		PbftEnvPointer new_ptr = pbft->IncPeerMessageRound(pre_prepare_msg_, ++pre_prepare_round_);
+		PbftEnvPointer new_ptr = pbft->IncPeerMessageRound(*pre_prepare_msg_, ++pre_prepare_round_);
 		pbft->SendMessage(new_ptr);
 		SetLastProposeTime(current_time);
 
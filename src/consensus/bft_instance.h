@@ -22,10 +22,10 @@ namespace bumo {
 	typedef std::map<int64_t, protocol::PbftPrepare> PbftPrepareMap; //replica id => message
 	typedef std::map<int64_t, protocol::PbftCommit> PbftCommitMap; //replica id => message
 	typedef std::map<int64_t, protocol::PbftViewChange> PbftViewChangeMap; //replica id => message
-	typedef std::vector<protocol::PbftEnv> PbftPhaseVector;
-	typedef std::vector<PbftPhaseVector> PbftPhaseVector2;
-
+	//The buffered messages share the env parsed once on receiving, they must not be modified
 	typedef std::shared_ptr<protocol::PbftEnv> PbftEnvPointer;
+	typedef std::vector<PbftEnvPointer> PbftPhaseVector;
+	typedef std::vector<PbftPhaseVector> PbftPhaseVector2;
 
 	const int64_t g_pbft_vcinstance_timeout_ = 60 * utils::MICRO_UNITS_PER_SEC;
 	const int64_t g_pbft_instance_timeout_ = 30 * utils::MICRO_UNITS_PER_SEC;
@@ -72,7 +72,7 @@ namespace bumo {
 		PbftCommitMap commits_;
 
 		PbftPhaseVector2 msg_buf_;
-		protocol::PbftEnv pre_prepare_msg_;
+		PbftEnvPointer pre_prepare_msg_;
 
 		int64_t start_time_;
 		int64_t end_time_;
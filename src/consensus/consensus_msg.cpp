@@ -18,12 +18,23 @@
 #include "consensus_msg.h"
 
 namespace bumo {
-	ConsensusMsg::ConsensusMsg(const protocol::PbftEnv &pbft_env) :pbft_env_(pbft_env) {
+	ConsensusMsg::ConsensusMsg(const protocol::PbftEnv &pbft_env) :pbft_env_(std::make_shared<protocol::PbftEnv>(pbft_env)) {
 		type_ = "pbft";
-		seq_ = Pbft::GetSeq(pbft_env_);
-		values_ = Pbft::GetValue(pbft_env_);
-		node_address_ = Pbft::GetNodeAddress(pbft_env_);
-		hash_ = HashWrapper::Crypto(pbft_env_.SerializeAsString());
+		seq_ = Pbft::GetSeq(*pbft_env_);
+		node_address_ = Pbft::GetNodeAddress(*pbft_env_);
+		signed_data_ = std::make_shared<std::string>(pbft_env_->pbft().SerializeAsString());
+		std::string env_data = pbft_env_->SerializeAsString();
+		hash_ = HashWrapper::Crypto(env_data);
+		size_ = env_data.size();
+	};
+
+	ConsensusMsg::ConsensusMsg(const std::shared_ptr<protocol::PbftEnv> &pbft_env, const std::string &env_data) :pbft_env_(pbft_env) {
+		type_ = "pbft";
+		seq_ = Pbft::GetSeq(*pbft_env_);
+		node_address_ = Pbft::GetNodeAddress(*pbft_env_);
+		signed_data_ = std::make_shared<std::string>(pbft_env_->pbft().SerializeAsString());
+		hash_ = HashWrapper::Crypto(env_data);
+		size_ = env_data.size();
 	};
 
 	ConsensusMsg::~ConsensusMsg() {}
@@ -42,7 +53,7 @@ namespace bumo {
 	}
 
 	std::vector<std::string> ConsensusMsg::GetValues() const {
-		return values_;
+		return Pbft::GetValue(*pbft_env_);
 	}
 
 	const char *ConsensusMsg::GetNodeAddress() const{
@@ -53,15 +64,23 @@ namespace bumo {
 		return type_;
 	}
 
-	protocol::PbftEnv ConsensusMsg::GetPbft() const{
+	const protocol::PbftEnv &ConsensusMsg::GetPbft() const{
+		return *pbft_env_;
+	}
+
+	const std::shared_ptr<protocol::PbftEnv> &ConsensusMsg::GetPbftPointer() const{
 		return pbft_env_;
 	}
 
+	const std::string &ConsensusMsg::GetSignedData() const{
+		return *signed_data_;
+	}
+
 	std::string  ConsensusMsg::GetHash() const {
 		return hash_;
 	}
 
 	size_t ConsensusMsg::GetSize() const {
-		return (size_t)pbft_env_.ByteSize();
+		return size_;
 	}
 }
\ No newline at end of file
@@ -22,13 +22,18 @@ namespace bumo {
 	class ConsensusMsg {
 		int64_t seq_;
 		std::string type_;
-		protocol::PbftEnv pbft_env_;
-		std::vector<std::string> values_;
+		//Shared by the copies of the message, and by the pbft instance buffering it
+		std::shared_ptr<protocol::PbftEnv> pbft_env_;
+		//The serialized pbft which the signature covers, serialized once when the message is built
+		std::shared_ptr<std::string> signed_data_;
 		std::string node_address_;
 		std::string hash_;
+		size_t size_;
 	public:
 		ConsensusMsg() {}
 		ConsensusMsg(const protocol::PbftEnv &pbft_env);
+		//The env has been parsed from env_data, so the hash is taken from the data without serializing again
+		ConsensusMsg(const std::shared_ptr<protocol::PbftEnv> &pbft_env, const std::string &env_data);
 		~ConsensusMsg();
 
 		bool operator < (const ConsensusMsg &msg) const;
@@ -37,7 +42,9 @@ namespace bumo {
 		std::vector<std::string> GetValues() const;
 		const char *GetNodeAddress() const;
 		std::string GetType() const;
-		protocol::PbftEnv  GetPbft() const;
+		const protocol::PbftEnv &GetPbft() const;
+		const std::shared_ptr<protocol::PbftEnv> &GetPbftPointer() const;
+		const std::string &GetSignedData() const;
 		std::string  GetHash() const;
 		size_t GetSize() const;
 	};
@@ -88,7 +88,6 @@ namespace bumo {
 		LOG_INFO("The current node is the leader node and starting consensus processing.");
 
 		protocol::LedgerHeader lcl = LedgerManager::Instance().GetLastClosedLedger();
-		protocol::TransactionEnvSet txset_raw = tx_pool_->TopTransaction(Configure::Instance().ledger_configure_.max_trans_per_ledger_);
 
 		int64_t next_close_time = utils::Timestamp::Now().timestamp();
 		if (next_close_time < lcl.close_time() + Configure::Instance().ledger_configure_.close_interval_) {
@@ -109,18 +108,36 @@ namespace bumo {
 			}
 		}
 
+		std::string pipelined_value;
+		if (TakePipelinedProposal(lcl, pipelined_value)) {
+			LOG_INFO("Take the pipelined proposal, value(%s), and the last ledger's hash is %s.", DescConsensusValue(pipelined_value).c_str(),
+				utils::String::Bin4ToHexString(lcl.hash()).c_str());
+			return consensus_->Request(pipelined_value);
+		}
+
+		protocol::ConsensusValue propose_value;
+		BuildProposal(lcl, next_close_time, propose_value);
+
+		LOG_INFO("The number of transactions in the proposal is %d, and the last ledger's hash is %s.", propose_value.txset().txs_size(),
+			utils::String::Bin4ToHexString(lcl.hash()).c_str());
+		consensus_->Request(propose_value.SerializeAsString());
+		return true;
+	}
+
+	bool GlueManager::BuildProposal(const protocol::LedgerHeader &lcl, int64_t close_time, protocol::ConsensusValue &propose_value) {
+		protocol::TransactionEnvSet txset_raw = tx_pool_->TopTransaction(Configure::Instance().ledger_configure_.max_trans_per_ledger_);
+
 		// Get previous block proof
 		std::string proof;
 		Storage::Instance().account_db()->Get(General::LAST_PROOF, proof);
 
-		protocol::ConsensusValue propose_value;
 		do {
+			propose_value.Clear();
 			*propose_value.mutable_txset() = txset_raw;
-			propose_value.set_close_time(next_close_time);
+			propose_value.set_close_time(close_time);
 			propose_value.set_ledger_seq(lcl.seq() + 1);
 			propose_value.set_previous_ledger_hash(lcl.hash());
 			propose_value.set_previous_proof(proof);
-
 			//Check whether we need to upgrade the ledger.
 			protocol::ValidatorSet validator_set;
 			size_t quorum_size = 0;
@@ -180,47 +197,130 @@ namespace bumo {
 			break;
 		} while (true);
 
-		LOG_INFO("The number of transactions in the proposal is %d, and the last ledger's hash is %s.", propose_value.txset().txs_size(),
-			utils::String::Bin4ToHexString(lcl.hash()).c_str());
-		consensus_->Request(propose_value.SerializeAsString());
 		return true;
 	}
 
-	bool GlueManager::OnTransaction(TransactionFrm::pointer tx, Result &err) {
-		std::string hash_value = tx->GetContentHash();
-		std::string address = tx->GetSourceAddress();
+	void GlueManager::BuildPipelinedProposal() {
+		if (!consensus_->IsLeader()) {
+			return;
+		}
+
+		//The close time is fixed here, so the value is pre-executed with the block time replicas will see
+		protocol::LedgerHeader lcl = LedgerManager::Instance().GetLastClosedLedger();
+		int64_t close_time = lcl.close_time() + Configure::Instance().ledger_configure_.close_interval_;
+		if (close_time < utils::Timestamp::Now().timestamp()) {
+			close_time = utils::Timestamp::Now().timestamp();
+		}
 
+		protocol::ConsensusValue propose_value;
+		BuildProposal(lcl, close_time, propose_value);
+
+		LOG_INFO("Built pipelined proposal for ledger(" FMT_I64 "), the number of transactions is %d.",
+			propose_value.ledger_seq(), propose_value.txset().txs_size());
+		utils::MutexGuard guard(lock_);
+		pipelined_value_ = propose_value.SerializeAsString();
+	}
+
+	bool GlueManager::TakePipelinedProposal(const protocol::LedgerHeader &lcl, std::string &value) {
 		do {
-			if (tx_pool_->IsExist(tx->GetContentHash())){
-				//Break when a transaction is replayed;
-				err.set_code(protocol::ERRCODE_ALREADY_EXIST);
-				err.set_desc(utils::String::Format("Received duplicate transaction message. The transaction's source address is %s, and hash is %s", address.c_str(), utils::String::Bin4ToHexString(hash_value).c_str()));
+			utils::MutexGuard guard(lock_);
+			value.swap(pipelined_value_);
+			pipelined_value_.clear();
+		} while (false);
+
+		if (value.empty()) {
+			return false;
+		}
+
+		//Abort the proposal if it does not extend the last closed ledger any more, or it has been waiting too long
+		protocol::ConsensusValue propose_value;
+		int64_t now = utils::Timestamp::Now().timestamp();
+		if (!propose_value.ParseFromString(value) ||
+			propose_value.ledger_seq() != lcl.seq() + 1 ||
+			propose_value.previous_ledger_hash() != lcl.hash() ||
+			now - propose_value.close_time() > Configure::Instance().ledger_configure_.close_interval_ ||
+			CheckValueHelper(propose_value, now) != Consensus::CHECK_VALUE_VALID) {
+			LOG_INFO("Discard the pipelined proposal, value(%s), last closed ledger(" FMT_I64 ")",
+				DescConsensusValue(value).c_str(), lcl.seq());
+			value.clear();
+			return false;
+		}
+
+		return true;
+	}
+
+	bool GlueManager::OnTransaction(TransactionFrm::pointer tx, Result &err) {
+		std::vector<Result> results;
+		OnTransactions(std::vector<TransactionFrm::pointer>(1, tx), results);
+		err = results[0];
+		return err.code() == protocol::ERRCODE_SUCCESS;
+	}
+
+	void GlueManager::OnTransactions(const std::vector<TransactionFrm::pointer> &txs, std::vector<Result> &results) {
+		results.assign(txs.size(), Result());
+
+		//Group by source account, a transaction replayed in the queue or in the batch is answered at once
+		std::unordered_map<std::string, std::vector<size_t>> accounts;
+		std::unordered_set<std::string> hashes;
+		for (size_t i = 0; i < txs.size(); i++) {
+			const TransactionFrm::pointer &tx = txs[i];
+			std::string hash_value = tx->GetContentHash();
+			if (!hashes.insert(hash_value).second || tx_pool_->IsExist(hash_value)) {
+				std::string address = tx->GetSourceAddress();
+				results[i].set_code(protocol::ERRCODE_ALREADY_EXIST);
+				results[i].set_desc(utils::String::Format("Received duplicate transaction message. The transaction's source address is %s, and hash is %s", address.c_str(), utils::String::Bin4ToHexString(hash_value).c_str()));
 				LOG_TRACE("Received duplicate transation message. The transaction's source address is %s, and hash is %s.", address.c_str(), utils::String::Bin4ToHexString(hash_value).c_str());
-				break;
+				continue;
 			}
+			accounts[tx->GetSourceAddress()].push_back(i);
+		}
 
-			//Validate a transaction upon received.
-			int64_t nonce = 0;
-			if (!tx->CheckValid(/*high_sequence*/ -1, true, nonce)) {
-				err = tx->GetResult();
-				Json::Value js;
-				js["action"] = "apply";
-				js["error_code"] = err.code();
-				js["desc"] = err.desc();
-				LOG_ERROR("Transaction verification failed. The transaction's source address: %s, nonce: (" FMT_I64 "), hash: %s, return value: %s.",
-					address.c_str(), tx->GetNonce(), utils::String::Bin4ToHexString(hash_value).c_str(), js.toFastString().c_str());
-				break;
-			}
+		std::vector<TransactionFrm::pointer> valid_txs;
+		std::vector<int64_t> nonces;
+		std::vector<size_t> indexes;
+		for (auto iter = accounts.begin(); iter != accounts.end(); iter++) {
+			//Validate the transactions of an account in nonce order against one load of it
+			std::vector<size_t> &group = iter->second;
+			std::stable_sort(group.begin(), group.end(), [&txs](size_t first, size_t second) {
+				return txs[first]->GetNonce() < txs[second]->GetNonce();
+			});
+
+			AccountFrm::pointer source_account;
+			Environment::AccountFromDB(iter->first, source_account);
+			for (size_t j = 0; j < group.size(); j++) {
+				const TransactionFrm::pointer &tx = txs[group[j]];
+				int64_t nonce = 0;
+				if (!tx->CheckValid(/*high_sequence*/ -1, true, nonce, source_account)) {
+					Result &err = results[group[j]];
+					err = tx->GetResult();
+					Json::Value js;
+					js["action"] = "apply";
+					js["error_code"] = err.code();
+					js["desc"] = err.desc();
+					LOG_ERROR("Transaction verification failed. The transaction's source address: %s, nonce: (" FMT_I64 "), hash: %s, return value: %s.",
+						iter->first.c_str(), tx->GetNonce(), utils::String::Bin4ToHexString(tx->GetContentHash()).c_str(), js.toFastString().c_str());
+					continue;
+				}
 
-			if (!tx_pool_->Import(tx, nonce, err)) {
-				LOG_ERROR("Failed to insert transaction into transaction queue. The transaction's source address: %s, hash: %s.",
-					address.c_str(), utils::String::Bin4ToHexString(hash_value).c_str());
+				valid_txs.push_back(tx);
+				nonces.push_back(nonce);
+				indexes.push_back(group[j]);
 			}
+		}
 
-		} while (false);
-
+		if (valid_txs.empty()) {
+			return;
+		}
 
-		return err.code() == protocol::ERRCODE_SUCCESS;
+		std::vector<Result> import_results(valid_txs.size());
+		tx_pool_->Import(valid_txs, nonces, import_results);
+		for (size_t i = 0; i < valid_txs.size(); i++) {
+			if (import_results[i].code() != protocol::ERRCODE_SUCCESS) {
+				LOG_ERROR("Failed to insert transaction into transaction queue. The transaction's source address: %s, hash: %s.",
+					valid_txs[i]->GetSourceAddress().c_str(), utils::String::Bin4ToHexString(valid_txs[i]->GetContentHash()).c_str());
+				results[indexes[i]] = import_results[i];
+			}
+		}
 	}
 
 	bool GlueManager::OnConsensus(const ConsensusMsg &msg) {
@@ -281,6 +381,9 @@ namespace bumo {
 
 		//Delete the cache 
 		tx_pool_->RemoveTxs(req.txset(),true);
+		if (consensus_->IsValidator()) {
+			speculative_checker_.Start(tx_pool_, req.ledger_seq(), Configure::Instance().ledger_configure_.max_trans_per_ledger_);
+		}
 
 		//Start calculating the time to start the next block.
 		int64_t next_interval = GetIntervalTime(req.txset().txs_size() == 0);
@@ -288,6 +391,13 @@ namespace bumo {
 		int64_t seq = req.ledger_seq();
 
 		Global::Instance().GetIoService().post([next_timestamp, time_use, seq, this]() {
+			//Pre-execute the next proposal against the new state while waiting for its close time
+			if (Configure::Instance().ledger_configure_.pipeline_enabled_ &&
+				consensus_->IsLeader() &&
+				next_timestamp > utils::Timestamp::Now().timestamp()) {
+				BuildPipelinedProposal();
+			}
+
 			int64_t waiting_time = next_timestamp - utils::Timestamp::Now().timestamp();
 			if (waiting_time <= 0)  waiting_time = 1;
 
@@ -313,6 +423,10 @@ namespace bumo {
 
 	void GlueManager::OnViewChanged(const std::string &last_consvalue) {
 		LOG_INFO("On view changed.");
+		do {
+			utils::MutexGuard guard(lock_);
+			pipelined_value_.clear();
+		} while (false);
 		StartConsensus(last_consvalue);
 		StartLedgerCloseTimer();
 	}
@@ -459,9 +573,9 @@ namespace bumo {
 		Global::Instance().GetIoService().post([this, message] (){
 			PeerManager::Instance().Broadcast(protocol::OVERLAY_MSGTYPE_PBFT, message);
 
-			protocol::PbftEnv env;
-			env.ParseFromString(message);
-			ConsensusMsg msg(env);
+			std::shared_ptr<protocol::PbftEnv> env = std::make_shared<protocol::PbftEnv>();
+			env->ParseFromString(message);
+			ConsensusMsg msg(env, message);
 			LOG_INFO("Received consensus message from self. Node address(%s), sequence(" FMT_I64 "), pbft type(%s)",
 				msg.GetNodeAddress(), msg.GetSeq(),PbftDesc::GetMessageTypeDesc(msg.GetPbft().pbft().type()));
 			consensus_->OnRecv(msg);
@@ -512,6 +626,10 @@ namespace bumo {
 		return tx_pool_->Size();
 	}
 
+	std::shared_ptr<PreAppliedTxs> GlueManager::TakePreAppliedTxs(int64_t ledger_seq) {
+		return speculative_checker_.Take(ledger_seq);
+	}
+
 	void GlueManager::QueryTransactionCache(const uint32_t& num, std::vector<TransactionFrm::pointer>& txs){
 		tx_pool_->Query(num,txs);
 	}
@@ -23,6 +23,7 @@
 #include <consensus/consensus_manager.h>
 #include "transaction_queue.h"
 #include "ledger_upgrade.h"
+#include "speculative_checker.h"
 
 namespace bumo {
 
@@ -49,9 +50,18 @@ namespace bumo {
 		//For ledger upgrade
 		LedgerUpgrade ledger_upgrade_;
 
+		//For pipelined consensus, the next proposal built against the post-state of the last closed ledger
+		std::string pipelined_value_;
+
+		//Removes the pooled transactions that fail against the last closed ledger and pre-applies the others before the next proposal
+		SpeculativeChecker speculative_checker_;
+
 		bool LoadLastLedger();
 		bool CreateGenesisLedger();
 		void StartLedgerCloseTimer();
+		bool BuildProposal(const protocol::LedgerHeader &lcl, int64_t close_time, protocol::ConsensusValue &propose_value);
+		void BuildPipelinedProposal();
+		bool TakePipelinedProposal(const protocol::LedgerHeader &lcl, std::string &value);
 	public:
 		GlueManager();
 		~GlueManager();
@@ -63,6 +73,8 @@ namespace bumo {
 		int64_t GetIntervalTime(bool empty_block);
 
 		bool OnTransaction(TransactionFrm::pointer tx, Result &err);
+		//Admits a batch, the source account of each group is loaded once and the queue imports them together
+		void OnTransactions(const std::vector<TransactionFrm::pointer> &txs, std::vector<Result> &results);
 		bool OnConsensus(const ConsensusMsg &msg);
 		void NotifyErrTx(std::vector<TransactionFrm::pointer> &txs);
 
@@ -80,6 +92,8 @@ namespace bumo {
 		size_t GetTransactionCacheSize();
 		void QueryTransactionCache(const uint32_t& num, std::vector<TransactionFrm::pointer>& txs);
 		bool QueryTransactionCache(const std::string& hash, TransactionFrm::pointer& tx);
+		//Called by the proposer, NULL unless the transactions were pre-applied on the ledger
+		std::shared_ptr<PreAppliedTxs> TakePreAppliedTxs(int64_t ledger_seq);
 
 		virtual void OnTimer(int64_t current_time) override;
 		virtual void OnSlowTimer(int64_t current_time) override {};
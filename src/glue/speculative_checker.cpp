@@ -0,0 +1,134 @@
+/*
+	bumo is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	bumo is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with bumo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <common/general.h>
+#include <ledger/ledger_manager.h>
+#include "speculative_checker.h"
+
+namespace bumo {
+	SpeculativeChecker::SpeculativeChecker() : running_(false){}
+
+	SpeculativeChecker::~SpeculativeChecker(){}
+
+	void SpeculativeChecker::Start(std::shared_ptr<TransactionQueue> tx_pool, int64_t ledger_seq, uint32_t limit){
+		bool expected = false;
+		if (!running_.compare_exchange_strong(expected, true)){
+			return;
+		}
+
+		if (!ParallelWorker::Instance().Post([this, tx_pool, ledger_seq, limit](){
+			Run(tx_pool, ledger_seq, limit);
+			running_ = false;
+		})){
+			running_ = false;
+		}
+	}
+
+	std::shared_ptr<PreAppliedTxs> SpeculativeChecker::Take(int64_t ledger_seq){
+		std::shared_ptr<PreAppliedTxs> pre_applied;
+		utils::MutexGuard guard(pre_applied_lock_);
+		pre_applied.swap(pre_applied_);
+		if (pre_applied && pre_applied->ledger_seq_ != ledger_seq){
+			pre_applied.reset();
+		}
+		return pre_applied;
+	}
+
+	void SpeculativeChecker::Run(std::shared_ptr<TransactionQueue> tx_pool, int64_t ledger_seq, uint32_t limit){
+		int64_t time_start = utils::Timestamp::HighResolution();
+		std::vector<TransactionFrm::pointer> txs;
+		tx_pool->TopTransaction(limit, &txs);
+
+		//The source accounts are read in the proposal order, which also loads them into the account cache before the proposal is executed
+		std::unordered_map<std::string, AccountFrm::pointer> sources;
+		std::vector<TransactionFrm::pointer> failed;
+		std::vector<TransactionFrm::pointer> heads;
+		uint32_t bad_nonce_count = 0;
+		uint32_t bad_signature_count = 0;
+		for (size_t i = 0; i < txs.size(); i++){
+			const TransactionFrm::pointer &tx = txs[i];
+			std::string address = tx->GetSourceAddress();
+			auto iter = sources.find(address);
+			if (iter == sources.end()){
+				AccountFrm::pointer account;
+				Environment::AccountFromDB(address, account);
+				iter = sources.insert(std::make_pair(address, account)).first;
+			}
+
+			//The account may be created by an earlier transaction of the next ledger
+			const AccountFrm::pointer &account = iter->second;
+			if (!account){
+				continue;
+			}
+
+			//The account nonce never goes back, so the transaction can not be applied in any later ledger
+			int64_t account_nonce = account->GetAccountNonce();
+			if (tx->GetNonce() <= account_nonce){
+				failed.push_back(tx);
+				bad_nonce_count++;
+				continue;
+			}
+
+			//Only the first transaction of an account is checked against the signers, an earlier transaction of the same account may change them
+			if (tx->GetNonce() == account_nonce + 1){
+				if (!tx->SignerHashPriv(account, -1)){
+					failed.push_back(tx);
+					bad_signature_count++;
+				}
+				else{
+					heads.push_back(tx);
+				}
+			}
+		}
+
+		//A newer ledger may have changed the signers, leave its transactions to the next check
+		if (LedgerManager::Instance().GetLastClosedLedger().seq() != ledger_seq){
+			LOG_INFO("Discard the speculative check of ledger(" FMT_I64 "), a newer ledger has been closed", ledger_seq);
+			return;
+		}
+
+		if (!failed.empty()){
+			tx_pool->RemoveTxs(failed);
+		}
+
+		LOG_INFO("Speculative check of ledger(" FMT_I64 ") done, checked(" FMT_SIZE "), bad nonce(%u), bad signature(%u), time used(" FMT_I64 ")us",
+			ledger_seq, txs.size(), bad_nonce_count, bad_signature_count, utils::Timestamp::HighResolution() - time_start);
+
+		if (!Configure::Instance().ledger_configure_.speculative_apply_enabled_ || heads.empty()){
+			return;
+		}
+
+		//A later transaction of an account depends on the earlier ones being proposed, only the first one is applied on the ledger
+		time_start = utils::Timestamp::HighResolution();
+		std::shared_ptr<PreAppliedTxs> pre_applied = std::make_shared<PreAppliedTxs>();
+		pre_applied->ledger_seq_ = ledger_seq;
+		pre_applied->ledger_ = std::make_shared<LedgerFrm>();
+		pre_applied->ledger_->PreApply(heads, pre_applied->txs_);
+
+		//The states read may belong to a newer ledger
+		if (LedgerManager::Instance().GetLastClosedLedger().seq() != ledger_seq){
+			LOG_INFO("Discard the transactions pre-applied on ledger(" FMT_I64 "), a newer ledger has been closed", ledger_seq);
+			return;
+		}
+
+		do{
+			utils::MutexGuard guard(pre_applied_lock_);
+			pre_applied_ = pre_applied;
+		} while (false);
+
+		LOG_INFO("Pre-applied " FMT_SIZE " of " FMT_SIZE " transactions on ledger(" FMT_I64 "), time used(" FMT_I64 ")us",
+			pre_applied->txs_.size(), heads.size(), ledger_seq, utils::Timestamp::HighResolution() - time_start);
+	}
+}
@@ -0,0 +1,47 @@
+/*
+	bumo is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	bumo is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with bumo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SPECULATIVE_CHECKER_H_
+#define SPECULATIVE_CHECKER_H_
+
+#include <atomic>
+#include <ledger/ledger_frm.h>
+#include "transaction_queue.h"
+
+namespace bumo {
+	//Checks the head transactions of the pool against the last closed ledger on a worker thread while the next ledger waits for its close time.
+	//Transactions that can not pass the application check on top of that ledger are removed, so they do not take the place of valid ones in the next proposal.
+	//With speculative_apply_enabled, the first transaction of each account is then applied on that ledger, and the proposer reuses the results.
+	class SpeculativeChecker {
+	public:
+		SpeculativeChecker();
+		~SpeculativeChecker();
+
+		//Does nothing if the previous check is still running
+		void Start(std::shared_ptr<TransactionQueue> tx_pool, int64_t ledger_seq, uint32_t limit);
+
+		//Takes the transactions pre-applied on the ledger, the older ones are dropped
+		std::shared_ptr<PreAppliedTxs> Take(int64_t ledger_seq);
+	private:
+		std::atomic<bool> running_;
+
+		utils::Mutex pre_applied_lock_;
+		std::shared_ptr<PreAppliedTxs> pre_applied_;
+
+		void Run(std::shared_ptr<TransactionQueue> tx_pool, int64_t ledger_seq, uint32_t limit);
+	};
+}
+
+#endif
@@ -20,88 +20,202 @@ along with bumo.  If not, see <http://www.gnu.org/licenses/>.
 namespace bumo {
 
 	int64_t const QUEUE_TRANSACTION_TIMEOUT = 600 * utils::MICRO_UNITS_PER_SEC;
+	uint32_t const QUEUE_SHARD_COUNT = 16;
 
 	TransactionQueue::TransactionQueue(uint32_t queue_limit, uint32_t account_txs_limit)
-		: queue_(PriorityCompare{ *this }),
-		queue_limit_(queue_limit),
+		: queue_limit_(queue_limit),
 		account_txs_limit_(account_txs_limit)
 	{
+		for (uint32_t i = 0; i < QUEUE_SHARD_COUNT; i++){
+			shards_.push_back(std::make_shared<Shard>());
+		}
 	}
 
 	TransactionQueue::~TransactionQueue(){}
 
-	
-	std::pair<bool, TransactionFrm::pointer> TransactionQueue::Remove(QueueByAddressAndNonce::iterator& account_it, QueueByNonce::iterator& tx_it, bool del_empty){
-		TransactionFrm::pointer ptr = nullptr;
-		ptr = *tx_it->second.first;
-		queue_.erase(tx_it->second.first);
-		time_queue_.erase(tx_it->second.second);
-		account_it->second.erase(tx_it);
-		queue_by_hash_.erase(ptr->GetContentHash());
-
-		if (del_empty && account_it->second.empty()){
-			account_nonce_.erase(account_it->first);
-			queue_by_address_and_nonce_.erase(account_it);
+	TransactionQueue::Shard& TransactionQueue::GetShard(const std::string& account_address){
+		return *shards_[std::hash<std::string>()(account_address) % shards_.size()];
+	}
+
+	void TransactionQueue::UpdateLane(Shard& shard, AccountLane& lane){
+		if (lane.has_head_){
+			shard.head_queue_.erase(lane.head_);
+			lane.has_head_ = false;
+		}
+		if (lane.has_tail_){
+			shard.tail_queue_.erase(lane.tail_);
+			lane.has_tail_ = false;
+		}
+		if (lane.txs_.empty()){
+			return;
+		}
+
+		//The lowest nonce is executable unless there is a gap after the system nonce
+		auto first = lane.txs_.begin();
+		if (first->first <= lane.nonce_ + 1){
+			lane.head_ = shard.head_queue_.insert(first->second.first).first;
+			lane.has_head_ = true;
+		}
+		lane.tail_ = shard.tail_queue_.insert(lane.txs_.rbegin()->second.first).first;
+		lane.has_tail_ = true;
+	}
+
+	void TransactionQueue::UpdateNonce(const std::string& account_address, int64_t nonce){
+		Shard& shard = GetShard(account_address);
+		auto account_it = shard.queue_by_address_and_nonce_.find(account_address);
+		if (account_it != shard.queue_by_address_and_nonce_.end() && account_it->second.nonce_ < nonce){
+			account_it->second.nonce_ = nonce;
+			UpdateLane(shard, account_it->second);
+		}
+	}
+
+	std::pair<bool, TransactionFrm::pointer> TransactionQueue::Remove(Shard& shard, QueueByAddressAndNonce::iterator& account_it, QueueByNonce::iterator& tx_it, bool del_empty){
+		TransactionFrm::pointer ptr = tx_it->second.first;
+		shard.time_queue_.erase(tx_it->second.second);
+		account_it->second.txs_.erase(tx_it);
+		UpdateLane(shard, account_it->second);
+		{
+			utils::MutexGuard g(hash_lock_);
+			queue_by_hash_.erase(ptr->GetContentHash());
+		}
+
+		if (del_empty && account_it->second.txs_.empty()){
+			shard.queue_by_address_and_nonce_.erase(account_it);
 		}
 		return std::move(std::make_pair(true, ptr));
 	}
-	
 
-	std::pair<bool, TransactionFrm::pointer> TransactionQueue::Remove(const std::string& account_address,const int64_t& nonce){
-		TransactionFrm::pointer ptr = nullptr;
-		auto account_it =queue_by_address_and_nonce_.find(account_address);
-		if (account_it != queue_by_address_and_nonce_.end()){
-			auto tx_it = account_it->second.find(nonce);
-			if (tx_it != account_it->second.end()){
-				ptr = *tx_it->second.first;
-				queue_.erase(tx_it->second.first);
-				time_queue_.erase(tx_it->second.second);
-				account_it->second.erase(tx_it);
-				queue_by_hash_.erase(ptr->GetContentHash());
-
-				if (account_it->second.empty()){
-					queue_by_address_and_nonce_.erase(account_it);
-					account_nonce_.erase(account_address);
-				}
-				return std::move(std::make_pair(true, ptr));
+	std::pair<bool, TransactionFrm::pointer> TransactionQueue::Remove(Shard& shard, const std::string& account_address, const int64_t& nonce){
+		auto account_it = shard.queue_by_address_and_nonce_.find(account_address);
+		if (account_it != shard.queue_by_address_and_nonce_.end()){
+			auto tx_it = account_it->second.txs_.find(nonce);
+			if (tx_it != account_it->second.txs_.end()){
+				return Remove(shard, account_it, tx_it);
 			}
 		}
-		return std::move(std::make_pair(false, ptr));
+		return std::move(std::make_pair(false, TransactionFrm::pointer()));
 	}
 	
-	void TransactionQueue::Insert(TransactionFrm::pointer const& tx){
+	void TransactionQueue::Insert(Shard& shard, AccountLane& lane, TransactionFrm::pointer const& tx){
 		// Insert into the queue
-		auto inserted = queue_by_address_and_nonce_[tx->GetSourceAddress()].insert(std::make_pair(tx->GetNonce(), std::make_pair(PriorityQueue::iterator(), TimeQueue::iterator())));
-		PriorityQueue::iterator left = queue_.emplace(tx);
-		TimeQueue::iterator right = time_queue_.emplace(tx);
-		inserted.first->second.first = left;
-		inserted.first->second.second = right;
-		queue_by_hash_[tx->GetContentHash()]=tx;
+		TimeQueue::iterator time_it = shard.time_queue_.emplace(tx);
+		lane.txs_[tx->GetNonce()] = std::make_pair(tx, time_it);
+		UpdateLane(shard, lane);
+		utils::MutexGuard g(hash_lock_);
+		queue_by_hash_[tx->GetContentHash()] = tx;
+	}
+
+	bool TransactionQueue::EvictOne(TransactionFrm::pointer& evicted){
+		//Find the cheapest tail over all shards, only one shard lock is held at a time
+		TransactionFrm::pointer victim;
+		for (size_t i = 0; i < shards_.size(); i++){
+			utils::ReadLockGuard g(shards_[i]->lock_);
+			if (!shards_[i]->tail_queue_.empty()){
+				const TransactionFrm::pointer& tail = *shards_[i]->tail_queue_.begin();
+				if (!victim || EvictCompare()(tail, victim)){
+					victim = tail;
+				}
+			}
+		}
+		if (!victim){
+			return false;
+		}
+
+		//It may have been removed or replaced by another thread meanwhile, then the caller looks again
+		Shard& shard = GetShard(victim->GetSourceAddress());
+		utils::WriteLockGuard g(shard.lock_);
+		auto account_it = shard.queue_by_address_and_nonce_.find(victim->GetSourceAddress());
+		if (account_it != shard.queue_by_address_and_nonce_.end()){
+			auto tx_it = account_it->second.txs_.find(victim->GetNonce());
+			if (tx_it != account_it->second.txs_.end() && tx_it->second.first == victim){
+				evicted = Remove(shard, account_it, tx_it).second;
+			}
+		}
+		return true;
 	}
 
 	bool TransactionQueue::Import(TransactionFrm::pointer tx, const int64_t& cur_source_nonce,Result &result){
-		utils::WriteLockGuard g(lock_);
 		bool inserted = false;
+		Shard& shard = GetShard(tx->GetSourceAddress());
+		do {
+			utils::WriteLockGuard g(shard.lock_);
+			inserted = Place(shard, tx, cur_source_nonce, result);
+		} while (false);
+
+		if (inserted) {
+			std::vector<TransactionFrm::pointer> evicted;
+			EvictOverflow(evicted);
+			for (size_t i = 0; i < evicted.size(); i++) {
+				if (evicted[i]->GetContentHash() == tx->GetContentHash()) {
+					SetEvictedResult(evicted[i], result);
+					inserted = false;
+				}
+			}
+		}
+		return inserted;
+	}
+
+	size_t TransactionQueue::Import(const std::vector<TransactionFrm::pointer>& txs, const std::vector<int64_t>& cur_source_nonces, std::vector<Result>& results){
+		//Each shard is locked once for all of its transactions, in the order they are given
+		std::vector<std::vector<size_t>> shard_indexes(shards_.size());
+		for (size_t i = 0; i < txs.size(); i++) {
+			shard_indexes[std::hash<std::string>()(txs[i]->GetSourceAddress()) % shards_.size()].push_back(i);
+		}
+
+		std::unordered_map<std::string, size_t> inserted;
+		for (size_t i = 0; i < shard_indexes.size(); i++) {
+			if (shard_indexes[i].empty()) {
+				continue;
+			}
+
+			Shard& shard = *shards_[i];
+			utils::WriteLockGuard g(shard.lock_);
+			for (size_t j = 0; j < shard_indexes[i].size(); j++) {
+				size_t index = shard_indexes[i][j];
+				if (Place(shard, txs[index], cur_source_nonces[index], results[index])) {
+					inserted[txs[index]->GetContentHash()] = index;
+				}
+			}
+		}
+
+		if (!inserted.empty()) {
+			std::vector<TransactionFrm::pointer> evicted;
+			EvictOverflow(evicted);
+			for (size_t i = 0; i < evicted.size(); i++) {
+				auto iter = inserted.find(evicted[i]->GetContentHash());
+				if (iter != inserted.end()) {
+					SetEvictedResult(evicted[i], results[iter->second]);
+					inserted.erase(iter);
+				}
+			}
+		}
+		return inserted.size();
+	}
+
+	bool TransactionQueue::Place(Shard& shard, TransactionFrm::pointer const& tx, int64_t cur_source_nonce, Result &result){
 		bool replace = false;
 		uint32_t account_txs_size = 0;
 
-		account_nonce_[tx->GetSourceAddress()] = cur_source_nonce;
-
 		LOG_TRACE("Import transaction: Account address(%s), transaction hash(%s), nonce(" FMT_I64 "), gas_price(" FMT_I64 ").",
 			tx->GetSourceAddress().c_str(), utils::String::BinToHexString(tx->GetContentHash()).c_str(), tx->GetNonce(), tx->GetGasPrice());
-		auto account_it = queue_by_address_and_nonce_.find(tx->GetSourceAddress());
-		if (account_it != queue_by_address_and_nonce_.end()) {
 
-			account_txs_size = account_it->second.size();
+		auto account_it = shard.queue_by_address_and_nonce_.find(tx->GetSourceAddress());
+		if (account_it != shard.queue_by_address_and_nonce_.end()) {
+			AccountLane& lane = account_it->second;
+			if (lane.nonce_ != cur_source_nonce){
+				lane.nonce_ = cur_source_nonce;
+				UpdateLane(shard, lane);
+			}
+
+			account_txs_size = lane.txs_.size();
 
-			auto tx_it = account_it->second.find(tx->GetNonce());
-			if (tx_it != account_it->second.end()){
-				int64_t p = (*tx_it->second.first)->GetGasPrice();
+			auto tx_it = lane.txs_.find(tx->GetNonce());
+			if (tx_it != lane.txs_.end()){
+				int64_t p = tx_it->second.first->GetGasPrice();
 				if ((tx->GetGasPrice() - p)>=(p*0.1)) {
 					//You need to replace the previous transaction by deleting the previous transaction and then inserting a new transaction.
-					std::string drop_hash = (*tx_it->second.first)->GetContentHash();
-					Remove(account_it, tx_it);
-					account_nonce_[tx->GetSourceAddress()] = cur_source_nonce;
+					std::string drop_hash = tx_it->second.first->GetContentHash();
+					Remove(shard, account_it, tx_it, false);
 					replace = true;
 					account_txs_size--;
 					LOG_TRACE("Replace transaction: removing old transaction(hash: %s) from the queue, and inserting new transaction(hash: %s, account address: %s, gas_price: " FMT_I64 ", nonce: " FMT_I64 ") into the queue.",
@@ -114,52 +228,117 @@ namespace bumo {
 					LOG_ERROR("%s", error_desc.c_str());
 					result.set_code(protocol::ERRCODE_TX_INSERT_QUEUE_FAIL);
 					result.set_desc(error_desc);
-					return inserted;
+					return false;
 				}
 			}
 		}
 
 		if (replace || account_txs_size < account_txs_limit_) {
-			Insert(tx);	
-			inserted = true;
-			//todo...
-			while (queue_.size() > queue_limit_) {
-				TransactionFrm::pointer t = *queue_.rbegin();
-				Remove(t->GetSourceAddress(), t->GetNonce());
-
-				std::string error_desc = utils::String::Format("Delete the transaction at the end of the queue: transaction hash(%s), account address(%s), gas_price(" FMT_I64 "), nonce(" FMT_I64 ").", utils::String::BinToHexString(t->GetContentHash()).c_str(), t->GetSourceAddress().c_str(), t->GetGasPrice(), t->GetNonce());
-				LOG_TRACE("%s", error_desc.c_str());
-				if (t->GetContentHash() == tx->GetContentHash()){
-					result.set_code(protocol::ERRCODE_TX_INSERT_QUEUE_FAIL);
-					result.set_desc(error_desc);
-					LOG_ERROR("%s", error_desc.c_str());
-					inserted = false;
-				}
-			}
+			AccountLane& lane = shard.queue_by_address_and_nonce_[tx->GetSourceAddress()];
+			lane.nonce_ = cur_source_nonce;
+			Insert(shard, lane, tx);
+			return true;
 		}
 
-		if (account_txs_size >= account_txs_limit_){
-			inserted = false;
-			std::string error_desc = utils::String::Format("The transaction exceeds the cache limit for each account in the queue: transaction hash(%s), account address(%s), gas_price(" FMT_I64 "), nonce(" FMT_I64 ").", utils::String::BinToHexString(tx->GetContentHash()).c_str(), tx->GetSourceAddress().c_str(), tx->GetGasPrice(), tx->GetNonce());
-			result.set_code(protocol::ERRCODE_TX_INSERT_QUEUE_FAIL);
-			result.set_desc(error_desc);
-			LOG_ERROR("%s", error_desc.c_str());
+		std::string error_desc = utils::String::Format("The transaction exceeds the cache limit for each account in the queue: transaction hash(%s), account address(%s), gas_price(" FMT_I64 "), nonce(" FMT_I64 ").", utils::String::BinToHexString(tx->GetContentHash()).c_str(), tx->GetSourceAddress().c_str(), tx->GetGasPrice(), tx->GetNonce());
+		result.set_code(protocol::ERRCODE_TX_INSERT_QUEUE_FAIL);
+		result.set_desc(error_desc);
+		LOG_ERROR("%s", error_desc.c_str());
+		return false;
+	}
+
+	void TransactionQueue::EvictOverflow(std::vector<TransactionFrm::pointer>& evicted){
+		while (Size() > queue_limit_) {
+			TransactionFrm::pointer t;
+			if (!EvictOne(t)){
+				break;
+			}
+			if (!t){
+				continue;
+			}
+
+			LOG_TRACE("Delete the transaction at the end of the queue: transaction hash(%s), account address(%s), gas_price(" FMT_I64 "), nonce(" FMT_I64 ").",
+				utils::String::BinToHexString(t->GetContentHash()).c_str(), t->GetSourceAddress().c_str(), t->GetGasPrice(), t->GetNonce());
+			evicted.push_back(t);
 		}
+	}
 
-		return inserted;
+	void TransactionQueue::SetEvictedResult(TransactionFrm::pointer const& tx, Result &result){
+		std::string error_desc = utils::String::Format("Delete the transaction at the end of the queue: transaction hash(%s), account address(%s), gas_price(" FMT_I64 "), nonce(" FMT_I64 ").", utils::String::BinToHexString(tx->GetContentHash()).c_str(), tx->GetSourceAddress().c_str(), tx->GetGasPrice(), tx->GetNonce());
+		result.set_code(protocol::ERRCODE_TX_INSERT_QUEUE_FAIL);
+		result.set_desc(error_desc);
+		LOG_ERROR("%s", error_desc.c_str());
 	}
 
-	protocol::TransactionEnvSet TransactionQueue::TopTransaction(uint32_t limit){
+	void TransactionQueue::SelectTop(Shard& shard, uint32_t limit, std::vector<TransactionFrm::pointer>& txs){
+		utils::ReadLockGuard g(shard.lock_);
+
+		//Merge the executable heads with the successors of the transactions already taken, so the cost depends on the limit rather than the queue size.
+		PriorityQueue successors;
+		auto head = shard.head_queue_.begin();
+		while (txs.size() < limit) {
+			TransactionFrm::pointer tx;
+			if (head != shard.head_queue_.end() && (successors.empty() || PriorityCompare()(*head, *successors.begin()))) {
+				tx = *head;
+				++head;
+			}
+			else if (!successors.empty()) {
+				tx = *successors.begin();
+				successors.erase(successors.begin());
+			}
+			else {
+				break;
+			}
+
+			txs.push_back(tx);
+
+			auto account_it = shard.queue_by_address_and_nonce_.find(tx->GetTransactionEnv().transaction().source_address());
+			if (account_it != shard.queue_by_address_and_nonce_.end()) {
+				const QueueByNonce& lane_txs = account_it->second.txs_;
+				auto next = lane_txs.upper_bound(tx->GetNonce());
+				if (next != lane_txs.end() && next->first <= tx->GetNonce() + 1) {
+					successors.insert(next->second.first);
+				}
+			}
+		}
+	}
+
+	protocol::TransactionEnvSet TransactionQueue::TopTransaction(uint32_t limit, std::vector<TransactionFrm::pointer>* txs){
 		protocol::TransactionEnvSet set;
-		std::unordered_map<std::string, int64_t> topic_seqs;
-		std::unordered_map<std::string, int64_t> break_nonce_accounts;
-		int64_t last_block_seq = LedgerManager::Instance().GetLastClosedLedger().seq();
-		utils::WriteLockGuard g(lock_);
 		uint32_t i = 0;
 		int64_t set_size = 0;
-		
-		for (auto t = queue_.begin(); set.txs().size() < limit && t != queue_.end(); ++t) {
-			const TransactionFrm::pointer& tx = *t;
+
+		//Each shard is locked only while its own candidates are selected. An account lives in one shard, so its nonce order holds.
+		//Start with a share of the limit from every shard and select more from a shard only when its share runs out.
+		std::vector<std::vector<TransactionFrm::pointer>> candidates(shards_.size());
+		std::vector<uint32_t> quotas(shards_.size(), std::min<uint32_t>(limit, 2 * limit / shards_.size() + 1));
+		std::vector<size_t> cursors(shards_.size(), 0);
+		for (size_t n = 0; n < shards_.size(); n++){
+			SelectTop(*shards_[n], quotas[n], candidates[n]);
+		}
+
+		while (set.txs().size() < limit) {
+			int32_t best = -1;
+			for (size_t n = 0; n < candidates.size(); n++){
+				if (cursors[n] < candidates[n].size() &&
+					(best < 0 || PriorityCompare()(candidates[n][cursors[n]], candidates[best][cursors[best]]))){
+					best = n;
+				}
+			}
+			if (best < 0){
+				break;
+			}
+			TransactionFrm::pointer tx = candidates[best][cursors[best]++];
+
+			if (cursors[best] == candidates[best].size() && candidates[best].size() == quotas[best] && quotas[best] < limit){
+				quotas[best] = std::min<uint32_t>(limit, quotas[best] * 2);
+				std::vector<TransactionFrm::pointer> more;
+				SelectTop(*shards_[best], quotas[best], more);
+				//Continue only if the shard has not changed the part already taken
+				if (more.size() >= cursors[best] && std::equal(candidates[best].begin(), candidates[best].end(), more.begin())){
+					candidates[best].swap(more);
+				}
+			}
 
 			if (i + set_size + tx->GetTransactionEnv().ByteSize() >= General::TXSET_LIMIT_SIZE){
 				if (set.ByteSize() + tx->GetTransactionEnv().ByteSize() >= General::TXSET_LIMIT_SIZE)
@@ -167,37 +346,13 @@ namespace bumo {
 			}
 
 			set_size += tx->GetTransactionEnv().ByteSize();
-			
-			if (break_nonce_accounts.find(tx->GetSourceAddress()) == break_nonce_accounts.end()) {
-
-				int64_t last_seq = 0;
-				do {
-					//Find this cache
-					auto this_iter = topic_seqs.find(tx->GetSourceAddress());
-					if (this_iter != topic_seqs.end()) {
-						last_seq = this_iter->second;
-						break;
-					}
-
-					last_seq = account_nonce_[tx->GetSourceAddress()];
-
-				} while (false);
-
-				if (tx->GetNonce() > last_seq + 1) {
-					break_nonce_accounts[tx->GetSourceAddress()] = last_seq + 1;
-					continue;
-				}
-
-				topic_seqs[tx->GetSourceAddress()] = tx->GetNonce();
-
-				*set.add_txs() = tx->GetProtoTxEnv();
-
-				i++;
-				//LOG_TRACE("top(%u) addr(%s) tx(%s) nonce(" FMT_I64 ") gas_price(" FMT_I64 ") last block seq(" FMT_I64 ")", i, tx->GetSourceAddress().c_str(), utils::String::BinToHexString(tx->GetContentHash()).c_str(), tx->GetNonce(), tx->GetGasPrice(), last_block_seq);
-			}
+			*set.add_txs() = tx->GetProtoTxEnv();
+			if (txs != nullptr)
+				txs->push_back(tx);
+			i++;
 		}
-		LOG_TRACE("Get transactions at the top of the queue. Current top size(%u), last ledger sequence(" FMT_I64 "), limit(%u), txset byte size(%d), (%d)M.",
-			i, last_block_seq, limit, set.ByteSize() ,set.ByteSize() / utils::BYTES_PER_MEGA);
+		LOG_TRACE("Get transactions at the top of the queue. Current top size(%u), queue size(" FMT_SIZE "), limit(%u), txset byte size(%d), (%d)M.",
+			i, Size(), limit, set.ByteSize() ,set.ByteSize() / utils::BYTES_PER_MEGA);
 		return std::move(set);
 	}
 
@@ -205,97 +360,93 @@ namespace bumo {
 		
 		uint32_t ret = 0;
 		int64_t last_seq = LedgerManager::Instance().GetLastClosedLedger().seq();
-		utils::WriteLockGuard g(lock_);
 		for (int i = 0; i < set.txs_size(); i++) {
-			auto txproto = set.txs(i);
-			std::string source_address = txproto.transaction().source_address();
-			int64_t nonce = txproto.transaction().nonce();
-			std::pair<bool, TransactionFrm::pointer> result = Remove(source_address, nonce);
+			const protocol::Transaction& tran = set.txs(i).transaction();
+			const std::string& source_address = tran.source_address();
+			int64_t nonce = tran.nonce();
+
+			Shard& shard = GetShard(source_address);
+			utils::WriteLockGuard g(shard.lock_);
+			std::pair<bool, TransactionFrm::pointer> result = Remove(shard, source_address, nonce);
 			if (result.first)
 				++ret;
 
 			//Update system account nonce
-			auto it = account_nonce_.find(source_address);
-			if (close_ledger && it != account_nonce_.end() && it->second < nonce)
-				it->second = nonce;
+			if (close_ledger)
+				UpdateNonce(source_address, nonce);
 		}
 
-		LOG_TRACE("Remove transactions: close ledger flag(%d), transaction set size(%d), actual deletion quantity(%u), remaining size of queue(%u), last ledger sequence(" FMT_I64 ")", 
-			(int)close_ledger, set.txs_size(), ret, queue_.size(), last_seq);
+		LOG_TRACE("Remove transactions: close ledger flag(%d), transaction set size(%d), actual deletion quantity(%u), remaining size of queue(" FMT_SIZE "), last ledger sequence(" FMT_I64 ")", 
+			(int)close_ledger, set.txs_size(), ret, Size(), last_seq);
 		return ret;
 	}
 
 	void TransactionQueue::RemoveTxs(std::vector<TransactionFrm::pointer>& txs, bool close_ledger){
-		utils::WriteLockGuard g(lock_);
 		uint32_t i = 0;
 		int64_t last_seq = LedgerManager::Instance().GetLastClosedLedger().seq();
 		for (auto it = txs.begin(); it != txs.end(); it++){
 			std::string source_address = (*it)->GetSourceAddress();
 			int64_t nonce = (*it)->GetNonce();
 
-			auto result = Remove(source_address, nonce);
+			Shard& shard = GetShard(source_address);
+			utils::WriteLockGuard g(shard.lock_);
+			auto result = Remove(shard, source_address, nonce);
 			i++;
 			LOG_TRACE("Remove transactions: close ledger flag(%d), sequence of transaction removed(%u), removed result(%d), account address(%s), transaction hash(%s), nonce(" FMT_I64 "), gas_price(" FMT_I64 ") last seq(" FMT_I64 ")", 
 				(int)close_ledger, i, (int)result.first, (*it)->GetSourceAddress().c_str(),
 				utils::String::BinToHexString((*it)->GetContentHash()).c_str(), (*it)->GetNonce(), (*it)->GetGasPrice(), last_seq);
 
 			//Update system account nonce
-			auto iter = account_nonce_.find(source_address);
-			if (close_ledger && iter != account_nonce_.end() && iter->second < nonce)
-				iter->second = nonce;
+			if (close_ledger)
+				UpdateNonce(source_address, nonce);
 		}
-		LOG_TRACE("remaining size of queue(%u)", queue_.size());
+		LOG_TRACE("remaining size of queue(" FMT_SIZE ")", Size());
 	}
 
 	void TransactionQueue::SafeRemoveTx(const std::string& account_address, const int64_t& nonce) {
-		utils::WriteLockGuard g(lock_);
-		std::pair<bool, TransactionFrm::pointer> result = Remove(account_address, nonce);
+		Shard& shard = GetShard(account_address);
+		utils::WriteLockGuard g(shard.lock_);
+		std::pair<bool, TransactionFrm::pointer> result = Remove(shard, account_address, nonce);
 	}
 
-
-
 	void TransactionQueue::CheckTimeout(int64_t current_time, std::vector<TransactionFrm::pointer>& timeout_txs){
-		utils::ReadLockGuard g(lock_);
-		for (auto it = time_queue_.begin(); it != time_queue_.end();it++){
-			if (!(*it)->CheckTimeout(current_time - QUEUE_TRANSACTION_TIMEOUT))
-				break;
-			timeout_txs.emplace_back(*it);
+		for (size_t n = 0; n < shards_.size(); n++){
+			Shard& shard = *shards_[n];
+			utils::ReadLockGuard g(shard.lock_);
+			for (auto it = shard.time_queue_.begin(); it != shard.time_queue_.end(); it++){
+				if (!(*it)->CheckTimeout(current_time - QUEUE_TRANSACTION_TIMEOUT))
+					break;
+				timeout_txs.emplace_back(*it);
+			}
 		}
 	}
 
 	void TransactionQueue::CheckTimeoutAndDel(int64_t current_time,std::vector<TransactionFrm::pointer>& timeout_txs){
-		utils::WriteLockGuard g(lock_);
-		int64_t last_seq = LedgerManager::Instance().GetLastClosedLedger().seq();		
-		while (!time_queue_.empty()){
-			auto it =time_queue_.begin();
-			if (!(*it)->CheckTimeout(current_time - QUEUE_TRANSACTION_TIMEOUT))
-				break;
-			timeout_txs.emplace_back(*it);
-			std::string account_address = (*it)->GetSourceAddress();
-			int64_t nonce = (*it)->GetNonce();
-			Remove(account_address, nonce);
+		int64_t last_seq = LedgerManager::Instance().GetLastClosedLedger().seq();
+		for (size_t n = 0; n < shards_.size(); n++){
+			Shard& shard = *shards_[n];
+			utils::WriteLockGuard g(shard.lock_);
+			while (!shard.time_queue_.empty()){
+				auto it = shard.time_queue_.begin();
+				if (!(*it)->CheckTimeout(current_time - QUEUE_TRANSACTION_TIMEOUT))
+					break;
+				timeout_txs.emplace_back(*it);
+				std::string account_address = (*it)->GetSourceAddress();
+				int64_t nonce = (*it)->GetNonce();
+				Remove(shard, account_address, nonce);
+			}
 		}
-		LOG_TRACE("Deleted timeout transactions(number: %u) for the last closed ledger(" FMT_I64 ").", timeout_txs.size(), last_seq);
+		LOG_TRACE("Deleted timeout transactions(number: " FMT_SIZE ") for the last closed ledger(" FMT_I64 ").", timeout_txs.size(), last_seq);
 	}
 
 	bool TransactionQueue::IsExist(const TransactionFrm::pointer& tx){
-		utils::ReadLockGuard g(lock_);
-		auto account_it1 = queue_by_address_and_nonce_.find(tx->GetSourceAddress());
-		if (account_it1 != queue_by_address_and_nonce_.end()){
-			auto tx_it = account_it1->second.find(tx->GetNonce());
-			if (tx_it != account_it1->second.end()){
-				TransactionFrm::pointer t = *tx_it->second.first;
-				if (t->GetContentHash() == tx->GetContentHash()){
-					return true;
-				}
-			}
-		}
-
-		return false;
+		utils::MutexGuard g(hash_lock_);
+		auto it = queue_by_hash_.find(tx->GetContentHash());
+		return it != queue_by_hash_.end();
 	}
 
 	bool TransactionQueue::IsExist(const std::string& hash){
-		utils::ReadLockGuard g(lock_);
+		utils::MutexGuard g(hash_lock_);
 		auto it = queue_by_hash_.find(hash);
 		if (it != queue_by_hash_.end()){
 			return true;
@@ -304,22 +455,32 @@ namespace bumo {
 	}
 
 	size_t TransactionQueue::Size() {
-		utils::ReadLockGuard g(lock_);
-		return queue_.size();
+		utils::MutexGuard g(hash_lock_);
+		return queue_by_hash_.size();
 	}
 
 	void TransactionQueue::Query(const uint32_t& num, std::vector<TransactionFrm::pointer>& txs){
-		utils::ReadLockGuard g(lock_);
-		uint32_t count = 0;
+		//Take the oldest ones of every shard, then keep the oldest over all
+		std::vector<TransactionFrm::pointer> all;
+		for (size_t n = 0; n < shards_.size(); n++){
+			Shard& shard = *shards_[n];
+			utils::ReadLockGuard g(shard.lock_);
+			uint32_t count = 0;
+			for (auto it = shard.time_queue_.begin(); it != shard.time_queue_.end() && count < num; it++) {
+				all.push_back(*it);
+				count++;
+			}
+		}
 
-		for (auto it = queue_.begin(); it != queue_.end() && count < num; it++) {
-			txs.push_back(*it);
-			count++;
+		std::sort(all.begin(), all.end(), TimePriorityCompare());
+		if (all.size() > num){
+			all.resize(num);
 		}
+		txs.insert(txs.end(), all.begin(), all.end());
 	}
 
 	bool TransactionQueue::Query(const std::string& hash, TransactionFrm::pointer& tx){
-		utils::ReadLockGuard g(lock_);
+		utils::MutexGuard g(hash_lock_);
 		auto it = queue_by_hash_.find(hash);
 		if (it != queue_by_hash_.end()){
 			tx = it->second;
@@ -328,4 +489,3 @@ namespace bumo {
 		return false;
 	}
 }
-
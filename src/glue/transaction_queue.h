@@ -22,6 +22,7 @@ along with bumo.  If not, see <http://www.gnu.org/licenses/>.
 #include "utils/thread.h"
 #include <set>
 #include <list>
+#include <vector>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -33,7 +34,9 @@ namespace bumo {
 		~TransactionQueue();
 
 		bool Import(TransactionFrm::pointer tx, const int64_t& cur_source_nonce, Result &result);
-		protocol::TransactionEnvSet TopTransaction(uint32_t limit);
+		//Imports a batch taking each shard lock once, results are only set for the failed ones, returns the number inserted
+		size_t Import(const std::vector<TransactionFrm::pointer>& txs, const std::vector<int64_t>& cur_source_nonces, std::vector<Result>& results);
+		protocol::TransactionEnvSet TopTransaction(uint32_t limit, std::vector<TransactionFrm::pointer>* txs = nullptr);
 		uint32_t RemoveTxs(const protocol::TransactionEnvSet& set, bool close_ledger = false);
 		void RemoveTxs(std::vector<TransactionFrm::pointer>& txs, bool close_ledger = false);
 		void CheckTimeout(int64_t current_time, std::vector<TransactionFrm::pointer>& timeout_txs);
@@ -49,19 +52,31 @@ namespace bumo {
 
 		struct PriorityCompare
 		{
-			TransactionQueue& transaction_queue_;
-			/// Compare transactions by nonce height and fee.
+			/// Compare transactions by fee and incoming time. Only immutable fields are used, so the order never changes while queued.
 			bool operator()(TransactionFrm::pointer const& first, TransactionFrm::pointer const& second) const
 			{
-				int64_t const& height1 = first->GetNonce() - transaction_queue_.account_nonce_[first->GetSourceAddress()];
-				int64_t const& height2 = second->GetNonce() - transaction_queue_.account_nonce_[second->GetSourceAddress()];
-				return height1 < height2 || (height1 == height2 && first->GetGasPrice() > second->GetGasPrice());
+				if (first->GetGasPrice() != second->GetGasPrice())
+					return first->GetGasPrice() > second->GetGasPrice();
+				if (first->GetInComingTime() != second->GetInComingTime())
+					return first->GetInComingTime() < second->GetInComingTime();
+				return first.get() < second.get();
 			}
 		};
 
-		using PriorityQueue = std::multiset<TransactionFrm::pointer, PriorityCompare>;
-		PriorityQueue queue_;
+		struct EvictCompare
+		{
+			/// The cheapest and latest transaction comes first.
+			bool operator()(TransactionFrm::pointer const& first, TransactionFrm::pointer const& second) const
+			{
+				return PriorityCompare()(second, first);
+			}
+		};
 
+		//Executable head transaction of each account, best first
+		using PriorityQueue = std::set<TransactionFrm::pointer, PriorityCompare>;
+
+		//Last transaction of each account, the first one is evicted when the queue is full
+		using EvictQueue = std::set<TransactionFrm::pointer, EvictCompare>;
 
 		struct TimePriorityCompare
 		{
@@ -74,26 +89,50 @@ namespace bumo {
 
 		//Time order
 		using TimeQueue = std::multiset<TransactionFrm::pointer, TimePriorityCompare>;
-		TimeQueue time_queue_;
 
-		using QueueIterPair = std::pair<PriorityQueue::iterator, TimeQueue::iterator>;
-		using QueueByNonce = std::map<int64_t, QueueIterPair>;
-		using QueueByAddressAndNonce = std::unordered_map<std::string, QueueByNonce>;
-		QueueByAddressAndNonce queue_by_address_and_nonce_;
+		using QueueByNonce = std::map<int64_t, std::pair<TransactionFrm::pointer, TimeQueue::iterator>>;
+		struct AccountLane {
+			//Account system nonce
+			int64_t nonce_;
+			QueueByNonce txs_;
+			bool has_head_;
+			PriorityQueue::iterator head_;
+			bool has_tail_;
+			EvictQueue::iterator tail_;
+
+			AccountLane() : nonce_(0), has_head_(false), has_tail_(false) {}
+		};
+		using QueueByAddressAndNonce = std::unordered_map<std::string, AccountLane>;
+
+		//Accounts are spread over the shards by address, each shard has its own lock
+		struct Shard {
+			PriorityQueue head_queue_;
+			EvictQueue tail_queue_;
+			TimeQueue time_queue_;
+			QueueByAddressAndNonce queue_by_address_and_nonce_;
+			utils::ReadWriteLock lock_;
+		};
+		std::vector<std::shared_ptr<Shard>> shards_;
 
+		//Global index for hash lookups, always locked after the shard lock
 		std::unordered_map<std::string, TransactionFrm::pointer> queue_by_hash_;
-		//Record account system nonce
-		std::unordered_map<std::string, int64_t> account_nonce_;
+		utils::Mutex hash_lock_;
 
 		uint32_t queue_limit_;
 		//Maximum number of transactions per account
 		uint32_t account_txs_limit_;
 
-		std::pair<bool, TransactionFrm::pointer> Remove(const std::string& account_address,const int64_t& nonce);
-		std::pair<bool, TransactionFrm::pointer> Remove(QueueByAddressAndNonce::iterator& account_it, QueueByNonce::iterator& tx_it, bool del_empty = true);
-		void Insert(TransactionFrm::pointer const& tx);
-
-		utils::ReadWriteLock lock_;
+		Shard& GetShard(const std::string& account_address);
+		std::pair<bool, TransactionFrm::pointer> Remove(Shard& shard, const std::string& account_address, const int64_t& nonce);
+		std::pair<bool, TransactionFrm::pointer> Remove(Shard& shard, QueueByAddressAndNonce::iterator& account_it, QueueByNonce::iterator& tx_it, bool del_empty = true);
+		void Insert(Shard& shard, AccountLane& lane, TransactionFrm::pointer const& tx);
+		bool Place(Shard& shard, TransactionFrm::pointer const& tx, int64_t cur_source_nonce, Result &result);
+		void EvictOverflow(std::vector<TransactionFrm::pointer>& evicted);
+		void SetEvictedResult(TransactionFrm::pointer const& tx, Result &result);
+		void UpdateLane(Shard& shard, AccountLane& lane);
+		void UpdateNonce(const std::string& account_address, int64_t nonce);
+		bool EvictOne(TransactionFrm::pointer& evicted);
+		void SelectTop(Shard& shard, uint32_t limit, std::vector<TransactionFrm::pointer>& txs);
 	};
 }
 
@@ -220,15 +220,12 @@ namespace bumo {
 			return true;
 		}
 
-		auto batch = std::make_shared<WRITE_BATCH>();
-		std::string asset_prefix = ComposePrefix(General::ASSET_PREFIX, DecodeAddress(account_info_.address()));
-		KVTrie trie;
-		trie.Init(Storage::Instance().account_db(), batch, asset_prefix, 1);
-
-		auto asset_key_str = asset_key.SerializeAsString();
 		std::string buff;
-	
-		if (!trie.Get(asset_key_str, buff)){
+		int32_t ret = Storage::Instance().account_db()->Get(FlatAssetKey(account_info_.address(), asset_key.SerializeAsString()), buff);
+		if (ret < 0){
+			PROCESS_EXIT("Failed to read asset of account(%s), %s", account_info_.address().c_str(), Storage::Instance().account_db()->error_desc().c_str());
+		}
+		else if (ret == 0){
 			return false;
 		}
 
@@ -262,13 +259,12 @@ namespace bumo {
 			return true;
 		}
 
-		auto batch = std::make_shared<WRITE_BATCH>();
-		KVTrie trie;
-		std::string prefix = ComposePrefix(General::METADATA_PREFIX, DecodeAddress(account_info_.address()));
-		trie.Init(Storage::Instance().account_db(), batch, prefix, 1);
-
 		std::string buff;
-		if (!trie.Get(binkey, buff)){
+		int32_t ret = Storage::Instance().account_db()->Get(FlatMetaDataKey(account_info_.address(), binkey), buff);
+		if (ret < 0){
+			PROCESS_EXIT("Failed to read metadata of account(%s), %s", account_info_.address().c_str(), Storage::Instance().account_db()->error_desc().c_str());
+		}
+		else if (ret == 0){
 			return false;
 		}
 		
@@ -316,13 +312,18 @@ namespace bumo {
 			{
 			case utils::ADD:
 			case utils::MOD:
-				if (asset.amount() == 0)
+				if (asset.amount() == 0){
 					trie_asset.Delete(asset.key().SerializeAsString());
-				else
+					batch->Delete(FlatAssetKey(account_info_.address(), asset.key().SerializeAsString()));
+				}
+				else{
 					trie_asset.Set(asset.key().SerializeAsString(), asset.SerializeAsString());
+					batch->Put(FlatAssetKey(account_info_.address(), asset.key().SerializeAsString()), asset.SerializeAsString());
+				}
 				break;
 			case utils::DEL:
 				trie_asset.Delete(asset.key().SerializeAsString());
+				batch->Delete(FlatAssetKey(account_info_.address(), asset.key().SerializeAsString()));
 				break;
 
 			default:
@@ -341,9 +342,11 @@ namespace bumo {
 			case utils::ADD:
 			case utils::MOD:
 				trie_metadata.Set(it->first, kp.SerializeAsString());
+				batch->Put(FlatMetaDataKey(account_info_.address(), it->first), kp.SerializeAsString());
 				break;
 			case utils::DEL:
 				trie_metadata.Delete(it->first);
+				batch->Delete(FlatMetaDataKey(account_info_.address(), it->first));
 				break;
 
 			default:
@@ -354,6 +357,18 @@ namespace bumo {
 		account_info_.set_metadatas_hash(trie_metadata.GetRootHash());
 	}
 
+	std::string AccountFrm::FlatAccountKey(const std::string &address){
+		return ComposePrefix(General::FLAT_ACCOUNT_PREFIX, DecodeAddress(address));
+	}
+
+	std::string AccountFrm::FlatAssetKey(const std::string &address, const std::string &asset_key){
+		return ComposePrefix(General::FLAT_ASSET_PREFIX, DecodeAddress(address)) + asset_key;
+	}
+
+	std::string AccountFrm::FlatMetaDataKey(const std::string &address, const std::string &key){
+		return ComposePrefix(General::FLAT_METADATA_PREFIX, DecodeAddress(address)) + key;
+	}
+
 	void AccountFrm::NonceIncrease(){
 		int64_t new_nonce = account_info_.nonce() + 1;
 		account_info_.set_nonce(new_nonce);
@@ -109,6 +109,11 @@ namespace bumo {
 		int64_t GetAccountBalance() const;
 		bool AddBalance(int64_t amount);
 		static AccountFrm::pointer CreatAccountFrm(const std::string& account_address, int64_t balance);
+
+		//Keys of the flat index, the address is decoded so the keys of different accounts never share a prefix
+		static std::string FlatAccountKey(const std::string &address);
+		static std::string FlatAssetKey(const std::string &address, const std::string &asset_key);
+		static std::string FlatMetaDataKey(const std::string &address, const std::string &key);
 	public:
 
 		template <class T>
@@ -0,0 +1,70 @@
+/*
+	bumo is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	bumo is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with bumo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "account_cache.h"
+
+namespace bumo {
+	AccountStateCache::AccountStateCache(size_t capacity) : seq_(0), states_(capacity) {}
+
+	AccountStateCache::~AccountStateCache() {}
+
+	bool AccountStateCache::Get(const std::string &address, AccountPointer &account) {
+		utils::MutexGuard guard(lock_);
+		Entry entry;
+		if (!states_.get(address, entry)) {
+			return false;
+		}
+		account = entry.account_;
+		return true;
+	}
+
+	int64_t AccountStateCache::GetSeq() {
+		utils::MutexGuard guard(lock_);
+		return seq_;
+	}
+
+	void AccountStateCache::Put(const std::string &address, const AccountPointer &account, int64_t seq) {
+		utils::MutexGuard guard(lock_);
+		//A ledger was published or a newer state was staged while the caller was reading the db.
+		if (seq != seq_ || staged_.find(address) != staged_.end()) {
+			return;
+		}
+
+		Entry entry;
+		if (states_.get(address, entry) && entry.seq_ > seq) {
+			return;
+		}
+
+		entry.seq_ = seq;
+		entry.account_ = account;
+		states_.put(address, entry);
+	}
+
+	void AccountStateCache::Stage(const std::string &address, const AccountPointer &account, int64_t seq) {
+		utils::MutexGuard guard(lock_);
+		Entry &entry = staged_[address];
+		entry.seq_ = seq;
+		entry.account_ = account;
+	}
+
+	void AccountStateCache::Publish(int64_t seq) {
+		utils::MutexGuard guard(lock_);
+		for (auto iter = staged_.begin(); iter != staged_.end(); iter++) {
+			states_.put(iter->first, iter->second);
+		}
+		staged_.clear();
+		seq_ = seq;
+	}
+}
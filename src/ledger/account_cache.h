@@ -0,0 +1,56 @@
+/*
+	bumo is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	bumo is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with bumo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ACCOUNT_CACHE_H_
+#define ACCOUNT_CACHE_H_
+
+#include <unordered_map>
+#include <utils/thread.h>
+#include <utils/lrucache.hpp>
+#include <proto/cpp/chain.pb.h>
+
+namespace bumo {
+	//Decoded account states of the last closed ledger, keyed by address.
+	//States written by a closing ledger are staged and only become visible after the ledger is written to the db.
+	class AccountStateCache {
+	public:
+		typedef std::shared_ptr<const protocol::Account> AccountPointer;
+
+		AccountStateCache(size_t capacity);
+		~AccountStateCache();
+
+		bool Get(const std::string &address, AccountPointer &account);
+
+		//The seq of the last published ledger. Read it before loading a state from the db and pass it to Put.
+		int64_t GetSeq();
+		void Put(const std::string &address, const AccountPointer &account, int64_t seq);
+
+		void Stage(const std::string &address, const AccountPointer &account, int64_t seq);
+		void Publish(int64_t seq);
+
+	private:
+		struct Entry {
+			int64_t seq_;
+			AccountPointer account_;
+		};
+
+		utils::Mutex lock_;
+		int64_t seq_;
+		cache::lru_cache<std::string, Entry> states_;
+		std::unordered_map<std::string, Entry> staged_;
+	};
+}
+
+#endif
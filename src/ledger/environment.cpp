@@ -23,10 +23,19 @@ namespace bumo{
 		utils::AtomMap<std::string, AccountFrm>(data), settings_(settings){}
 
 	bool Environment::GetEntry(const std::string &key, AccountFrm::pointer &frm){
+		if (record_access_){
+			read_set_.insert(key);
+		}
 		return Get(key, frm);
 	}
 
 	bool Environment::Commit(){
+		//An entry is in the change buffer once it is read, so it counts as written even if it is not modified
+		if (record_access_){
+			for (auto it = buff_.begin(); it != buff_.end(); it++){
+				write_set_.insert(it->first);
+			}
+		}
 		return settings_.Commit() && AtomMap<std::string, AccountFrm>::Commit();
 	}
 
@@ -40,19 +49,32 @@ namespace bumo{
 	}
 
 	bool Environment::GetFromDB(const std::string &address, AccountFrm::pointer &account_ptr){
+		if (base_ != nullptr){
+			auto it = base_->find(address);
+			if (it != base_->end()){
+				account_ptr = std::make_shared<AccountFrm>(*it->second.ptr_);
+				return true;
+			}
+		}
 		return AccountFromDB(address, account_ptr);
 	}
 
 	bool Environment::AccountFromDB(const std::string &address, AccountFrm::pointer &account_ptr){
-		auto db = Storage::Instance().account_db();
-		std::string index = DecodeAddress(address);
-		std::string buff;
+		AccountStateCache &cache = LedgerManager::Instance().account_cache_;
+		AccountStateCache::AccountPointer state;
+		if (cache.Get(address, state)) {
+			account_ptr = std::make_shared<AccountFrm>(*state);
+			return true;
+		}
 
-		{
-			utils::WriteLockGuard guard(LedgerManager::Instance().GetTreeMutex());
-			if (!LedgerManager::Instance().tree_->Get(index, buff)){
-				return false;
-			}
+		int64_t seq = cache.GetSeq();
+		std::string buff;
+		int32_t ret = Storage::Instance().account_db()->Get(AccountFrm::FlatAccountKey(address), buff);
+		if (ret < 0){
+			PROCESS_EXIT("Failed to read account(%s), %s", address.c_str(), Storage::Instance().account_db()->error_desc().c_str());
+		}
+		else if (ret == 0){
+			return false;
 		}
 
 		protocol::Account account;
@@ -61,6 +83,7 @@ namespace bumo{
 		}
 
 		account_ptr = std::make_shared<AccountFrm>(account);
+		cache.Put(address, std::make_shared<protocol::Account>(account), seq);
 		return true;
 	}
 
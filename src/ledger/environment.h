@@ -21,6 +21,7 @@
 #include <utils/atom_map.h>
 #include <main/configure.h>
 #include <json/value.h>
+#include <unordered_set>
 #include "account.h"
 
 namespace bumo {
@@ -32,6 +33,14 @@ namespace bumo {
 
 		AtomMap<std::string, Json::Value> settings_;
 
+		//Accounts read through GetEntry (including missing ones) and accounts committed, recorded for the parallel apply when record_access_ is set
+		bool record_access_ = false;
+		std::unordered_set<std::string> read_set_;
+		std::unordered_set<std::string> write_set_;
+
+		//Accounts applied ahead by earlier parallel batches, read before the database
+		const Map* base_ = nullptr;
+
 		Environment() = default;
 		Environment(Environment const&) = delete;
 		Environment& operator=(Environment const&) = delete;
@@ -36,7 +36,7 @@ namespace bumo{
 
 		protocol::Node info;
 		if (storage_load(location, info)){
-			root_->info_.CopyFrom(info);
+			root_->info_.FromProto(info);
 			Load(root_, depth);
 		}
 		return true;
@@ -64,10 +64,9 @@ namespace bumo{
 		return b;
 	}
 
-	void KVTrie::StorageSaveNode(NodeFrm::POINTER node) {
-		std::string buff = node->info_.SerializeAsString();
+	void KVTrie::StorageSaveNode(NodeFrm::POINTER node, const std::string& encoded) {
 		std::string key = Location2DBkey(node->location_, false);
-		batch_->Put(key, buff);
+		batch_->Put(key, encoded);
 		//LOG_DEBUG("save INNER(%s)", utils::String::BinToHexString(key).c_str());
 	}
 
@@ -129,6 +128,10 @@ namespace bumo{
 		return HashWrapper::Crypto(input);
 	}
 
+	void KVTrie::HashCryptoBatch(const std::vector<const std::string *>& inputs, std::vector<std::string>& outputs){
+		HashWrapper::Crypto(inputs, outputs);
+	}
+
 	std::string KVTrie::Location2DBkey(const Location& location, bool leaf){
 		std::string key = location;
 		if (leaf){
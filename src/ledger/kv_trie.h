@@ -38,7 +38,7 @@ namespace bumo{
 		void Load(NodeFrm::POINTER node, int depth);
 	    std::string Location2DBkey(const Location& location, bool leaf);
 	protected:
-		virtual void StorageSaveNode(NodeFrm::POINTER node) override;
+		virtual void StorageSaveNode(NodeFrm::POINTER node, const std::string& encoded) override;
 		virtual void StorageSaveLeaf(NodeFrm::POINTER node) override;
 		
 		virtual void StorageDeleteNode(NodeFrm::POINTER node) override;
@@ -47,6 +47,7 @@ namespace bumo{
 		virtual bool storage_load(const Location& location, protocol::Node& info) override;
 		virtual bool StorageGetLeaf(const Location& location, std::string& value)override;
 		virtual std::string HashCrypto(const std::string& input) override;
+		virtual void HashCryptoBatch(const std::vector<const std::string *>& inputs, std::vector<std::string>& outputs) override;
 	};
 }
 
@@ -248,56 +248,76 @@ namespace bumo {
 			return false;
 		}
 
+		//The transactions pre-applied on the last closed ledger are only reused by the proposer, the validators apply the proposal themselves
+		std::shared_ptr<PreAppliedTxs> pre_applied;
+		if (ledger_context != NULL && !IsTestMode()) {
+			pre_applied = GlueManager::Instance().TakePreAppliedTxs(request.ledger_seq() - 1);
+		}
+
+		std::vector<SpeculativeTx> spec_txs;
+		ApplySpeculative(request, true, std::set<int32_t>(), pre_applied.get(), spec_txs);
+
 		for (int i = 0; i < request.txset().txs_size() && enabled_; i++) {
 			const protocol::TransactionEnv &txproto = request.txset().txs(i);
 
-			TransactionFrm::pointer tx_frm = std::make_shared<TransactionFrm>(txproto);
-
-			if (!tx_frm->ValidForApply(environment_, !IsTestMode())) {
-				dropped_tx_frms_.push_back(tx_frm);
-				proposed_result.need_dropped_tx_.insert(i); //for drop
-				continue;
+			TransactionFrm::pointer tx_frm;
+			bool ret = false;
+			bool expired = false;
+			std::string error_info;
+			if (!spec_txs.empty() && CommitSpeculative(spec_txs[i])) {
+				tx_frm = spec_txs[i].tx_frm_;
+				ret = spec_txs[i].apply_ret_;
+				expired = spec_txs[i].expired_;
+				error_info = spec_txs[i].error_info_;
 			}
+			else {
+				tx_frm = NewTransactionFrm(spec_txs, i, txproto);
 
-			//pay fee
-			if (!tx_frm->PayFee(environment_, total_fee_)) {
-				dropped_tx_frms_.push_back(tx_frm);
-				proposed_result.need_dropped_tx_.insert(i);//for drop
-				continue;
-			}
+				if (!tx_frm->ValidForApply(environment_, !IsTestMode())) {
+					dropped_tx_frms_.push_back(tx_frm);
+					proposed_result.need_dropped_tx_.insert(i); //for drop
+					continue;
+				}
 
-			ledger_context->transaction_stack_.push_back(tx_frm);
-			tx_frm->NonceIncrease(this, environment_);
-			environment_->Commit();
+				//pay fee
+				if (!tx_frm->PayFee(environment_, total_fee_)) {
+					dropped_tx_frms_.push_back(tx_frm);
+					proposed_result.need_dropped_tx_.insert(i);//for drop
+					continue;
+				}
 
-			tx_frm->EnableChecked();
-			tx_frm->SetMaxEndTime(utils::Timestamp::HighResolution() + General::TX_EXECUTE_TIME_OUT);
+				ledger_context->transaction_stack_.push_back(tx_frm);
+				tx_frm->NonceIncrease(this, environment_);
+				environment_->Commit();
+
+				tx_frm->EnableChecked();
+				tx_frm->SetMaxEndTime(utils::Timestamp::HighResolution() + General::TX_EXECUTE_TIME_OUT);
+
+				ret = tx_frm->Apply(this, environment_);
+				expired = tx_frm->IsExpire(error_info);
+				if (!expired && ret) {
+					tx_frm->ReturnFee(total_fee_);
+					tx_frm->environment_->Commit();
+				}
+				ledger_context->transaction_stack_.pop_back();
+			}
 
-			bool ret = tx_frm->Apply(this, environment_);
 			//Calculate the required minimum fee by calculating the bytes of the transaction. Do not store the transaction when the user-specified fee is less than this fee. 
-			std::string error_info;
-			if (tx_frm->IsExpire(error_info)) {
+			if (expired) {
 				LOG_ERROR("Failed to apply transaction(%s): %s, %s",
 					utils::String::BinToHexString(tx_frm->GetContentHash()).c_str(), tx_frm->GetResult().desc().c_str(),
 					error_info.c_str());
 				expire_txs.insert(i - proposed_result.need_dropped_tx_.size());//for check
 			}
-			else {
-				if (!ret) {
-					LOG_ERROR("Failed to apply transaction(%s): %s",
-						utils::String::BinToHexString(tx_frm->GetContentHash()).c_str(), tx_frm->GetResult().desc().c_str());
-					error_txs.insert(i - proposed_result.need_dropped_tx_.size());//for check
-				}
-				else {
-					tx_frm->ReturnFee(total_fee_);
-					tx_frm->environment_->Commit();
-				}
+			else if (!ret) {
+				LOG_ERROR("Failed to apply transaction(%s): %s",
+					utils::String::BinToHexString(tx_frm->GetContentHash()).c_str(), tx_frm->GetResult().desc().c_str());
+				error_txs.insert(i - proposed_result.need_dropped_tx_.size());//for check
 			}
 
 			environment_->ClearChangeBuf();
 			apply_tx_frms_.push_back(tx_frm);
 			ledger_.add_transaction_envs()->CopyFrom(txproto);
-			ledger_context->transaction_stack_.pop_back();
 
 			if ( utils::Timestamp::HighResolution() - start_time > General::BLOCK_EXECUTE_TIME_OUT) {
 				LOG_ERROR("Applying block timeout(" FMT_I64 ") ", utils::Timestamp::HighResolution() - start_time);
@@ -332,54 +352,68 @@ namespace bumo {
 			return false;
 		}
 
+		std::vector<SpeculativeTx> spec_txs;
+		ApplySpeculative(request, true, std::set<int32_t>(), NULL, spec_txs);
+
 		for (int i = 0; i < request.txset().txs_size() && enabled_; i++) {
 			auto txproto = request.txset().txs(i);
 
-			TransactionFrm::pointer tx_frm = std::make_shared<TransactionFrm>(txproto);
-
-			if (!tx_frm->ValidForApply(environment_, !IsTestMode())) {
-				LOG_ERROR("Validition for application failed: consensus value sequence(" FMT_I64 ")", request.ledger_seq());
-				return false;
+			TransactionFrm::pointer tx_frm;
+			bool ret = false;
+			bool expired = false;
+			std::string error_info;
+			if (!spec_txs.empty() && CommitSpeculative(spec_txs[i])) {
+				tx_frm = spec_txs[i].tx_frm_;
+				ret = spec_txs[i].apply_ret_;
+				expired = spec_txs[i].expired_;
+				error_info = spec_txs[i].error_info_;
 			}
+			else {
+				tx_frm = NewTransactionFrm(spec_txs, i, txproto);
 
-			//pay fee
-			if (!tx_frm->PayFee(environment_, total_fee_)) {
-				LOG_ERROR("Failed to pay fee, consensus value sequence(" FMT_I64 ")", request.ledger_seq());
-				return false;
-			}
+				if (!tx_frm->ValidForApply(environment_, !IsTestMode())) {
+					LOG_ERROR("Validition for application failed: consensus value sequence(" FMT_I64 ")", request.ledger_seq());
+					return false;
+				}
 
-			ledger_context->transaction_stack_.push_back(tx_frm);
-			tx_frm->NonceIncrease(this, environment_);
-			environment_->Commit();
+				//pay fee
+				if (!tx_frm->PayFee(environment_, total_fee_)) {
+					LOG_ERROR("Failed to pay fee, consensus value sequence(" FMT_I64 ")", request.ledger_seq());
+					return false;
+				}
 
-			tx_frm->EnableChecked();
-			tx_frm->SetMaxEndTime(utils::Timestamp::HighResolution() + General::TX_EXECUTE_TIME_OUT);
+				ledger_context->transaction_stack_.push_back(tx_frm);
+				tx_frm->NonceIncrease(this, environment_);
+				environment_->Commit();
+
+				tx_frm->EnableChecked();
+				tx_frm->SetMaxEndTime(utils::Timestamp::HighResolution() + General::TX_EXECUTE_TIME_OUT);
+
+				ret = tx_frm->Apply(this, environment_);
+				expired = tx_frm->IsExpire(error_info);
+				if (!expired && ret) {
+					tx_frm->ReturnFee(total_fee_);
+					tx_frm->environment_->Commit();
+				}
+				ledger_context->transaction_stack_.pop_back();
+			}
 
-			bool ret = tx_frm->Apply(this, environment_);
 			//Caculate the required mininum fee by calculting the bytes of the transaction. Do not store the transaction when the user-specified fee is less than this fee. 
-			std::string error_info;
-			if (tx_frm->IsExpire(error_info)) {
+			if (expired) {
 				LOG_ERROR("Failed to apply transaction(%s). %s, %s",
 					utils::String::BinToHexString(tx_frm->GetContentHash()).c_str(), tx_frm->GetResult().desc().c_str(),
 					error_info.c_str());
 				expire_txs.insert(i);//for check
 			}
-			else {
-				if (!ret) {
-					LOG_ERROR("Failed to apply transaction(%s). %s",
-						utils::String::BinToHexString(tx_frm->GetContentHash()).c_str(), tx_frm->GetResult().desc().c_str());
-					error_txs.insert(i);//for check
-				}
-				else {
-					tx_frm->ReturnFee(total_fee_);
-					tx_frm->environment_->Commit();
-				}
+			else if (!ret) {
+				LOG_ERROR("Failed to apply transaction(%s). %s",
+					utils::String::BinToHexString(tx_frm->GetContentHash()).c_str(), tx_frm->GetResult().desc().c_str());
+				error_txs.insert(i);//for check
 			}
 
 			environment_->ClearChangeBuf();
 			apply_tx_frms_.push_back(tx_frm);
 			ledger_.add_transaction_envs()->CopyFrom(txproto);
-			ledger_context->transaction_stack_.pop_back();
 
 			if (utils::Timestamp::HighResolution() - start_time > General::BLOCK_EXECUTE_TIME_OUT) {
 				LOG_ERROR("Applying block timeout(" FMT_I64 ") ", utils::Timestamp::HighResolution() - start_time);
@@ -417,44 +451,54 @@ namespace bumo {
 			return false;
 		}
 
+		std::vector<SpeculativeTx> spec_txs;
+		ApplySpeculative(request, false, expire_txs_check, NULL, spec_txs);
+
 		for (int i = 0; i < request.txset().txs_size() && enabled_; i++) {
 			auto txproto = request.txset().txs(i);
 			
-			TransactionFrm::pointer tx_frm = std::make_shared<TransactionFrm>(txproto);
-
-			//Pay fee
-			if (!tx_frm->PayFee(environment_, total_fee_)) {
-				LOG_WARN("Failed to pay fee.");
-				continue;
+			TransactionFrm::pointer tx_frm;
+			bool ret = true;
+			if (!spec_txs.empty() && CommitSpeculative(spec_txs[i])) {
+				tx_frm = spec_txs[i].tx_frm_;
+				ret = spec_txs[i].apply_ret_;
 			}
+			else {
+				tx_frm = NewTransactionFrm(spec_txs, i, txproto);
 
-			ledger_context->transaction_stack_.push_back(tx_frm);
-			tx_frm->NonceIncrease(this, environment_);
-			environment_->Commit();
+				//Pay fee
+				if (!tx_frm->PayFee(environment_, total_fee_)) {
+					LOG_WARN("Failed to pay fee.");
+					continue;
+				}
 
+				ledger_context->transaction_stack_.push_back(tx_frm);
+				tx_frm->NonceIncrease(this, environment_);
+				environment_->Commit();
 
-			if ( expire_txs_check.find(i) != expire_txs_check.end()) {
-				//Follow the consensus value, and do not apply the transaction set.
-				tx_frm->ApplyExpireResult();
-			}
-			else {
-				bool ret = tx_frm->Apply(this, environment_);
-				if (!ret) {
-					LOG_ERROR("Failed to apply transaction(%s). %s",
-						utils::String::BinToHexString(tx_frm->GetContentHash()).c_str(), tx_frm->GetResult().desc().c_str());
-					error_txs.insert(i);//for check
+				if (expire_txs_check.find(i) != expire_txs_check.end()) {
+					//Follow the consensus value, and do not apply the transaction set.
+					tx_frm->ApplyExpireResult();
 				}
 				else {
-					tx_frm->ReturnFee(total_fee_);
-					tx_frm->environment_->Commit();
+					ret = tx_frm->Apply(this, environment_);
+					if (ret) {
+						tx_frm->ReturnFee(total_fee_);
+						tx_frm->environment_->Commit();
+					}
 				}
+				ledger_context->transaction_stack_.pop_back();
+			}
+
+			if (!ret) {
+				LOG_ERROR("Failed to apply transaction(%s). %s",
+					utils::String::BinToHexString(tx_frm->GetContentHash()).c_str(), tx_frm->GetResult().desc().c_str());
+				error_txs.insert(i);//for check
 			}
 
 			environment_->ClearChangeBuf();
 			apply_tx_frms_.push_back(tx_frm);			
 			ledger_.add_transaction_envs()->CopyFrom(txproto);
-			ledger_context->transaction_stack_.pop_back();
-
 		}
 		AllocateReward();
 		apply_time_ = utils::Timestamp::HighResolution() - start_time;
@@ -466,6 +510,225 @@ namespace bumo {
 		return true;
 	}
 
+	void LedgerFrm::ApplySpeculative(const protocol::ConsensusValue& request, bool check, const std::set<int32_t> &skipped_txs, const PreAppliedTxs *pre_applied, std::vector<SpeculativeTx> &spec_txs) {
+		ParallelWorker *worker = ParallelWorker::GetInstance();
+		if (worker == NULL || request.txset().txs_size() == 0 || !enabled_) {
+			return;
+		}
+
+		bool parallel = worker->GetThreadCount() > 0 && request.txset().txs_size() >= 2 && Configure::Instance().ledger_configure_.parallel_apply_enabled_;
+		bool reuse = pre_applied != NULL && !pre_applied->txs_.empty();
+		if (!parallel && !reuse) {
+			return;
+		}
+
+		int64_t start_time = utils::Timestamp::HighResolution();
+		spec_txs.resize(request.txset().txs_size());
+		worker->ParallelFor(spec_txs.size(), [&request, &skipped_txs, &spec_txs](size_t i) {
+			SpeculativeTx &spec_tx = spec_txs[i];
+			spec_tx.tx_frm_ = std::make_shared<TransactionFrm>(request.txset().txs(i));
+			//A transaction which may trigger a contract is applied in order on the ledger context thread
+			spec_tx.scheduled_ = skipped_txs.find(i) == skipped_txs.end() && spec_tx.tx_frm_->GetFootprint(spec_tx.footprint_);
+		});
+
+		//A transaction goes into the batch after the last one touching any of its accounts,
+		//so the transactions in a batch touch different accounts and the earlier ones on the same account are in the earlier batches
+		std::unordered_map<std::string, size_t> account_batches;
+		std::vector<std::vector<size_t>> batches;
+		for (size_t i = 0; i < spec_txs.size(); i++) {
+			SpeculativeTx &spec_tx = spec_txs[i];
+			if (!spec_tx.scheduled_) {
+				continue;
+			}
+
+			spec_tx.batch_ = 0;
+			for (auto it = spec_tx.footprint_.begin(); it != spec_tx.footprint_.end(); it++) {
+				auto iter = account_batches.find(*it);
+				if (iter != account_batches.end()) {
+					spec_tx.batch_ = std::max(spec_tx.batch_, iter->second + 1);
+				}
+			}
+			for (auto it = spec_tx.footprint_.begin(); it != spec_tx.footprint_.end(); it++) {
+				account_batches[*it] = spec_tx.batch_;
+			}
+
+			if (batches.size() <= spec_tx.batch_) {
+				batches.resize(spec_tx.batch_ + 1);
+			}
+			batches[spec_tx.batch_].push_back(i);
+		}
+
+		//Nothing ahead of a transaction in the first batch touches its accounts, so it reads the states of the last closed ledger as it did when pre-applied
+		size_t reused_count = 0;
+		if (reuse && !batches.empty()) {
+			for (size_t i = 0; i < batches[0].size(); i++) {
+				SpeculativeTx &spec_tx = spec_txs[batches[0][i]];
+				auto iter = pre_applied->txs_.find(spec_tx.tx_frm_->GetContentHash());
+				if (iter == pre_applied->txs_.end()) {
+					continue;
+				}
+
+				spec_tx = iter->second;
+				spec_tx.tx_frm_->ledger_ = this;
+				reused_count++;
+			}
+		}
+
+		//Without the parallel apply, only the reused transactions are committed ahead
+		Environment::Map base;
+		for (size_t b = 0; parallel && b < batches.size(); b++) {
+			const std::vector<size_t> &batch = batches[b];
+			worker->ParallelFor(batch.size(), [this, check, &batch, &base, &spec_txs](size_t i) {
+				SpeculativeTx &spec_tx = spec_txs[batch[i]];
+				if (!spec_tx.applied_) {
+					ApplySpeculativeTx(spec_tx, check, &base);
+				}
+			});
+
+			for (size_t i = 0; i < batch.size(); i++) {
+				SpeculativeTx &spec_tx = spec_txs[batch[i]];
+				if (!spec_tx.applied_) {
+					continue;
+				}
+				const Environment::Map &entries = spec_tx.environment_->GetData();
+				for (auto it = entries.begin(); it != entries.end(); it++) {
+					base[it->first] = it->second;
+				}
+			}
+		}
+
+		//The writes of every transaction applied in order are checked against the reads of the later ones
+		environment_->record_access_ = true;
+
+		size_t applied_count = 0;
+		for (size_t i = 0; i < spec_txs.size(); i++) {
+			if (spec_txs[i].applied_) applied_count++;
+		}
+		LOG_TRACE("Applied " FMT_SIZE " of " FMT_SIZE " transactions ahead in " FMT_SIZE " batches in ledger(" FMT_I64 "), reused(" FMT_SIZE "), time used(" FMT_I64 "us)",
+			applied_count, spec_txs.size(), batches.size(), request.ledger_seq(), reused_count, utils::Timestamp::HighResolution() - start_time);
+	}
+
+	void LedgerFrm::PreApply(const std::vector<TransactionFrm::pointer> &txs, std::unordered_map<std::string, SpeculativeTx> &spec_txs) {
+		std::vector<SpeculativeTx> applied_txs(txs.size());
+		auto apply = [this, &txs, &applied_txs](size_t i) {
+			SpeculativeTx &spec_tx = applied_txs[i];
+			//The pooled frame is shared with the pool, apply a copy
+			spec_tx.tx_frm_ = std::make_shared<TransactionFrm>(txs[i]->GetTransactionEnv());
+			spec_tx.scheduled_ = spec_tx.tx_frm_->GetFootprint(spec_tx.footprint_);
+			if (spec_tx.scheduled_) {
+				ApplySpeculativeTx(spec_tx, true, NULL);
+			}
+		};
+
+		ParallelWorker *worker = ParallelWorker::GetInstance();
+		if (worker != NULL) {
+			worker->ParallelFor(applied_txs.size(), apply);
+		}
+		else {
+			for (size_t i = 0; i < applied_txs.size(); i++) {
+				apply(i);
+			}
+		}
+
+		for (size_t i = 0; i < applied_txs.size(); i++) {
+			SpeculativeTx &spec_tx = applied_txs[i];
+			if (spec_tx.applied_ && !spec_tx.expired_) {
+				spec_txs[spec_tx.tx_frm_->GetContentHash()] = spec_tx;
+			}
+		}
+	}
+
+	void LedgerFrm::ApplySpeculativeTx(SpeculativeTx &spec_tx, bool check, const Environment::Map *base) {
+		std::shared_ptr<Environment> environment = std::make_shared<Environment>();
+		environment->record_access_ = true;
+		environment->base_ = base;
+
+		//The same steps as applying in order, but on an environment over the earlier batches
+		TransactionFrm::pointer tx_frm = spec_tx.tx_frm_;
+		spec_tx.clean_ = false;
+		if (check && !tx_frm->ValidForApply(environment, !IsTestMode())) {
+			return;
+		}
+
+		int64_t fee = 0;
+		if (!tx_frm->PayFee(environment, fee)) {
+			return;
+		}
+		tx_frm->NonceIncrease(this, environment);
+		environment->Commit();
+
+		if (check) {
+			tx_frm->EnableChecked();
+			tx_frm->SetMaxEndTime(utils::Timestamp::HighResolution() + General::TX_EXECUTE_TIME_OUT);
+		}
+
+		spec_tx.apply_ret_ = tx_frm->Apply(this, environment);
+		spec_tx.expired_ = check && tx_frm->IsExpire(spec_tx.error_info_);
+		if (!spec_tx.expired_ && spec_tx.apply_ret_) {
+			tx_frm->ReturnFee(fee);
+			environment->Commit();
+		}
+		environment->ClearChangeBuf();
+
+		//The batches are only disjoint if the footprint covers every account touched
+		const std::unordered_set<std::string> *access_sets[] = { &environment->read_set_, &environment->write_set_ };
+		for (size_t i = 0; i < 2; i++) {
+			for (auto it = access_sets[i]->begin(); it != access_sets[i]->end(); it++) {
+				if (spec_tx.footprint_.find(*it) == spec_tx.footprint_.end()) {
+					LOG_ERROR("Failed to apply transaction(%s) ahead, account(%s) is out of its footprint",
+						utils::String::BinToHexString(tx_frm->GetContentHash()).c_str(), it->c_str());
+					return;
+				}
+			}
+		}
+
+		spec_tx.fee_ = fee;
+		spec_tx.environment_ = environment;
+		spec_tx.applied_ = true;
+	}
+
+	bool LedgerFrm::CommitSpeculative(SpeculativeTx &spec_tx) {
+		if (!spec_tx.applied_) {
+			return false;
+		}
+
+		//It has read the same states as applying in order unless a transaction applied in order has written one of them.
+		//The write set holds the writes of those transactions and the reads of the rejected ones, whose results the later batches have read.
+		std::unordered_set<std::string> &write_set = environment_->write_set_;
+		const std::unordered_set<std::string> &read_set = spec_tx.environment_->read_set_;
+		bool conflicted = false;
+		for (auto it = read_set.begin(); it != read_set.end() && !conflicted; it++) {
+			conflicted = write_set.find(*it) != write_set.end();
+		}
+
+		//Paying the fee in order fails if the total fee overflows
+		int64_t total_fee = 0;
+		if (conflicted || !utils::SafeIntAdd(total_fee_, spec_tx.tx_frm_->GetFeeLimit(), total_fee)) {
+			write_set.insert(read_set.begin(), read_set.end());
+			return false;
+		}
+		total_fee_ += spec_tx.fee_;
+
+		//The later transactions of the same accounts have read these states in the earlier batches
+		environment_->record_access_ = false;
+		const Environment::Map &entries = spec_tx.environment_->GetData();
+		for (auto it = entries.begin(); it != entries.end(); it++) {
+			environment_->AddEntry(it->first, it->second.ptr_);
+		}
+		environment_->Commit();
+		environment_->record_access_ = true;
+		spec_tx.tx_frm_->environment_ = environment_;
+		return true;
+	}
+
+	TransactionFrm::pointer LedgerFrm::NewTransactionFrm(std::vector<SpeculativeTx> &spec_txs, int32_t index, const protocol::TransactionEnv &txproto) {
+		//Reuse the frame built on the worker threads unless it has been applied ahead
+		if (!spec_txs.empty() && spec_txs[index].clean_) {
+			return spec_txs[index].tx_frm_;
+		}
+		return std::make_shared<TransactionFrm>(txproto);
+	}
+
 	Json::Value LedgerFrm::ToJson() {
 		return bumo::Proto2Json(ledger_);
 	}
@@ -488,6 +751,8 @@ namespace bumo {
 			std::string ss = account->Serializer();
 			std::string index = DecodeAddress(it->first);
 			bool is_new = trie->Set(index, ss);
+			batch->Put(AccountFrm::FlatAccountKey(it->first), ss);
+			LedgerManager::Instance().account_cache_.Stage(it->first, std::make_shared<protocol::Account>(account->ProtocolAccount()), ledger_.header().seq());
 			if (is_new){
 				new_count++;
 			}
@@ -38,6 +38,33 @@ namespace bumo {
 		void SetApply(ProposeTxsResult &result);
 	};
 
+	//A transaction applied ahead on its own environment over the states of the earlier batches
+	struct SpeculativeTx {
+		TransactionFrm::pointer tx_frm_;
+		std::shared_ptr<Environment> environment_;
+		std::set<std::string> footprint_;	//Accounts found by TransactionFrm::GetFootprint
+		bool scheduled_;	//The footprint is complete and no contract is triggered
+		size_t batch_;
+		bool clean_;	//tx_frm_ has not been touched and can still be applied in order
+		bool applied_;
+		bool apply_ret_;
+		bool expired_;
+		std::string error_info_;
+		int64_t fee_;	//Fee limit paid minus fee returned
+
+		SpeculativeTx() : scheduled_(false), batch_(0), clean_(true), applied_(false), apply_ret_(false), expired_(false), fee_(0) {}
+	};
+
+	class LedgerFrm;
+	//Pooled transactions applied one by one on the last closed ledger by the speculative checker, for the next proposal to reuse
+	struct PreAppliedTxs {
+		int64_t ledger_seq_;
+		std::shared_ptr<LedgerFrm> ledger_;	//The ledger the transactions were applied with
+		std::unordered_map<std::string, SpeculativeTx> txs_;	//By content hash
+
+		PreAppliedTxs() : ledger_seq_(0) {}
+	};
+
 	class LedgerContext;
 	class LedgerFrm {
 	public:
@@ -104,9 +131,17 @@ namespace bumo {
 		void SetTestMode(bool test_mode);
 		bool IsTestMode();
 
+		//Applies each transaction alone on the last closed ledger, keeps the ones applied without expiring
+		void PreApply(const std::vector<TransactionFrm::pointer> &txs, std::unordered_map<std::string, SpeculativeTx> &spec_txs);
+
 	private:
 		protocol::Ledger ledger_;
 		bool is_test_mode_;
+
+		void ApplySpeculative(const protocol::ConsensusValue& request, bool check, const std::set<int32_t> &skipped_txs, const PreAppliedTxs *pre_applied, std::vector<SpeculativeTx> &spec_txs);
+		void ApplySpeculativeTx(SpeculativeTx &spec_tx, bool check, const Environment::Map *base);
+		bool CommitSpeculative(SpeculativeTx &spec_tx);
+		TransactionFrm::pointer NewTransactionFrm(std::vector<SpeculativeTx> &spec_txs, int32_t index, const protocol::TransactionEnv &txproto);
 	public:
 		std::shared_ptr<protocol::ConsensusValue> value_;
 		std::vector<TransactionFrm::pointer> apply_tx_frms_;
@@ -22,7 +22,7 @@
 #include "fee_calculate.h"
 
 namespace bumo {
-	LedgerManager::LedgerManager() : tree_(NULL) {
+	LedgerManager::LedgerManager() : tree_(NULL), account_cache_(General::ACCOUNT_STATE_CACHE_SIZE) {
 		check_interval_ = 500 * utils::MICRO_UNITS_PER_MILLI;
 		timer_name_ = "Ledger Mananger";
 		chain_max_ledger_probaly_ = 0;
@@ -137,6 +137,11 @@ namespace bumo {
 			seq_kvdb = 1;
 		}
 
+		if (!BuildFlatIndex()) {
+			LOG_ERROR("Failed to build the flat account index.");
+			return false;
+		}
+
 		std::string str;
 		if (kvdb->Get(General::STATISTICS, str)) {
 			statistics_.fromString(str);
@@ -184,6 +189,11 @@ namespace bumo {
 			PROCESS_EXIT("Consensus ledger version:%d, software ledger version:%d", lclheader.version(), General::LEDGER_VERSION);
 		}
 
+		if (!writer_.Initialize(Configure::Instance().ledger_configure_.async_commit_enabled_)) {
+			LOG_ERROR("Failed to start the ledger writer");
+			return false;
+		}
+
 		TimerNotify::RegisterModule(this);
 		StatusModule::RegisterModule(this);
 		return true;
@@ -191,6 +201,7 @@ namespace bumo {
 
 	bool LedgerManager::Exit() {
 		LOG_INFO("Ledger manager stoping...");
+		writer_.Exit();
 
 		if (tree_) {
 			delete tree_;
@@ -385,6 +396,85 @@ namespace bumo {
 		return true;
 	}
 
+	bool LedgerManager::BuildFlatIndex() {
+		KeyValueDb *db = Storage::Instance().account_db();
+		int64_t lcl_seq = last_closed_ledger_->GetProtoHeader().seq();
+		std::string flat_index;
+		if (db->Get(General::KEY_FLAT_INDEX, flat_index) > 0 && utils::String::Stoi64(flat_index) == lcl_seq) {
+			return true;
+		}
+
+		//The index is kept in the same batch as the tries and marked with the ledger seq.
+		//It is missing or stale if the ledgers were closed by a version without it, then it is rebuilt from the tries.
+		LOG_INFO("Building the flat account index of ledger(" FMT_I64 ") from the account tree, the index is of ledger(%s)...",
+			lcl_seq, flat_index.empty() ? "none" : flat_index.c_str());
+		int64_t start_time = utils::Timestamp::HighResolution();
+
+		WRITE_BATCH batch;
+		if (!flat_index.empty()) {
+			//The assets and metadata deleted since then are still indexed, clear every key under the common prefix of the flat keys
+			const std::string flat_prefix = "flat_";
+#ifdef WIN32
+			leveldb::Iterator *it = (leveldb::Iterator *)db->NewIterator();
+#else
+			rocksdb::Iterator *it = (rocksdb::Iterator *)db->NewIterator();
+#endif
+			for (it->Seek(flat_prefix); it->Valid() && it->key().starts_with(flat_prefix); it->Next()) {
+				batch.Delete(it->key().ToString());
+			}
+			delete it;
+
+			if (!db->WriteBatch(batch)) {
+				LOG_ERROR("Failed to clear the flat account index, %s", db->error_desc().c_str());
+				return false;
+			}
+			batch.Clear();
+		}
+
+		std::vector<std::string> accounts;
+		tree_->GetAll("", accounts);
+		for (size_t i = 0; i < accounts.size(); i++) {
+			protocol::Account account;
+			if (!account.ParseFromString(accounts[i])) {
+				LOG_ERROR("Failed to parse account from the account tree.");
+				return false;
+			}
+			batch.Put(AccountFrm::FlatAccountKey(account.address()), accounts[i]);
+
+			AccountFrm account_frm(account);
+			std::vector<protocol::AssetStore> assets;
+			account_frm.GetAllAssets(assets);
+			for (size_t j = 0; j < assets.size(); j++) {
+				batch.Put(AccountFrm::FlatAssetKey(account.address(), assets[j].key().SerializeAsString()), assets[j].SerializeAsString());
+			}
+
+			std::vector<protocol::KeyPair> metadata;
+			account_frm.GetAllMetaData(metadata);
+			for (size_t j = 0; j < metadata.size(); j++) {
+				batch.Put(AccountFrm::FlatMetaDataKey(account.address(), metadata[j].key()), metadata[j].SerializeAsString());
+			}
+
+			if (WRITE_BATCH_DATA_SIZE(batch) > 64 * utils::BYTES_PER_MEGA) {
+				if (!db->WriteBatch(batch)) {
+					LOG_ERROR("Failed to write the flat account index, %s", db->error_desc().c_str());
+					return false;
+				}
+				batch.Clear();
+			}
+		}
+
+		batch.Put(General::KEY_FLAT_INDEX, utils::String::ToString(lcl_seq));
+		if (!db->WriteBatch(batch)) {
+			LOG_ERROR("Failed to write the flat account index, %s", db->error_desc().c_str());
+			return false;
+		}
+		tree_->FreeMemory(4);
+
+		LOG_INFO("Built the flat account index of " FMT_SIZE " accounts, time used(" FMT_I64 "ms)",
+			accounts.size(), (utils::Timestamp::HighResolution() - start_time) / utils::MICRO_UNITS_PER_MILLI);
+		return true;
+	}
+
 	//warn
 	void LedgerManager::CreateHardforkLedger() {
 		LOG_INFO("Are you sure to create hardfork ledger? Press y to continue.");
@@ -477,11 +567,13 @@ namespace bumo {
 			if (!Storage::Instance().account_db()->WriteBatch(*batch_account)) {
 				PROCESS_EXIT("Failed to write account to database, %s", Storage::Instance().account_db()->error_desc().c_str());
 			}
+			LedgerManager::GetInstance()->account_cache_.Publish(header->seq());
 
 			header->set_hash(HashWrapper::Crypto(ledger_frm->ProtoLedger().SerializeAsString()));
 
 			std::shared_ptr<WRITE_BATCH> batch = std::make_shared<WRITE_BATCH>();
 			batch->Put(bumo::General::KEY_LEDGER_SEQ, utils::String::ToString(header->seq()));
+			batch->Put(bumo::General::KEY_FLAT_INDEX, utils::String::ToString(header->seq()));
 			batch->Put(bumo::General::LAST_PROOF, "");
 
 			ValidatorsSet(batch, new_validator_set);
@@ -566,6 +658,7 @@ namespace bumo {
 			(utils::Timestamp::HighResolution() - begin_time) / utils::MICRO_UNITS_PER_MILLI);
 		data["hash_type"] = HashWrapper::GetLedgerHashType() == HashWrapper::HASH_TYPE_SM3 ? "sm3" : "sha256";
 		data["sync"] = sync_.ToJson();
+		data["write_queue_size"] = writer_.GetQueueSize();
 		context_manager_.GetModuleStatus(data["ledger_context"]);
 
 		data["chain_max_ledger_seq"] = chain_max_ledger_probaly_ > data["ledger_sequence"].asInt64() ?
@@ -603,13 +696,18 @@ namespace bumo {
 
 		int64_t time0 = utils::Timestamp().HighResolution();
 		int64_t new_count = 0, change_count = 0;
-		closing_ledger->Commit(tree_, new_count, change_count);
-		statistics_["account_count"] = statistics_["account_count"].asInt64() + new_count;
-
-		int64_t time1 = utils::Timestamp().HighResolution();
+		int64_t time1 = 0, time2 = 0;
+		{
+			//Readers walk the tree without caching, so only the mutation needs the exclusive lock.
+			//Leaf values are still read from the db, so readers keep seeing the last closed ledger until the batch below is written.
+			utils::WriteLockGuard guard(tree_mutex_);
+			closing_ledger->Commit(tree_, new_count, change_count);
+			time1 = utils::Timestamp().HighResolution();
 
-		tree_->UpdateHash();
-		int64_t time2 = utils::Timestamp().HighResolution();
+			tree_->UpdateHash();
+			time2 = utils::Timestamp().HighResolution();
+		}
+		statistics_["account_count"] = statistics_["account_count"].asInt64() + new_count;
 
 		header->set_account_tree_hash(tree_->GetRootHash());
 		header->set_tx_count(last_closed_ledger_->GetProtoHeader().tx_count() + closing_ledger->ProtoLedger().transaction_envs_size());
@@ -638,6 +736,7 @@ namespace bumo {
 		int64_t ledger_seq = closing_ledger->GetProtoHeader().seq();
 		std::shared_ptr<WRITE_BATCH> account_db_batch = tree_->batch_;
 		account_db_batch->Put(bumo::General::KEY_LEDGER_SEQ, utils::String::Format(FMT_I64, ledger_seq));
+		account_db_batch->Put(bumo::General::KEY_FLAT_INDEX, utils::String::Format(FMT_I64, ledger_seq));
 
 		//for validator upgrade
 		if (new_set.validators_size() > 0 || closing_ledger->environment_->GetVotedValidators(validators_, new_set)) {
@@ -664,19 +763,20 @@ namespace bumo {
 		proof_ = proof;
 
 		//consensus value
-		WRITE_BATCH ledger_db_batch;
-		ledger_db_batch.Put(ComposePrefix(General::CONSENSUS_VALUE_PREFIX, consensus_value.ledger_seq()), consensus_value.SerializeAsString());
+		std::shared_ptr<WRITE_BATCH> ledger_db_batch = std::make_shared<WRITE_BATCH>();
+		ledger_db_batch->Put(ComposePrefix(General::CONSENSUS_VALUE_PREFIX, consensus_value.ledger_seq()), consensus_value.SerializeAsString());
 
+		//The state root is computed above, only the db write may be left to the writer thread
+		writer_.WaitForRoom();
 		do {
 			utils::WriteLockGuard guard(Storage::Instance().account_ledger_lock_);
 
-			if (!closing_ledger->AddToDb(ledger_db_batch)) {
+			if (!closing_ledger->AddToDb(*ledger_db_batch)) {
 				PROCESS_EXIT("Failed to write ledger to database.");
 			}
 
-			if (!Storage::Instance().account_db()->WriteBatch(*account_db_batch)) {
-				PROCESS_EXIT("Failed to write accounts to database: %s", Storage::Instance().account_db()->error_desc().c_str());
-			}
+			writer_.Write(ledger_seq, ledger_db_batch, account_db_batch);
+			account_cache_.Publish(consensus_value.ledger_seq());
 
 		} while (false);
 
@@ -726,10 +826,12 @@ namespace bumo {
 		//Broadcast that the ledger is closed.
 		WebSocketServer::Instance().BroadcastMsg(protocol::CHAIN_LEDGER_HEADER, tmp_lcl_header.SerializeAsString());
 
-		// The broadcast message is applied.
+		// The broadcast message is applied, pushed as one ledger close event to the subscribers.
+		protocol::ChainLedgerClose ledger_close;
+		*ledger_close.mutable_header() = tmp_lcl_header;
 		for (size_t i = 0; i < closing_ledger->apply_tx_frms_.size(); i++) {
 			TransactionFrm::pointer tx = closing_ledger->apply_tx_frms_[i];
-			protocol::TransactionEnvStore apply_tx_msg;
+			protocol::TransactionEnvStore &apply_tx_msg = *ledger_close.add_transactions();
 			*apply_tx_msg.mutable_transaction_env() = closing_ledger->apply_tx_frms_[i]->GetTransactionEnv();
 			apply_tx_msg.set_ledger_seq(closing_ledger->GetProtoHeader().seq());
 			apply_tx_msg.set_close_time(closing_ledger->GetProtoHeader().close_time());
@@ -747,14 +849,13 @@ namespace bumo {
 				apply_tx_msg.set_actual_fee(actual_fee);
 			}
 
-			WebSocketServer::Instance().BroadcastChainTxMsg(apply_tx_msg);
-
 			if (tx->GetResult().code() == protocol::ERRCODE_SUCCESS)
 			for (size_t j = 0; j < tx->instructions_.size(); j++) {
 				const protocol::TransactionEnvStore &env_sto = tx->instructions_.at(j);
-				WebSocketServer::Instance().BroadcastChainTxMsg(env_sto);
+				*ledger_close.add_transactions() = env_sto;
 			}
 		}
+		WebSocketServer::Instance().BroadcastLedgerClose(ledger_close);
 		// notice dropped
 		/*
 		for (size_t i = 0; i < closing_ledger->dropped_tx_frms_.size(); i++) {
@@ -835,6 +936,9 @@ namespace bumo {
 			}
 		} while (false);
 		if (ret) {
+			//Serve the proof only after the ledgers are durable
+			writer_.WaitWritten(message.end());
+
 			bumo::WsMessagePointer ws = std::make_shared<protocol::WsMessage>();
 			ws->set_data(ledgers.SerializeAsString());
 			ws->set_type(protocol::OVERLAY_MSGTYPE_LEDGERS);
@@ -968,7 +1072,7 @@ namespace bumo {
 				new_tx->Apply(ledger_context->closing_ledger_.get(), cacheEnv, true);
 			}
 			else {
-				TransactionFrm::AddActualFee(bottom_tx, new_tx.get());
+				TransactionFrm::AddActualFee(bottom_tx.get(), new_tx.get());
 			}
 
 			//Throw the contract
@@ -25,6 +25,8 @@
 #include "ledger/ledger_frm.h"
 #include "ledgercontext_manager.h"
 #include "environment.h"
+#include "account_cache.h"
+#include "ledger_writer.h"
 #include "kv_trie.h"
 #include "proto/cpp/consensus.pb.h"
 
@@ -83,6 +85,8 @@ namespace bumo {
 		Json::Value statistics_;
 		utils::ReadWriteLock tree_mutex_;
 		KVTrie* tree_;
+		AccountStateCache account_cache_;
+		LedgerWriter writer_;
 
 		LedgerContextManager context_manager_;
 	private:
@@ -96,6 +100,7 @@ namespace bumo {
 		bool CloseLedger(const protocol::ConsensusValue& request, const std::string& proof);
 
 		bool CreateGenesisAccount();
+		bool BuildFlatIndex();
 
 		static void ValidatorsSet(std::shared_ptr<WRITE_BATCH> batch, const protocol::ValidatorSet& validators);
 		static bool ValidatorsGet(const std::string& hash, protocol::ValidatorSet& vlidators_set);
@@ -0,0 +1,126 @@
+/*
+	bumo is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	bumo is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with bumo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <utils/logger.h>
+#include "ledger_writer.h"
+
+namespace bumo {
+	LedgerWriter::LedgerWriter() : thread_ptr_(NULL) {}
+
+	LedgerWriter::~LedgerWriter() {}
+
+	bool LedgerWriter::Initialize(bool enabled) {
+		if (!enabled) {
+			return true;
+		}
+
+		thread_ptr_ = new utils::Thread(this);
+		if (!thread_ptr_->Start("ledger-writer")) {
+			delete thread_ptr_;
+			thread_ptr_ = NULL;
+			return false;
+		}
+		return true;
+	}
+
+	bool LedgerWriter::Exit() {
+		if (thread_ptr_ != NULL) {
+			job_queued_.notify_all();
+			thread_ptr_->JoinWithStop();
+			delete thread_ptr_;
+			thread_ptr_ = NULL;
+		}
+		return true;
+	}
+
+	void LedgerWriter::WaitForRoom() {
+		std::unique_lock<std::mutex> guard(lock_);
+		job_written_.wait(guard, [this]() { return jobs_.size() < MAX_QUEUE_SIZE; });
+	}
+
+	void LedgerWriter::Write(int64_t seq, const std::shared_ptr<WRITE_BATCH> &ledger_batch, const std::shared_ptr<WRITE_BATCH> &account_batch) {
+		Job job;
+		job.seq_ = seq;
+		job.ledger_batch_ = ledger_batch;
+		job.account_batch_ = account_batch;
+		if (thread_ptr_ == NULL) {
+			WriteJob(job);
+			return;
+		}
+
+		Storage::Instance().ledger_db()->AddPending(*ledger_batch);
+		Storage::Instance().account_db()->AddPending(*account_batch);
+		do {
+			std::lock_guard<std::mutex> guard(lock_);
+			jobs_.push_back(job);
+		} while (false);
+		job_queued_.notify_one();
+	}
+
+	void LedgerWriter::WaitWritten(int64_t seq) {
+		std::unique_lock<std::mutex> guard(lock_);
+		job_written_.wait(guard, [this, seq]() { return jobs_.empty() || jobs_.front().seq_ > seq; });
+	}
+
+	size_t LedgerWriter::GetQueueSize() {
+		std::lock_guard<std::mutex> guard(lock_);
+		return jobs_.size();
+	}
+
+	void LedgerWriter::WriteJob(const Job &job) {
+		//The ledger db goes first, the same order CheckAndRepairLedgerSeq expects
+		if (!Storage::Instance().ledger_db()->WriteBatch(*job.ledger_batch_)) {
+			PROCESS_EXIT("Failed to write ledger(" FMT_I64 ") to database: %s", job.seq_, Storage::Instance().ledger_db()->error_desc().c_str());
+		}
+
+		if (!Storage::Instance().account_db()->WriteBatch(*job.account_batch_)) {
+			PROCESS_EXIT("Failed to write accounts of ledger(" FMT_I64 ") to database: %s", job.seq_, Storage::Instance().account_db()->error_desc().c_str());
+		}
+	}
+
+	void LedgerWriter::Run(utils::Thread *thread) {
+		while (true) {
+			Job job;
+			bool has_job = false;
+			do {
+				std::unique_lock<std::mutex> guard(lock_);
+				if (jobs_.empty() && thread->enabled()) {
+					job_queued_.wait_for(guard, std::chrono::milliseconds(100));
+				}
+				if (!jobs_.empty()) {
+					job = jobs_.front();
+					has_job = true;
+				}
+			} while (false);
+
+			if (!has_job) {
+				//Stop only after the queued ledgers are written
+				if (!thread->enabled()) break;
+				continue;
+			}
+
+			int64_t start_time = utils::Timestamp::HighResolution();
+			WriteJob(job);
+			Storage::Instance().ledger_db()->RemovePending();
+			Storage::Instance().account_db()->RemovePending();
+			do {
+				std::lock_guard<std::mutex> guard(lock_);
+				jobs_.pop_front();
+			} while (false);
+			job_written_.notify_all();
+			LOG_TRACE("Wrote ledger(" FMT_I64 ") to database, time used(" FMT_I64 "us)", job.seq_, utils::Timestamp::HighResolution() - start_time);
+		}
+	}
+}
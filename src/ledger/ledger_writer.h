@@ -0,0 +1,68 @@
+/*
+	bumo is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	bumo is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with bumo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef LEDGER_WRITER_H_
+#define LEDGER_WRITER_H_
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <utils/thread.h>
+#include <common/storage.h>
+
+namespace bumo {
+	//Writes the batches of closed ledgers to the ledger db and account db in order on a dedicated thread.
+	//The batches are readable through KeyValueDb::Get as soon as they are queued, so only durability lags behind consensus.
+	//A crash loses at most the queued ledgers, and CheckAndRepairLedgerSeq repairs a ledger db written ahead of the account db.
+	class LedgerWriter : public utils::Runnable {
+	public:
+		LedgerWriter();
+		~LedgerWriter();
+
+		//Start the writer thread if enabled, otherwise Write writes on the calling thread
+		bool Initialize(bool enabled);
+		//Write the queued ledgers and stop the writer thread
+		bool Exit();
+
+		//Block while too many closed ledgers wait to be written. Call it before taking account_ledger_lock_.
+		void WaitForRoom();
+		//Queue the batches of a closed ledger. Call it with account_ledger_lock_ held so readers see both batches at once.
+		void Write(int64_t seq, const std::shared_ptr<WRITE_BATCH> &ledger_batch, const std::shared_ptr<WRITE_BATCH> &account_batch);
+		//Block until the ledger seq and the earlier ones are written to the db
+		void WaitWritten(int64_t seq);
+		size_t GetQueueSize();
+
+		virtual void Run(utils::Thread *thread) override;
+
+	private:
+		struct Job {
+			int64_t seq_;
+			std::shared_ptr<WRITE_BATCH> ledger_batch_;
+			std::shared_ptr<WRITE_BATCH> account_batch_;
+		};
+
+		static const size_t MAX_QUEUE_SIZE = 4;
+
+		void WriteJob(const Job &job);
+
+		utils::Thread *thread_ptr_;
+		std::mutex lock_;
+		std::deque<Job> jobs_;	//The front one is being written
+		std::condition_variable job_queued_;
+		std::condition_variable job_written_;	//Notified by the writer thread after each job
+	};
+}
+
+#endif
@@ -394,6 +394,45 @@ namespace bumo {
 		return result;
 	}
 
+	bool OperationFrm::GetFootprint(const protocol::Operation& ope, const std::string &source_address, std::set<std::string> &accounts) {
+		accounts.insert(source_address);
+
+		std::string dest_address;
+		switch (ope.type()) {
+		case protocol::Operation_Type_CREATE_ACCOUNT:
+			//An empty dest address is generated for a contract
+			if (!ope.create_account().contract().payload().empty() || ope.create_account().dest_address().empty()) {
+				return false;
+			}
+			accounts.insert(ope.create_account().dest_address());
+			return true;
+		case protocol::Operation_Type_PAY_COIN:
+			dest_address = ope.pay_coin().dest_address();
+			break;
+		case protocol::Operation_Type_PAY_ASSET:
+			dest_address = ope.pay_asset().dest_address();
+			break;
+		case protocol::Operation_Type_ISSUE_ASSET:
+		case protocol::Operation_Type_SET_METADATA:
+		case protocol::Operation_Type_SET_SIGNER_WEIGHT:
+		case protocol::Operation_Type_SET_THRESHOLD:
+		case protocol::Operation_Type_SET_PRIVILEGE:
+		case protocol::Operation_Type_LOG:
+			return true;
+		default:
+			return false;
+		}
+
+		//A payment triggers the contract of the dest account. Contract code is only set when an account is created,
+		//and an account created in the same ledger is in the footprint of the creating transaction.
+		accounts.insert(dest_address);
+		AccountFrm::pointer dest_account;
+		if (Environment::AccountFromDB(dest_address, dest_account) && !dest_account->GetProtoAccount().contract().payload().empty()) {
+			return false;
+		}
+		return true;
+	}
+
 	bool OperationFrm::CheckSignature(std::shared_ptr<Environment> txenvironment) {
 		std::string source_address_ = operation_.source_address();
 		if (source_address_.size() == 0) {
@@ -46,6 +46,9 @@ namespace bumo{
 		int64_t GetOpeFee() const;
 
 		static Result CheckValid(const protocol::Operation& ope, const std::string &source_address);
+
+		//Add the accounts the operation touches to accounts. Returns false if it may trigger a contract or its accounts are only known when it is applied.
+		static bool GetFootprint(const protocol::Operation& ope, const std::string &source_address, std::set<std::string> &accounts);
 	protected:
 		void CreateAccount(std::shared_ptr<Environment> environment);
 		void IssueAsset(std::shared_ptr<Environment> environment);
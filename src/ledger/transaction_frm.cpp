@@ -89,6 +89,35 @@ namespace bumo {
 		}
 	}
 
+	void TransactionFrm::ToJson(std::string &out) {
+		//Members in the order of the sorted Json::Value, the envelope ones fall between ledger_seq and tx_size
+		out += "{\"actual_fee\":";
+		JsonWriteInt64(actual_gas_for_query_, out);
+		out += ",\"close_time\":";
+		JsonWriteUInt64(apply_time_, out);
+		if (!contract_tx_hashes_.empty()) {
+			out += ",\"contract_tx_hashes\":[";
+			for (auto it = contract_tx_hashes_.begin(); it != contract_tx_hashes_.end(); it++) {
+				if (it != contract_tx_hashes_.begin()) out += ',';
+				JsonWriteHex(*it, out);
+			}
+			out += ']';
+		}
+		out += ",\"error_code\":";
+		JsonWriteInt64(result_.code(), out);
+		out += ",\"error_desc\":";
+		JsonWriteString(result_.desc(), out);
+		out += ",\"hash\":";
+		JsonWriteHex(hash_, out);
+		out += ",\"ledger_seq\":";
+		JsonWriteInt64(ledger_seq_, out);
+		out += ',';
+		if (Proto2JsonWriteMembers(transaction_env_, out) > 0) out += ',';
+		out += "\"tx_size\":";
+		JsonWriteInt64(transaction_env_.ByteSize(), out);
+		out += '}';
+	}
+
 	void TransactionFrm::CacheTxToJson(Json::Value &result){
 		result = Proto2Json(transaction_env_);
 		result["incoming_time"] = incoming_time_;
@@ -403,9 +432,27 @@ namespace bumo {
 		return false;
 	}
 
+	bool TransactionFrm::GetFootprint(std::set<std::string> &accounts) const {
+		const protocol::Transaction &tran = transaction_env_.transaction();
+		accounts.insert(tran.source_address());
+		for (int i = 0; i < tran.operations_size(); i++) {
+			const protocol::Operation &ope = tran.operations(i);
+			std::string ope_source = !ope.source_address().empty() ? ope.source_address() : tran.source_address();
+			if (!OperationFrm::GetFootprint(ope, ope_source, accounts)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
 	bool TransactionFrm::CheckValid(int64_t last_seq, bool check_priv, int64_t &nonce) {
 		AccountFrm::pointer source_account;
-		if (!Environment::AccountFromDB(GetSourceAddress(), source_account)) {
+		Environment::AccountFromDB(GetSourceAddress(), source_account);
+		return CheckValid(last_seq, check_priv, nonce, source_account);
+	}
+
+	bool TransactionFrm::CheckValid(int64_t last_seq, bool check_priv, int64_t &nonce, AccountFrm::pointer source_account) {
+		if (!source_account) {
 			result_.set_code(protocol::ERRCODE_ACCOUNT_NOT_EXIST);
 			result_.set_desc(utils::String::Format("Source account(%s) does not exist", GetSourceAddress().c_str()));
 			LOG_ERROR("%s", result_.desc().c_str());
@@ -633,7 +680,7 @@ namespace bumo {
 		return true;
 	}
 
-	bool TransactionFrm::AddActualFee(TransactionFrm::pointer bottom_tx, TransactionFrm* txfrm){
+	bool TransactionFrm::AddActualFee(TransactionFrm* bottom_tx, TransactionFrm* txfrm){
 		bottom_tx->AddActualGas(txfrm->GetSelfGas());
 		int64_t actual_fee = 0;
 		if (!utils::SafeIntMul(bottom_tx->GetActualGas(), bottom_tx->GetGasPrice(), actual_fee)){
@@ -761,7 +808,9 @@ namespace bumo {
 		ledger_ = ledger_frm;
 		environment_ = parent;
 
-		bool ret = TransactionFrm::AddActualFee(ledger_frm->lpledger_context_->GetBottomTx(), this);
+		//A transaction applied by the ledger is the bottom of its own stack, so it does not need the ledger context when it is applied ahead on a worker thread
+		TransactionFrm *bottom_tx = bool_contract ? ledger_frm->lpledger_context_->GetBottomTx().get() : this;
+		bool ret = TransactionFrm::AddActualFee(bottom_tx, this);
 		if (!ret) return ret;
 
 		bool bSucess = true;
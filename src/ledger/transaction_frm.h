@@ -49,6 +49,8 @@ namespace bumo {
 		std::string GetContentData() const;
 
 		void ToJson(Json::Value &result);
+		//Appends the same text as ToJson(result).toFastString()
+		void ToJson(std::string &out);
 		void CacheTxToJson(Json::Value &result);
 
 		std::string GetSourceAddress() const;
@@ -57,6 +59,8 @@ namespace bumo {
 		const protocol::TransactionEnv &GetTransactionEnv() const;
 
 		bool CheckValid(int64_t last_seq, bool check_priv, int64_t& nonce);
+		//Checks against a source account loaded by the caller, NULL if it does not exist
+		bool CheckValid(int64_t last_seq, bool check_priv, int64_t& nonce, AccountFrm::pointer source_account);
 		bool SignerHashPriv(AccountFrm::pointer account_ptr, int32_t type) const;
 		Result GetResult() const;
 
@@ -86,8 +90,11 @@ namespace bumo {
 		
 		bool ValidForApply(std::shared_ptr<Environment> environment, bool check_priv = true);
 
+		//Accounts touched by the transaction, see OperationFrm::GetFootprint
+		bool GetFootprint(std::set<std::string> &accounts) const;
+
 		bool CheckFee(const int64_t& gas_price, const int64_t& fee_limit, AccountFrm::pointer account);
-		static bool AddActualFee(TransactionFrm::pointer bottom_tx, TransactionFrm* txfrm);
+		static bool AddActualFee(TransactionFrm* bottom_tx, TransactionFrm* txfrm);
 
 		bool PayFee(std::shared_ptr<Environment> environment,int64_t& total_fee);
 		bool ReturnFee(int64_t& total_fee);
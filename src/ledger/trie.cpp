@@ -13,6 +13,7 @@
 	along with bumo.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <cstring>
 #include <utils/logger.h>
 #include "utils/strings.h"
 #include "trie.h"
@@ -30,13 +31,154 @@ namespace bumo{
 	-----------------------------
 	*/
 
+	ChildEntry::ChildEntry() :type_(protocol::NONE), hash_size_(0){}
+
+	bool ChildEntry::Empty() const{
+		return sublocation_.empty() && type_ == protocol::NONE && hash_size_ == 0;
+	}
+
+	HASH ChildEntry::Hash() const{
+		return HASH(hash_, hash_size_);
+	}
+
+	void ChildEntry::SetHash(const HASH& hash){
+		if (hash.size() > HASH_SIZE){
+			PROCESS_EXIT("Hash size(%d) of trie node exceeds %d", (int)hash.size(), (int)HASH_SIZE);
+		}
+		memcpy(hash_, hash.data(), hash.size());
+		hash_size_ = (uint8_t)hash.size();
+	}
+
+	static size_t BitCount(uint32_t value){
+		value = value - ((value >> 1) & 0x55555555);
+		value = (value & 0x33333333) + ((value >> 2) & 0x33333333);
+		return (((value + (value >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+	}
+
+	static void AppendVarint(std::string& out, uint64_t value){
+		while (value >= 0x80){
+			out.push_back((char)(value | 0x80));
+			value >>= 7;
+		}
+		out.push_back((char)value);
+	}
+
+	static size_t VarintSize(uint64_t value){
+		size_t size = 1;
+		while (value >= 0x80){
+			value >>= 7;
+			size++;
+		}
+		return size;
+	}
+
+	ChildTable::ChildTable() :present_(0){}
+
+	size_t ChildTable::Index(int slot) const{
+		return BitCount(present_ & ((1u << slot) - 1));
+	}
+
+	const ChildEntry* ChildTable::Get(int slot) const{
+		if ((present_ & (1u << slot)) == 0){
+			return nullptr;
+		}
+		return &entries_[Index(slot)];
+	}
+
+	protocol::CHILDTYPE ChildTable::Type(int slot) const{
+		const ChildEntry* entry = Get(slot);
+		return entry == nullptr ? protocol::NONE : entry->type_;
+	}
+
+	ChildEntry& ChildTable::Mutable(int slot){
+		size_t index = Index(slot);
+		if ((present_ & (1u << slot)) == 0){
+			present_ |= (1u << slot);
+			entries_.insert(entries_.begin() + index, ChildEntry());
+		}
+		return entries_[index];
+	}
+
+	void ChildTable::Set(int slot, const ChildEntry& entry){
+		if (entry.Empty()){
+			Clear(slot);
+		}
+		else{
+			Mutable(slot) = entry;
+		}
+	}
+
+	void ChildTable::Clear(int slot){
+		if ((present_ & (1u << slot)) != 0){
+			entries_.erase(entries_.begin() + Index(slot));
+			present_ &= ~(1u << slot);
+		}
+	}
+
+	void ChildTable::FromProto(const protocol::Node& node){
+		present_ = 0;
+		entries_.clear();
+		for (int i = 0; i < node.children_size() && i <= LEAF_SLOT; i++){
+			const protocol::Child& child = node.children(i);
+			ChildEntry entry;
+			entry.sublocation_ = child.sublocation();
+			entry.type_ = child.childtype();
+			entry.SetHash(child.hash());
+			Set(i, entry);
+		}
+	}
+
+	void ChildTable::ToProto(protocol::Node& node) const{
+		node.Clear();
+		for (int i = 0; i <= LEAF_SLOT; i++){
+			protocol::Child* child = node.add_children();
+			const ChildEntry* entry = Get(i);
+			if (entry != nullptr){
+				child->set_sublocation(entry->sublocation_);
+				child->set_hash(entry->Hash());
+				child->set_childtype(entry->type_);
+			}
+		}
+	}
+
+	std::string ChildTable::Encode() const{
+		//Node.children is field 1 and Child has sublocation(1), hash(2) and childtype(3), the default values are omitted
+		std::string out;
+		out.reserve(entries_.size() * (ChildEntry::HASH_SIZE + 32) + LEAF_SLOT + 1);
+		for (int i = 0; i <= LEAF_SLOT; i++){
+			const ChildEntry* entry = Get(i);
+			out.push_back(0x0A);
+			if (entry == nullptr){
+				out.push_back(0);
+				continue;
+			}
+
+			size_t size = 0;
+			if (!entry->sublocation_.empty()) size += 1 + VarintSize(entry->sublocation_.size()) + entry->sublocation_.size();
+			if (entry->hash_size_ > 0) size += 1 + VarintSize(entry->hash_size_) + entry->hash_size_;
+			if (entry->type_ != protocol::NONE) size += 1 + VarintSize(entry->type_);
+			AppendVarint(out, size);
+
+			if (!entry->sublocation_.empty()){
+				out.push_back(0x0A);
+				AppendVarint(out, entry->sublocation_.size());
+				out.append(entry->sublocation_);
+			}
+			if (entry->hash_size_ > 0){
+				out.push_back(0x12);
+				AppendVarint(out, entry->hash_size_);
+				out.append(entry->hash_, entry->hash_size_);
+			}
+			if (entry->type_ != protocol::NONE){
+				out.push_back(0x18);
+				AppendVarint(out, entry->type_);
+			}
+		}
+		return out;
+	}
+
 	NodeFrm::NodeFrm(const Location& location)
 		:leaf_(nullptr),  /*indb_(false),leaf_indb_(false),*/ leaf_deleted_(false), modified_(true), location_(location){
-		for (int i = 0; i <= 16; i++){
-			protocol::Child* ch = info_.add_children();
-			if (i != 16)
-				children_[i] = nullptr;
-		}
 		NEWCOUNT++;
 	}
 
@@ -44,25 +186,23 @@ namespace bumo{
 		modified_ = true;
 		leaf_deleted_ = false;
 		leaf_ = std::make_shared<std::string>(v);
-		protocol::Child* ch16 = info_.mutable_children(16);
-		ch16->set_childtype(protocol::LEAF);
-		ch16->set_sublocation(location_);
+		ChildEntry& leaf = info_.Mutable(ChildTable::LEAF_SLOT);
+		leaf.type_ = protocol::LEAF;
+		leaf.sublocation_ = location_;
 	}
 
 	void NodeFrm::MarkRemove(){
 		modified_ = true;
 		leaf_deleted_ = true;
 		leaf_ = nullptr;
-		protocol::Child* ch16 = info_.mutable_children(16);
-		ch16->Clear();
+		info_.Clear(ChildTable::LEAF_SLOT);
 	}
 
 	void NodeFrm::SetChild(int branch, POINTER child){
 		assert(branch < 16);
 		modified_ = true;
 		children_[branch] = child;
-		info_.mutable_children(branch)->set_sublocation(child->location_);
-		//info_.mutable_children(branch)->set_childtype();
+		info_.Mutable(branch).sublocation_ = child->location_;
 	}
 
 	NodeFrm::~NodeFrm(){
@@ -98,22 +238,23 @@ namespace bumo{
 	NodeFrm::POINTER Trie::ChildMayFromDB(NodeFrm::POINTER node, int branch) {
 		if (node->children_[branch] == nullptr){
 			NodeFrm::POINTER frm = nullptr;
-			const protocol::Child& chd = node->info_.children(branch);
-			if (chd.childtype() == protocol::NONE){
+			const ChildEntry* chd = node->info_.Get(branch);
+			if (chd == nullptr || chd->type_ == protocol::NONE){
 				return nullptr;
 			}
 
-			frm = std::make_shared<NodeFrm>(chd.sublocation());
+			frm = std::make_shared<NodeFrm>(chd->sublocation_);
 			frm->modified_ = false;
 
-			if (chd.childtype() == protocol::LEAF){
-				frm->info_.mutable_children(16)->CopyFrom(node->info_.children(branch));
-
+			if (chd->type_ == protocol::LEAF){
+				frm->info_.Set(ChildTable::LEAF_SLOT, *chd);
 			}
-			else if (chd.childtype() == protocol::INNER){
-				if (!storage_load(chd.sublocation(), frm->info_)){
-					PROCESS_EXIT("load:%s failed", utils::String::BinToHexString(chd.sublocation()).c_str());
+			else if (chd->type_ == protocol::INNER){
+				protocol::Node info;
+				if (!storage_load(chd->sublocation_, info)){
+					PROCESS_EXIT("load:%s failed", utils::String::BinToHexString(chd->sublocation_).c_str());
 				}
+				frm->info_.FromProto(info);
 			}
 			node->children_[branch] = frm;
 		}
@@ -179,81 +320,127 @@ namespace bumo{
 		return location + key;
 	}
 
-	protocol::Child Trie::update_hash(NodeFrm::POINTER node){
-
-		int branch_count = 0;
-		int onlybranch = -1;
-		int64_t children_count = 0;
+	//A modified node waiting for its entry, and the slot of the parent the entry goes to
+	struct HashTask{
+		NodeFrm::POINTER node_;
+		NodeFrm *parent_;
+		int branch_;
+	};
 
-		//////////////////////////////////////////////////////////////
-		if (!node->leaf_deleted_){
-			if (node->leaf_ != nullptr){
-				protocol::Child* this_child = node->info_.mutable_children(16);
-#ifdef COUNT
-				this_child->set_count(1);
-#endif
-				this_child->set_sublocation(node->location_);
-				this_child->set_hash(HashCrypto(*(node->leaf_)));
-				this_child->set_childtype(protocol::LEAF);
-				StorageSaveLeaf(node);
-			}
-		}
-		else{
-			protocol::Child* ch = node->info_.mutable_children(16);
-			ch->Clear();
-			StorageDeleteLeaf(node);
-		}
-
-		if (node->info_.children(16).childtype() != protocol::CHILDTYPE::NONE){
-			branch_count++;
-			onlybranch = 16;
-			children_count++;
+	static void CollectModified(NodeFrm::POINTER node, NodeFrm *parent, int branch, size_t depth, std::vector<std::vector<HashTask> >& levels){
+		if (levels.size() <= depth){
+			levels.resize(depth + 1);
 		}
+		HashTask task = { node, parent, branch };
+		levels[depth].push_back(task);
 
 		for (int i = 0; i < 16; i++){
 			NodeFrm::POINTER child = node->children_[i];
 			if ((child != nullptr) && (child->modified_)){
-				protocol::Child childresult = update_hash(child);
-				node->info_.mutable_children(i)->CopyFrom(childresult);
+				CollectModified(child, node.get(), i, depth + 1, levels);
 			}
+		}
+	}
 
-			if (node->info_.children(i).childtype() != protocol::CHILDTYPE::NONE){
-				branch_count++;
-				onlybranch = i;
-#ifdef COUNT
-				if (node->info_.children(i).count() == 0){
-					printf("fatel error");
+	void Trie::HashCryptoBatch(const std::vector<const std::string *>& inputs, std::vector<std::string>& outputs){
+		outputs.resize(inputs.size());
+		for (size_t i = 0; i < inputs.size(); i++){
+			outputs[i] = HashCrypto(*inputs[i]);
+		}
+	}
+
+	ChildEntry Trie::update_hash(NodeFrm::POINTER node){
+		//A node only needs the entries of its children, so the modified nodes are hashed a level at a time,
+		//deepest first, one batch per level. The leaves depend on nothing and all go in the first batch.
+		std::vector<std::vector<HashTask> > levels;
+		CollectModified(node, nullptr, 0, 0, levels);
+
+		std::vector<NodeFrm::POINTER> leaf_nodes;
+		std::vector<const std::string *> inputs;
+		std::vector<std::string> hashes;
+		for (size_t depth = 0; depth < levels.size(); depth++){
+			for (size_t i = 0; i < levels[depth].size(); i++){
+				NodeFrm::POINTER current = levels[depth][i].node_;
+				if (!current->leaf_deleted_){
+					if (current->leaf_ != nullptr){
+						leaf_nodes.push_back(current);
+						inputs.push_back(current->leaf_.get());
+					}
+				}
+				else{
+					current->info_.Clear(ChildTable::LEAF_SLOT);
+					StorageDeleteLeaf(current);
 				}
-				children_count += node->info_.children(i).count();
-#endif
 			}
 		}
 
+		HashCryptoBatch(inputs, hashes);
+		for (size_t i = 0; i < leaf_nodes.size(); i++){
+			ChildEntry& this_child = leaf_nodes[i]->info_.Mutable(ChildTable::LEAF_SLOT);
+			this_child.sublocation_ = leaf_nodes[i]->location_;
+			this_child.SetHash(hashes[i]);
+			this_child.type_ = protocol::LEAF;
+			StorageSaveLeaf(leaf_nodes[i]);
+		}
+
+		ChildEntry root_result;
+		std::vector<std::string> encoded;
+		std::vector<size_t> hashed;
+		for (size_t depth = levels.size(); depth-- > 0;){
+			std::vector<HashTask>& level = levels[depth];
+			std::vector<ChildEntry> results(level.size());
+			encoded.clear();
+			hashed.clear();
+
+			for (size_t i = 0; i < level.size(); i++){
+				NodeFrm::POINTER current = level[i].node_;
+				int branch_count = 0;
+				int onlybranch = -1;
+				for (int slot = 0; slot <= ChildTable::LEAF_SLOT; slot++){
+					if (current->info_.Type(slot) != protocol::CHILDTYPE::NONE){
+						branch_count++;
+						onlybranch = slot;
+					}
+				}
 
-		protocol::Child result;
-#ifdef COUNT
-		result.set_count(children_count);
-#endif		
-		if (branch_count == 0 && node->location_ != rootl){
-			StorageDeleteNode(node);
-			//node->indb_ = false;
-		}
-		else if (branch_count == 1 && node->location_ != rootl){
-			StorageDeleteNode(node);
-			//node->indb_ = false;
-			result.CopyFrom(node->info_.children(onlybranch));
-		}
-		else {
-			StorageSaveNode(node);
-			result.set_hash(HashCrypto(node->info_.SerializeAsString()));
-			result.set_sublocation(node->location_);
-			result.set_childtype(protocol::CHILDTYPE::INNER);
-#ifdef COUNT
-			result.set_count(children_count);
-#endif
+				if (branch_count == 0 && current->location_ != rootl){
+					StorageDeleteNode(current);
+				}
+				else if (branch_count == 1 && current->location_ != rootl){
+					StorageDeleteNode(current);
+					results[i] = *current->info_.Get(onlybranch);
+				}
+				else {
+					//The node is hashed and stored in the protobuf encoding without building the protobuf
+					encoded.push_back(current->info_.Encode());
+					StorageSaveNode(current, encoded.back());
+					hashed.push_back(i);
+				}
+			}
+
+			inputs.clear();
+			for (size_t j = 0; j < encoded.size(); j++){
+				inputs.push_back(&encoded[j]);
+			}
+			HashCryptoBatch(inputs, hashes);
+			for (size_t j = 0; j < hashed.size(); j++){
+				ChildEntry& result = results[hashed[j]];
+				result.SetHash(hashes[j]);
+				result.sublocation_ = level[hashed[j]].node_->location_;
+				result.type_ = protocol::CHILDTYPE::INNER;
+			}
+
+			for (size_t i = 0; i < level.size(); i++){
+				if (level[i].parent_ != nullptr){
+					level[i].parent_->info_.Set(level[i].branch_, results[i]);
+				}
+				else{
+					root_result = results[i];
+				}
+				level[i].node_->modified_ = false;
+			}
 		}
-		node->modified_ = false;
-		return result;
+		return root_result;
 	}
 
 	bool Trie::SetItem(NodeFrm::POINTER node, const Location& location, const std::string &data, int depth){
@@ -270,13 +457,14 @@ namespace bumo{
 		int branch = NextBranch(common, location);
 
 		NodeFrm::POINTER node2 = ChildMayFromDB(node, branch);
-		protocol::Child child2 = node->info_.children(branch);
+		const ChildEntry* entry2 = node->info_.Get(branch);
+		ChildEntry child2 = (entry2 != nullptr) ? *entry2 : ChildEntry();
 		if (node2 == nullptr){
 			NodeFrm::POINTER newnode = std::make_shared<NodeFrm>(location);
 			newnode->SetValue(data);
 
 			node->SetChild(branch, newnode);
-			node->info_.mutable_children(branch)->set_childtype(protocol::LEAF);
+			node->info_.Mutable(branch).type_ = protocol::LEAF;
 			
 			return true;
 		}
@@ -302,10 +490,10 @@ namespace bumo{
 			newnode->SetValue(data);
 			int b1 = NextBranch(newcommon, location2);
 			newnode->SetChild(b1, node2);
-			newnode->info_.mutable_children(b1)->CopyFrom(child2);
+			newnode->info_.Set(b1, child2);
 
 			node->SetChild(branch, newnode);
-			node->info_.mutable_children(branch)->set_childtype(protocol::INNER);
+			node->info_.Mutable(branch).type_ = protocol::INNER;
 			return true;
 		}
 		else {
@@ -331,7 +519,7 @@ namespace bumo{
 			int b2 = NextBranch(newcommon, location2);
 			mnode->SetChild(b1, newnode);
 			mnode->SetChild(b2, node2);
-			mnode->info_.mutable_children(b2)->CopyFrom(child2);
+			mnode->info_.Set(b2, child2);
 			node->SetChild(branch, mnode);
 			return true;
 		}
@@ -406,11 +594,11 @@ namespace bumo{
 		auto common = CommonPrefix(node->location_, key);
 		int branch = NextBranch(common, key);
 
-		if (node->info_.children(branch).childtype() == protocol::CHILDTYPE::NONE){
+		if (node->info_.Type(branch) == protocol::CHILDTYPE::NONE){
 			return false;
 		}
 
-		Location location2 = node->info_.children(branch).sublocation();
+		Location location2 = node->info_.Get(branch)->sublocation_;
 
 		auto common2 = CommonPrefix(location2, key);
 		if (common2 != location2){
@@ -420,6 +608,64 @@ namespace bumo{
 		return Exists(child, key);
 	}
 
+	bool Trie::ReadOnlyGet(const std::string& key, std::string& value){
+		Location location = Key2Location(key);
+		if (!FindNode(location, nullptr))
+			return false;
+		return StorageGetLeaf(location, value);
+	}
+
+	bool Trie::FindNode(const Location& location, ChildTable* info){
+		//Walk the cached nodes as far as they go, then continue with temporaries loaded from storage.
+		NodeFrm::POINTER node = root_;
+		ChildTable loaded;
+		const ChildTable* current = &root_->info_;
+		Location current_location = root_->location_;
+
+		while (current_location != location){
+			auto common = CommonPrefix(current_location, location);
+			int branch = NextBranch(common, location);
+
+			const ChildEntry* chd = current->Get(branch);
+			if (chd == nullptr || chd->type_ == protocol::CHILDTYPE::NONE){
+				return false;
+			}
+
+			Location sublocation = chd->sublocation_;
+			if (CommonPrefix(sublocation, location) != sublocation){
+				return false;
+			}
+
+			NodeFrm::POINTER child = (node != nullptr) ? node->children_[branch] : nullptr;
+			if (child != nullptr){
+				node = child;
+				current = &node->info_;
+			}
+			else{
+				ChildTable next;
+				if (chd->type_ == protocol::LEAF){
+					next.Set(ChildTable::LEAF_SLOT, *chd);
+				}
+				else{
+					protocol::Node stored;
+					if (!storage_load(sublocation, stored)){
+						PROCESS_EXIT("load:%s failed", utils::String::BinToHexString(sublocation).c_str());
+					}
+					next.FromProto(stored);
+				}
+				loaded = next;
+				current = &loaded;
+				node = nullptr;
+			}
+			current_location = sublocation;
+		}
+
+		if (info != nullptr){
+			*info = *current;
+		}
+		return true;
+	}
+
 	void Trie::GetAll(const std::string& key, std::vector<std::string>& values){
 		Location location = Key2Location(key);
 		Location node = Key2Location("");
@@ -432,7 +678,7 @@ namespace bumo{
 	}
 
 	void Trie::UpdateHash(){
-		root_hash_ = update_hash(root_).hash();
+		root_hash_ = update_hash(root_).Hash();
 	}
 
 	bool Trie::Delete(const std::string& key){
@@ -505,9 +751,24 @@ namespace bumo{
 		return getNode(root_, lc);
 	}
 
+	protocol::Node Trie::ReadOnlyGetNode(const Location& location){
+		Location lc = location;
+		if (lc == ""){
+			lc.push_back(0);
+		}
+		ChildTable table;
+		protocol::Node info;
+		if (FindNode(lc, &table)){
+			table.ToProto(info);
+		}
+		return info;
+	}
+
 	protocol::Node Trie::getNode(NodeFrm::POINTER node, const Location& location){
 		if (node->location_ == location){
-			return node->info_;
+			protocol::Node info;
+			node->info_.ToProto(info);
+			return info;
 		}
 
 		Location common = CommonPrefix(location, node->location_);
@@ -23,13 +23,56 @@ namespace bumo{
 	typedef std::string Location;
 	typedef std::string HASH;
 
+	//A child slot of a node, the same fields as protocol::Child
+	struct ChildEntry{
+		static const size_t HASH_SIZE = 32;
+
+		Location sublocation_;
+		protocol::CHILDTYPE type_;
+		uint8_t hash_size_;
+		char hash_[HASH_SIZE];
+
+		ChildEntry();
+		bool Empty() const;
+		HASH Hash() const;
+		void SetHash(const HASH& hash);
+	};
+
+	//The 16 branches of a node and its own leaf in slot 16. Only the slots in the presence bitmap are stored, in slot order,
+	//and protocol::Node is only built when a node is loaded or handed out.
+	class ChildTable{
+	public:
+		static const int LEAF_SLOT = 16;
+
+		ChildTable();
+
+		//nullptr if the slot is not present
+		const ChildEntry* Get(int slot) const;
+		protocol::CHILDTYPE Type(int slot) const;
+		ChildEntry& Mutable(int slot);
+		//An empty entry clears the slot
+		void Set(int slot, const ChildEntry& entry);
+		void Clear(int slot);
+
+		void FromProto(const protocol::Node& node);
+		void ToProto(protocol::Node& node) const;
+		//Same bytes as ToProto followed by SerializeAsString, so the hashes and the stored nodes do not change
+		std::string Encode() const;
+
+	private:
+		size_t Index(int slot) const;
+
+		uint32_t present_;
+		std::vector<ChildEntry> entries_;
+	};
+
 	class NodeFrm{
 	public:
 		typedef std::shared_ptr<NodeFrm> POINTER;
 		Location location_;
 		POINTER children_[16];
 		
-		protocol::Node info_;
+		ChildTable info_;
 		
 		bool modified_;
 		bool leaf_deleted_;
@@ -52,7 +95,7 @@ namespace bumo{
 
 		bool SetItem(NodeFrm::POINTER node, const Location &key, const std::string &value, int depth);
 		bool DeleteItem(NodeFrm::POINTER node, const Location& key);
-		protocol::Child update_hash(NodeFrm::POINTER node);
+		ChildEntry update_hash(NodeFrm::POINTER node);
 
 		void Release(NodeFrm::POINTER node, int depth);
 		
@@ -66,15 +109,18 @@ namespace bumo{
 
 		virtual bool storage_load(const Location& location, protocol::Node& info) = 0;
 
-		virtual void StorageSaveNode(NodeFrm::POINTER node) = 0;
+		virtual void StorageSaveNode(NodeFrm::POINTER node, const std::string& encoded) = 0;
 		virtual void StorageSaveLeaf(NodeFrm::POINTER node) = 0;
 		virtual	void StorageDeleteNode(NodeFrm::POINTER node) = 0;
 		virtual void StorageDeleteLeaf(NodeFrm::POINTER node) = 0;
 
 		virtual bool StorageGetLeaf(const Location& location, std::string& value) = 0;
 		virtual std::string HashCrypto(const std::string& input) = 0;
+		//outputs[i] is HashCrypto(*inputs[i]); a storage may hash the whole batch at once
+		virtual void HashCryptoBatch(const std::vector<const std::string *>& inputs, std::vector<std::string>& outputs);
 		
 		protocol::Node getNode(NodeFrm::POINTER node, const Location& location);
+		bool FindNode(const Location& location, ChildTable* info);
 	public:
 		static const char EVEN_PREFIX = 0x00;
 		static const char ODD_PREFIX = 0x01;
@@ -93,6 +139,9 @@ namespace bumo{
 
 		bool Exists(NodeFrm::POINTER node, const Location& key);
 
+		//Same as Get, but never caches the nodes loaded from storage, so concurrent callers only need a read lock.
+		bool ReadOnlyGet(const std::string& key, std::string& value);
+
 		void GetAll(const std::string& key, std::vector<std::string>& values);
 
 		//Return false if it is not existed; otherwise, return true.
@@ -106,6 +155,9 @@ namespace bumo{
 	
 		protocol::Node GetNode(const Location& key);
 
+		//Same as GetNode, without mutating the in-memory tree.
+		protocol::Node ReadOnlyGetNode(const Location& key);
+
 	public:
 		static Location CommonPrefix(const Location& s1, const Location& s2);
 		static int NextBranch(const Location &s1, const Location& s2);
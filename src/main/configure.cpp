@@ -27,7 +27,9 @@ namespace bumo {
 		target_peer_connection_(10),
 		max_connection_(2000),
 		connect_timeout_(5),// second
-		heartbeat_interval_(1800) {// second
+		heartbeat_interval_(1800),// second
+		compress_enabled_(false),
+		compress_threshold_(4 * utils::BYTES_PER_KILO) {
 			listen_port_ = General::CONSENSUS_PORT;
 	}
 
@@ -65,6 +67,11 @@ namespace bumo {
 		Configure::GetValue(value, "connect_timeout", connect_timeout_);
 		Configure::GetValue(value, "heartbeat_interval", heartbeat_interval_);
 		Configure::GetValue(value, "listen_port", listen_port_);
+		Configure::GetValue(value, "compress_enabled", compress_enabled_);
+		Configure::GetValue(value, "compress_threshold", compress_threshold_);
+		if (compress_threshold_ <= 0) {
+			compress_enabled_ = false;
+		}
 
 		connect_timeout_ = connect_timeout_ * utils::MICRO_UNITS_PER_SEC; //micro second
 		heartbeat_interval_ = heartbeat_interval_ * utils::MICRO_UNITS_PER_SEC; //micro second
@@ -77,17 +84,23 @@ namespace bumo {
 		std::string address;
 		Configure::GetValue(value, "listen_address", address);
 		listen_address_ = utils::InetAddress(address);
+		Configure::GetValue(value, "send_queue_limit", send_queue_limit_);
+		Configure::GetValue(value, "send_buffer_limit", send_buffer_limit_);
 
 		return true;
 	}
 
 	WsServerConfigure::WsServerConfigure() {
+		send_queue_limit_ = 1024;
+		send_buffer_limit_ = 4 * utils::BYTES_PER_MEGA;
 	}
 
 	WebServerConfigure::WebServerConfigure() {
 		ssl_enable_ = false;
 		query_limit_ = 1000;
 		multiquery_limit_ = 100;
+		response_cache_size_ = 64 * utils::BYTES_PER_MEGA;
+		keep_alive_timeout_ = 30;
 		thread_count_ = 0;
 	}
 
@@ -105,6 +118,8 @@ namespace bumo {
 		ConfigureBase::GetValue(value, "ssl_enable", ssl_enable_);
 		ConfigureBase::GetValue(value, "query_limit", query_limit_);
 		ConfigureBase::GetValue(value, "multiquery_limit", multiquery_limit_);
+		ConfigureBase::GetValue(value, "response_cache_size", response_cache_size_);
+		ConfigureBase::GetValue(value, "keep_alive_timeout", keep_alive_timeout_);
 		ConfigureBase::GetValue(value, "thread_count", thread_count_);
 		ConfigureBase::GetValue(value, "allow_origin", allow_origin_);
 		
@@ -121,6 +136,10 @@ namespace bumo {
 		max_apply_ledger_per_round_ = 5;
 		close_interval_ = 10;
 		use_atom_map_ = true;
+		pipeline_enabled_ = false;
+		parallel_apply_enabled_ = false;
+		async_commit_enabled_ = false;
+		speculative_apply_enabled_ = false;
 		hash_type_ = 0; // 0 : SHA256, 1 :SM2
 		queue_limit_ = 10240;
 		queue_per_account_txs_limit_ = 64;
@@ -140,6 +159,10 @@ namespace bumo {
 		Configure::GetValue(value, "max_trans_in_memory", max_trans_in_memory_);
 		Configure::GetValue(value, "hardfork_points", hardfork_points_);
 		Configure::GetValue(value, "use_atom_map", use_atom_map_);
+		Configure::GetValue(value, "pipeline_enabled", pipeline_enabled_);
+		Configure::GetValue(value, "parallel_apply_enabled", parallel_apply_enabled_);
+		Configure::GetValue(value, "async_commit_enabled", async_commit_enabled_);
+		Configure::GetValue(value, "speculative_apply_enabled", speculative_apply_enabled_);
 
 		Configure::GetValue(value["tx_pool"], "queue_limit", queue_limit_);
         Configure::GetValue(value["tx_pool"], "queue_per_account_txs_limit", queue_per_account_txs_limit_);
@@ -31,6 +31,8 @@ namespace bumo {
 		int64_t heartbeat_interval_;
 		int32_t listen_port_;
 		utils::StringList known_peer_list_;
+		bool compress_enabled_;
+		int64_t compress_threshold_; //Byte
 		bool Load(const Json::Value &value);
 	};
 
@@ -52,6 +54,10 @@ namespace bumo {
 		~WsServerConfigure();
 
 		utils::InetAddress listen_address_;
+		//Events queued for a connection, the oldest is dropped beyond it
+		uint32_t send_queue_limit_;
+		//Bytes waiting in the socket of a connection before the events are queued
+		uint32_t send_buffer_limit_;
 
 		bool Load(const Json::Value &value);
 	};
@@ -68,6 +74,8 @@ namespace bumo {
 		bool ssl_enable_;
 		uint32_t query_limit_;
 		uint32_t multiquery_limit_;
+		uint32_t response_cache_size_;
+		uint32_t keep_alive_timeout_;
 		SSLConfigure ssl_configure_;
 		uint32_t thread_count_;
 		std::string allow_origin_;
@@ -91,6 +99,10 @@ namespace bumo {
 		uint32_t queue_per_account_txs_limit_;
 		utils::StringList hardfork_points_;
 		bool use_atom_map_;
+		bool pipeline_enabled_;
+		bool parallel_apply_enabled_;
+		bool async_commit_enabled_;
+		bool speculative_apply_enabled_;
 		bool Load(const Json::Value &value);
 	};
 
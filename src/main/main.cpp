@@ -70,6 +70,7 @@ int main(int argc, char *argv[]){
 	bumo::Storage::InitInstance();
 	bumo::Global::InitInstance();
 	bumo::SlowTimer::InitInstance();
+	bumo::ParallelWorker::InitInstance();
 	utils::Logger::InitInstance();
 	bumo::Console::InitInstance();
 	bumo::PeerManager::InitInstance();
@@ -188,6 +189,14 @@ int main(int argc, char *argv[]){
 		object_exit.Push(std::bind(&bumo::Global::Exit, &global));
 		LOG_INFO("Initialized global module successfully");
 
+		bumo::ParallelWorker &parallel_worker = bumo::ParallelWorker::Instance();
+		if (!bumo::g_enable_ || !parallel_worker.Initialize(utils::System::GetCpuCoreCount())){
+			LOG_ERROR_ERRNO("Failed to initialize parallel worker", STD_ERR_CODE, STD_ERR_DESC);
+			break;
+		}
+		object_exit.Push(std::bind(&bumo::ParallelWorker::Exit, &parallel_worker));
+		LOG_INFO("Initialized parallel worker with " FMT_SIZE " threads successfully", parallel_worker.GetThreadCount());
+
 		//Consensus manager must be initialized before ledger manager and glue manager
 		bumo::ConsensusManager &consensus_manager = bumo::ConsensusManager::Instance();
 		if (!bumo::g_enable_ || !consensus_manager.Initialize(bumo::Configure::Instance().ledger_configure_.validation_type_)) {
@@ -274,6 +283,7 @@ int main(int argc, char *argv[]){
 
 	bumo::ContractManager::ExitInstance();
 	bumo::SlowTimer::ExitInstance();
+	bumo::ParallelWorker::ExitInstance();
 	bumo::GlueManager::ExitInstance();
 	bumo::LedgerManager::ExitInstance();
 	bumo::PeerManager::ExitInstance();
@@ -19,6 +19,12 @@
 #include "broadcast.h"
 
 namespace bumo{
+
+	//Bodies are kept long enough for the announced peers to request them
+	int64_t const INVENTORY_BODY_TIMEOUT = 60 * utils::MICRO_UNITS_PER_SEC;
+	//Ask the next announcer when a requested body has not arrived in time
+	int64_t const INVENTORY_REQUEST_TIMEOUT = 2 * utils::MICRO_UNITS_PER_SEC;
+
 	BroadcastRecord::BroadcastRecord(int64_t type, const std::string &data, int64_t peer_id) {
 		type_ = type;
 		peers_.insert(peer_id);
@@ -27,6 +33,14 @@ namespace bumo{
 
 	BroadcastRecord::~BroadcastRecord(){}
 
+	InventoryRequest::InventoryRequest(int64_t type, int64_t peer_id, int64_t time_stamp) {
+		type_ = type;
+		peer_id_ = peer_id;
+		time_stamp_ = time_stamp;
+	}
+
+	InventoryRequest::~InventoryRequest(){}
+
 	Broadcast::Broadcast(IBroadcastDriver *driver)
 		:driver_(driver){}
 
@@ -39,7 +53,8 @@ namespace bumo{
 		if (result == records_.end()){ // We have never seen this message
 			BroadcastRecord::pointer record = std::make_shared<BroadcastRecord>(type, data, peer_id);
 			records_[hash] = record;
-			records_couple_[record->time_stamp_] = hash;
+			records_couple_.insert(std::make_pair(record->time_stamp_, hash));
+			inventory_requested_.erase(hash);
 			return true;
 		}
 		else {
@@ -60,29 +75,173 @@ namespace bumo{
 	void Broadcast::Send(int64_t type, const std::string &data) {
 		std::string hash = HashWrapper::Crypto(data);
 		utils::MutexGuard guard(mutex_msg_sending_);
+		std::set<int64_t> inventory_peer_ids;
+		if (inventory_types_.find(type) != inventory_types_.end()) {
+			inventory_peer_ids = driver_->GetInventoryPeerIds();
+		}
+		std::set<int64_t> announced;
+		SendLocked(type, data, hash, driver_->GetActivePeerIds(), inventory_peer_ids, announced);
+	}
+
+	void Broadcast::Send(int64_t type, const std::vector<std::string> &datas) {
+		std::vector<std::string> hashes(datas.size());
+		for (size_t i = 0; i < datas.size(); i++) {
+			hashes[i] = HashWrapper::Crypto(datas[i]);
+		}
+
+		//The peers are looked up once for the batch
+		utils::MutexGuard guard(mutex_msg_sending_);
+		std::set<int64_t> inventory_peer_ids;
+		if (inventory_types_.find(type) != inventory_types_.end()) {
+			inventory_peer_ids = driver_->GetInventoryPeerIds();
+		}
+		std::set<int64_t> active_peer_ids = driver_->GetActivePeerIds();
+		std::set<int64_t> announced;
+		for (size_t i = 0; i < datas.size(); i++) {
+			SendLocked(type, datas[i], hashes[i], active_peer_ids, inventory_peer_ids, announced);
+		}
+
+		//The whole batch is announced now instead of waiting for the inventory timer
+		for (const auto peer : announced) {
+			std::vector<std::string> &pending = inventory_pending_[type][peer];
+			if (!pending.empty()) {
+				SendInventoryMsg(type, peer, pending);
+			}
+		}
+	}
+
+	void Broadcast::SendLocked(int64_t type, const std::string &data, const std::string &hash,
+		const std::set<int64_t> &active_peer_ids, const std::set<int64_t> &inventory_peer_ids, std::set<int64_t> &announced) {
+		BroadcastRecord::pointer record;
 		BroadcastRecordMap::iterator result = records_.find(hash);
 		if (result == records_.end()){ // No one has sent us this message
-			BroadcastRecord::pointer record = std::make_shared<BroadcastRecord>(
-				type, data, 0);
-
+			record = std::make_shared<BroadcastRecord>(type, data, 0);
 			records_[hash] = record;
-			records_couple_[record->time_stamp_] = hash;
-			std::set<int64_t> peer_ids = driver_->GetActivePeerIds();
-			for (const auto peer_id : peer_ids)
-			{
-				driver_->SendRequest(peer_id, type, data);
-				record->peers_.insert(peer_id);
-			}
+			records_couple_.insert(std::make_pair(record->time_stamp_, hash));
 		}
 		else{ // Send it to people who haven't sent it to us
-			std::set<int64_t>& peersTold = result->second->peers_;
-			for (const auto peer : driver_->GetActivePeerIds()){
-				if (peersTold.find(peer) == peersTold.end())
-				{
-					driver_->SendRequest(peer, type, data);
-					result->second->peers_.insert(peer);
+			record = result->second;
+		}
+
+		if (inventory_types_.find(type) != inventory_types_.end()) {
+			if (record->data_.empty()) {
+				record->data_ = data;
+				bodies_couple_.insert(std::make_pair(record->time_stamp_, hash));
+			}
+		}
+
+		std::set<int64_t>& peersTold = record->peers_;
+		for (const auto peer : active_peer_ids){
+			if (peersTold.find(peer) != peersTold.end()) {
+				continue;
+			}
+
+			if (inventory_peer_ids.find(peer) != inventory_peer_ids.end()) {
+				std::vector<std::string> &pending = inventory_pending_[type][peer];
+				pending.push_back(hash);
+				announced.insert(peer);
+				if (pending.size() >= BROADCAST_INVENTORY_BATCH_SIZE) {
+					SendInventoryMsg(type, peer, pending);
+				}
+			}
+			else {
+				driver_->SendRequest(peer, type, data);
+			}
+			peersTold.insert(peer);
+		}
+	}
+
+	void Broadcast::SendInventoryMsg(int64_t type, int64_t peer_id, std::vector<std::string> &hashes) {
+		if (!driver_->SendInventory(peer_id, type, hashes)) {
+			LOG_TRACE("Failed to announce " FMT_SIZE " hashes to peer(" FMT_I64 ")", hashes.size(), peer_id);
+		}
+		hashes.clear();
+	}
+
+	void Broadcast::AddInventoryType(int64_t type) {
+		utils::MutexGuard guard(mutex_msg_sending_);
+		inventory_types_.insert(type);
+	}
+
+	void Broadcast::OnInventory(int64_t type, const std::vector<std::string> &hashes, int64_t peer_id) {
+		utils::MutexGuard guard(mutex_msg_sending_);
+		int64_t current_time = utils::Timestamp::HighResolution();
+		std::vector<std::string> wanted;
+		for (const auto &hash : hashes) {
+			BroadcastRecordMap::iterator result = records_.find(hash);
+			if (result != records_.end()) { // The peer has it, so never announce it back
+				result->second->peers_.insert(peer_id);
+				continue;
+			}
+
+			InventoryRequestMap::iterator iter = inventory_requested_.find(hash);
+			if (iter != inventory_requested_.end()) { // Already requested from another peer
+				if (iter->second.peer_id_ != peer_id) {
+					iter->second.announcers_.push_back(peer_id);
+				}
+				continue;
+			}
+
+			inventory_requested_.insert(std::make_pair(hash, InventoryRequest(type, peer_id, current_time)));
+			wanted.push_back(hash);
+		}
+
+		if (!wanted.empty()) {
+			driver_->RequestInventory(peer_id, type, wanted);
+		}
+	}
+
+	void Broadcast::OnInventoryRequest(const std::vector<std::string> &hashes, int64_t peer_id) {
+		utils::MutexGuard guard(mutex_msg_sending_);
+		for (const auto &hash : hashes) {
+			BroadcastRecordMap::iterator result = records_.find(hash);
+			if (result == records_.end() || result->second->data_.empty()) {
+				LOG_TRACE("Failed to find the body of inventory(%s) requested by peer(" FMT_I64 ")",
+					utils::String::BinToHexString(hash).c_str(), peer_id);
+				continue;
+			}
+
+			driver_->SendRequest(peer_id, result->second->type_, result->second->data_);
+			result->second->peers_.insert(peer_id);
+		}
+	}
+
+	void Broadcast::FlushInventory(int64_t current_time) {
+		utils::MutexGuard guard(mutex_msg_sending_);
+		for (auto &type_item : inventory_pending_) {
+			for (auto &peer_item : type_item.second) {
+				if (!peer_item.second.empty()) {
+					SendInventoryMsg(type_item.first, peer_item.first, peer_item.second);
 				}
 			}
+			type_item.second.clear();
+		}
+
+		//Ask the next announcer for the bodies that have not arrived in time
+		std::map<int64_t, InventoryPeerMap> retries;
+		for (auto it = inventory_requested_.begin(); it != inventory_requested_.end();) {
+			InventoryRequest &request = it->second;
+			if (request.time_stamp_ + INVENTORY_REQUEST_TIMEOUT > current_time) {
+				it++;
+				continue;
+			}
+
+			if (request.announcers_.empty()) {
+				inventory_requested_.erase(it++);
+				continue;
+			}
+
+			request.peer_id_ = request.announcers_.front();
+			request.announcers_.pop_front();
+			request.time_stamp_ = current_time;
+			retries[request.type_][request.peer_id_].push_back(it->first);
+			it++;
+		}
+
+		for (const auto &type_item : retries) {
+			for (const auto &peer_item : type_item.second) {
+				driver_->RequestInventory(peer_item.first, type_item.first, peer_item.second);
+			}
 		}
 	}
 
@@ -90,6 +249,19 @@ namespace bumo{
 		utils::MutexGuard guard(mutex_msg_sending_);
 		int64_t current_time = utils::Timestamp::HighResolution();
 
+		//Release the bodies which are too old to be requested
+		for (auto it = bodies_couple_.begin(); it != bodies_couple_.end();){
+			if (it->first + INVENTORY_BODY_TIMEOUT >= current_time) {
+				break;
+			}
+
+			BroadcastRecordMap::iterator result = records_.find(it->second);
+			if (result != records_.end()) {
+				std::string().swap(result->second->data_);
+			}
+			bodies_couple_.erase(it++);
+		}
+
 		for (auto it = records_couple_.begin(); it != records_couple_.end();){
 			// Give one ledger of leeway
 			if (it->first + 3600 * utils::MICRO_UNITS_PER_SEC < current_time)
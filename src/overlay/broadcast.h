@@ -19,6 +19,9 @@
 #include <unordered_map>
 namespace bumo{
 
+	//Announce inventory to a peer once this number of hashes is queued
+	const size_t BROADCAST_INVENTORY_BATCH_SIZE = 256;
+
 	class IBroadcastDriver{
 	public:
 		IBroadcastDriver(){};
@@ -27,6 +30,11 @@ namespace bumo{
 		//Virtual bool SendMessage(int64_t peer_id, WsMessagePointer msg) = 0;
 		virtual bool SendRequest(int64_t peer_id, int64_t type, const std::string &data) = 0;
 		virtual std::set<int64_t> GetActivePeerIds() = 0;
+
+		//Inventory announcement, only used for the peers which support it
+		virtual bool SendInventory(int64_t peer_id, int64_t type, const std::vector<std::string> &hashes) = 0;
+		virtual bool RequestInventory(int64_t peer_id, int64_t type, const std::vector<std::string> &hashes) = 0;
+		virtual std::set<int64_t> GetInventoryPeerIds() = 0;
 	};
 
 	class BroadcastRecord{
@@ -39,10 +47,25 @@ namespace bumo{
 		int64_t type_;
 		int64_t time_stamp_;
 		std::set<int64_t> peers_;
+		std::string data_; //Kept for a while to serve inventory requests
 	};
 
-	typedef std::map<int64_t, std::string> BroadcastRecordCoupleMap;
+	class InventoryRequest{
+	public:
+		InventoryRequest(int64_t type, int64_t peer_id, int64_t time_stamp);
+		~InventoryRequest();
+
+		int64_t type_;
+		int64_t peer_id_;
+		int64_t time_stamp_;
+		std::list<int64_t> announcers_; //Other peers that can be asked if this request times out
+	};
+
+	//A batch is recorded within the same microsecond, so the time keys repeat
+	typedef std::multimap<int64_t, std::string> BroadcastRecordCoupleMap;
 	typedef std::unordered_map<std::string, BroadcastRecord::pointer> BroadcastRecordMap;
+	typedef std::unordered_map<std::string, InventoryRequest> InventoryRequestMap;
+	typedef std::map<int64_t, std::vector<std::string>> InventoryPeerMap;
 
 	class Broadcast {
 	private:
@@ -51,15 +74,36 @@ namespace bumo{
 		utils::Mutex mutex_msg_sending_;
 		IBroadcastDriver *driver_;
 
+		//Message types that are announced by hash instead of being flooded
+		std::set<int64_t> inventory_types_;
+		//Records which still hold the message body, in time order
+		BroadcastRecordCoupleMap bodies_couple_;
+		//Hashes waiting to be announced, type -> peer -> hashes
+		std::map<int64_t, InventoryPeerMap> inventory_pending_;
+		//Hashes requested from peers but not received yet
+		InventoryRequestMap inventory_requested_;
+
+		void SendInventoryMsg(int64_t type, int64_t peer_id, std::vector<std::string> &hashes);
+		void SendLocked(int64_t type, const std::string &data, const std::string &hash,
+			const std::set<int64_t> &active_peer_ids, const std::set<int64_t> &inventory_peer_ids, std::set<int64_t> &announced);
+
 	public:
 		Broadcast(IBroadcastDriver *driver);
 		~Broadcast();
 
 		bool Add(int64_t type, const std::string &data, int64_t peer_id);
 		void Send(int64_t type, const std::string &data);
+		//Sends a batch under one lock, the inventory peers get its hashes without waiting for the timer
+		void Send(int64_t type, const std::vector<std::string> &datas);
 		bool IsQueued(int64_t type, const std::string &data);
 		void OnTimer();
 		size_t GetRecordSize() const { return records_.size(); };
+
+		void AddInventoryType(int64_t type);
+		void OnInventory(int64_t type, const std::vector<std::string> &hashes, int64_t peer_id);
+		void OnInventoryRequest(const std::vector<std::string> &hashes, int64_t peer_id);
+		void FlushInventory(int64_t current_time);
+		size_t GetInventoryRequestedSize() const { return inventory_requested_.size(); };
 	};
 };
 
@@ -50,6 +50,10 @@ namespace bumo {
 		return active_time_ > 0;
 	}
 
+	bool Peer::IsInventorySupported() const {
+		return peer_overlay_version_ >= General::OVERLAY_VERSION_TX_INVENTORY;
+	}
+
 	bool Peer::SendPeers(const protocol::Peers &db_peers, std::error_code &ec) {
 		return SendRequest(protocol::OVERLAY_MSGTYPE_PEERS, db_peers.SerializeAsString(), ec);
 	}
@@ -66,7 +70,7 @@ namespace bumo {
 		active_time_ = current_time;
 	}
 
-	bool Peer::SendHello(int32_t listen_port, const std::string &node_address, const int64_t &network_id, const std::string &node_rand, std::error_code &ec) {
+	bool Peer::SendHello(int32_t listen_port, const std::string &node_address, const int64_t &network_id, const std::string &node_rand, bool compress_enabled, std::error_code &ec) {
 		protocol::Hello hello;
 
 		hello.set_ledger_version(General::LEDGER_VERSION);
@@ -76,6 +80,7 @@ namespace bumo {
 		hello.set_node_address(node_address);
 		hello.set_node_rand(node_rand);
 		hello.set_network_id(network_id);
+		hello.set_compress_enabled(compress_enabled);
 		return SendRequest(protocol::OVERLAY_MSGTYPE_HELLO, hello.SerializeAsString(), ec);
 	}
 
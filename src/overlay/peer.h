@@ -51,6 +51,7 @@ namespace bumo {
 
 		utils::InetAddress GetRemoteAddress() const;
 		bool IsActive() const;
+		bool IsInventorySupported() const;
 		std::string GetPeerNodeAddress() const;
 		int64_t GetActiveTime() const;
 		int64_t GetDelay() const;
@@ -58,7 +59,7 @@ namespace bumo {
 		bool SendPeers(const protocol::Peers &db_peers, std::error_code &ec);
 		void SetPeerInfo(const protocol::Hello &hello);
 		void SetActiveTime(int64_t current_time);
-		bool SendHello(int32_t listen_port, const std::string &node_address, const int64_t &network_id, const std::string &node_rand, std::error_code &ec);
+		bool SendHello(int32_t listen_port, const std::string &node_address, const int64_t &network_id, const std::string &node_rand, bool compress_enabled, std::error_code &ec);
 
 		virtual void ToJson(Json::Value &status) const;
 		virtual bool OnNetworkTimer(int64_t current_time);
@@ -38,7 +38,10 @@ namespace bumo {
 		:consensus_network_(NULL),
 		thread_ptr_(NULL),
 		priv_key_(SIGNTYPE_CFCASM2),
-		cert_enabled_(false) {}
+		cert_enabled_(false) {
+		//Flush the pending transaction inventory
+		check_interval_ = 100 * utils::MICRO_UNITS_PER_MILLI;
+	}
 
 	PeerManager::~PeerManager() {
 		if (thread_ptr_) {
@@ -100,6 +103,10 @@ namespace bumo {
 		if (consensus_network_) consensus_network_->BroadcastMsg(type, data);
 	}
 
+	void PeerManager::Broadcast(int64_t type, const std::vector<std::string> &datas) {
+		if (consensus_network_) consensus_network_->BroadcastMsg(type, datas);
+	}
+
 
 	bool PeerManager::SendRequest(int64_t peer_id, int64_t type, const std::string &data) {
 		if (consensus_network_) consensus_network_->SendRequest(peer_id, type, data);
@@ -112,6 +119,10 @@ namespace bumo {
 		if (consensus_network_) consensus_network_->GetModuleStatus(data["consensus_network"]);
 	}
 
+	void PeerManager::OnTimer(int64_t current_time) {
+		if (consensus_network_) consensus_network_->OnInventoryTimer(current_time);
+	}
+
 	void PeerManager::OnSlowTimer(int64_t current_time) {
 		if (!cert_enabled_) {
 			return;
@@ -36,12 +36,13 @@ namespace bumo {
 		bool Initialize(char *serial_num = NULL, bool cert_enabled = false);
 		bool Exit();
 
-		virtual void OnTimer(int64_t current_time) override {};
+		virtual void OnTimer(int64_t current_time) override;
 		virtual void OnSlowTimer(int64_t current_time);
 
 		virtual void Run(utils::Thread *thread) override;
 
 		void Broadcast(int64_t type, const std::string &data);
+		void Broadcast(int64_t type, const std::vector<std::string> &datas);
 		//bool SendMessage(int64_t peer_id, protocol::WsMessage &message);
 		bool SendRequest(int64_t peer_id, int64_t type, const std::string &data);
 
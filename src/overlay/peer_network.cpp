@@ -43,11 +43,16 @@ namespace bumo {
 		request_methods_[protocol::OVERLAY_MSGTYPE_LEDGERS] = std::bind(&PeerNetwork::OnMethodGetLedgers, this, std::placeholders::_1, std::placeholders::_2);
 		request_methods_[protocol::OVERLAY_MSGTYPE_PBFT] = std::bind(&PeerNetwork::OnMethodPbft, this, std::placeholders::_1, std::placeholders::_2);
 		request_methods_[protocol::OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY] = std::bind(&PeerNetwork::OnMethodLedgerUpNotify, this, std::placeholders::_1, std::placeholders::_2);
+		request_methods_[protocol::OVERLAY_MSGTYPE_TRANSACTION_INVENTORY] = std::bind(&PeerNetwork::OnMethodTransactionInventory, this, std::placeholders::_1, std::placeholders::_2);
+		request_methods_[protocol::OVERLAY_MSGTYPE_GET_TRANSACTIONS] = std::bind(&PeerNetwork::OnMethodGetTransactions, this, std::placeholders::_1, std::placeholders::_2);
 
 
 		response_methods_[protocol::OVERLAY_MSGTYPE_LEDGERS] = std::bind(&PeerNetwork::OnMethodLedgers, this, std::placeholders::_1, std::placeholders::_2);
 		response_methods_[protocol::OVERLAY_MSGTYPE_HELLO] = std::bind(&PeerNetwork::OnMethodHelloResponse, this, std::placeholders::_1, std::placeholders::_2);
 		last_update_peercache_time_ = 0;
+
+		//Transactions are announced by hash to the peers which support it
+		broadcast_.AddInventoryType(protocol::OVERLAY_MSGTYPE_TRANSACTION);
 	}
 
 	PeerNetwork::~PeerNetwork() {
@@ -187,11 +192,16 @@ namespace bumo {
 			LOG_INFO("Received a hello message, peer(%s) is active", peer->GetRemoteAddress().ToIpPort().c_str());
 			peer->SetActiveTime(utils::Timestamp::HighResolution());
 
+			//Compress only if both sides enable it
+			const P2pNetwork &p2p_configure = bumo::Configure::Instance().p2p_configure_.consensus_network_configure_;
+			if (p2p_configure.compress_enabled_ && hello.compress_enabled()) {
+				peer->SetCompressThreshold((size_t)p2p_configure.compress_threshold_);
+			}
+
 			if (peer->InBound()) {
-				const P2pNetwork &p2p_configure = bumo::Configure::Instance().p2p_configure_.consensus_network_configure_;
 
 				std::error_code ec;
-				peer->SendHello(p2p_configure.listen_port_, peer_node_address_, network_id_, node_rand_, last_ec_);
+				peer->SendHello(p2p_configure.listen_port_, peer_node_address_, network_id_, node_rand_, p2p_configure.compress_enabled_, last_ec_);
 
 				//Create
 				if (total_peers_count_ < General::PEER_DB_COUNT) CreatePeerIfNotExist(peer->GetRemoteAddress());
@@ -259,6 +269,40 @@ namespace bumo {
 		return true;
 	}
 
+	bool PeerNetwork::OnMethodTransactionInventory(protocol::WsMessage &message, int64_t conn_id) {
+		protocol::TransactionInventory inventory;
+		if (!inventory.ParseFromString(message.data())) {
+			LOG_ERROR("Failed to parse transaction inventory from a connection which id is(" FMT_I64 ")", conn_id);
+			return false;
+		}
+
+		if (inventory.hashes_size() > General::TX_INVENTORY_LIMIT) {
+			LOG_ERROR("Failed to process the peer transaction inventory.Hash size(%d) is too large", inventory.hashes_size());
+			return false;
+		}
+
+		std::vector<std::string> hashes(inventory.hashes().begin(), inventory.hashes().end());
+		broadcast_.OnInventory(protocol::OVERLAY_MSGTYPE_TRANSACTION, hashes, conn_id);
+		return true;
+	}
+
+	bool PeerNetwork::OnMethodGetTransactions(protocol::WsMessage &message, int64_t conn_id) {
+		protocol::GetTransactions get_txs;
+		if (!get_txs.ParseFromString(message.data())) {
+			LOG_ERROR("Failed to parse transaction request from a connection which id is(" FMT_I64 ")", conn_id);
+			return false;
+		}
+
+		if (get_txs.hashes_size() > General::TX_INVENTORY_LIMIT) {
+			LOG_ERROR("Failed to process the peer transaction request.Hash size(%d) is too large", get_txs.hashes_size());
+			return false;
+		}
+
+		std::vector<std::string> hashes(get_txs.hashes().begin(), get_txs.hashes().end());
+		broadcast_.OnInventoryRequest(hashes, conn_id);
+		return true;
+	}
+
 	bool PeerNetwork::OnMethodGetLedgers(protocol::WsMessage &message, int64_t conn_id) {
 		protocol::GetLedgers getledgers;
 		getledgers.ParseFromString(message.data());
@@ -296,15 +340,15 @@ namespace bumo {
 			return false;
 		}
 
-		protocol::PbftEnv env;
-		env.ParseFromString(message.data());
-		if (!env.has_pbft()) {
+		std::shared_ptr<protocol::PbftEnv> env = std::make_shared<protocol::PbftEnv>();
+		env->ParseFromString(message.data());
+		if (!env->has_pbft()) {
 			LOG_ERROR("Failed to process the peer pbft message.Pbft env is not initialized");
 			return false;
 		}
 
 		//Should be in validators
-		ConsensusMsg msg(env);
+		ConsensusMsg msg(env, message.data());
 		if (ConsensusManager::Instance().GetConsensus()->GetValidatorIndex(msg.GetNodeAddress()) < 0) {
 			LOG_TRACE("Failed to find validator (%s) in the list.", msg.GetNodeAddress());
 			return true;
@@ -365,7 +409,7 @@ namespace bumo {
 		if (connections_.size() < total_connection) {
 			if (!conn->InBound()) {
 				Peer *peer = (Peer *)conn;
-				peer->SendHello(p2p_configure.listen_port_, peer_node_address_, network_id_, node_rand_, last_ec_);
+				peer->SendHello(p2p_configure.listen_port_, peer_node_address_, network_id_, node_rand_, p2p_configure.compress_enabled_, last_ec_);
 			}
 			return true;
 		} else{
@@ -777,6 +821,10 @@ namespace bumo {
 		broadcast_.OnTimer();
 	}
 
+	void PeerNetwork::OnInventoryTimer(int64_t current_time) {
+		broadcast_.FlushInventory(current_time);
+	}
+
 	void PeerNetwork::AddReceivedPeers(const utils::StringMap &item) {
 		utils::MutexGuard guard(peer_lock_);
 		received_peer_list_.push_back(item);
@@ -786,6 +834,10 @@ namespace bumo {
 		broadcast_.Send(type, data);
 	}
 
+	void PeerNetwork::BroadcastMsg(int64_t type, const std::vector<std::string> &datas) {
+		broadcast_.Send(type, datas);
+	}
+
 	bool PeerNetwork::ReceiveBroadcastMsg(int64_t type, const std::string &data, int64_t peer_id) {
 		return broadcast_.Add(type, data, peer_id);
 	}
@@ -794,7 +846,7 @@ namespace bumo {
 		utils::MutexGuard guard(conns_list_lock_);
 		Peer *peer = (Peer *)GetConnection(peer_id);
 		if (peer && peer->IsActive()) {
-			return peer->SendByteMessage(message->SerializeAsString(), last_ec_);
+			return peer->SendWsMessage(*message, last_ec_);
 		}
 
 		return false;
@@ -823,6 +875,59 @@ namespace bumo {
 		return ids;
 	}
 
+	template <class HashMessage>
+	static void PackHashes(const std::vector<std::string> &hashes, std::vector<std::string> &datas) {
+		for (size_t i = 0; i < hashes.size(); i += General::TX_INVENTORY_LIMIT) {
+			size_t end = MIN(hashes.size(), i + General::TX_INVENTORY_LIMIT);
+			HashMessage message;
+			for (size_t j = i; j < end; j++) {
+				*message.add_hashes() = hashes[j];
+			}
+			datas.push_back(message.SerializeAsString());
+		}
+	}
+
+	bool PeerNetwork::SendInventory(int64_t peer_id, int64_t type, const std::vector<std::string> &hashes) {
+		if (type != protocol::OVERLAY_MSGTYPE_TRANSACTION) {
+			return false;
+		}
+
+		std::vector<std::string> datas;
+		PackHashes<protocol::TransactionInventory>(hashes, datas);
+		bool ret = true;
+		for (const auto &data : datas) {
+			ret = SendRequest(peer_id, protocol::OVERLAY_MSGTYPE_TRANSACTION_INVENTORY, data) && ret;
+		}
+		return ret;
+	}
+
+	bool PeerNetwork::RequestInventory(int64_t peer_id, int64_t type, const std::vector<std::string> &hashes) {
+		if (type != protocol::OVERLAY_MSGTYPE_TRANSACTION) {
+			return false;
+		}
+
+		std::vector<std::string> datas;
+		PackHashes<protocol::GetTransactions>(hashes, datas);
+		bool ret = true;
+		for (const auto &data : datas) {
+			ret = SendRequest(peer_id, protocol::OVERLAY_MSGTYPE_GET_TRANSACTIONS, data) && ret;
+		}
+		return ret;
+	}
+
+	std::set<int64_t> PeerNetwork::GetInventoryPeerIds() {
+		std::set<int64_t> ids;
+		utils::MutexGuard guard(conns_list_lock_);
+		for (auto item : connections_) {
+			Peer *peer = (Peer *)item.second;
+			if (peer->IsActive() && peer->IsInventorySupported()) {
+				ids.insert(peer->GetId());
+			}
+		}
+
+		return ids;
+	}
+
 	bool PeerNetwork::NodeExist(std::string node_address, int64_t peer_id) {
 		bool exist = false;
 		for (ConnectionMap::iterator iter = connections_.begin(); iter != connections_.end(); iter++) {
@@ -844,6 +949,7 @@ namespace bumo {
 		data["peer_cache_size"] = (Json::UInt64)db_peer_cache_.peers_size();
 		data["recv_peerlist_size"] = (Json::UInt64)received_peer_list_.size();
 		data["broad_record_size"] = (Json::UInt64)broadcast_.GetRecordSize();
+		data["broad_inventory_requested_size"] = (Json::UInt64)broadcast_.GetInventoryRequestedSize();
 		int active_size = 0;
 		Json::Value peers;
 		do {
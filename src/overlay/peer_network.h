@@ -80,6 +80,8 @@ namespace bumo {
 		bool OnMethodPbft(protocol::WsMessage &message, int64_t conn_id);
 		bool OnMethodLedgerUpNotify(protocol::WsMessage &message, int64_t conn_id);
 		bool OnMethodHelloResponse(protocol::WsMessage &message, int64_t conn_id);
+		bool OnMethodTransactionInventory(protocol::WsMessage &message, int64_t conn_id);
+		bool OnMethodGetTransactions(protocol::WsMessage &message, int64_t conn_id);
 
 		//Operate the ip list
 		int32_t QueryItem(const utils::InetAddress &address, protocol::Peers &records);
@@ -101,6 +103,7 @@ namespace bumo {
 
 		void AddReceivedPeers(const utils::StringMap &item);
 		void BroadcastMsg(int64_t type, const std::string &data);
+		void BroadcastMsg(int64_t type, const std::vector<std::string> &datas);
 		bool ReceiveBroadcastMsg(int64_t type, const std::string &data, int64_t peer_id);
 
 		void GetPeers(Json::Value &peers);
@@ -112,6 +115,10 @@ namespace bumo {
 		virtual bool SendMsgToPeer(int64_t peer_id, WsMessagePointer msg);
 		virtual bool SendRequest(int64_t peer_id, int64_t type, const std::string &data);
 		virtual std::set<int64_t> GetActivePeerIds();
+		virtual bool SendInventory(int64_t peer_id, int64_t type, const std::vector<std::string> &hashes);
+		virtual bool RequestInventory(int64_t peer_id, int64_t type, const std::vector<std::string> &hashes);
+		virtual std::set<int64_t> GetInventoryPeerIds();
+		void OnInventoryTimer(int64_t current_time);
 
 		bool NodeExist(std::string node_address, int64_t peer_id);
 	};
@@ -116,6 +116,21 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* OperationSetMetadata_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   OperationSetMetadata_reflection_ = NULL;
+const ::google::protobuf::Descriptor* AccountResponse_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  AccountResponse_reflection_ = NULL;
+const ::google::protobuf::Descriptor* LedgerResponse_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  LedgerResponse_reflection_ = NULL;
+const ::google::protobuf::Descriptor* TransactionResponse_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  TransactionResponse_reflection_ = NULL;
+const ::google::protobuf::Descriptor* SubmitTransactionResponse_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  SubmitTransactionResponse_reflection_ = NULL;
+const ::google::protobuf::Descriptor* SubmitTransactionResponse_Result_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  SubmitTransactionResponse_Result_reflection_ = NULL;
 const ::google::protobuf::EnumDescriptor* Limit_descriptor_ = NULL;
 
 }  // namespace
@@ -672,6 +687,94 @@ void protobuf_AssignDesc_chain_2eproto() {
       sizeof(OperationSetMetadata),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(OperationSetMetadata, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(OperationSetMetadata, _is_default_instance_));
+  AccountResponse_descriptor_ = file->message_type(29);
+  static const int AccountResponse_offsets_[5] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AccountResponse, error_code_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AccountResponse, error_desc_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AccountResponse, account_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AccountResponse, assets_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AccountResponse, metadatas_),
+  };
+  AccountResponse_reflection_ =
+    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
+      AccountResponse_descriptor_,
+      AccountResponse::default_instance_,
+      AccountResponse_offsets_,
+      -1,
+      -1,
+      -1,
+      sizeof(AccountResponse),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AccountResponse, _internal_metadata_),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(AccountResponse, _is_default_instance_));
+  LedgerResponse_descriptor_ = file->message_type(30);
+  static const int LedgerResponse_offsets_[4] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LedgerResponse, error_code_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LedgerResponse, error_desc_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LedgerResponse, header_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LedgerResponse, transactions_),
+  };
+  LedgerResponse_reflection_ =
+    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
+      LedgerResponse_descriptor_,
+      LedgerResponse::default_instance_,
+      LedgerResponse_offsets_,
+      -1,
+      -1,
+      -1,
+      sizeof(LedgerResponse),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LedgerResponse, _internal_metadata_),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LedgerResponse, _is_default_instance_));
+  TransactionResponse_descriptor_ = file->message_type(31);
+  static const int TransactionResponse_offsets_[4] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TransactionResponse, error_code_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TransactionResponse, error_desc_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TransactionResponse, total_count_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TransactionResponse, transactions_),
+  };
+  TransactionResponse_reflection_ =
+    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
+      TransactionResponse_descriptor_,
+      TransactionResponse::default_instance_,
+      TransactionResponse_offsets_,
+      -1,
+      -1,
+      -1,
+      sizeof(TransactionResponse),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TransactionResponse, _internal_metadata_),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TransactionResponse, _is_default_instance_));
+  SubmitTransactionResponse_descriptor_ = file->message_type(32);
+  static const int SubmitTransactionResponse_offsets_[2] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SubmitTransactionResponse, success_count_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SubmitTransactionResponse, results_),
+  };
+  SubmitTransactionResponse_reflection_ =
+    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
+      SubmitTransactionResponse_descriptor_,
+      SubmitTransactionResponse::default_instance_,
+      SubmitTransactionResponse_offsets_,
+      -1,
+      -1,
+      -1,
+      sizeof(SubmitTransactionResponse),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SubmitTransactionResponse, _internal_metadata_),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SubmitTransactionResponse, _is_default_instance_));
+  SubmitTransactionResponse_Result_descriptor_ = SubmitTransactionResponse_descriptor_->nested_type(0);
+  static const int SubmitTransactionResponse_Result_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SubmitTransactionResponse_Result, hash_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SubmitTransactionResponse_Result, error_code_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SubmitTransactionResponse_Result, error_desc_),
+  };
+  SubmitTransactionResponse_Result_reflection_ =
+    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
+      SubmitTransactionResponse_Result_descriptor_,
+      SubmitTransactionResponse_Result::default_instance_,
+      SubmitTransactionResponse_Result_offsets_,
+      -1,
+      -1,
+      -1,
+      sizeof(SubmitTransactionResponse_Result),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SubmitTransactionResponse_Result, _internal_metadata_),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SubmitTransactionResponse_Result, _is_default_instance_));
   Limit_descriptor_ = file->enum_type(0);
 }
 
@@ -746,6 +849,16 @@ void protobuf_RegisterTypes(const ::std::string&) {
       OperationCreateAccount_descriptor_, &OperationCreateAccount::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
       OperationSetMetadata_descriptor_, &OperationSetMetadata::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+      AccountResponse_descriptor_, &AccountResponse::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+      LedgerResponse_descriptor_, &LedgerResponse::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+      TransactionResponse_descriptor_, &TransactionResponse::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+      SubmitTransactionResponse_descriptor_, &SubmitTransactionResponse::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+      SubmitTransactionResponse_Result_descriptor_, &SubmitTransactionResponse_Result::default_instance());
 }
 
 }  // namespace
@@ -811,6 +924,16 @@ void protobuf_ShutdownFile_chain_2eproto() {
   delete OperationCreateAccount_reflection_;
   delete OperationSetMetadata::default_instance_;
   delete OperationSetMetadata_reflection_;
+  delete AccountResponse::default_instance_;
+  delete AccountResponse_reflection_;
+  delete LedgerResponse::default_instance_;
+  delete LedgerResponse_reflection_;
+  delete TransactionResponse::default_instance_;
+  delete TransactionResponse_reflection_;
+  delete SubmitTransactionResponse::default_instance_;
+  delete SubmitTransactionResponse_reflection_;
+  delete SubmitTransactionResponse_Result::default_instance_;
+  delete SubmitTransactionResponse_Result_reflection_;
 }
 
 void protobuf_AddDesc_chain_2eproto() GOOGLE_ATTRIBUTE_COLD;
@@ -930,9 +1053,25 @@ void protobuf_AddDesc_chain_2eproto() {
     "yPair\022\024\n\014init_balance\030\005 \001(\003\022\022\n\ninit_inpu"
     "t\030\006 \001(\t\"X\n\024OperationSetMetadata\022\013\n\003key\030\001"
     " \001(\t\022\r\n\005value\030\002 \001(\t\022\017\n\007version\030\003 \001(\003\022\023\n\013"
-    "delete_flag\030\004 \001(\010*#\n\005Limit\022\013\n\007UNKNOWN\020\000\022"
+    "delete_flag\030\004 \001(\010\"\251\001\n\017AccountResponse\022\022\n"
+    "\nerror_code\030\001 \001(\005\022\022\n\nerror_desc\030\002 \001(\t\022\"\n"
+    "\007account\030\003 \001(\0132\021.protocol.Account\022$\n\006ass"
+    "ets\030\004 \003(\0132\024.protocol.AssetStore\022$\n\tmetad"
+    "atas\030\005 \003(\0132\021.protocol.KeyPair\"\225\001\n\016Ledger"
+    "Response\022\022\n\nerror_code\030\001 \001(\005\022\022\n\nerror_de"
+    "sc\030\002 \001(\t\022&\n\006header\030\003 \001(\0132\026.protocol.Ledg"
+    "erHeader\0223\n\014transactions\030\004 \003(\0132\035.protoco"
+    "l.TransactionEnvStore\"\207\001\n\023TransactionRes"
+    "ponse\022\022\n\nerror_code\030\001 \001(\005\022\022\n\nerror_desc\030"
+    "\002 \001(\t\022\023\n\013total_count\030\003 \001(\003\0223\n\014transactio"
+    "ns\030\004 \003(\0132\035.protocol.TransactionEnvStore\""
+    "\257\001\n\031SubmitTransactionResponse\022\025\n\rsuccess"
+    "_count\030\001 \001(\005\022;\n\007results\030\002 \003(\0132*.protocol"
+    ".SubmitTransactionResponse.Result\032>\n\006Res"
+    "ult\022\014\n\004hash\030\001 \001(\014\022\022\n\nerror_code\030\002 \001(\005\022\022\n"
+    "\nerror_desc\030\003 \001(\t*#\n\005Limit\022\013\n\007UNKNOWN\020\000\022"
     "\r\n\tSIGNATURE\020dB\"\n io.bumo.sdk.core.exten"
-    "d.protobufb\006proto3", 4418);
+    "d.protobufb\006proto3", 5058);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "chain.proto", &protobuf_RegisterTypes);
   Account::default_instance_ = new Account();
@@ -965,6 +1104,11 @@ void protobuf_AddDesc_chain_2eproto() {
   Contract::default_instance_ = new Contract();
   OperationCreateAccount::default_instance_ = new OperationCreateAccount();
   OperationSetMetadata::default_instance_ = new OperationSetMetadata();
+  AccountResponse::default_instance_ = new AccountResponse();
+  LedgerResponse::default_instance_ = new LedgerResponse();
+  TransactionResponse::default_instance_ = new TransactionResponse();
+  SubmitTransactionResponse::default_instance_ = new SubmitTransactionResponse();
+  SubmitTransactionResponse_Result::default_instance_ = new SubmitTransactionResponse_Result();
   Account::default_instance_->InitAsDefaultInstance();
   AssetKey::default_instance_->InitAsDefaultInstance();
   Asset::default_instance_->InitAsDefaultInstance();
@@ -995,6 +1139,11 @@ void protobuf_AddDesc_chain_2eproto() {
   Contract::default_instance_->InitAsDefaultInstance();
   OperationCreateAccount::default_instance_->InitAsDefaultInstance();
   OperationSetMetadata::default_instance_->InitAsDefaultInstance();
+  AccountResponse::default_instance_->InitAsDefaultInstance();
+  LedgerResponse::default_instance_->InitAsDefaultInstance();
+  TransactionResponse::default_instance_->InitAsDefaultInstance();
+  SubmitTransactionResponse::default_instance_->InitAsDefaultInstance();
+  SubmitTransactionResponse_Result::default_instance_->InitAsDefaultInstance();
   ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_chain_2eproto);
 }
 
@@ -15689,6 +15838,2252 @@ void OperationSetMetadata::clear_delete_flag() {
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int AccountResponse::kErrorCodeFieldNumber;
+const int AccountResponse::kErrorDescFieldNumber;
+const int AccountResponse::kAccountFieldNumber;
+const int AccountResponse::kAssetsFieldNumber;
+const int AccountResponse::kMetadatasFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+AccountResponse::AccountResponse()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protocol.AccountResponse)
+}
+
+void AccountResponse::InitAsDefaultInstance() {
+  _is_default_instance_ = true;
+  account_ = const_cast< ::protocol::Account*>(&::protocol::Account::default_instance());
+}
+
+AccountResponse::AccountResponse(const AccountResponse& from)
+  : ::google::protobuf::Message(),
+    _internal_metadata_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:protocol.AccountResponse)
+}
+
+void AccountResponse::SharedCtor() {
+    _is_default_instance_ = false;
+  ::google::protobuf::internal::GetEmptyString();
+  _cached_size_ = 0;
+  error_code_ = 0;
+  error_desc_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  account_ = NULL;
+}
+
+AccountResponse::~AccountResponse() {
+  // @@protoc_insertion_point(destructor:protocol.AccountResponse)
+  SharedDtor();
+}
+
+void AccountResponse::SharedDtor() {
+  error_desc_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (this != default_instance_) {
+    delete account_;
+  }
+}
+
+void AccountResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* AccountResponse::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return AccountResponse_descriptor_;
+}
+
+const AccountResponse& AccountResponse::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_chain_2eproto();
+  return *default_instance_;
+}
+
+AccountResponse* AccountResponse::default_instance_ = NULL;
+
+AccountResponse* AccountResponse::New(::google::protobuf::Arena* arena) const {
+  AccountResponse* n = new AccountResponse;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void AccountResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.AccountResponse)
+  error_code_ = 0;
+  error_desc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (GetArenaNoVirtual() == NULL && account_ != NULL) delete account_;
+  account_ = NULL;
+  assets_.Clear();
+  metadatas_.Clear();
+}
+
+bool AccountResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protocol.AccountResponse)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 error_code = 1;
+      case 1: {
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &error_code_)));
+
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_error_desc;
+        break;
+      }
+
+      // optional string error_desc = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_error_desc:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_error_desc()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->error_desc().data(), this->error_desc().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "protocol.AccountResponse.error_desc"));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(26)) goto parse_account;
+        break;
+      }
+
+      // optional .protocol.Account account = 3;
+      case 3: {
+        if (tag == 26) {
+         parse_account:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_account()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(34)) goto parse_assets;
+        break;
+      }
+
+      // repeated .protocol.AssetStore assets = 4;
+      case 4: {
+        if (tag == 34) {
+         parse_assets:
+          DO_(input->IncrementRecursionDepth());
+         parse_loop_assets:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_assets()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(34)) goto parse_loop_assets;
+        if (input->ExpectTag(42)) goto parse_loop_metadatas;
+        input->UnsafeDecrementRecursionDepth();
+        break;
+      }
+
+      // repeated .protocol.KeyPair metadatas = 5;
+      case 5: {
+        if (tag == 42) {
+          DO_(input->IncrementRecursionDepth());
+         parse_loop_metadatas:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_metadatas()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(42)) goto parse_loop_metadatas;
+        input->UnsafeDecrementRecursionDepth();
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protocol.AccountResponse)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protocol.AccountResponse)
+  return false;
+#undef DO_
+}
+
+void AccountResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protocol.AccountResponse)
+  // optional int32 error_code = 1;
+  if (this->error_code() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->error_code(), output);
+  }
+
+  // optional string error_desc = 2;
+  if (this->error_desc().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->error_desc().data(), this->error_desc().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.AccountResponse.error_desc");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->error_desc(), output);
+  }
+
+  // optional .protocol.Account account = 3;
+  if (this->has_account()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, *this->account_, output);
+  }
+
+  // repeated .protocol.AssetStore assets = 4;
+  for (unsigned int i = 0, n = this->assets_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->assets(i), output);
+  }
+
+  // repeated .protocol.KeyPair metadatas = 5;
+  for (unsigned int i = 0, n = this->metadatas_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, this->metadatas(i), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:protocol.AccountResponse)
+}
+
+::google::protobuf::uint8* AccountResponse::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.AccountResponse)
+  // optional int32 error_code = 1;
+  if (this->error_code() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->error_code(), target);
+  }
+
+  // optional string error_desc = 2;
+  if (this->error_desc().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->error_desc().data(), this->error_desc().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.AccountResponse.error_desc");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->error_desc(), target);
+  }
+
+  // optional .protocol.Account account = 3;
+  if (this->has_account()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        3, *this->account_, false, target);
+  }
+
+  // repeated .protocol.AssetStore assets = 4;
+  for (unsigned int i = 0, n = this->assets_size(); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        4, this->assets(i), false, target);
+  }
+
+  // repeated .protocol.KeyPair metadatas = 5;
+  for (unsigned int i = 0, n = this->metadatas_size(); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        5, this->metadatas(i), false, target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.AccountResponse)
+  return target;
+}
+
+int AccountResponse::ByteSize() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.AccountResponse)
+  int total_size = 0;
+
+  // optional int32 error_code = 1;
+  if (this->error_code() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->error_code());
+  }
+
+  // optional string error_desc = 2;
+  if (this->error_desc().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->error_desc());
+  }
+
+  // optional .protocol.Account account = 3;
+  if (this->has_account()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->account_);
+  }
+
+  // repeated .protocol.AssetStore assets = 4;
+  total_size += 1 * this->assets_size();
+  for (int i = 0; i < this->assets_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->assets(i));
+  }
+
+  // repeated .protocol.KeyPair metadatas = 5;
+  total_size += 1 * this->metadatas_size();
+  for (int i = 0; i < this->metadatas_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->metadatas(i));
+  }
+
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void AccountResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protocol.AccountResponse)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  const AccountResponse* source = 
+      ::google::protobuf::internal::DynamicCastToGenerated<const AccountResponse>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.AccountResponse)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.AccountResponse)
+    MergeFrom(*source);
+  }
+}
+
+void AccountResponse::MergeFrom(const AccountResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protocol.AccountResponse)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  assets_.MergeFrom(from.assets_);
+  metadatas_.MergeFrom(from.metadatas_);
+  if (from.error_code() != 0) {
+    set_error_code(from.error_code());
+  }
+  if (from.error_desc().size() > 0) {
+
+    error_desc_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_desc_);
+  }
+  if (from.has_account()) {
+    mutable_account()->::protocol::Account::MergeFrom(from.account());
+  }
+}
+
+void AccountResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protocol.AccountResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void AccountResponse::CopyFrom(const AccountResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.AccountResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AccountResponse::IsInitialized() const {
+
+  return true;
+}
+
+void AccountResponse::Swap(AccountResponse* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void AccountResponse::InternalSwap(AccountResponse* other) {
+  std::swap(error_code_, other->error_code_);
+  error_desc_.Swap(&other->error_desc_);
+  std::swap(account_, other->account_);
+  assets_.UnsafeArenaSwap(&other->assets_);
+  metadatas_.UnsafeArenaSwap(&other->metadatas_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata AccountResponse::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = AccountResponse_descriptor_;
+  metadata.reflection = AccountResponse_reflection_;
+  return metadata;
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// AccountResponse
+
+// optional int32 error_code = 1;
+void AccountResponse::clear_error_code() {
+  error_code_ = 0;
+}
+ ::google::protobuf::int32 AccountResponse::error_code() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountResponse.error_code)
+  return error_code_;
+}
+ void AccountResponse::set_error_code(::google::protobuf::int32 value) {
+  
+  error_code_ = value;
+  // @@protoc_insertion_point(field_set:protocol.AccountResponse.error_code)
+}
+
+// optional string error_desc = 2;
+void AccountResponse::clear_error_desc() {
+  error_desc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ const ::std::string& AccountResponse::error_desc() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountResponse.error_desc)
+  return error_desc_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void AccountResponse::set_error_desc(const ::std::string& value) {
+  
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.AccountResponse.error_desc)
+}
+ void AccountResponse::set_error_desc(const char* value) {
+  
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.AccountResponse.error_desc)
+}
+ void AccountResponse::set_error_desc(const char* value, size_t size) {
+  
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.AccountResponse.error_desc)
+}
+ ::std::string* AccountResponse::mutable_error_desc() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.AccountResponse.error_desc)
+  return error_desc_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ ::std::string* AccountResponse::release_error_desc() {
+  // @@protoc_insertion_point(field_release:protocol.AccountResponse.error_desc)
+  
+  return error_desc_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void AccountResponse::set_allocated_error_desc(::std::string* error_desc) {
+  if (error_desc != NULL) {
+    
+  } else {
+    
+  }
+  error_desc_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_desc);
+  // @@protoc_insertion_point(field_set_allocated:protocol.AccountResponse.error_desc)
+}
+
+// optional .protocol.Account account = 3;
+bool AccountResponse::has_account() const {
+  return !_is_default_instance_ && account_ != NULL;
+}
+void AccountResponse::clear_account() {
+  if (GetArenaNoVirtual() == NULL && account_ != NULL) delete account_;
+  account_ = NULL;
+}
+const ::protocol::Account& AccountResponse::account() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountResponse.account)
+  return account_ != NULL ? *account_ : *default_instance_->account_;
+}
+::protocol::Account* AccountResponse::mutable_account() {
+  
+  if (account_ == NULL) {
+    account_ = new ::protocol::Account;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.AccountResponse.account)
+  return account_;
+}
+::protocol::Account* AccountResponse::release_account() {
+  // @@protoc_insertion_point(field_release:protocol.AccountResponse.account)
+  
+  ::protocol::Account* temp = account_;
+  account_ = NULL;
+  return temp;
+}
+void AccountResponse::set_allocated_account(::protocol::Account* account) {
+  delete account_;
+  account_ = account;
+  if (account) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.AccountResponse.account)
+}
+
+// repeated .protocol.AssetStore assets = 4;
+int AccountResponse::assets_size() const {
+  return assets_.size();
+}
+void AccountResponse::clear_assets() {
+  assets_.Clear();
+}
+const ::protocol::AssetStore& AccountResponse::assets(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.AccountResponse.assets)
+  return assets_.Get(index);
+}
+::protocol::AssetStore* AccountResponse::mutable_assets(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.AccountResponse.assets)
+  return assets_.Mutable(index);
+}
+::protocol::AssetStore* AccountResponse::add_assets() {
+  // @@protoc_insertion_point(field_add:protocol.AccountResponse.assets)
+  return assets_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::protocol::AssetStore >*
+AccountResponse::mutable_assets() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.AccountResponse.assets)
+  return &assets_;
+}
+const ::google::protobuf::RepeatedPtrField< ::protocol::AssetStore >&
+AccountResponse::assets() const {
+  // @@protoc_insertion_point(field_list:protocol.AccountResponse.assets)
+  return assets_;
+}
+
+// repeated .protocol.KeyPair metadatas = 5;
+int AccountResponse::metadatas_size() const {
+  return metadatas_.size();
+}
+void AccountResponse::clear_metadatas() {
+  metadatas_.Clear();
+}
+const ::protocol::KeyPair& AccountResponse::metadatas(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.AccountResponse.metadatas)
+  return metadatas_.Get(index);
+}
+::protocol::KeyPair* AccountResponse::mutable_metadatas(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.AccountResponse.metadatas)
+  return metadatas_.Mutable(index);
+}
+::protocol::KeyPair* AccountResponse::add_metadatas() {
+  // @@protoc_insertion_point(field_add:protocol.AccountResponse.metadatas)
+  return metadatas_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::protocol::KeyPair >*
+AccountResponse::mutable_metadatas() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.AccountResponse.metadatas)
+  return &metadatas_;
+}
+const ::google::protobuf::RepeatedPtrField< ::protocol::KeyPair >&
+AccountResponse::metadatas() const {
+  // @@protoc_insertion_point(field_list:protocol.AccountResponse.metadatas)
+  return metadatas_;
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int LedgerResponse::kErrorCodeFieldNumber;
+const int LedgerResponse::kErrorDescFieldNumber;
+const int LedgerResponse::kHeaderFieldNumber;
+const int LedgerResponse::kTransactionsFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+LedgerResponse::LedgerResponse()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protocol.LedgerResponse)
+}
+
+void LedgerResponse::InitAsDefaultInstance() {
+  _is_default_instance_ = true;
+  header_ = const_cast< ::protocol::LedgerHeader*>(&::protocol::LedgerHeader::default_instance());
+}
+
+LedgerResponse::LedgerResponse(const LedgerResponse& from)
+  : ::google::protobuf::Message(),
+    _internal_metadata_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:protocol.LedgerResponse)
+}
+
+void LedgerResponse::SharedCtor() {
+    _is_default_instance_ = false;
+  ::google::protobuf::internal::GetEmptyString();
+  _cached_size_ = 0;
+  error_code_ = 0;
+  error_desc_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  header_ = NULL;
+}
+
+LedgerResponse::~LedgerResponse() {
+  // @@protoc_insertion_point(destructor:protocol.LedgerResponse)
+  SharedDtor();
+}
+
+void LedgerResponse::SharedDtor() {
+  error_desc_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (this != default_instance_) {
+    delete header_;
+  }
+}
+
+void LedgerResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* LedgerResponse::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return LedgerResponse_descriptor_;
+}
+
+const LedgerResponse& LedgerResponse::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_chain_2eproto();
+  return *default_instance_;
+}
+
+LedgerResponse* LedgerResponse::default_instance_ = NULL;
+
+LedgerResponse* LedgerResponse::New(::google::protobuf::Arena* arena) const {
+  LedgerResponse* n = new LedgerResponse;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void LedgerResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.LedgerResponse)
+  error_code_ = 0;
+  error_desc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
+  transactions_.Clear();
+}
+
+bool LedgerResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protocol.LedgerResponse)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 error_code = 1;
+      case 1: {
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &error_code_)));
+
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_error_desc;
+        break;
+      }
+
+      // optional string error_desc = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_error_desc:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_error_desc()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->error_desc().data(), this->error_desc().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "protocol.LedgerResponse.error_desc"));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(26)) goto parse_header;
+        break;
+      }
+
+      // optional .protocol.LedgerHeader header = 3;
+      case 3: {
+        if (tag == 26) {
+         parse_header:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_header()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(34)) goto parse_transactions;
+        break;
+      }
+
+      // repeated .protocol.TransactionEnvStore transactions = 4;
+      case 4: {
+        if (tag == 34) {
+         parse_transactions:
+          DO_(input->IncrementRecursionDepth());
+         parse_loop_transactions:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_transactions()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(34)) goto parse_loop_transactions;
+        input->UnsafeDecrementRecursionDepth();
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protocol.LedgerResponse)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protocol.LedgerResponse)
+  return false;
+#undef DO_
+}
+
+void LedgerResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protocol.LedgerResponse)
+  // optional int32 error_code = 1;
+  if (this->error_code() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->error_code(), output);
+  }
+
+  // optional string error_desc = 2;
+  if (this->error_desc().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->error_desc().data(), this->error_desc().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.LedgerResponse.error_desc");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->error_desc(), output);
+  }
+
+  // optional .protocol.LedgerHeader header = 3;
+  if (this->has_header()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, *this->header_, output);
+  }
+
+  // repeated .protocol.TransactionEnvStore transactions = 4;
+  for (unsigned int i = 0, n = this->transactions_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->transactions(i), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:protocol.LedgerResponse)
+}
+
+::google::protobuf::uint8* LedgerResponse::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.LedgerResponse)
+  // optional int32 error_code = 1;
+  if (this->error_code() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->error_code(), target);
+  }
+
+  // optional string error_desc = 2;
+  if (this->error_desc().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->error_desc().data(), this->error_desc().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.LedgerResponse.error_desc");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->error_desc(), target);
+  }
+
+  // optional .protocol.LedgerHeader header = 3;
+  if (this->has_header()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        3, *this->header_, false, target);
+  }
+
+  // repeated .protocol.TransactionEnvStore transactions = 4;
+  for (unsigned int i = 0, n = this->transactions_size(); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        4, this->transactions(i), false, target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.LedgerResponse)
+  return target;
+}
+
+int LedgerResponse::ByteSize() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.LedgerResponse)
+  int total_size = 0;
+
+  // optional int32 error_code = 1;
+  if (this->error_code() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->error_code());
+  }
+
+  // optional string error_desc = 2;
+  if (this->error_desc().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->error_desc());
+  }
+
+  // optional .protocol.LedgerHeader header = 3;
+  if (this->has_header()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->header_);
+  }
+
+  // repeated .protocol.TransactionEnvStore transactions = 4;
+  total_size += 1 * this->transactions_size();
+  for (int i = 0; i < this->transactions_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->transactions(i));
+  }
+
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void LedgerResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protocol.LedgerResponse)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  const LedgerResponse* source = 
+      ::google::protobuf::internal::DynamicCastToGenerated<const LedgerResponse>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.LedgerResponse)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.LedgerResponse)
+    MergeFrom(*source);
+  }
+}
+
+void LedgerResponse::MergeFrom(const LedgerResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protocol.LedgerResponse)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  transactions_.MergeFrom(from.transactions_);
+  if (from.error_code() != 0) {
+    set_error_code(from.error_code());
+  }
+  if (from.error_desc().size() > 0) {
+
+    error_desc_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_desc_);
+  }
+  if (from.has_header()) {
+    mutable_header()->::protocol::LedgerHeader::MergeFrom(from.header());
+  }
+}
+
+void LedgerResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protocol.LedgerResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void LedgerResponse::CopyFrom(const LedgerResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.LedgerResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LedgerResponse::IsInitialized() const {
+
+  return true;
+}
+
+void LedgerResponse::Swap(LedgerResponse* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void LedgerResponse::InternalSwap(LedgerResponse* other) {
+  std::swap(error_code_, other->error_code_);
+  error_desc_.Swap(&other->error_desc_);
+  std::swap(header_, other->header_);
+  transactions_.UnsafeArenaSwap(&other->transactions_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata LedgerResponse::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = LedgerResponse_descriptor_;
+  metadata.reflection = LedgerResponse_reflection_;
+  return metadata;
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// LedgerResponse
+
+// optional int32 error_code = 1;
+void LedgerResponse::clear_error_code() {
+  error_code_ = 0;
+}
+ ::google::protobuf::int32 LedgerResponse::error_code() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerResponse.error_code)
+  return error_code_;
+}
+ void LedgerResponse::set_error_code(::google::protobuf::int32 value) {
+  
+  error_code_ = value;
+  // @@protoc_insertion_point(field_set:protocol.LedgerResponse.error_code)
+}
+
+// optional string error_desc = 2;
+void LedgerResponse::clear_error_desc() {
+  error_desc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ const ::std::string& LedgerResponse::error_desc() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerResponse.error_desc)
+  return error_desc_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void LedgerResponse::set_error_desc(const ::std::string& value) {
+  
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.LedgerResponse.error_desc)
+}
+ void LedgerResponse::set_error_desc(const char* value) {
+  
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.LedgerResponse.error_desc)
+}
+ void LedgerResponse::set_error_desc(const char* value, size_t size) {
+  
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.LedgerResponse.error_desc)
+}
+ ::std::string* LedgerResponse::mutable_error_desc() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.LedgerResponse.error_desc)
+  return error_desc_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ ::std::string* LedgerResponse::release_error_desc() {
+  // @@protoc_insertion_point(field_release:protocol.LedgerResponse.error_desc)
+  
+  return error_desc_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void LedgerResponse::set_allocated_error_desc(::std::string* error_desc) {
+  if (error_desc != NULL) {
+    
+  } else {
+    
+  }
+  error_desc_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_desc);
+  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerResponse.error_desc)
+}
+
+// optional .protocol.LedgerHeader header = 3;
+bool LedgerResponse::has_header() const {
+  return !_is_default_instance_ && header_ != NULL;
+}
+void LedgerResponse::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
+}
+const ::protocol::LedgerHeader& LedgerResponse::header() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerResponse.header)
+  return header_ != NULL ? *header_ : *default_instance_->header_;
+}
+::protocol::LedgerHeader* LedgerResponse::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::protocol::LedgerHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.LedgerResponse.header)
+  return header_;
+}
+::protocol::LedgerHeader* LedgerResponse::release_header() {
+  // @@protoc_insertion_point(field_release:protocol.LedgerResponse.header)
+  
+  ::protocol::LedgerHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+void LedgerResponse::set_allocated_header(::protocol::LedgerHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerResponse.header)
+}
+
+// repeated .protocol.TransactionEnvStore transactions = 4;
+int LedgerResponse::transactions_size() const {
+  return transactions_.size();
+}
+void LedgerResponse::clear_transactions() {
+  transactions_.Clear();
+}
+const ::protocol::TransactionEnvStore& LedgerResponse::transactions(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerResponse.transactions)
+  return transactions_.Get(index);
+}
+::protocol::TransactionEnvStore* LedgerResponse::mutable_transactions(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.LedgerResponse.transactions)
+  return transactions_.Mutable(index);
+}
+::protocol::TransactionEnvStore* LedgerResponse::add_transactions() {
+  // @@protoc_insertion_point(field_add:protocol.LedgerResponse.transactions)
+  return transactions_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >*
+LedgerResponse::mutable_transactions() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.LedgerResponse.transactions)
+  return &transactions_;
+}
+const ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >&
+LedgerResponse::transactions() const {
+  // @@protoc_insertion_point(field_list:protocol.LedgerResponse.transactions)
+  return transactions_;
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TransactionResponse::kErrorCodeFieldNumber;
+const int TransactionResponse::kErrorDescFieldNumber;
+const int TransactionResponse::kTotalCountFieldNumber;
+const int TransactionResponse::kTransactionsFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TransactionResponse::TransactionResponse()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protocol.TransactionResponse)
+}
+
+void TransactionResponse::InitAsDefaultInstance() {
+  _is_default_instance_ = true;
+}
+
+TransactionResponse::TransactionResponse(const TransactionResponse& from)
+  : ::google::protobuf::Message(),
+    _internal_metadata_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:protocol.TransactionResponse)
+}
+
+void TransactionResponse::SharedCtor() {
+    _is_default_instance_ = false;
+  ::google::protobuf::internal::GetEmptyString();
+  _cached_size_ = 0;
+  error_code_ = 0;
+  error_desc_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  total_count_ = GOOGLE_LONGLONG(0);
+}
+
+TransactionResponse::~TransactionResponse() {
+  // @@protoc_insertion_point(destructor:protocol.TransactionResponse)
+  SharedDtor();
+}
+
+void TransactionResponse::SharedDtor() {
+  error_desc_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (this != default_instance_) {
+  }
+}
+
+void TransactionResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* TransactionResponse::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return TransactionResponse_descriptor_;
+}
+
+const TransactionResponse& TransactionResponse::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_chain_2eproto();
+  return *default_instance_;
+}
+
+TransactionResponse* TransactionResponse::default_instance_ = NULL;
+
+TransactionResponse* TransactionResponse::New(::google::protobuf::Arena* arena) const {
+  TransactionResponse* n = new TransactionResponse;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void TransactionResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.TransactionResponse)
+  error_code_ = 0;
+  error_desc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  total_count_ = GOOGLE_LONGLONG(0);
+  transactions_.Clear();
+}
+
+bool TransactionResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protocol.TransactionResponse)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 error_code = 1;
+      case 1: {
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &error_code_)));
+
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_error_desc;
+        break;
+      }
+
+      // optional string error_desc = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_error_desc:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_error_desc()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->error_desc().data(), this->error_desc().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "protocol.TransactionResponse.error_desc"));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(24)) goto parse_total_count;
+        break;
+      }
+
+      // optional int64 total_count = 3;
+      case 3: {
+        if (tag == 24) {
+         parse_total_count:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &total_count_)));
+
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(34)) goto parse_transactions;
+        break;
+      }
+
+      // repeated .protocol.TransactionEnvStore transactions = 4;
+      case 4: {
+        if (tag == 34) {
+         parse_transactions:
+          DO_(input->IncrementRecursionDepth());
+         parse_loop_transactions:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_transactions()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(34)) goto parse_loop_transactions;
+        input->UnsafeDecrementRecursionDepth();
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protocol.TransactionResponse)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protocol.TransactionResponse)
+  return false;
+#undef DO_
+}
+
+void TransactionResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protocol.TransactionResponse)
+  // optional int32 error_code = 1;
+  if (this->error_code() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->error_code(), output);
+  }
+
+  // optional string error_desc = 2;
+  if (this->error_desc().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->error_desc().data(), this->error_desc().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.TransactionResponse.error_desc");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->error_desc(), output);
+  }
+
+  // optional int64 total_count = 3;
+  if (this->total_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->total_count(), output);
+  }
+
+  // repeated .protocol.TransactionEnvStore transactions = 4;
+  for (unsigned int i = 0, n = this->transactions_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->transactions(i), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:protocol.TransactionResponse)
+}
+
+::google::protobuf::uint8* TransactionResponse::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.TransactionResponse)
+  // optional int32 error_code = 1;
+  if (this->error_code() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->error_code(), target);
+  }
+
+  // optional string error_desc = 2;
+  if (this->error_desc().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->error_desc().data(), this->error_desc().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.TransactionResponse.error_desc");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->error_desc(), target);
+  }
+
+  // optional int64 total_count = 3;
+  if (this->total_count() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->total_count(), target);
+  }
+
+  // repeated .protocol.TransactionEnvStore transactions = 4;
+  for (unsigned int i = 0, n = this->transactions_size(); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        4, this->transactions(i), false, target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.TransactionResponse)
+  return target;
+}
+
+int TransactionResponse::ByteSize() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.TransactionResponse)
+  int total_size = 0;
+
+  // optional int32 error_code = 1;
+  if (this->error_code() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->error_code());
+  }
+
+  // optional string error_desc = 2;
+  if (this->error_desc().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->error_desc());
+  }
+
+  // optional int64 total_count = 3;
+  if (this->total_count() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int64Size(
+        this->total_count());
+  }
+
+  // repeated .protocol.TransactionEnvStore transactions = 4;
+  total_size += 1 * this->transactions_size();
+  for (int i = 0; i < this->transactions_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->transactions(i));
+  }
+
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void TransactionResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protocol.TransactionResponse)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  const TransactionResponse* source = 
+      ::google::protobuf::internal::DynamicCastToGenerated<const TransactionResponse>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.TransactionResponse)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.TransactionResponse)
+    MergeFrom(*source);
+  }
+}
+
+void TransactionResponse::MergeFrom(const TransactionResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protocol.TransactionResponse)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  transactions_.MergeFrom(from.transactions_);
+  if (from.error_code() != 0) {
+    set_error_code(from.error_code());
+  }
+  if (from.error_desc().size() > 0) {
+
+    error_desc_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_desc_);
+  }
+  if (from.total_count() != 0) {
+    set_total_count(from.total_count());
+  }
+}
+
+void TransactionResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protocol.TransactionResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TransactionResponse::CopyFrom(const TransactionResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.TransactionResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TransactionResponse::IsInitialized() const {
+
+  return true;
+}
+
+void TransactionResponse::Swap(TransactionResponse* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TransactionResponse::InternalSwap(TransactionResponse* other) {
+  std::swap(error_code_, other->error_code_);
+  error_desc_.Swap(&other->error_desc_);
+  std::swap(total_count_, other->total_count_);
+  transactions_.UnsafeArenaSwap(&other->transactions_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata TransactionResponse::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = TransactionResponse_descriptor_;
+  metadata.reflection = TransactionResponse_reflection_;
+  return metadata;
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// TransactionResponse
+
+// optional int32 error_code = 1;
+void TransactionResponse::clear_error_code() {
+  error_code_ = 0;
+}
+ ::google::protobuf::int32 TransactionResponse::error_code() const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionResponse.error_code)
+  return error_code_;
+}
+ void TransactionResponse::set_error_code(::google::protobuf::int32 value) {
+  
+  error_code_ = value;
+  // @@protoc_insertion_point(field_set:protocol.TransactionResponse.error_code)
+}
+
+// optional string error_desc = 2;
+void TransactionResponse::clear_error_desc() {
+  error_desc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ const ::std::string& TransactionResponse::error_desc() const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionResponse.error_desc)
+  return error_desc_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void TransactionResponse::set_error_desc(const ::std::string& value) {
+  
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.TransactionResponse.error_desc)
+}
+ void TransactionResponse::set_error_desc(const char* value) {
+  
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.TransactionResponse.error_desc)
+}
+ void TransactionResponse::set_error_desc(const char* value, size_t size) {
+  
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.TransactionResponse.error_desc)
+}
+ ::std::string* TransactionResponse::mutable_error_desc() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.TransactionResponse.error_desc)
+  return error_desc_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ ::std::string* TransactionResponse::release_error_desc() {
+  // @@protoc_insertion_point(field_release:protocol.TransactionResponse.error_desc)
+  
+  return error_desc_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void TransactionResponse::set_allocated_error_desc(::std::string* error_desc) {
+  if (error_desc != NULL) {
+    
+  } else {
+    
+  }
+  error_desc_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_desc);
+  // @@protoc_insertion_point(field_set_allocated:protocol.TransactionResponse.error_desc)
+}
+
+// optional int64 total_count = 3;
+void TransactionResponse::clear_total_count() {
+  total_count_ = GOOGLE_LONGLONG(0);
+}
+ ::google::protobuf::int64 TransactionResponse::total_count() const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionResponse.total_count)
+  return total_count_;
+}
+ void TransactionResponse::set_total_count(::google::protobuf::int64 value) {
+  
+  total_count_ = value;
+  // @@protoc_insertion_point(field_set:protocol.TransactionResponse.total_count)
+}
+
+// repeated .protocol.TransactionEnvStore transactions = 4;
+int TransactionResponse::transactions_size() const {
+  return transactions_.size();
+}
+void TransactionResponse::clear_transactions() {
+  transactions_.Clear();
+}
+const ::protocol::TransactionEnvStore& TransactionResponse::transactions(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionResponse.transactions)
+  return transactions_.Get(index);
+}
+::protocol::TransactionEnvStore* TransactionResponse::mutable_transactions(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.TransactionResponse.transactions)
+  return transactions_.Mutable(index);
+}
+::protocol::TransactionEnvStore* TransactionResponse::add_transactions() {
+  // @@protoc_insertion_point(field_add:protocol.TransactionResponse.transactions)
+  return transactions_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >*
+TransactionResponse::mutable_transactions() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.TransactionResponse.transactions)
+  return &transactions_;
+}
+const ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >&
+TransactionResponse::transactions() const {
+  // @@protoc_insertion_point(field_list:protocol.TransactionResponse.transactions)
+  return transactions_;
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int SubmitTransactionResponse_Result::kHashFieldNumber;
+const int SubmitTransactionResponse_Result::kErrorCodeFieldNumber;
+const int SubmitTransactionResponse_Result::kErrorDescFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+SubmitTransactionResponse_Result::SubmitTransactionResponse_Result()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protocol.SubmitTransactionResponse.Result)
+}
+
+void SubmitTransactionResponse_Result::InitAsDefaultInstance() {
+  _is_default_instance_ = true;
+}
+
+SubmitTransactionResponse_Result::SubmitTransactionResponse_Result(const SubmitTransactionResponse_Result& from)
+  : ::google::protobuf::Message(),
+    _internal_metadata_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:protocol.SubmitTransactionResponse.Result)
+}
+
+void SubmitTransactionResponse_Result::SharedCtor() {
+    _is_default_instance_ = false;
+  ::google::protobuf::internal::GetEmptyString();
+  _cached_size_ = 0;
+  hash_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  error_code_ = 0;
+  error_desc_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+SubmitTransactionResponse_Result::~SubmitTransactionResponse_Result() {
+  // @@protoc_insertion_point(destructor:protocol.SubmitTransactionResponse.Result)
+  SharedDtor();
+}
+
+void SubmitTransactionResponse_Result::SharedDtor() {
+  hash_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  error_desc_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (this != default_instance_) {
+  }
+}
+
+void SubmitTransactionResponse_Result::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* SubmitTransactionResponse_Result::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return SubmitTransactionResponse_Result_descriptor_;
+}
+
+const SubmitTransactionResponse_Result& SubmitTransactionResponse_Result::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_chain_2eproto();
+  return *default_instance_;
+}
+
+SubmitTransactionResponse_Result* SubmitTransactionResponse_Result::default_instance_ = NULL;
+
+SubmitTransactionResponse_Result* SubmitTransactionResponse_Result::New(::google::protobuf::Arena* arena) const {
+  SubmitTransactionResponse_Result* n = new SubmitTransactionResponse_Result;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void SubmitTransactionResponse_Result::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.SubmitTransactionResponse.Result)
+  hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  error_code_ = 0;
+  error_desc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+bool SubmitTransactionResponse_Result::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protocol.SubmitTransactionResponse.Result)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional bytes hash = 1;
+      case 1: {
+        if (tag == 10) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_hash()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(16)) goto parse_error_code;
+        break;
+      }
+
+      // optional int32 error_code = 2;
+      case 2: {
+        if (tag == 16) {
+         parse_error_code:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &error_code_)));
+
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(26)) goto parse_error_desc;
+        break;
+      }
+
+      // optional string error_desc = 3;
+      case 3: {
+        if (tag == 26) {
+         parse_error_desc:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_error_desc()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->error_desc().data(), this->error_desc().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "protocol.SubmitTransactionResponse.Result.error_desc"));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protocol.SubmitTransactionResponse.Result)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protocol.SubmitTransactionResponse.Result)
+  return false;
+#undef DO_
+}
+
+void SubmitTransactionResponse_Result::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protocol.SubmitTransactionResponse.Result)
+  // optional bytes hash = 1;
+  if (this->hash().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      1, this->hash(), output);
+  }
+
+  // optional int32 error_code = 2;
+  if (this->error_code() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->error_code(), output);
+  }
+
+  // optional string error_desc = 3;
+  if (this->error_desc().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->error_desc().data(), this->error_desc().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.SubmitTransactionResponse.Result.error_desc");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      3, this->error_desc(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:protocol.SubmitTransactionResponse.Result)
+}
+
+::google::protobuf::uint8* SubmitTransactionResponse_Result::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.SubmitTransactionResponse.Result)
+  // optional bytes hash = 1;
+  if (this->hash().size() > 0) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        1, this->hash(), target);
+  }
+
+  // optional int32 error_code = 2;
+  if (this->error_code() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->error_code(), target);
+  }
+
+  // optional string error_desc = 3;
+  if (this->error_desc().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->error_desc().data(), this->error_desc().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.SubmitTransactionResponse.Result.error_desc");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        3, this->error_desc(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.SubmitTransactionResponse.Result)
+  return target;
+}
+
+int SubmitTransactionResponse_Result::ByteSize() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.SubmitTransactionResponse.Result)
+  int total_size = 0;
+
+  // optional bytes hash = 1;
+  if (this->hash().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->hash());
+  }
+
+  // optional int32 error_code = 2;
+  if (this->error_code() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->error_code());
+  }
+
+  // optional string error_desc = 3;
+  if (this->error_desc().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->error_desc());
+  }
+
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void SubmitTransactionResponse_Result::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protocol.SubmitTransactionResponse.Result)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  const SubmitTransactionResponse_Result* source = 
+      ::google::protobuf::internal::DynamicCastToGenerated<const SubmitTransactionResponse_Result>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.SubmitTransactionResponse.Result)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.SubmitTransactionResponse.Result)
+    MergeFrom(*source);
+  }
+}
+
+void SubmitTransactionResponse_Result::MergeFrom(const SubmitTransactionResponse_Result& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protocol.SubmitTransactionResponse.Result)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  if (from.hash().size() > 0) {
+
+    hash_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.hash_);
+  }
+  if (from.error_code() != 0) {
+    set_error_code(from.error_code());
+  }
+  if (from.error_desc().size() > 0) {
+
+    error_desc_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_desc_);
+  }
+}
+
+void SubmitTransactionResponse_Result::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protocol.SubmitTransactionResponse.Result)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void SubmitTransactionResponse_Result::CopyFrom(const SubmitTransactionResponse_Result& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.SubmitTransactionResponse.Result)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubmitTransactionResponse_Result::IsInitialized() const {
+
+  return true;
+}
+
+void SubmitTransactionResponse_Result::Swap(SubmitTransactionResponse_Result* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void SubmitTransactionResponse_Result::InternalSwap(SubmitTransactionResponse_Result* other) {
+  hash_.Swap(&other->hash_);
+  std::swap(error_code_, other->error_code_);
+  error_desc_.Swap(&other->error_desc_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata SubmitTransactionResponse_Result::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = SubmitTransactionResponse_Result_descriptor_;
+  metadata.reflection = SubmitTransactionResponse_Result_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int SubmitTransactionResponse::kSuccessCountFieldNumber;
+const int SubmitTransactionResponse::kResultsFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+SubmitTransactionResponse::SubmitTransactionResponse()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protocol.SubmitTransactionResponse)
+}
+
+void SubmitTransactionResponse::InitAsDefaultInstance() {
+  _is_default_instance_ = true;
+}
+
+SubmitTransactionResponse::SubmitTransactionResponse(const SubmitTransactionResponse& from)
+  : ::google::protobuf::Message(),
+    _internal_metadata_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:protocol.SubmitTransactionResponse)
+}
+
+void SubmitTransactionResponse::SharedCtor() {
+    _is_default_instance_ = false;
+  _cached_size_ = 0;
+  success_count_ = 0;
+}
+
+SubmitTransactionResponse::~SubmitTransactionResponse() {
+  // @@protoc_insertion_point(destructor:protocol.SubmitTransactionResponse)
+  SharedDtor();
+}
+
+void SubmitTransactionResponse::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void SubmitTransactionResponse::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* SubmitTransactionResponse::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return SubmitTransactionResponse_descriptor_;
+}
+
+const SubmitTransactionResponse& SubmitTransactionResponse::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_chain_2eproto();
+  return *default_instance_;
+}
+
+SubmitTransactionResponse* SubmitTransactionResponse::default_instance_ = NULL;
+
+SubmitTransactionResponse* SubmitTransactionResponse::New(::google::protobuf::Arena* arena) const {
+  SubmitTransactionResponse* n = new SubmitTransactionResponse;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void SubmitTransactionResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.SubmitTransactionResponse)
+  success_count_ = 0;
+  results_.Clear();
+}
+
+bool SubmitTransactionResponse::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protocol.SubmitTransactionResponse)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 success_count = 1;
+      case 1: {
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &success_count_)));
+
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_results;
+        break;
+      }
+
+      // repeated .protocol.SubmitTransactionResponse.Result results = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_results:
+          DO_(input->IncrementRecursionDepth());
+         parse_loop_results:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_results()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_loop_results;
+        input->UnsafeDecrementRecursionDepth();
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protocol.SubmitTransactionResponse)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protocol.SubmitTransactionResponse)
+  return false;
+#undef DO_
+}
+
+void SubmitTransactionResponse::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protocol.SubmitTransactionResponse)
+  // optional int32 success_count = 1;
+  if (this->success_count() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->success_count(), output);
+  }
+
+  // repeated .protocol.SubmitTransactionResponse.Result results = 2;
+  for (unsigned int i = 0, n = this->results_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->results(i), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:protocol.SubmitTransactionResponse)
+}
+
+::google::protobuf::uint8* SubmitTransactionResponse::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.SubmitTransactionResponse)
+  // optional int32 success_count = 1;
+  if (this->success_count() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->success_count(), target);
+  }
+
+  // repeated .protocol.SubmitTransactionResponse.Result results = 2;
+  for (unsigned int i = 0, n = this->results_size(); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        2, this->results(i), false, target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.SubmitTransactionResponse)
+  return target;
+}
+
+int SubmitTransactionResponse::ByteSize() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.SubmitTransactionResponse)
+  int total_size = 0;
+
+  // optional int32 success_count = 1;
+  if (this->success_count() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->success_count());
+  }
+
+  // repeated .protocol.SubmitTransactionResponse.Result results = 2;
+  total_size += 1 * this->results_size();
+  for (int i = 0; i < this->results_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->results(i));
+  }
+
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void SubmitTransactionResponse::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protocol.SubmitTransactionResponse)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  const SubmitTransactionResponse* source = 
+      ::google::protobuf::internal::DynamicCastToGenerated<const SubmitTransactionResponse>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.SubmitTransactionResponse)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.SubmitTransactionResponse)
+    MergeFrom(*source);
+  }
+}
+
+void SubmitTransactionResponse::MergeFrom(const SubmitTransactionResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protocol.SubmitTransactionResponse)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  results_.MergeFrom(from.results_);
+  if (from.success_count() != 0) {
+    set_success_count(from.success_count());
+  }
+}
+
+void SubmitTransactionResponse::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protocol.SubmitTransactionResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void SubmitTransactionResponse::CopyFrom(const SubmitTransactionResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.SubmitTransactionResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubmitTransactionResponse::IsInitialized() const {
+
+  return true;
+}
+
+void SubmitTransactionResponse::Swap(SubmitTransactionResponse* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void SubmitTransactionResponse::InternalSwap(SubmitTransactionResponse* other) {
+  std::swap(success_count_, other->success_count_);
+  results_.UnsafeArenaSwap(&other->results_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata SubmitTransactionResponse::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = SubmitTransactionResponse_descriptor_;
+  metadata.reflection = SubmitTransactionResponse_reflection_;
+  return metadata;
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// SubmitTransactionResponse_Result
+
+// optional bytes hash = 1;
+void SubmitTransactionResponse_Result::clear_hash() {
+  hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ const ::std::string& SubmitTransactionResponse_Result::hash() const {
+  // @@protoc_insertion_point(field_get:protocol.SubmitTransactionResponse.Result.hash)
+  return hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void SubmitTransactionResponse_Result::set_hash(const ::std::string& value) {
+  
+  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.SubmitTransactionResponse.Result.hash)
+}
+ void SubmitTransactionResponse_Result::set_hash(const char* value) {
+  
+  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.SubmitTransactionResponse.Result.hash)
+}
+ void SubmitTransactionResponse_Result::set_hash(const void* value, size_t size) {
+  
+  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.SubmitTransactionResponse.Result.hash)
+}
+ ::std::string* SubmitTransactionResponse_Result::mutable_hash() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.SubmitTransactionResponse.Result.hash)
+  return hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ ::std::string* SubmitTransactionResponse_Result::release_hash() {
+  // @@protoc_insertion_point(field_release:protocol.SubmitTransactionResponse.Result.hash)
+  
+  return hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void SubmitTransactionResponse_Result::set_allocated_hash(::std::string* hash) {
+  if (hash != NULL) {
+    
+  } else {
+    
+  }
+  hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hash);
+  // @@protoc_insertion_point(field_set_allocated:protocol.SubmitTransactionResponse.Result.hash)
+}
+
+// optional int32 error_code = 2;
+void SubmitTransactionResponse_Result::clear_error_code() {
+  error_code_ = 0;
+}
+ ::google::protobuf::int32 SubmitTransactionResponse_Result::error_code() const {
+  // @@protoc_insertion_point(field_get:protocol.SubmitTransactionResponse.Result.error_code)
+  return error_code_;
+}
+ void SubmitTransactionResponse_Result::set_error_code(::google::protobuf::int32 value) {
+  
+  error_code_ = value;
+  // @@protoc_insertion_point(field_set:protocol.SubmitTransactionResponse.Result.error_code)
+}
+
+// optional string error_desc = 3;
+void SubmitTransactionResponse_Result::clear_error_desc() {
+  error_desc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ const ::std::string& SubmitTransactionResponse_Result::error_desc() const {
+  // @@protoc_insertion_point(field_get:protocol.SubmitTransactionResponse.Result.error_desc)
+  return error_desc_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void SubmitTransactionResponse_Result::set_error_desc(const ::std::string& value) {
+  
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.SubmitTransactionResponse.Result.error_desc)
+}
+ void SubmitTransactionResponse_Result::set_error_desc(const char* value) {
+  
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.SubmitTransactionResponse.Result.error_desc)
+}
+ void SubmitTransactionResponse_Result::set_error_desc(const char* value, size_t size) {
+  
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.SubmitTransactionResponse.Result.error_desc)
+}
+ ::std::string* SubmitTransactionResponse_Result::mutable_error_desc() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.SubmitTransactionResponse.Result.error_desc)
+  return error_desc_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ ::std::string* SubmitTransactionResponse_Result::release_error_desc() {
+  // @@protoc_insertion_point(field_release:protocol.SubmitTransactionResponse.Result.error_desc)
+  
+  return error_desc_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void SubmitTransactionResponse_Result::set_allocated_error_desc(::std::string* error_desc) {
+  if (error_desc != NULL) {
+    
+  } else {
+    
+  }
+  error_desc_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_desc);
+  // @@protoc_insertion_point(field_set_allocated:protocol.SubmitTransactionResponse.Result.error_desc)
+}
+
+// -------------------------------------------------------------------
+
+// SubmitTransactionResponse
+
+// optional int32 success_count = 1;
+void SubmitTransactionResponse::clear_success_count() {
+  success_count_ = 0;
+}
+ ::google::protobuf::int32 SubmitTransactionResponse::success_count() const {
+  // @@protoc_insertion_point(field_get:protocol.SubmitTransactionResponse.success_count)
+  return success_count_;
+}
+ void SubmitTransactionResponse::set_success_count(::google::protobuf::int32 value) {
+  
+  success_count_ = value;
+  // @@protoc_insertion_point(field_set:protocol.SubmitTransactionResponse.success_count)
+}
+
+// repeated .protocol.SubmitTransactionResponse.Result results = 2;
+int SubmitTransactionResponse::results_size() const {
+  return results_.size();
+}
+void SubmitTransactionResponse::clear_results() {
+  results_.Clear();
+}
+const ::protocol::SubmitTransactionResponse_Result& SubmitTransactionResponse::results(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.SubmitTransactionResponse.results)
+  return results_.Get(index);
+}
+::protocol::SubmitTransactionResponse_Result* SubmitTransactionResponse::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.SubmitTransactionResponse.results)
+  return results_.Mutable(index);
+}
+::protocol::SubmitTransactionResponse_Result* SubmitTransactionResponse::add_results() {
+  // @@protoc_insertion_point(field_add:protocol.SubmitTransactionResponse.results)
+  return results_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::protocol::SubmitTransactionResponse_Result >*
+SubmitTransactionResponse::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.SubmitTransactionResponse.results)
+  return &results_;
+}
+const ::google::protobuf::RepeatedPtrField< ::protocol::SubmitTransactionResponse_Result >&
+SubmitTransactionResponse::results() const {
+  // @@protoc_insertion_point(field_list:protocol.SubmitTransactionResponse.results)
+  return results_;
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace protocol
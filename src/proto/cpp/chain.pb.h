@@ -40,6 +40,7 @@ void protobuf_ShutdownFile_chain_2eproto();
 
 class Account;
 class AccountPrivilege;
+class AccountResponse;
 class AccountThreshold;
 class Asset;
 class AssetKey;
@@ -50,6 +51,7 @@ class ConsensusValueValidation;
 class Contract;
 class Ledger;
 class LedgerHeader;
+class LedgerResponse;
 class Operation;
 class OperationCreateAccount;
 class OperationIssueAsset;
@@ -62,10 +64,13 @@ class OperationSetSignerWeight;
 class OperationSetThreshold;
 class OperationTypeThreshold;
 class Signer;
+class SubmitTransactionResponse;
+class SubmitTransactionResponse_Result;
 class Transaction;
 class TransactionEnv;
 class TransactionEnvSet;
 class TransactionEnvStore;
+class TransactionResponse;
 class Trigger;
 class Trigger_OperationTrigger;
 
@@ -3789,3788 +3794,4902 @@ class OperationSetMetadata : public ::google::protobuf::Message /* @@protoc_inse
   void InitAsDefaultInstance();
   static OperationSetMetadata* default_instance_;
 };
+// -------------------------------------------------------------------
+
+class AccountResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protocol.AccountResponse) */ {
+ public:
+  AccountResponse();
+  virtual ~AccountResponse();
+
+  AccountResponse(const AccountResponse& from);
+
+  inline AccountResponse& operator=(const AccountResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const AccountResponse& default_instance();
+
+  void Swap(AccountResponse* other);
+
+  // implements Message ----------------------------------------------
+
+  inline AccountResponse* New() const { return New(NULL); }
+
+  AccountResponse* New(::google::protobuf::Arena* arena) const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const AccountResponse& from);
+  void MergeFrom(const AccountResponse& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(AccountResponse* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return _internal_metadata_.arena();
+  }
+  inline void* MaybeArenaPtr() const {
+    return _internal_metadata_.raw_arena_ptr();
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional int32 error_code = 1;
+  void clear_error_code();
+  static const int kErrorCodeFieldNumber = 1;
+  ::google::protobuf::int32 error_code() const;
+  void set_error_code(::google::protobuf::int32 value);
+
+  // optional string error_desc = 2;
+  void clear_error_desc();
+  static const int kErrorDescFieldNumber = 2;
+  const ::std::string& error_desc() const;
+  void set_error_desc(const ::std::string& value);
+  void set_error_desc(const char* value);
+  void set_error_desc(const char* value, size_t size);
+  ::std::string* mutable_error_desc();
+  ::std::string* release_error_desc();
+  void set_allocated_error_desc(::std::string* error_desc);
+
+  // optional .protocol.Account account = 3;
+  bool has_account() const;
+  void clear_account();
+  static const int kAccountFieldNumber = 3;
+  const ::protocol::Account& account() const;
+  ::protocol::Account* mutable_account();
+  ::protocol::Account* release_account();
+  void set_allocated_account(::protocol::Account* account);
+
+  // repeated .protocol.AssetStore assets = 4;
+  int assets_size() const;
+  void clear_assets();
+  static const int kAssetsFieldNumber = 4;
+  const ::protocol::AssetStore& assets(int index) const;
+  ::protocol::AssetStore* mutable_assets(int index);
+  ::protocol::AssetStore* add_assets();
+  ::google::protobuf::RepeatedPtrField< ::protocol::AssetStore >*
+      mutable_assets();
+  const ::google::protobuf::RepeatedPtrField< ::protocol::AssetStore >&
+      assets() const;
+
+  // repeated .protocol.KeyPair metadatas = 5;
+  int metadatas_size() const;
+  void clear_metadatas();
+  static const int kMetadatasFieldNumber = 5;
+  const ::protocol::KeyPair& metadatas(int index) const;
+  ::protocol::KeyPair* mutable_metadatas(int index);
+  ::protocol::KeyPair* add_metadatas();
+  ::google::protobuf::RepeatedPtrField< ::protocol::KeyPair >*
+      mutable_metadatas();
+  const ::google::protobuf::RepeatedPtrField< ::protocol::KeyPair >&
+      metadatas() const;
+
+  // @@protoc_insertion_point(class_scope:protocol.AccountResponse)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  bool _is_default_instance_;
+  ::google::protobuf::internal::ArenaStringPtr error_desc_;
+  ::protocol::Account* account_;
+  ::google::protobuf::RepeatedPtrField< ::protocol::AssetStore > assets_;
+  ::google::protobuf::RepeatedPtrField< ::protocol::KeyPair > metadatas_;
+  ::google::protobuf::int32 error_code_;
+  mutable int _cached_size_;
+  friend void  protobuf_AddDesc_chain_2eproto();
+  friend void protobuf_AssignDesc_chain_2eproto();
+  friend void protobuf_ShutdownFile_chain_2eproto();
+
+  void InitAsDefaultInstance();
+  static AccountResponse* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class LedgerResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protocol.LedgerResponse) */ {
+ public:
+  LedgerResponse();
+  virtual ~LedgerResponse();
+
+  LedgerResponse(const LedgerResponse& from);
+
+  inline LedgerResponse& operator=(const LedgerResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const LedgerResponse& default_instance();
+
+  void Swap(LedgerResponse* other);
+
+  // implements Message ----------------------------------------------
+
+  inline LedgerResponse* New() const { return New(NULL); }
+
+  LedgerResponse* New(::google::protobuf::Arena* arena) const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const LedgerResponse& from);
+  void MergeFrom(const LedgerResponse& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(LedgerResponse* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return _internal_metadata_.arena();
+  }
+  inline void* MaybeArenaPtr() const {
+    return _internal_metadata_.raw_arena_ptr();
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional int32 error_code = 1;
+  void clear_error_code();
+  static const int kErrorCodeFieldNumber = 1;
+  ::google::protobuf::int32 error_code() const;
+  void set_error_code(::google::protobuf::int32 value);
+
+  // optional string error_desc = 2;
+  void clear_error_desc();
+  static const int kErrorDescFieldNumber = 2;
+  const ::std::string& error_desc() const;
+  void set_error_desc(const ::std::string& value);
+  void set_error_desc(const char* value);
+  void set_error_desc(const char* value, size_t size);
+  ::std::string* mutable_error_desc();
+  ::std::string* release_error_desc();
+  void set_allocated_error_desc(::std::string* error_desc);
+
+  // optional .protocol.LedgerHeader header = 3;
+  bool has_header() const;
+  void clear_header();
+  static const int kHeaderFieldNumber = 3;
+  const ::protocol::LedgerHeader& header() const;
+  ::protocol::LedgerHeader* mutable_header();
+  ::protocol::LedgerHeader* release_header();
+  void set_allocated_header(::protocol::LedgerHeader* header);
+
+  // repeated .protocol.TransactionEnvStore transactions = 4;
+  int transactions_size() const;
+  void clear_transactions();
+  static const int kTransactionsFieldNumber = 4;
+  const ::protocol::TransactionEnvStore& transactions(int index) const;
+  ::protocol::TransactionEnvStore* mutable_transactions(int index);
+  ::protocol::TransactionEnvStore* add_transactions();
+  ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >*
+      mutable_transactions();
+  const ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >&
+      transactions() const;
+
+  // @@protoc_insertion_point(class_scope:protocol.LedgerResponse)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  bool _is_default_instance_;
+  ::google::protobuf::internal::ArenaStringPtr error_desc_;
+  ::protocol::LedgerHeader* header_;
+  ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore > transactions_;
+  ::google::protobuf::int32 error_code_;
+  mutable int _cached_size_;
+  friend void  protobuf_AddDesc_chain_2eproto();
+  friend void protobuf_AssignDesc_chain_2eproto();
+  friend void protobuf_ShutdownFile_chain_2eproto();
+
+  void InitAsDefaultInstance();
+  static LedgerResponse* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class TransactionResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protocol.TransactionResponse) */ {
+ public:
+  TransactionResponse();
+  virtual ~TransactionResponse();
+
+  TransactionResponse(const TransactionResponse& from);
+
+  inline TransactionResponse& operator=(const TransactionResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TransactionResponse& default_instance();
+
+  void Swap(TransactionResponse* other);
+
+  // implements Message ----------------------------------------------
+
+  inline TransactionResponse* New() const { return New(NULL); }
+
+  TransactionResponse* New(::google::protobuf::Arena* arena) const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const TransactionResponse& from);
+  void MergeFrom(const TransactionResponse& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TransactionResponse* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return _internal_metadata_.arena();
+  }
+  inline void* MaybeArenaPtr() const {
+    return _internal_metadata_.raw_arena_ptr();
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional int32 error_code = 1;
+  void clear_error_code();
+  static const int kErrorCodeFieldNumber = 1;
+  ::google::protobuf::int32 error_code() const;
+  void set_error_code(::google::protobuf::int32 value);
+
+  // optional string error_desc = 2;
+  void clear_error_desc();
+  static const int kErrorDescFieldNumber = 2;
+  const ::std::string& error_desc() const;
+  void set_error_desc(const ::std::string& value);
+  void set_error_desc(const char* value);
+  void set_error_desc(const char* value, size_t size);
+  ::std::string* mutable_error_desc();
+  ::std::string* release_error_desc();
+  void set_allocated_error_desc(::std::string* error_desc);
+
+  // optional int64 total_count = 3;
+  void clear_total_count();
+  static const int kTotalCountFieldNumber = 3;
+  ::google::protobuf::int64 total_count() const;
+  void set_total_count(::google::protobuf::int64 value);
+
+  // repeated .protocol.TransactionEnvStore transactions = 4;
+  int transactions_size() const;
+  void clear_transactions();
+  static const int kTransactionsFieldNumber = 4;
+  const ::protocol::TransactionEnvStore& transactions(int index) const;
+  ::protocol::TransactionEnvStore* mutable_transactions(int index);
+  ::protocol::TransactionEnvStore* add_transactions();
+  ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >*
+      mutable_transactions();
+  const ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >&
+      transactions() const;
+
+  // @@protoc_insertion_point(class_scope:protocol.TransactionResponse)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  bool _is_default_instance_;
+  ::google::protobuf::internal::ArenaStringPtr error_desc_;
+  ::google::protobuf::int64 total_count_;
+  ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore > transactions_;
+  ::google::protobuf::int32 error_code_;
+  mutable int _cached_size_;
+  friend void  protobuf_AddDesc_chain_2eproto();
+  friend void protobuf_AssignDesc_chain_2eproto();
+  friend void protobuf_ShutdownFile_chain_2eproto();
+
+  void InitAsDefaultInstance();
+  static TransactionResponse* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class SubmitTransactionResponse_Result : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protocol.SubmitTransactionResponse.Result) */ {
+ public:
+  SubmitTransactionResponse_Result();
+  virtual ~SubmitTransactionResponse_Result();
+
+  SubmitTransactionResponse_Result(const SubmitTransactionResponse_Result& from);
+
+  inline SubmitTransactionResponse_Result& operator=(const SubmitTransactionResponse_Result& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const SubmitTransactionResponse_Result& default_instance();
+
+  void Swap(SubmitTransactionResponse_Result* other);
+
+  // implements Message ----------------------------------------------
+
+  inline SubmitTransactionResponse_Result* New() const { return New(NULL); }
+
+  SubmitTransactionResponse_Result* New(::google::protobuf::Arena* arena) const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const SubmitTransactionResponse_Result& from);
+  void MergeFrom(const SubmitTransactionResponse_Result& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SubmitTransactionResponse_Result* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return _internal_metadata_.arena();
+  }
+  inline void* MaybeArenaPtr() const {
+    return _internal_metadata_.raw_arena_ptr();
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional bytes hash = 1;
+  void clear_hash();
+  static const int kHashFieldNumber = 1;
+  const ::std::string& hash() const;
+  void set_hash(const ::std::string& value);
+  void set_hash(const char* value);
+  void set_hash(const void* value, size_t size);
+  ::std::string* mutable_hash();
+  ::std::string* release_hash();
+  void set_allocated_hash(::std::string* hash);
+
+  // optional int32 error_code = 2;
+  void clear_error_code();
+  static const int kErrorCodeFieldNumber = 2;
+  ::google::protobuf::int32 error_code() const;
+  void set_error_code(::google::protobuf::int32 value);
+
+  // optional string error_desc = 3;
+  void clear_error_desc();
+  static const int kErrorDescFieldNumber = 3;
+  const ::std::string& error_desc() const;
+  void set_error_desc(const ::std::string& value);
+  void set_error_desc(const char* value);
+  void set_error_desc(const char* value, size_t size);
+  ::std::string* mutable_error_desc();
+  ::std::string* release_error_desc();
+  void set_allocated_error_desc(::std::string* error_desc);
+
+  // @@protoc_insertion_point(class_scope:protocol.SubmitTransactionResponse.Result)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  bool _is_default_instance_;
+  ::google::protobuf::internal::ArenaStringPtr hash_;
+  ::google::protobuf::internal::ArenaStringPtr error_desc_;
+  ::google::protobuf::int32 error_code_;
+  mutable int _cached_size_;
+  friend void  protobuf_AddDesc_chain_2eproto();
+  friend void protobuf_AssignDesc_chain_2eproto();
+  friend void protobuf_ShutdownFile_chain_2eproto();
+
+  void InitAsDefaultInstance();
+  static SubmitTransactionResponse_Result* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class SubmitTransactionResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protocol.SubmitTransactionResponse) */ {
+ public:
+  SubmitTransactionResponse();
+  virtual ~SubmitTransactionResponse();
+
+  SubmitTransactionResponse(const SubmitTransactionResponse& from);
+
+  inline SubmitTransactionResponse& operator=(const SubmitTransactionResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const SubmitTransactionResponse& default_instance();
+
+  void Swap(SubmitTransactionResponse* other);
+
+  // implements Message ----------------------------------------------
+
+  inline SubmitTransactionResponse* New() const { return New(NULL); }
+
+  SubmitTransactionResponse* New(::google::protobuf::Arena* arena) const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const SubmitTransactionResponse& from);
+  void MergeFrom(const SubmitTransactionResponse& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SubmitTransactionResponse* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return _internal_metadata_.arena();
+  }
+  inline void* MaybeArenaPtr() const {
+    return _internal_metadata_.raw_arena_ptr();
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  typedef SubmitTransactionResponse_Result Result;
+
+  // accessors -------------------------------------------------------
+
+  // optional int32 success_count = 1;
+  void clear_success_count();
+  static const int kSuccessCountFieldNumber = 1;
+  ::google::protobuf::int32 success_count() const;
+  void set_success_count(::google::protobuf::int32 value);
+
+  // repeated .protocol.SubmitTransactionResponse.Result results = 2;
+  int results_size() const;
+  void clear_results();
+  static const int kResultsFieldNumber = 2;
+  const ::protocol::SubmitTransactionResponse_Result& results(int index) const;
+  ::protocol::SubmitTransactionResponse_Result* mutable_results(int index);
+  ::protocol::SubmitTransactionResponse_Result* add_results();
+  ::google::protobuf::RepeatedPtrField< ::protocol::SubmitTransactionResponse_Result >*
+      mutable_results();
+  const ::google::protobuf::RepeatedPtrField< ::protocol::SubmitTransactionResponse_Result >&
+      results() const;
+
+  // @@protoc_insertion_point(class_scope:protocol.SubmitTransactionResponse)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  bool _is_default_instance_;
+  ::google::protobuf::RepeatedPtrField< ::protocol::SubmitTransactionResponse_Result > results_;
+  ::google::protobuf::int32 success_count_;
+  mutable int _cached_size_;
+  friend void  protobuf_AddDesc_chain_2eproto();
+  friend void protobuf_AssignDesc_chain_2eproto();
+  friend void protobuf_ShutdownFile_chain_2eproto();
+
+  void InitAsDefaultInstance();
+  static SubmitTransactionResponse* default_instance_;
+};
 // ===================================================================
 
 
-// ===================================================================
+// ===================================================================
+
+#if !PROTOBUF_INLINE_NOT_IN_HEADERS
+// Account
+
+// optional string address = 1;
+inline void Account::clear_address() {
+  address_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& Account::address() const {
+  // @@protoc_insertion_point(field_get:protocol.Account.address)
+  return address_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void Account::set_address(const ::std::string& value) {
+  
+  address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.Account.address)
+}
+inline void Account::set_address(const char* value) {
+  
+  address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.Account.address)
+}
+inline void Account::set_address(const char* value, size_t size) {
+  
+  address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.Account.address)
+}
+inline ::std::string* Account::mutable_address() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.Account.address)
+  return address_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* Account::release_address() {
+  // @@protoc_insertion_point(field_release:protocol.Account.address)
+  
+  return address_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void Account::set_allocated_address(::std::string* address) {
+  if (address != NULL) {
+    
+  } else {
+    
+  }
+  address_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), address);
+  // @@protoc_insertion_point(field_set_allocated:protocol.Account.address)
+}
+
+// optional int64 nonce = 2;
+inline void Account::clear_nonce() {
+  nonce_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 Account::nonce() const {
+  // @@protoc_insertion_point(field_get:protocol.Account.nonce)
+  return nonce_;
+}
+inline void Account::set_nonce(::google::protobuf::int64 value) {
+  
+  nonce_ = value;
+  // @@protoc_insertion_point(field_set:protocol.Account.nonce)
+}
+
+// optional .protocol.AccountPrivilege priv = 3;
+inline bool Account::has_priv() const {
+  return !_is_default_instance_ && priv_ != NULL;
+}
+inline void Account::clear_priv() {
+  if (GetArenaNoVirtual() == NULL && priv_ != NULL) delete priv_;
+  priv_ = NULL;
+}
+inline const ::protocol::AccountPrivilege& Account::priv() const {
+  // @@protoc_insertion_point(field_get:protocol.Account.priv)
+  return priv_ != NULL ? *priv_ : *default_instance_->priv_;
+}
+inline ::protocol::AccountPrivilege* Account::mutable_priv() {
+  
+  if (priv_ == NULL) {
+    priv_ = new ::protocol::AccountPrivilege;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.Account.priv)
+  return priv_;
+}
+inline ::protocol::AccountPrivilege* Account::release_priv() {
+  // @@protoc_insertion_point(field_release:protocol.Account.priv)
+  
+  ::protocol::AccountPrivilege* temp = priv_;
+  priv_ = NULL;
+  return temp;
+}
+inline void Account::set_allocated_priv(::protocol::AccountPrivilege* priv) {
+  delete priv_;
+  priv_ = priv;
+  if (priv) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.Account.priv)
+}
+
+// optional bytes metadatas_hash = 4;
+inline void Account::clear_metadatas_hash() {
+  metadatas_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& Account::metadatas_hash() const {
+  // @@protoc_insertion_point(field_get:protocol.Account.metadatas_hash)
+  return metadatas_hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void Account::set_metadatas_hash(const ::std::string& value) {
+  
+  metadatas_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.Account.metadatas_hash)
+}
+inline void Account::set_metadatas_hash(const char* value) {
+  
+  metadatas_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.Account.metadatas_hash)
+}
+inline void Account::set_metadatas_hash(const void* value, size_t size) {
+  
+  metadatas_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.Account.metadatas_hash)
+}
+inline ::std::string* Account::mutable_metadatas_hash() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.Account.metadatas_hash)
+  return metadatas_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* Account::release_metadatas_hash() {
+  // @@protoc_insertion_point(field_release:protocol.Account.metadatas_hash)
+  
+  return metadatas_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void Account::set_allocated_metadatas_hash(::std::string* metadatas_hash) {
+  if (metadatas_hash != NULL) {
+    
+  } else {
+    
+  }
+  metadatas_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), metadatas_hash);
+  // @@protoc_insertion_point(field_set_allocated:protocol.Account.metadatas_hash)
+}
+
+// optional bytes assets_hash = 5;
+inline void Account::clear_assets_hash() {
+  assets_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& Account::assets_hash() const {
+  // @@protoc_insertion_point(field_get:protocol.Account.assets_hash)
+  return assets_hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void Account::set_assets_hash(const ::std::string& value) {
+  
+  assets_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.Account.assets_hash)
+}
+inline void Account::set_assets_hash(const char* value) {
+  
+  assets_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.Account.assets_hash)
+}
+inline void Account::set_assets_hash(const void* value, size_t size) {
+  
+  assets_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.Account.assets_hash)
+}
+inline ::std::string* Account::mutable_assets_hash() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.Account.assets_hash)
+  return assets_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* Account::release_assets_hash() {
+  // @@protoc_insertion_point(field_release:protocol.Account.assets_hash)
+  
+  return assets_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void Account::set_allocated_assets_hash(::std::string* assets_hash) {
+  if (assets_hash != NULL) {
+    
+  } else {
+    
+  }
+  assets_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), assets_hash);
+  // @@protoc_insertion_point(field_set_allocated:protocol.Account.assets_hash)
+}
+
+// optional .protocol.Contract contract = 6;
+inline bool Account::has_contract() const {
+  return !_is_default_instance_ && contract_ != NULL;
+}
+inline void Account::clear_contract() {
+  if (GetArenaNoVirtual() == NULL && contract_ != NULL) delete contract_;
+  contract_ = NULL;
+}
+inline const ::protocol::Contract& Account::contract() const {
+  // @@protoc_insertion_point(field_get:protocol.Account.contract)
+  return contract_ != NULL ? *contract_ : *default_instance_->contract_;
+}
+inline ::protocol::Contract* Account::mutable_contract() {
+  
+  if (contract_ == NULL) {
+    contract_ = new ::protocol::Contract;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.Account.contract)
+  return contract_;
+}
+inline ::protocol::Contract* Account::release_contract() {
+  // @@protoc_insertion_point(field_release:protocol.Account.contract)
+  
+  ::protocol::Contract* temp = contract_;
+  contract_ = NULL;
+  return temp;
+}
+inline void Account::set_allocated_contract(::protocol::Contract* contract) {
+  delete contract_;
+  contract_ = contract;
+  if (contract) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.Account.contract)
+}
+
+// optional int64 balance = 7;
+inline void Account::clear_balance() {
+  balance_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 Account::balance() const {
+  // @@protoc_insertion_point(field_get:protocol.Account.balance)
+  return balance_;
+}
+inline void Account::set_balance(::google::protobuf::int64 value) {
+  
+  balance_ = value;
+  // @@protoc_insertion_point(field_set:protocol.Account.balance)
+}
+
+// -------------------------------------------------------------------
+
+// AssetKey
+
+// optional string issuer = 1;
+inline void AssetKey::clear_issuer() {
+  issuer_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& AssetKey::issuer() const {
+  // @@protoc_insertion_point(field_get:protocol.AssetKey.issuer)
+  return issuer_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void AssetKey::set_issuer(const ::std::string& value) {
+  
+  issuer_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.AssetKey.issuer)
+}
+inline void AssetKey::set_issuer(const char* value) {
+  
+  issuer_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.AssetKey.issuer)
+}
+inline void AssetKey::set_issuer(const char* value, size_t size) {
+  
+  issuer_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.AssetKey.issuer)
+}
+inline ::std::string* AssetKey::mutable_issuer() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.AssetKey.issuer)
+  return issuer_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* AssetKey::release_issuer() {
+  // @@protoc_insertion_point(field_release:protocol.AssetKey.issuer)
+  
+  return issuer_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void AssetKey::set_allocated_issuer(::std::string* issuer) {
+  if (issuer != NULL) {
+    
+  } else {
+    
+  }
+  issuer_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), issuer);
+  // @@protoc_insertion_point(field_set_allocated:protocol.AssetKey.issuer)
+}
+
+// optional string code = 2;
+inline void AssetKey::clear_code() {
+  code_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& AssetKey::code() const {
+  // @@protoc_insertion_point(field_get:protocol.AssetKey.code)
+  return code_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void AssetKey::set_code(const ::std::string& value) {
+  
+  code_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.AssetKey.code)
+}
+inline void AssetKey::set_code(const char* value) {
+  
+  code_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.AssetKey.code)
+}
+inline void AssetKey::set_code(const char* value, size_t size) {
+  
+  code_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.AssetKey.code)
+}
+inline ::std::string* AssetKey::mutable_code() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.AssetKey.code)
+  return code_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* AssetKey::release_code() {
+  // @@protoc_insertion_point(field_release:protocol.AssetKey.code)
+  
+  return code_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void AssetKey::set_allocated_code(::std::string* code) {
+  if (code != NULL) {
+    
+  } else {
+    
+  }
+  code_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), code);
+  // @@protoc_insertion_point(field_set_allocated:protocol.AssetKey.code)
+}
+
+// optional int32 type = 3;
+inline void AssetKey::clear_type() {
+  type_ = 0;
+}
+inline ::google::protobuf::int32 AssetKey::type() const {
+  // @@protoc_insertion_point(field_get:protocol.AssetKey.type)
+  return type_;
+}
+inline void AssetKey::set_type(::google::protobuf::int32 value) {
+  
+  type_ = value;
+  // @@protoc_insertion_point(field_set:protocol.AssetKey.type)
+}
+
+// -------------------------------------------------------------------
+
+// Asset
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
-// Account
+// optional .protocol.AssetKey key = 1;
+inline bool Asset::has_key() const {
+  return !_is_default_instance_ && key_ != NULL;
+}
+inline void Asset::clear_key() {
+  if (GetArenaNoVirtual() == NULL && key_ != NULL) delete key_;
+  key_ = NULL;
+}
+inline const ::protocol::AssetKey& Asset::key() const {
+  // @@protoc_insertion_point(field_get:protocol.Asset.key)
+  return key_ != NULL ? *key_ : *default_instance_->key_;
+}
+inline ::protocol::AssetKey* Asset::mutable_key() {
+  
+  if (key_ == NULL) {
+    key_ = new ::protocol::AssetKey;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.Asset.key)
+  return key_;
+}
+inline ::protocol::AssetKey* Asset::release_key() {
+  // @@protoc_insertion_point(field_release:protocol.Asset.key)
+  
+  ::protocol::AssetKey* temp = key_;
+  key_ = NULL;
+  return temp;
+}
+inline void Asset::set_allocated_key(::protocol::AssetKey* key) {
+  delete key_;
+  key_ = key;
+  if (key) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.Asset.key)
+}
 
-// optional string address = 1;
-inline void Account::clear_address() {
-  address_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// optional int64 amount = 2;
+inline void Asset::clear_amount() {
+  amount_ = GOOGLE_LONGLONG(0);
 }
-inline const ::std::string& Account::address() const {
-  // @@protoc_insertion_point(field_get:protocol.Account.address)
-  return address_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::google::protobuf::int64 Asset::amount() const {
+  // @@protoc_insertion_point(field_get:protocol.Asset.amount)
+  return amount_;
 }
-inline void Account::set_address(const ::std::string& value) {
+inline void Asset::set_amount(::google::protobuf::int64 value) {
   
-  address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.Account.address)
+  amount_ = value;
+  // @@protoc_insertion_point(field_set:protocol.Asset.amount)
 }
-inline void Account::set_address(const char* value) {
+
+// -------------------------------------------------------------------
+
+// AssetProperty
+
+// optional int32 decimal = 1;
+inline void AssetProperty::clear_decimal() {
+  decimal_ = 0;
+}
+inline ::google::protobuf::int32 AssetProperty::decimal() const {
+  // @@protoc_insertion_point(field_get:protocol.AssetProperty.decimal)
+  return decimal_;
+}
+inline void AssetProperty::set_decimal(::google::protobuf::int32 value) {
   
-  address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.Account.address)
+  decimal_ = value;
+  // @@protoc_insertion_point(field_set:protocol.AssetProperty.decimal)
 }
-inline void Account::set_address(const char* value, size_t size) {
+
+// optional string description = 2;
+inline void AssetProperty::clear_description() {
+  description_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& AssetProperty::description() const {
+  // @@protoc_insertion_point(field_get:protocol.AssetProperty.description)
+  return description_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void AssetProperty::set_description(const ::std::string& value) {
   
-  address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  description_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.AssetProperty.description)
+}
+inline void AssetProperty::set_description(const char* value) {
+  
+  description_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.AssetProperty.description)
+}
+inline void AssetProperty::set_description(const char* value, size_t size) {
+  
+  description_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.Account.address)
+  // @@protoc_insertion_point(field_set_pointer:protocol.AssetProperty.description)
 }
-inline ::std::string* Account::mutable_address() {
+inline ::std::string* AssetProperty::mutable_description() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.Account.address)
-  return address_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:protocol.AssetProperty.description)
+  return description_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* Account::release_address() {
-  // @@protoc_insertion_point(field_release:protocol.Account.address)
+inline ::std::string* AssetProperty::release_description() {
+  // @@protoc_insertion_point(field_release:protocol.AssetProperty.description)
   
-  return address_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return description_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Account::set_allocated_address(::std::string* address) {
-  if (address != NULL) {
+inline void AssetProperty::set_allocated_description(::std::string* description) {
+  if (description != NULL) {
     
   } else {
     
   }
-  address_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), address);
-  // @@protoc_insertion_point(field_set_allocated:protocol.Account.address)
+  description_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), description);
+  // @@protoc_insertion_point(field_set_allocated:protocol.AssetProperty.description)
 }
 
-// optional int64 nonce = 2;
-inline void Account::clear_nonce() {
-  nonce_ = GOOGLE_LONGLONG(0);
+// optional int64 max_supply = 3;
+inline void AssetProperty::clear_max_supply() {
+  max_supply_ = GOOGLE_LONGLONG(0);
 }
-inline ::google::protobuf::int64 Account::nonce() const {
-  // @@protoc_insertion_point(field_get:protocol.Account.nonce)
-  return nonce_;
+inline ::google::protobuf::int64 AssetProperty::max_supply() const {
+  // @@protoc_insertion_point(field_get:protocol.AssetProperty.max_supply)
+  return max_supply_;
 }
-inline void Account::set_nonce(::google::protobuf::int64 value) {
+inline void AssetProperty::set_max_supply(::google::protobuf::int64 value) {
   
-  nonce_ = value;
-  // @@protoc_insertion_point(field_set:protocol.Account.nonce)
+  max_supply_ = value;
+  // @@protoc_insertion_point(field_set:protocol.AssetProperty.max_supply)
 }
 
-// optional .protocol.AccountPrivilege priv = 3;
-inline bool Account::has_priv() const {
-  return !_is_default_instance_ && priv_ != NULL;
+// optional int64 issued_amount = 4;
+inline void AssetProperty::clear_issued_amount() {
+  issued_amount_ = GOOGLE_LONGLONG(0);
 }
-inline void Account::clear_priv() {
-  if (GetArenaNoVirtual() == NULL && priv_ != NULL) delete priv_;
-  priv_ = NULL;
+inline ::google::protobuf::int64 AssetProperty::issued_amount() const {
+  // @@protoc_insertion_point(field_get:protocol.AssetProperty.issued_amount)
+  return issued_amount_;
 }
-inline const ::protocol::AccountPrivilege& Account::priv() const {
-  // @@protoc_insertion_point(field_get:protocol.Account.priv)
-  return priv_ != NULL ? *priv_ : *default_instance_->priv_;
+inline void AssetProperty::set_issued_amount(::google::protobuf::int64 value) {
+  
+  issued_amount_ = value;
+  // @@protoc_insertion_point(field_set:protocol.AssetProperty.issued_amount)
 }
-inline ::protocol::AccountPrivilege* Account::mutable_priv() {
+
+// optional int32 fee_percent = 5;
+inline void AssetProperty::clear_fee_percent() {
+  fee_percent_ = 0;
+}
+inline ::google::protobuf::int32 AssetProperty::fee_percent() const {
+  // @@protoc_insertion_point(field_get:protocol.AssetProperty.fee_percent)
+  return fee_percent_;
+}
+inline void AssetProperty::set_fee_percent(::google::protobuf::int32 value) {
   
-  if (priv_ == NULL) {
-    priv_ = new ::protocol::AccountPrivilege;
+  fee_percent_ = value;
+  // @@protoc_insertion_point(field_set:protocol.AssetProperty.fee_percent)
+}
+
+// -------------------------------------------------------------------
+
+// AssetStore
+
+// optional .protocol.AssetKey key = 1;
+inline bool AssetStore::has_key() const {
+  return !_is_default_instance_ && key_ != NULL;
+}
+inline void AssetStore::clear_key() {
+  if (GetArenaNoVirtual() == NULL && key_ != NULL) delete key_;
+  key_ = NULL;
+}
+inline const ::protocol::AssetKey& AssetStore::key() const {
+  // @@protoc_insertion_point(field_get:protocol.AssetStore.key)
+  return key_ != NULL ? *key_ : *default_instance_->key_;
+}
+inline ::protocol::AssetKey* AssetStore::mutable_key() {
+  
+  if (key_ == NULL) {
+    key_ = new ::protocol::AssetKey;
   }
-  // @@protoc_insertion_point(field_mutable:protocol.Account.priv)
-  return priv_;
+  // @@protoc_insertion_point(field_mutable:protocol.AssetStore.key)
+  return key_;
 }
-inline ::protocol::AccountPrivilege* Account::release_priv() {
-  // @@protoc_insertion_point(field_release:protocol.Account.priv)
+inline ::protocol::AssetKey* AssetStore::release_key() {
+  // @@protoc_insertion_point(field_release:protocol.AssetStore.key)
   
-  ::protocol::AccountPrivilege* temp = priv_;
-  priv_ = NULL;
+  ::protocol::AssetKey* temp = key_;
+  key_ = NULL;
   return temp;
 }
-inline void Account::set_allocated_priv(::protocol::AccountPrivilege* priv) {
-  delete priv_;
-  priv_ = priv;
-  if (priv) {
+inline void AssetStore::set_allocated_key(::protocol::AssetKey* key) {
+  delete key_;
+  key_ = key;
+  if (key) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.Account.priv)
+  // @@protoc_insertion_point(field_set_allocated:protocol.AssetStore.key)
 }
 
-// optional bytes metadatas_hash = 4;
-inline void Account::clear_metadatas_hash() {
-  metadatas_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// optional int64 amount = 2;
+inline void AssetStore::clear_amount() {
+  amount_ = GOOGLE_LONGLONG(0);
 }
-inline const ::std::string& Account::metadatas_hash() const {
-  // @@protoc_insertion_point(field_get:protocol.Account.metadatas_hash)
-  return metadatas_hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::google::protobuf::int64 AssetStore::amount() const {
+  // @@protoc_insertion_point(field_get:protocol.AssetStore.amount)
+  return amount_;
 }
-inline void Account::set_metadatas_hash(const ::std::string& value) {
+inline void AssetStore::set_amount(::google::protobuf::int64 value) {
   
-  metadatas_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.Account.metadatas_hash)
+  amount_ = value;
+  // @@protoc_insertion_point(field_set:protocol.AssetStore.amount)
 }
-inline void Account::set_metadatas_hash(const char* value) {
-  
-  metadatas_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.Account.metadatas_hash)
+
+// optional .protocol.AssetProperty property = 3;
+inline bool AssetStore::has_property() const {
+  return !_is_default_instance_ && property_ != NULL;
+}
+inline void AssetStore::clear_property() {
+  if (GetArenaNoVirtual() == NULL && property_ != NULL) delete property_;
+  property_ = NULL;
 }
-inline void Account::set_metadatas_hash(const void* value, size_t size) {
-  
-  metadatas_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.Account.metadatas_hash)
+inline const ::protocol::AssetProperty& AssetStore::property() const {
+  // @@protoc_insertion_point(field_get:protocol.AssetStore.property)
+  return property_ != NULL ? *property_ : *default_instance_->property_;
 }
-inline ::std::string* Account::mutable_metadatas_hash() {
+inline ::protocol::AssetProperty* AssetStore::mutable_property() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.Account.metadatas_hash)
-  return metadatas_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (property_ == NULL) {
+    property_ = new ::protocol::AssetProperty;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.AssetStore.property)
+  return property_;
 }
-inline ::std::string* Account::release_metadatas_hash() {
-  // @@protoc_insertion_point(field_release:protocol.Account.metadatas_hash)
+inline ::protocol::AssetProperty* AssetStore::release_property() {
+  // @@protoc_insertion_point(field_release:protocol.AssetStore.property)
   
-  return metadatas_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::protocol::AssetProperty* temp = property_;
+  property_ = NULL;
+  return temp;
 }
-inline void Account::set_allocated_metadatas_hash(::std::string* metadatas_hash) {
-  if (metadatas_hash != NULL) {
+inline void AssetStore::set_allocated_property(::protocol::AssetProperty* property) {
+  delete property_;
+  property_ = property;
+  if (property) {
     
   } else {
     
   }
-  metadatas_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), metadatas_hash);
-  // @@protoc_insertion_point(field_set_allocated:protocol.Account.metadatas_hash)
+  // @@protoc_insertion_point(field_set_allocated:protocol.AssetStore.property)
 }
 
-// optional bytes assets_hash = 5;
-inline void Account::clear_assets_hash() {
-  assets_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// -------------------------------------------------------------------
+
+// LedgerHeader
+
+// optional int64 seq = 1;
+inline void LedgerHeader::clear_seq() {
+  seq_ = GOOGLE_LONGLONG(0);
 }
-inline const ::std::string& Account::assets_hash() const {
-  // @@protoc_insertion_point(field_get:protocol.Account.assets_hash)
-  return assets_hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::google::protobuf::int64 LedgerHeader::seq() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.seq)
+  return seq_;
 }
-inline void Account::set_assets_hash(const ::std::string& value) {
+inline void LedgerHeader::set_seq(::google::protobuf::int64 value) {
   
-  assets_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.Account.assets_hash)
+  seq_ = value;
+  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.seq)
 }
-inline void Account::set_assets_hash(const char* value) {
-  
-  assets_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.Account.assets_hash)
+
+// optional bytes hash = 2;
+inline void LedgerHeader::clear_hash() {
+  hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Account::set_assets_hash(const void* value, size_t size) {
-  
-  assets_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.Account.assets_hash)
+inline const ::std::string& LedgerHeader::hash() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.hash)
+  return hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* Account::mutable_assets_hash() {
+inline void LedgerHeader::set_hash(const ::std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:protocol.Account.assets_hash)
-  return assets_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.hash)
 }
-inline ::std::string* Account::release_assets_hash() {
-  // @@protoc_insertion_point(field_release:protocol.Account.assets_hash)
+inline void LedgerHeader::set_hash(const char* value) {
   
-  return assets_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void Account::set_allocated_assets_hash(::std::string* assets_hash) {
-  if (assets_hash != NULL) {
-    
-  } else {
-    
-  }
-  assets_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), assets_hash);
-  // @@protoc_insertion_point(field_set_allocated:protocol.Account.assets_hash)
-}
-
-// optional .protocol.Contract contract = 6;
-inline bool Account::has_contract() const {
-  return !_is_default_instance_ && contract_ != NULL;
-}
-inline void Account::clear_contract() {
-  if (GetArenaNoVirtual() == NULL && contract_ != NULL) delete contract_;
-  contract_ = NULL;
+  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.LedgerHeader.hash)
 }
-inline const ::protocol::Contract& Account::contract() const {
-  // @@protoc_insertion_point(field_get:protocol.Account.contract)
-  return contract_ != NULL ? *contract_ : *default_instance_->contract_;
+inline void LedgerHeader::set_hash(const void* value, size_t size) {
+  
+  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.LedgerHeader.hash)
 }
-inline ::protocol::Contract* Account::mutable_contract() {
+inline ::std::string* LedgerHeader::mutable_hash() {
   
-  if (contract_ == NULL) {
-    contract_ = new ::protocol::Contract;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.Account.contract)
-  return contract_;
+  // @@protoc_insertion_point(field_mutable:protocol.LedgerHeader.hash)
+  return hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::protocol::Contract* Account::release_contract() {
-  // @@protoc_insertion_point(field_release:protocol.Account.contract)
+inline ::std::string* LedgerHeader::release_hash() {
+  // @@protoc_insertion_point(field_release:protocol.LedgerHeader.hash)
   
-  ::protocol::Contract* temp = contract_;
-  contract_ = NULL;
-  return temp;
+  return hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Account::set_allocated_contract(::protocol::Contract* contract) {
-  delete contract_;
-  contract_ = contract;
-  if (contract) {
+inline void LedgerHeader::set_allocated_hash(::std::string* hash) {
+  if (hash != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.Account.contract)
-}
-
-// optional int64 balance = 7;
-inline void Account::clear_balance() {
-  balance_ = GOOGLE_LONGLONG(0);
-}
-inline ::google::protobuf::int64 Account::balance() const {
-  // @@protoc_insertion_point(field_get:protocol.Account.balance)
-  return balance_;
-}
-inline void Account::set_balance(::google::protobuf::int64 value) {
-  
-  balance_ = value;
-  // @@protoc_insertion_point(field_set:protocol.Account.balance)
+  hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hash);
+  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerHeader.hash)
 }
 
-// -------------------------------------------------------------------
-
-// AssetKey
-
-// optional string issuer = 1;
-inline void AssetKey::clear_issuer() {
-  issuer_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// optional bytes previous_hash = 3;
+inline void LedgerHeader::clear_previous_hash() {
+  previous_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& AssetKey::issuer() const {
-  // @@protoc_insertion_point(field_get:protocol.AssetKey.issuer)
-  return issuer_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::std::string& LedgerHeader::previous_hash() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.previous_hash)
+  return previous_hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void AssetKey::set_issuer(const ::std::string& value) {
+inline void LedgerHeader::set_previous_hash(const ::std::string& value) {
   
-  issuer_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.AssetKey.issuer)
+  previous_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.previous_hash)
 }
-inline void AssetKey::set_issuer(const char* value) {
+inline void LedgerHeader::set_previous_hash(const char* value) {
   
-  issuer_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.AssetKey.issuer)
+  previous_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.LedgerHeader.previous_hash)
 }
-inline void AssetKey::set_issuer(const char* value, size_t size) {
+inline void LedgerHeader::set_previous_hash(const void* value, size_t size) {
   
-  issuer_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  previous_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.AssetKey.issuer)
+  // @@protoc_insertion_point(field_set_pointer:protocol.LedgerHeader.previous_hash)
 }
-inline ::std::string* AssetKey::mutable_issuer() {
+inline ::std::string* LedgerHeader::mutable_previous_hash() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.AssetKey.issuer)
-  return issuer_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:protocol.LedgerHeader.previous_hash)
+  return previous_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* AssetKey::release_issuer() {
-  // @@protoc_insertion_point(field_release:protocol.AssetKey.issuer)
+inline ::std::string* LedgerHeader::release_previous_hash() {
+  // @@protoc_insertion_point(field_release:protocol.LedgerHeader.previous_hash)
   
-  return issuer_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return previous_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void AssetKey::set_allocated_issuer(::std::string* issuer) {
-  if (issuer != NULL) {
+inline void LedgerHeader::set_allocated_previous_hash(::std::string* previous_hash) {
+  if (previous_hash != NULL) {
     
   } else {
     
   }
-  issuer_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), issuer);
-  // @@protoc_insertion_point(field_set_allocated:protocol.AssetKey.issuer)
+  previous_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), previous_hash);
+  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerHeader.previous_hash)
 }
 
-// optional string code = 2;
-inline void AssetKey::clear_code() {
-  code_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// optional bytes account_tree_hash = 4;
+inline void LedgerHeader::clear_account_tree_hash() {
+  account_tree_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& AssetKey::code() const {
-  // @@protoc_insertion_point(field_get:protocol.AssetKey.code)
-  return code_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::std::string& LedgerHeader::account_tree_hash() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.account_tree_hash)
+  return account_tree_hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void AssetKey::set_code(const ::std::string& value) {
+inline void LedgerHeader::set_account_tree_hash(const ::std::string& value) {
   
-  code_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.AssetKey.code)
+  account_tree_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.account_tree_hash)
 }
-inline void AssetKey::set_code(const char* value) {
+inline void LedgerHeader::set_account_tree_hash(const char* value) {
   
-  code_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.AssetKey.code)
+  account_tree_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.LedgerHeader.account_tree_hash)
 }
-inline void AssetKey::set_code(const char* value, size_t size) {
+inline void LedgerHeader::set_account_tree_hash(const void* value, size_t size) {
   
-  code_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  account_tree_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.AssetKey.code)
+  // @@protoc_insertion_point(field_set_pointer:protocol.LedgerHeader.account_tree_hash)
 }
-inline ::std::string* AssetKey::mutable_code() {
+inline ::std::string* LedgerHeader::mutable_account_tree_hash() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.AssetKey.code)
-  return code_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:protocol.LedgerHeader.account_tree_hash)
+  return account_tree_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* AssetKey::release_code() {
-  // @@protoc_insertion_point(field_release:protocol.AssetKey.code)
+inline ::std::string* LedgerHeader::release_account_tree_hash() {
+  // @@protoc_insertion_point(field_release:protocol.LedgerHeader.account_tree_hash)
   
-  return code_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return account_tree_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void AssetKey::set_allocated_code(::std::string* code) {
-  if (code != NULL) {
+inline void LedgerHeader::set_allocated_account_tree_hash(::std::string* account_tree_hash) {
+  if (account_tree_hash != NULL) {
     
   } else {
     
   }
-  code_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), code);
-  // @@protoc_insertion_point(field_set_allocated:protocol.AssetKey.code)
+  account_tree_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), account_tree_hash);
+  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerHeader.account_tree_hash)
 }
 
-// optional int32 type = 3;
-inline void AssetKey::clear_type() {
-  type_ = 0;
+// optional int64 close_time = 5;
+inline void LedgerHeader::clear_close_time() {
+  close_time_ = GOOGLE_LONGLONG(0);
 }
-inline ::google::protobuf::int32 AssetKey::type() const {
-  // @@protoc_insertion_point(field_get:protocol.AssetKey.type)
-  return type_;
+inline ::google::protobuf::int64 LedgerHeader::close_time() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.close_time)
+  return close_time_;
 }
-inline void AssetKey::set_type(::google::protobuf::int32 value) {
+inline void LedgerHeader::set_close_time(::google::protobuf::int64 value) {
   
-  type_ = value;
-  // @@protoc_insertion_point(field_set:protocol.AssetKey.type)
+  close_time_ = value;
+  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.close_time)
 }
 
-// -------------------------------------------------------------------
-
-// Asset
-
-// optional .protocol.AssetKey key = 1;
-inline bool Asset::has_key() const {
-  return !_is_default_instance_ && key_ != NULL;
+// optional bytes consensus_value_hash = 6;
+inline void LedgerHeader::clear_consensus_value_hash() {
+  consensus_value_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Asset::clear_key() {
-  if (GetArenaNoVirtual() == NULL && key_ != NULL) delete key_;
-  key_ = NULL;
+inline const ::std::string& LedgerHeader::consensus_value_hash() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.consensus_value_hash)
+  return consensus_value_hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::protocol::AssetKey& Asset::key() const {
-  // @@protoc_insertion_point(field_get:protocol.Asset.key)
-  return key_ != NULL ? *key_ : *default_instance_->key_;
+inline void LedgerHeader::set_consensus_value_hash(const ::std::string& value) {
+  
+  consensus_value_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.consensus_value_hash)
 }
-inline ::protocol::AssetKey* Asset::mutable_key() {
+inline void LedgerHeader::set_consensus_value_hash(const char* value) {
   
-  if (key_ == NULL) {
-    key_ = new ::protocol::AssetKey;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.Asset.key)
-  return key_;
+  consensus_value_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.LedgerHeader.consensus_value_hash)
 }
-inline ::protocol::AssetKey* Asset::release_key() {
-  // @@protoc_insertion_point(field_release:protocol.Asset.key)
+inline void LedgerHeader::set_consensus_value_hash(const void* value, size_t size) {
   
-  ::protocol::AssetKey* temp = key_;
-  key_ = NULL;
-  return temp;
+  consensus_value_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.LedgerHeader.consensus_value_hash)
 }
-inline void Asset::set_allocated_key(::protocol::AssetKey* key) {
-  delete key_;
-  key_ = key;
-  if (key) {
+inline ::std::string* LedgerHeader::mutable_consensus_value_hash() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.LedgerHeader.consensus_value_hash)
+  return consensus_value_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* LedgerHeader::release_consensus_value_hash() {
+  // @@protoc_insertion_point(field_release:protocol.LedgerHeader.consensus_value_hash)
+  
+  return consensus_value_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void LedgerHeader::set_allocated_consensus_value_hash(::std::string* consensus_value_hash) {
+  if (consensus_value_hash != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.Asset.key)
+  consensus_value_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), consensus_value_hash);
+  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerHeader.consensus_value_hash)
 }
 
-// optional int64 amount = 2;
-inline void Asset::clear_amount() {
-  amount_ = GOOGLE_LONGLONG(0);
+// optional int64 version = 7;
+inline void LedgerHeader::clear_version() {
+  version_ = GOOGLE_LONGLONG(0);
 }
-inline ::google::protobuf::int64 Asset::amount() const {
-  // @@protoc_insertion_point(field_get:protocol.Asset.amount)
-  return amount_;
+inline ::google::protobuf::int64 LedgerHeader::version() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.version)
+  return version_;
 }
-inline void Asset::set_amount(::google::protobuf::int64 value) {
+inline void LedgerHeader::set_version(::google::protobuf::int64 value) {
   
-  amount_ = value;
-  // @@protoc_insertion_point(field_set:protocol.Asset.amount)
+  version_ = value;
+  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.version)
 }
 
-// -------------------------------------------------------------------
-
-// AssetProperty
-
-// optional int32 decimal = 1;
-inline void AssetProperty::clear_decimal() {
-  decimal_ = 0;
+// optional int64 tx_count = 8;
+inline void LedgerHeader::clear_tx_count() {
+  tx_count_ = GOOGLE_LONGLONG(0);
 }
-inline ::google::protobuf::int32 AssetProperty::decimal() const {
-  // @@protoc_insertion_point(field_get:protocol.AssetProperty.decimal)
-  return decimal_;
+inline ::google::protobuf::int64 LedgerHeader::tx_count() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.tx_count)
+  return tx_count_;
 }
-inline void AssetProperty::set_decimal(::google::protobuf::int32 value) {
+inline void LedgerHeader::set_tx_count(::google::protobuf::int64 value) {
   
-  decimal_ = value;
-  // @@protoc_insertion_point(field_set:protocol.AssetProperty.decimal)
+  tx_count_ = value;
+  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.tx_count)
 }
 
-// optional string description = 2;
-inline void AssetProperty::clear_description() {
-  description_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// optional bytes validators_hash = 9;
+inline void LedgerHeader::clear_validators_hash() {
+  validators_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& AssetProperty::description() const {
-  // @@protoc_insertion_point(field_get:protocol.AssetProperty.description)
-  return description_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::std::string& LedgerHeader::validators_hash() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.validators_hash)
+  return validators_hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void AssetProperty::set_description(const ::std::string& value) {
+inline void LedgerHeader::set_validators_hash(const ::std::string& value) {
   
-  description_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.AssetProperty.description)
+  validators_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.validators_hash)
 }
-inline void AssetProperty::set_description(const char* value) {
+inline void LedgerHeader::set_validators_hash(const char* value) {
   
-  description_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.AssetProperty.description)
+  validators_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.LedgerHeader.validators_hash)
 }
-inline void AssetProperty::set_description(const char* value, size_t size) {
+inline void LedgerHeader::set_validators_hash(const void* value, size_t size) {
   
-  description_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  validators_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.AssetProperty.description)
+  // @@protoc_insertion_point(field_set_pointer:protocol.LedgerHeader.validators_hash)
 }
-inline ::std::string* AssetProperty::mutable_description() {
+inline ::std::string* LedgerHeader::mutable_validators_hash() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.AssetProperty.description)
-  return description_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:protocol.LedgerHeader.validators_hash)
+  return validators_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* AssetProperty::release_description() {
-  // @@protoc_insertion_point(field_release:protocol.AssetProperty.description)
+inline ::std::string* LedgerHeader::release_validators_hash() {
+  // @@protoc_insertion_point(field_release:protocol.LedgerHeader.validators_hash)
   
-  return description_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return validators_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void AssetProperty::set_allocated_description(::std::string* description) {
-  if (description != NULL) {
+inline void LedgerHeader::set_allocated_validators_hash(::std::string* validators_hash) {
+  if (validators_hash != NULL) {
     
   } else {
     
   }
-  description_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), description);
-  // @@protoc_insertion_point(field_set_allocated:protocol.AssetProperty.description)
+  validators_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), validators_hash);
+  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerHeader.validators_hash)
 }
 
-// optional int64 max_supply = 3;
-inline void AssetProperty::clear_max_supply() {
-  max_supply_ = GOOGLE_LONGLONG(0);
+// optional bytes fees_hash = 10;
+inline void LedgerHeader::clear_fees_hash() {
+  fees_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::google::protobuf::int64 AssetProperty::max_supply() const {
-  // @@protoc_insertion_point(field_get:protocol.AssetProperty.max_supply)
-  return max_supply_;
+inline const ::std::string& LedgerHeader::fees_hash() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.fees_hash)
+  return fees_hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void AssetProperty::set_max_supply(::google::protobuf::int64 value) {
+inline void LedgerHeader::set_fees_hash(const ::std::string& value) {
   
-  max_supply_ = value;
-  // @@protoc_insertion_point(field_set:protocol.AssetProperty.max_supply)
-}
-
-// optional int64 issued_amount = 4;
-inline void AssetProperty::clear_issued_amount() {
-  issued_amount_ = GOOGLE_LONGLONG(0);
-}
-inline ::google::protobuf::int64 AssetProperty::issued_amount() const {
-  // @@protoc_insertion_point(field_get:protocol.AssetProperty.issued_amount)
-  return issued_amount_;
+  fees_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.fees_hash)
 }
-inline void AssetProperty::set_issued_amount(::google::protobuf::int64 value) {
+inline void LedgerHeader::set_fees_hash(const char* value) {
   
-  issued_amount_ = value;
-  // @@protoc_insertion_point(field_set:protocol.AssetProperty.issued_amount)
-}
-
-// optional int32 fee_percent = 5;
-inline void AssetProperty::clear_fee_percent() {
-  fee_percent_ = 0;
-}
-inline ::google::protobuf::int32 AssetProperty::fee_percent() const {
-  // @@protoc_insertion_point(field_get:protocol.AssetProperty.fee_percent)
-  return fee_percent_;
+  fees_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.LedgerHeader.fees_hash)
 }
-inline void AssetProperty::set_fee_percent(::google::protobuf::int32 value) {
+inline void LedgerHeader::set_fees_hash(const void* value, size_t size) {
   
-  fee_percent_ = value;
-  // @@protoc_insertion_point(field_set:protocol.AssetProperty.fee_percent)
-}
-
-// -------------------------------------------------------------------
-
-// AssetStore
-
-// optional .protocol.AssetKey key = 1;
-inline bool AssetStore::has_key() const {
-  return !_is_default_instance_ && key_ != NULL;
-}
-inline void AssetStore::clear_key() {
-  if (GetArenaNoVirtual() == NULL && key_ != NULL) delete key_;
-  key_ = NULL;
-}
-inline const ::protocol::AssetKey& AssetStore::key() const {
-  // @@protoc_insertion_point(field_get:protocol.AssetStore.key)
-  return key_ != NULL ? *key_ : *default_instance_->key_;
+  fees_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.LedgerHeader.fees_hash)
 }
-inline ::protocol::AssetKey* AssetStore::mutable_key() {
+inline ::std::string* LedgerHeader::mutable_fees_hash() {
   
-  if (key_ == NULL) {
-    key_ = new ::protocol::AssetKey;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.AssetStore.key)
-  return key_;
+  // @@protoc_insertion_point(field_mutable:protocol.LedgerHeader.fees_hash)
+  return fees_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::protocol::AssetKey* AssetStore::release_key() {
-  // @@protoc_insertion_point(field_release:protocol.AssetStore.key)
+inline ::std::string* LedgerHeader::release_fees_hash() {
+  // @@protoc_insertion_point(field_release:protocol.LedgerHeader.fees_hash)
   
-  ::protocol::AssetKey* temp = key_;
-  key_ = NULL;
-  return temp;
+  return fees_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void AssetStore::set_allocated_key(::protocol::AssetKey* key) {
-  delete key_;
-  key_ = key;
-  if (key) {
+inline void LedgerHeader::set_allocated_fees_hash(::std::string* fees_hash) {
+  if (fees_hash != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.AssetStore.key)
+  fees_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), fees_hash);
+  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerHeader.fees_hash)
 }
 
-// optional int64 amount = 2;
-inline void AssetStore::clear_amount() {
-  amount_ = GOOGLE_LONGLONG(0);
+// optional string reserve = 11;
+inline void LedgerHeader::clear_reserve() {
+  reserve_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::google::protobuf::int64 AssetStore::amount() const {
-  // @@protoc_insertion_point(field_get:protocol.AssetStore.amount)
-  return amount_;
+inline const ::std::string& LedgerHeader::reserve() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.reserve)
+  return reserve_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void AssetStore::set_amount(::google::protobuf::int64 value) {
+inline void LedgerHeader::set_reserve(const ::std::string& value) {
   
-  amount_ = value;
-  // @@protoc_insertion_point(field_set:protocol.AssetStore.amount)
-}
-
-// optional .protocol.AssetProperty property = 3;
-inline bool AssetStore::has_property() const {
-  return !_is_default_instance_ && property_ != NULL;
+  reserve_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.reserve)
 }
-inline void AssetStore::clear_property() {
-  if (GetArenaNoVirtual() == NULL && property_ != NULL) delete property_;
-  property_ = NULL;
+inline void LedgerHeader::set_reserve(const char* value) {
+  
+  reserve_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.LedgerHeader.reserve)
 }
-inline const ::protocol::AssetProperty& AssetStore::property() const {
-  // @@protoc_insertion_point(field_get:protocol.AssetStore.property)
-  return property_ != NULL ? *property_ : *default_instance_->property_;
+inline void LedgerHeader::set_reserve(const char* value, size_t size) {
+  
+  reserve_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.LedgerHeader.reserve)
 }
-inline ::protocol::AssetProperty* AssetStore::mutable_property() {
+inline ::std::string* LedgerHeader::mutable_reserve() {
   
-  if (property_ == NULL) {
-    property_ = new ::protocol::AssetProperty;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.AssetStore.property)
-  return property_;
+  // @@protoc_insertion_point(field_mutable:protocol.LedgerHeader.reserve)
+  return reserve_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::protocol::AssetProperty* AssetStore::release_property() {
-  // @@protoc_insertion_point(field_release:protocol.AssetStore.property)
+inline ::std::string* LedgerHeader::release_reserve() {
+  // @@protoc_insertion_point(field_release:protocol.LedgerHeader.reserve)
   
-  ::protocol::AssetProperty* temp = property_;
-  property_ = NULL;
-  return temp;
+  return reserve_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void AssetStore::set_allocated_property(::protocol::AssetProperty* property) {
-  delete property_;
-  property_ = property;
-  if (property) {
+inline void LedgerHeader::set_allocated_reserve(::std::string* reserve) {
+  if (reserve != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.AssetStore.property)
+  reserve_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), reserve);
+  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerHeader.reserve)
 }
 
-// -------------------------------------------------------------------
-
-// LedgerHeader
-
-// optional int64 seq = 1;
-inline void LedgerHeader::clear_seq() {
-  seq_ = GOOGLE_LONGLONG(0);
+// optional int64 chain_id = 12;
+inline void LedgerHeader::clear_chain_id() {
+  chain_id_ = GOOGLE_LONGLONG(0);
 }
-inline ::google::protobuf::int64 LedgerHeader::seq() const {
-  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.seq)
-  return seq_;
+inline ::google::protobuf::int64 LedgerHeader::chain_id() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.chain_id)
+  return chain_id_;
 }
-inline void LedgerHeader::set_seq(::google::protobuf::int64 value) {
+inline void LedgerHeader::set_chain_id(::google::protobuf::int64 value) {
   
-  seq_ = value;
-  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.seq)
+  chain_id_ = value;
+  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.chain_id)
 }
 
-// optional bytes hash = 2;
-inline void LedgerHeader::clear_hash() {
-  hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& LedgerHeader::hash() const {
-  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.hash)
-  return hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void LedgerHeader::set_hash(const ::std::string& value) {
-  
-  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.hash)
+// -------------------------------------------------------------------
+
+// Ledger
+
+// optional .protocol.LedgerHeader header = 1;
+inline bool Ledger::has_header() const {
+  return !_is_default_instance_ && header_ != NULL;
 }
-inline void LedgerHeader::set_hash(const char* value) {
-  
-  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.LedgerHeader.hash)
+inline void Ledger::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
 }
-inline void LedgerHeader::set_hash(const void* value, size_t size) {
-  
-  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.LedgerHeader.hash)
+inline const ::protocol::LedgerHeader& Ledger::header() const {
+  // @@protoc_insertion_point(field_get:protocol.Ledger.header)
+  return header_ != NULL ? *header_ : *default_instance_->header_;
 }
-inline ::std::string* LedgerHeader::mutable_hash() {
+inline ::protocol::LedgerHeader* Ledger::mutable_header() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.LedgerHeader.hash)
-  return hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (header_ == NULL) {
+    header_ = new ::protocol::LedgerHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.Ledger.header)
+  return header_;
 }
-inline ::std::string* LedgerHeader::release_hash() {
-  // @@protoc_insertion_point(field_release:protocol.LedgerHeader.hash)
+inline ::protocol::LedgerHeader* Ledger::release_header() {
+  // @@protoc_insertion_point(field_release:protocol.Ledger.header)
   
-  return hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::protocol::LedgerHeader* temp = header_;
+  header_ = NULL;
+  return temp;
 }
-inline void LedgerHeader::set_allocated_hash(::std::string* hash) {
-  if (hash != NULL) {
+inline void Ledger::set_allocated_header(::protocol::LedgerHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
     
   } else {
     
   }
-  hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hash);
-  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerHeader.hash)
+  // @@protoc_insertion_point(field_set_allocated:protocol.Ledger.header)
 }
 
-// optional bytes previous_hash = 3;
-inline void LedgerHeader::clear_previous_hash() {
-  previous_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// repeated .protocol.TransactionEnv transaction_envs = 2;
+inline int Ledger::transaction_envs_size() const {
+  return transaction_envs_.size();
 }
-inline const ::std::string& LedgerHeader::previous_hash() const {
-  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.previous_hash)
-  return previous_hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Ledger::clear_transaction_envs() {
+  transaction_envs_.Clear();
 }
-inline void LedgerHeader::set_previous_hash(const ::std::string& value) {
+inline const ::protocol::TransactionEnv& Ledger::transaction_envs(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.Ledger.transaction_envs)
+  return transaction_envs_.Get(index);
+}
+inline ::protocol::TransactionEnv* Ledger::mutable_transaction_envs(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.Ledger.transaction_envs)
+  return transaction_envs_.Mutable(index);
+}
+inline ::protocol::TransactionEnv* Ledger::add_transaction_envs() {
+  // @@protoc_insertion_point(field_add:protocol.Ledger.transaction_envs)
+  return transaction_envs_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnv >*
+Ledger::mutable_transaction_envs() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.Ledger.transaction_envs)
+  return &transaction_envs_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnv >&
+Ledger::transaction_envs() const {
+  // @@protoc_insertion_point(field_list:protocol.Ledger.transaction_envs)
+  return transaction_envs_;
+}
+
+// -------------------------------------------------------------------
+
+// OperationPayAsset
+
+// optional string dest_address = 1;
+inline void OperationPayAsset::clear_dest_address() {
+  dest_address_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& OperationPayAsset::dest_address() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationPayAsset.dest_address)
+  return dest_address_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void OperationPayAsset::set_dest_address(const ::std::string& value) {
   
-  previous_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.previous_hash)
+  dest_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.OperationPayAsset.dest_address)
 }
-inline void LedgerHeader::set_previous_hash(const char* value) {
+inline void OperationPayAsset::set_dest_address(const char* value) {
   
-  previous_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.LedgerHeader.previous_hash)
+  dest_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.OperationPayAsset.dest_address)
 }
-inline void LedgerHeader::set_previous_hash(const void* value, size_t size) {
+inline void OperationPayAsset::set_dest_address(const char* value, size_t size) {
   
-  previous_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  dest_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.LedgerHeader.previous_hash)
+  // @@protoc_insertion_point(field_set_pointer:protocol.OperationPayAsset.dest_address)
 }
-inline ::std::string* LedgerHeader::mutable_previous_hash() {
+inline ::std::string* OperationPayAsset::mutable_dest_address() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.LedgerHeader.previous_hash)
-  return previous_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:protocol.OperationPayAsset.dest_address)
+  return dest_address_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* LedgerHeader::release_previous_hash() {
-  // @@protoc_insertion_point(field_release:protocol.LedgerHeader.previous_hash)
+inline ::std::string* OperationPayAsset::release_dest_address() {
+  // @@protoc_insertion_point(field_release:protocol.OperationPayAsset.dest_address)
   
-  return previous_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return dest_address_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void LedgerHeader::set_allocated_previous_hash(::std::string* previous_hash) {
-  if (previous_hash != NULL) {
+inline void OperationPayAsset::set_allocated_dest_address(::std::string* dest_address) {
+  if (dest_address != NULL) {
     
   } else {
     
   }
-  previous_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), previous_hash);
-  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerHeader.previous_hash)
+  dest_address_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), dest_address);
+  // @@protoc_insertion_point(field_set_allocated:protocol.OperationPayAsset.dest_address)
 }
 
-// optional bytes account_tree_hash = 4;
-inline void LedgerHeader::clear_account_tree_hash() {
-  account_tree_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& LedgerHeader::account_tree_hash() const {
-  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.account_tree_hash)
-  return account_tree_hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void LedgerHeader::set_account_tree_hash(const ::std::string& value) {
-  
-  account_tree_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.account_tree_hash)
+// optional .protocol.Asset asset = 2;
+inline bool OperationPayAsset::has_asset() const {
+  return !_is_default_instance_ && asset_ != NULL;
 }
-inline void LedgerHeader::set_account_tree_hash(const char* value) {
-  
-  account_tree_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.LedgerHeader.account_tree_hash)
+inline void OperationPayAsset::clear_asset() {
+  if (GetArenaNoVirtual() == NULL && asset_ != NULL) delete asset_;
+  asset_ = NULL;
 }
-inline void LedgerHeader::set_account_tree_hash(const void* value, size_t size) {
-  
-  account_tree_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.LedgerHeader.account_tree_hash)
+inline const ::protocol::Asset& OperationPayAsset::asset() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationPayAsset.asset)
+  return asset_ != NULL ? *asset_ : *default_instance_->asset_;
 }
-inline ::std::string* LedgerHeader::mutable_account_tree_hash() {
+inline ::protocol::Asset* OperationPayAsset::mutable_asset() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.LedgerHeader.account_tree_hash)
-  return account_tree_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (asset_ == NULL) {
+    asset_ = new ::protocol::Asset;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.OperationPayAsset.asset)
+  return asset_;
 }
-inline ::std::string* LedgerHeader::release_account_tree_hash() {
-  // @@protoc_insertion_point(field_release:protocol.LedgerHeader.account_tree_hash)
+inline ::protocol::Asset* OperationPayAsset::release_asset() {
+  // @@protoc_insertion_point(field_release:protocol.OperationPayAsset.asset)
   
-  return account_tree_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::protocol::Asset* temp = asset_;
+  asset_ = NULL;
+  return temp;
 }
-inline void LedgerHeader::set_allocated_account_tree_hash(::std::string* account_tree_hash) {
-  if (account_tree_hash != NULL) {
+inline void OperationPayAsset::set_allocated_asset(::protocol::Asset* asset) {
+  delete asset_;
+  asset_ = asset;
+  if (asset) {
     
   } else {
     
   }
-  account_tree_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), account_tree_hash);
-  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerHeader.account_tree_hash)
-}
-
-// optional int64 close_time = 5;
-inline void LedgerHeader::clear_close_time() {
-  close_time_ = GOOGLE_LONGLONG(0);
-}
-inline ::google::protobuf::int64 LedgerHeader::close_time() const {
-  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.close_time)
-  return close_time_;
-}
-inline void LedgerHeader::set_close_time(::google::protobuf::int64 value) {
-  
-  close_time_ = value;
-  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.close_time)
+  // @@protoc_insertion_point(field_set_allocated:protocol.OperationPayAsset.asset)
 }
 
-// optional bytes consensus_value_hash = 6;
-inline void LedgerHeader::clear_consensus_value_hash() {
-  consensus_value_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// optional string input = 3;
+inline void OperationPayAsset::clear_input() {
+  input_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& LedgerHeader::consensus_value_hash() const {
-  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.consensus_value_hash)
-  return consensus_value_hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::std::string& OperationPayAsset::input() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationPayAsset.input)
+  return input_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void LedgerHeader::set_consensus_value_hash(const ::std::string& value) {
+inline void OperationPayAsset::set_input(const ::std::string& value) {
   
-  consensus_value_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.consensus_value_hash)
+  input_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.OperationPayAsset.input)
 }
-inline void LedgerHeader::set_consensus_value_hash(const char* value) {
+inline void OperationPayAsset::set_input(const char* value) {
   
-  consensus_value_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.LedgerHeader.consensus_value_hash)
+  input_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.OperationPayAsset.input)
 }
-inline void LedgerHeader::set_consensus_value_hash(const void* value, size_t size) {
+inline void OperationPayAsset::set_input(const char* value, size_t size) {
   
-  consensus_value_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  input_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.LedgerHeader.consensus_value_hash)
+  // @@protoc_insertion_point(field_set_pointer:protocol.OperationPayAsset.input)
 }
-inline ::std::string* LedgerHeader::mutable_consensus_value_hash() {
+inline ::std::string* OperationPayAsset::mutable_input() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.LedgerHeader.consensus_value_hash)
-  return consensus_value_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:protocol.OperationPayAsset.input)
+  return input_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* LedgerHeader::release_consensus_value_hash() {
-  // @@protoc_insertion_point(field_release:protocol.LedgerHeader.consensus_value_hash)
+inline ::std::string* OperationPayAsset::release_input() {
+  // @@protoc_insertion_point(field_release:protocol.OperationPayAsset.input)
   
-  return consensus_value_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return input_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void LedgerHeader::set_allocated_consensus_value_hash(::std::string* consensus_value_hash) {
-  if (consensus_value_hash != NULL) {
+inline void OperationPayAsset::set_allocated_input(::std::string* input) {
+  if (input != NULL) {
     
   } else {
     
   }
-  consensus_value_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), consensus_value_hash);
-  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerHeader.consensus_value_hash)
+  input_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), input);
+  // @@protoc_insertion_point(field_set_allocated:protocol.OperationPayAsset.input)
 }
 
-// optional int64 version = 7;
-inline void LedgerHeader::clear_version() {
-  version_ = GOOGLE_LONGLONG(0);
+// -------------------------------------------------------------------
+
+// OperationTypeThreshold
+
+// optional .protocol.Operation.Type type = 1;
+inline void OperationTypeThreshold::clear_type() {
+  type_ = 0;
 }
-inline ::google::protobuf::int64 LedgerHeader::version() const {
-  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.version)
-  return version_;
+inline ::protocol::Operation_Type OperationTypeThreshold::type() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationTypeThreshold.type)
+  return static_cast< ::protocol::Operation_Type >(type_);
 }
-inline void LedgerHeader::set_version(::google::protobuf::int64 value) {
+inline void OperationTypeThreshold::set_type(::protocol::Operation_Type value) {
   
-  version_ = value;
-  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.version)
+  type_ = value;
+  // @@protoc_insertion_point(field_set:protocol.OperationTypeThreshold.type)
 }
 
-// optional int64 tx_count = 8;
-inline void LedgerHeader::clear_tx_count() {
-  tx_count_ = GOOGLE_LONGLONG(0);
+// optional int64 threshold = 2;
+inline void OperationTypeThreshold::clear_threshold() {
+  threshold_ = GOOGLE_LONGLONG(0);
 }
-inline ::google::protobuf::int64 LedgerHeader::tx_count() const {
-  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.tx_count)
-  return tx_count_;
+inline ::google::protobuf::int64 OperationTypeThreshold::threshold() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationTypeThreshold.threshold)
+  return threshold_;
 }
-inline void LedgerHeader::set_tx_count(::google::protobuf::int64 value) {
+inline void OperationTypeThreshold::set_threshold(::google::protobuf::int64 value) {
   
-  tx_count_ = value;
-  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.tx_count)
+  threshold_ = value;
+  // @@protoc_insertion_point(field_set:protocol.OperationTypeThreshold.threshold)
 }
 
-// optional bytes validators_hash = 9;
-inline void LedgerHeader::clear_validators_hash() {
-  validators_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// -------------------------------------------------------------------
+
+// AccountPrivilege
+
+// optional int64 master_weight = 1;
+inline void AccountPrivilege::clear_master_weight() {
+  master_weight_ = GOOGLE_LONGLONG(0);
 }
-inline const ::std::string& LedgerHeader::validators_hash() const {
-  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.validators_hash)
-  return validators_hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::google::protobuf::int64 AccountPrivilege::master_weight() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountPrivilege.master_weight)
+  return master_weight_;
 }
-inline void LedgerHeader::set_validators_hash(const ::std::string& value) {
+inline void AccountPrivilege::set_master_weight(::google::protobuf::int64 value) {
   
-  validators_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.validators_hash)
+  master_weight_ = value;
+  // @@protoc_insertion_point(field_set:protocol.AccountPrivilege.master_weight)
 }
-inline void LedgerHeader::set_validators_hash(const char* value) {
-  
-  validators_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.LedgerHeader.validators_hash)
+
+// repeated .protocol.Signer signers = 2;
+inline int AccountPrivilege::signers_size() const {
+  return signers_.size();
 }
-inline void LedgerHeader::set_validators_hash(const void* value, size_t size) {
-  
-  validators_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.LedgerHeader.validators_hash)
+inline void AccountPrivilege::clear_signers() {
+  signers_.Clear();
 }
-inline ::std::string* LedgerHeader::mutable_validators_hash() {
-  
-  // @@protoc_insertion_point(field_mutable:protocol.LedgerHeader.validators_hash)
-  return validators_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::protocol::Signer& AccountPrivilege::signers(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.AccountPrivilege.signers)
+  return signers_.Get(index);
 }
-inline ::std::string* LedgerHeader::release_validators_hash() {
-  // @@protoc_insertion_point(field_release:protocol.LedgerHeader.validators_hash)
-  
-  return validators_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::protocol::Signer* AccountPrivilege::mutable_signers(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.AccountPrivilege.signers)
+  return signers_.Mutable(index);
 }
-inline void LedgerHeader::set_allocated_validators_hash(::std::string* validators_hash) {
-  if (validators_hash != NULL) {
-    
-  } else {
-    
-  }
-  validators_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), validators_hash);
-  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerHeader.validators_hash)
+inline ::protocol::Signer* AccountPrivilege::add_signers() {
+  // @@protoc_insertion_point(field_add:protocol.AccountPrivilege.signers)
+  return signers_.Add();
 }
-
-// optional bytes fees_hash = 10;
-inline void LedgerHeader::clear_fees_hash() {
-  fees_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::google::protobuf::RepeatedPtrField< ::protocol::Signer >*
+AccountPrivilege::mutable_signers() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.AccountPrivilege.signers)
+  return &signers_;
 }
-inline const ::std::string& LedgerHeader::fees_hash() const {
-  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.fees_hash)
-  return fees_hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::google::protobuf::RepeatedPtrField< ::protocol::Signer >&
+AccountPrivilege::signers() const {
+  // @@protoc_insertion_point(field_list:protocol.AccountPrivilege.signers)
+  return signers_;
 }
-inline void LedgerHeader::set_fees_hash(const ::std::string& value) {
-  
-  fees_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.fees_hash)
+
+// optional .protocol.AccountThreshold thresholds = 3;
+inline bool AccountPrivilege::has_thresholds() const {
+  return !_is_default_instance_ && thresholds_ != NULL;
 }
-inline void LedgerHeader::set_fees_hash(const char* value) {
-  
-  fees_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.LedgerHeader.fees_hash)
+inline void AccountPrivilege::clear_thresholds() {
+  if (GetArenaNoVirtual() == NULL && thresholds_ != NULL) delete thresholds_;
+  thresholds_ = NULL;
 }
-inline void LedgerHeader::set_fees_hash(const void* value, size_t size) {
-  
-  fees_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.LedgerHeader.fees_hash)
+inline const ::protocol::AccountThreshold& AccountPrivilege::thresholds() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountPrivilege.thresholds)
+  return thresholds_ != NULL ? *thresholds_ : *default_instance_->thresholds_;
 }
-inline ::std::string* LedgerHeader::mutable_fees_hash() {
+inline ::protocol::AccountThreshold* AccountPrivilege::mutable_thresholds() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.LedgerHeader.fees_hash)
-  return fees_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (thresholds_ == NULL) {
+    thresholds_ = new ::protocol::AccountThreshold;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.AccountPrivilege.thresholds)
+  return thresholds_;
 }
-inline ::std::string* LedgerHeader::release_fees_hash() {
-  // @@protoc_insertion_point(field_release:protocol.LedgerHeader.fees_hash)
+inline ::protocol::AccountThreshold* AccountPrivilege::release_thresholds() {
+  // @@protoc_insertion_point(field_release:protocol.AccountPrivilege.thresholds)
   
-  return fees_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::protocol::AccountThreshold* temp = thresholds_;
+  thresholds_ = NULL;
+  return temp;
 }
-inline void LedgerHeader::set_allocated_fees_hash(::std::string* fees_hash) {
-  if (fees_hash != NULL) {
+inline void AccountPrivilege::set_allocated_thresholds(::protocol::AccountThreshold* thresholds) {
+  delete thresholds_;
+  thresholds_ = thresholds;
+  if (thresholds) {
     
   } else {
     
   }
-  fees_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), fees_hash);
-  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerHeader.fees_hash)
+  // @@protoc_insertion_point(field_set_allocated:protocol.AccountPrivilege.thresholds)
 }
 
-// optional string reserve = 11;
-inline void LedgerHeader::clear_reserve() {
-  reserve_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& LedgerHeader::reserve() const {
-  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.reserve)
-  return reserve_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// -------------------------------------------------------------------
+
+// AccountThreshold
+
+// optional int64 tx_threshold = 1;
+inline void AccountThreshold::clear_tx_threshold() {
+  tx_threshold_ = GOOGLE_LONGLONG(0);
 }
-inline void LedgerHeader::set_reserve(const ::std::string& value) {
-  
-  reserve_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.reserve)
+inline ::google::protobuf::int64 AccountThreshold::tx_threshold() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountThreshold.tx_threshold)
+  return tx_threshold_;
 }
-inline void LedgerHeader::set_reserve(const char* value) {
+inline void AccountThreshold::set_tx_threshold(::google::protobuf::int64 value) {
   
-  reserve_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.LedgerHeader.reserve)
+  tx_threshold_ = value;
+  // @@protoc_insertion_point(field_set:protocol.AccountThreshold.tx_threshold)
 }
-inline void LedgerHeader::set_reserve(const char* value, size_t size) {
-  
-  reserve_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.LedgerHeader.reserve)
+
+// repeated .protocol.OperationTypeThreshold type_thresholds = 2;
+inline int AccountThreshold::type_thresholds_size() const {
+  return type_thresholds_.size();
 }
-inline ::std::string* LedgerHeader::mutable_reserve() {
-  
-  // @@protoc_insertion_point(field_mutable:protocol.LedgerHeader.reserve)
-  return reserve_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void AccountThreshold::clear_type_thresholds() {
+  type_thresholds_.Clear();
 }
-inline ::std::string* LedgerHeader::release_reserve() {
-  // @@protoc_insertion_point(field_release:protocol.LedgerHeader.reserve)
-  
-  return reserve_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::protocol::OperationTypeThreshold& AccountThreshold::type_thresholds(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.AccountThreshold.type_thresholds)
+  return type_thresholds_.Get(index);
 }
-inline void LedgerHeader::set_allocated_reserve(::std::string* reserve) {
-  if (reserve != NULL) {
-    
-  } else {
-    
-  }
-  reserve_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), reserve);
-  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerHeader.reserve)
+inline ::protocol::OperationTypeThreshold* AccountThreshold::mutable_type_thresholds(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.AccountThreshold.type_thresholds)
+  return type_thresholds_.Mutable(index);
 }
-
-// optional int64 chain_id = 12;
-inline void LedgerHeader::clear_chain_id() {
-  chain_id_ = GOOGLE_LONGLONG(0);
+inline ::protocol::OperationTypeThreshold* AccountThreshold::add_type_thresholds() {
+  // @@protoc_insertion_point(field_add:protocol.AccountThreshold.type_thresholds)
+  return type_thresholds_.Add();
 }
-inline ::google::protobuf::int64 LedgerHeader::chain_id() const {
-  // @@protoc_insertion_point(field_get:protocol.LedgerHeader.chain_id)
-  return chain_id_;
+inline ::google::protobuf::RepeatedPtrField< ::protocol::OperationTypeThreshold >*
+AccountThreshold::mutable_type_thresholds() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.AccountThreshold.type_thresholds)
+  return &type_thresholds_;
 }
-inline void LedgerHeader::set_chain_id(::google::protobuf::int64 value) {
-  
-  chain_id_ = value;
-  // @@protoc_insertion_point(field_set:protocol.LedgerHeader.chain_id)
+inline const ::google::protobuf::RepeatedPtrField< ::protocol::OperationTypeThreshold >&
+AccountThreshold::type_thresholds() const {
+  // @@protoc_insertion_point(field_list:protocol.AccountThreshold.type_thresholds)
+  return type_thresholds_;
 }
 
 // -------------------------------------------------------------------
 
-// Ledger
+// OperationIssueAsset
 
-// optional .protocol.LedgerHeader header = 1;
-inline bool Ledger::has_header() const {
-  return !_is_default_instance_ && header_ != NULL;
+// optional string code = 1;
+inline void OperationIssueAsset::clear_code() {
+  code_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Ledger::clear_header() {
-  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
-  header_ = NULL;
+inline const ::std::string& OperationIssueAsset::code() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationIssueAsset.code)
+  return code_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::protocol::LedgerHeader& Ledger::header() const {
-  // @@protoc_insertion_point(field_get:protocol.Ledger.header)
-  return header_ != NULL ? *header_ : *default_instance_->header_;
+inline void OperationIssueAsset::set_code(const ::std::string& value) {
+  
+  code_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.OperationIssueAsset.code)
 }
-inline ::protocol::LedgerHeader* Ledger::mutable_header() {
+inline void OperationIssueAsset::set_code(const char* value) {
   
-  if (header_ == NULL) {
-    header_ = new ::protocol::LedgerHeader;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.Ledger.header)
-  return header_;
+  code_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.OperationIssueAsset.code)
 }
-inline ::protocol::LedgerHeader* Ledger::release_header() {
-  // @@protoc_insertion_point(field_release:protocol.Ledger.header)
+inline void OperationIssueAsset::set_code(const char* value, size_t size) {
   
-  ::protocol::LedgerHeader* temp = header_;
-  header_ = NULL;
-  return temp;
+  code_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.OperationIssueAsset.code)
 }
-inline void Ledger::set_allocated_header(::protocol::LedgerHeader* header) {
-  delete header_;
-  header_ = header;
-  if (header) {
+inline ::std::string* OperationIssueAsset::mutable_code() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.OperationIssueAsset.code)
+  return code_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* OperationIssueAsset::release_code() {
+  // @@protoc_insertion_point(field_release:protocol.OperationIssueAsset.code)
+  
+  return code_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void OperationIssueAsset::set_allocated_code(::std::string* code) {
+  if (code != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.Ledger.header)
+  code_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), code);
+  // @@protoc_insertion_point(field_set_allocated:protocol.OperationIssueAsset.code)
 }
 
-// repeated .protocol.TransactionEnv transaction_envs = 2;
-inline int Ledger::transaction_envs_size() const {
-  return transaction_envs_.size();
-}
-inline void Ledger::clear_transaction_envs() {
-  transaction_envs_.Clear();
-}
-inline const ::protocol::TransactionEnv& Ledger::transaction_envs(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.Ledger.transaction_envs)
-  return transaction_envs_.Get(index);
-}
-inline ::protocol::TransactionEnv* Ledger::mutable_transaction_envs(int index) {
-  // @@protoc_insertion_point(field_mutable:protocol.Ledger.transaction_envs)
-  return transaction_envs_.Mutable(index);
-}
-inline ::protocol::TransactionEnv* Ledger::add_transaction_envs() {
-  // @@protoc_insertion_point(field_add:protocol.Ledger.transaction_envs)
-  return transaction_envs_.Add();
+// optional int64 amount = 2;
+inline void OperationIssueAsset::clear_amount() {
+  amount_ = GOOGLE_LONGLONG(0);
 }
-inline ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnv >*
-Ledger::mutable_transaction_envs() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.Ledger.transaction_envs)
-  return &transaction_envs_;
+inline ::google::protobuf::int64 OperationIssueAsset::amount() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationIssueAsset.amount)
+  return amount_;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnv >&
-Ledger::transaction_envs() const {
-  // @@protoc_insertion_point(field_list:protocol.Ledger.transaction_envs)
-  return transaction_envs_;
+inline void OperationIssueAsset::set_amount(::google::protobuf::int64 value) {
+  
+  amount_ = value;
+  // @@protoc_insertion_point(field_set:protocol.OperationIssueAsset.amount)
 }
 
 // -------------------------------------------------------------------
 
-// OperationPayAsset
+// OperationPayCoin
 
 // optional string dest_address = 1;
-inline void OperationPayAsset::clear_dest_address() {
+inline void OperationPayCoin::clear_dest_address() {
   dest_address_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& OperationPayAsset::dest_address() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationPayAsset.dest_address)
+inline const ::std::string& OperationPayCoin::dest_address() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationPayCoin.dest_address)
   return dest_address_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void OperationPayAsset::set_dest_address(const ::std::string& value) {
+inline void OperationPayCoin::set_dest_address(const ::std::string& value) {
   
   dest_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.OperationPayAsset.dest_address)
+  // @@protoc_insertion_point(field_set:protocol.OperationPayCoin.dest_address)
 }
-inline void OperationPayAsset::set_dest_address(const char* value) {
+inline void OperationPayCoin::set_dest_address(const char* value) {
   
   dest_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.OperationPayAsset.dest_address)
+  // @@protoc_insertion_point(field_set_char:protocol.OperationPayCoin.dest_address)
 }
-inline void OperationPayAsset::set_dest_address(const char* value, size_t size) {
+inline void OperationPayCoin::set_dest_address(const char* value, size_t size) {
   
   dest_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.OperationPayAsset.dest_address)
+  // @@protoc_insertion_point(field_set_pointer:protocol.OperationPayCoin.dest_address)
 }
-inline ::std::string* OperationPayAsset::mutable_dest_address() {
+inline ::std::string* OperationPayCoin::mutable_dest_address() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.OperationPayAsset.dest_address)
+  // @@protoc_insertion_point(field_mutable:protocol.OperationPayCoin.dest_address)
   return dest_address_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* OperationPayAsset::release_dest_address() {
-  // @@protoc_insertion_point(field_release:protocol.OperationPayAsset.dest_address)
-  
-  return dest_address_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void OperationPayAsset::set_allocated_dest_address(::std::string* dest_address) {
-  if (dest_address != NULL) {
-    
-  } else {
-    
-  }
-  dest_address_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), dest_address);
-  // @@protoc_insertion_point(field_set_allocated:protocol.OperationPayAsset.dest_address)
-}
-
-// optional .protocol.Asset asset = 2;
-inline bool OperationPayAsset::has_asset() const {
-  return !_is_default_instance_ && asset_ != NULL;
-}
-inline void OperationPayAsset::clear_asset() {
-  if (GetArenaNoVirtual() == NULL && asset_ != NULL) delete asset_;
-  asset_ = NULL;
-}
-inline const ::protocol::Asset& OperationPayAsset::asset() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationPayAsset.asset)
-  return asset_ != NULL ? *asset_ : *default_instance_->asset_;
-}
-inline ::protocol::Asset* OperationPayAsset::mutable_asset() {
-  
-  if (asset_ == NULL) {
-    asset_ = new ::protocol::Asset;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.OperationPayAsset.asset)
-  return asset_;
-}
-inline ::protocol::Asset* OperationPayAsset::release_asset() {
-  // @@protoc_insertion_point(field_release:protocol.OperationPayAsset.asset)
+inline ::std::string* OperationPayCoin::release_dest_address() {
+  // @@protoc_insertion_point(field_release:protocol.OperationPayCoin.dest_address)
   
-  ::protocol::Asset* temp = asset_;
-  asset_ = NULL;
-  return temp;
-}
-inline void OperationPayAsset::set_allocated_asset(::protocol::Asset* asset) {
-  delete asset_;
-  asset_ = asset;
-  if (asset) {
+  return dest_address_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void OperationPayCoin::set_allocated_dest_address(::std::string* dest_address) {
+  if (dest_address != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.OperationPayAsset.asset)
+  dest_address_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), dest_address);
+  // @@protoc_insertion_point(field_set_allocated:protocol.OperationPayCoin.dest_address)
+}
+
+// optional int64 amount = 2;
+inline void OperationPayCoin::clear_amount() {
+  amount_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 OperationPayCoin::amount() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationPayCoin.amount)
+  return amount_;
+}
+inline void OperationPayCoin::set_amount(::google::protobuf::int64 value) {
+  
+  amount_ = value;
+  // @@protoc_insertion_point(field_set:protocol.OperationPayCoin.amount)
 }
 
 // optional string input = 3;
-inline void OperationPayAsset::clear_input() {
+inline void OperationPayCoin::clear_input() {
   input_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& OperationPayAsset::input() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationPayAsset.input)
+inline const ::std::string& OperationPayCoin::input() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationPayCoin.input)
   return input_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void OperationPayAsset::set_input(const ::std::string& value) {
+inline void OperationPayCoin::set_input(const ::std::string& value) {
   
   input_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.OperationPayAsset.input)
+  // @@protoc_insertion_point(field_set:protocol.OperationPayCoin.input)
 }
-inline void OperationPayAsset::set_input(const char* value) {
+inline void OperationPayCoin::set_input(const char* value) {
   
   input_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.OperationPayAsset.input)
+  // @@protoc_insertion_point(field_set_char:protocol.OperationPayCoin.input)
 }
-inline void OperationPayAsset::set_input(const char* value, size_t size) {
+inline void OperationPayCoin::set_input(const char* value, size_t size) {
   
   input_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.OperationPayAsset.input)
+  // @@protoc_insertion_point(field_set_pointer:protocol.OperationPayCoin.input)
 }
-inline ::std::string* OperationPayAsset::mutable_input() {
+inline ::std::string* OperationPayCoin::mutable_input() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.OperationPayAsset.input)
+  // @@protoc_insertion_point(field_mutable:protocol.OperationPayCoin.input)
   return input_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* OperationPayAsset::release_input() {
-  // @@protoc_insertion_point(field_release:protocol.OperationPayAsset.input)
+inline ::std::string* OperationPayCoin::release_input() {
+  // @@protoc_insertion_point(field_release:protocol.OperationPayCoin.input)
   
   return input_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void OperationPayAsset::set_allocated_input(::std::string* input) {
+inline void OperationPayCoin::set_allocated_input(::std::string* input) {
   if (input != NULL) {
     
   } else {
     
   }
   input_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), input);
-  // @@protoc_insertion_point(field_set_allocated:protocol.OperationPayAsset.input)
+  // @@protoc_insertion_point(field_set_allocated:protocol.OperationPayCoin.input)
 }
 
 // -------------------------------------------------------------------
 
-// OperationTypeThreshold
+// OperationSetSignerWeight
 
-// optional .protocol.Operation.Type type = 1;
-inline void OperationTypeThreshold::clear_type() {
-  type_ = 0;
+// optional int64 master_weight = 1;
+inline void OperationSetSignerWeight::clear_master_weight() {
+  master_weight_ = GOOGLE_LONGLONG(0);
 }
-inline ::protocol::Operation_Type OperationTypeThreshold::type() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationTypeThreshold.type)
-  return static_cast< ::protocol::Operation_Type >(type_);
+inline ::google::protobuf::int64 OperationSetSignerWeight::master_weight() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationSetSignerWeight.master_weight)
+  return master_weight_;
 }
-inline void OperationTypeThreshold::set_type(::protocol::Operation_Type value) {
+inline void OperationSetSignerWeight::set_master_weight(::google::protobuf::int64 value) {
   
-  type_ = value;
-  // @@protoc_insertion_point(field_set:protocol.OperationTypeThreshold.type)
+  master_weight_ = value;
+  // @@protoc_insertion_point(field_set:protocol.OperationSetSignerWeight.master_weight)
 }
 
-// optional int64 threshold = 2;
-inline void OperationTypeThreshold::clear_threshold() {
-  threshold_ = GOOGLE_LONGLONG(0);
+// repeated .protocol.Signer signers = 2;
+inline int OperationSetSignerWeight::signers_size() const {
+  return signers_.size();
 }
-inline ::google::protobuf::int64 OperationTypeThreshold::threshold() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationTypeThreshold.threshold)
-  return threshold_;
+inline void OperationSetSignerWeight::clear_signers() {
+  signers_.Clear();
 }
-inline void OperationTypeThreshold::set_threshold(::google::protobuf::int64 value) {
+inline const ::protocol::Signer& OperationSetSignerWeight::signers(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.OperationSetSignerWeight.signers)
+  return signers_.Get(index);
+}
+inline ::protocol::Signer* OperationSetSignerWeight::mutable_signers(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.OperationSetSignerWeight.signers)
+  return signers_.Mutable(index);
+}
+inline ::protocol::Signer* OperationSetSignerWeight::add_signers() {
+  // @@protoc_insertion_point(field_add:protocol.OperationSetSignerWeight.signers)
+  return signers_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::protocol::Signer >*
+OperationSetSignerWeight::mutable_signers() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.OperationSetSignerWeight.signers)
+  return &signers_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protocol::Signer >&
+OperationSetSignerWeight::signers() const {
+  // @@protoc_insertion_point(field_list:protocol.OperationSetSignerWeight.signers)
+  return signers_;
+}
+
+// -------------------------------------------------------------------
+
+// OperationLog
+
+// optional string topic = 1;
+inline void OperationLog::clear_topic() {
+  topic_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& OperationLog::topic() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationLog.topic)
+  return topic_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void OperationLog::set_topic(const ::std::string& value) {
   
-  threshold_ = value;
-  // @@protoc_insertion_point(field_set:protocol.OperationTypeThreshold.threshold)
+  topic_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.OperationLog.topic)
+}
+inline void OperationLog::set_topic(const char* value) {
+  
+  topic_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.OperationLog.topic)
+}
+inline void OperationLog::set_topic(const char* value, size_t size) {
+  
+  topic_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.OperationLog.topic)
+}
+inline ::std::string* OperationLog::mutable_topic() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.OperationLog.topic)
+  return topic_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* OperationLog::release_topic() {
+  // @@protoc_insertion_point(field_release:protocol.OperationLog.topic)
+  
+  return topic_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void OperationLog::set_allocated_topic(::std::string* topic) {
+  if (topic != NULL) {
+    
+  } else {
+    
+  }
+  topic_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), topic);
+  // @@protoc_insertion_point(field_set_allocated:protocol.OperationLog.topic)
+}
+
+// repeated string datas = 2;
+inline int OperationLog::datas_size() const {
+  return datas_.size();
+}
+inline void OperationLog::clear_datas() {
+  datas_.Clear();
+}
+inline const ::std::string& OperationLog::datas(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.OperationLog.datas)
+  return datas_.Get(index);
+}
+inline ::std::string* OperationLog::mutable_datas(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.OperationLog.datas)
+  return datas_.Mutable(index);
+}
+inline void OperationLog::set_datas(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.OperationLog.datas)
+  datas_.Mutable(index)->assign(value);
+}
+inline void OperationLog::set_datas(int index, const char* value) {
+  datas_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.OperationLog.datas)
+}
+inline void OperationLog::set_datas(int index, const char* value, size_t size) {
+  datas_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protocol.OperationLog.datas)
+}
+inline ::std::string* OperationLog::add_datas() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.OperationLog.datas)
+  return datas_.Add();
+}
+inline void OperationLog::add_datas(const ::std::string& value) {
+  datas_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.OperationLog.datas)
+}
+inline void OperationLog::add_datas(const char* value) {
+  datas_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.OperationLog.datas)
+}
+inline void OperationLog::add_datas(const char* value, size_t size) {
+  datas_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.OperationLog.datas)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+OperationLog::datas() const {
+  // @@protoc_insertion_point(field_list:protocol.OperationLog.datas)
+  return datas_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+OperationLog::mutable_datas() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.OperationLog.datas)
+  return &datas_;
 }
 
 // -------------------------------------------------------------------
 
-// AccountPrivilege
+// OperationSetPrivilege
 
-// optional int64 master_weight = 1;
-inline void AccountPrivilege::clear_master_weight() {
-  master_weight_ = GOOGLE_LONGLONG(0);
+// optional string master_weight = 1;
+inline void OperationSetPrivilege::clear_master_weight() {
+  master_weight_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::google::protobuf::int64 AccountPrivilege::master_weight() const {
-  // @@protoc_insertion_point(field_get:protocol.AccountPrivilege.master_weight)
-  return master_weight_;
+inline const ::std::string& OperationSetPrivilege::master_weight() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationSetPrivilege.master_weight)
+  return master_weight_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void AccountPrivilege::set_master_weight(::google::protobuf::int64 value) {
+inline void OperationSetPrivilege::set_master_weight(const ::std::string& value) {
   
-  master_weight_ = value;
-  // @@protoc_insertion_point(field_set:protocol.AccountPrivilege.master_weight)
+  master_weight_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.OperationSetPrivilege.master_weight)
+}
+inline void OperationSetPrivilege::set_master_weight(const char* value) {
+  
+  master_weight_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.OperationSetPrivilege.master_weight)
+}
+inline void OperationSetPrivilege::set_master_weight(const char* value, size_t size) {
+  
+  master_weight_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.OperationSetPrivilege.master_weight)
+}
+inline ::std::string* OperationSetPrivilege::mutable_master_weight() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.OperationSetPrivilege.master_weight)
+  return master_weight_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* OperationSetPrivilege::release_master_weight() {
+  // @@protoc_insertion_point(field_release:protocol.OperationSetPrivilege.master_weight)
+  
+  return master_weight_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void OperationSetPrivilege::set_allocated_master_weight(::std::string* master_weight) {
+  if (master_weight != NULL) {
+    
+  } else {
+    
+  }
+  master_weight_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), master_weight);
+  // @@protoc_insertion_point(field_set_allocated:protocol.OperationSetPrivilege.master_weight)
 }
 
 // repeated .protocol.Signer signers = 2;
-inline int AccountPrivilege::signers_size() const {
+inline int OperationSetPrivilege::signers_size() const {
   return signers_.size();
 }
-inline void AccountPrivilege::clear_signers() {
+inline void OperationSetPrivilege::clear_signers() {
   signers_.Clear();
 }
-inline const ::protocol::Signer& AccountPrivilege::signers(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.AccountPrivilege.signers)
+inline const ::protocol::Signer& OperationSetPrivilege::signers(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.OperationSetPrivilege.signers)
   return signers_.Get(index);
 }
-inline ::protocol::Signer* AccountPrivilege::mutable_signers(int index) {
-  // @@protoc_insertion_point(field_mutable:protocol.AccountPrivilege.signers)
+inline ::protocol::Signer* OperationSetPrivilege::mutable_signers(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.OperationSetPrivilege.signers)
   return signers_.Mutable(index);
 }
-inline ::protocol::Signer* AccountPrivilege::add_signers() {
-  // @@protoc_insertion_point(field_add:protocol.AccountPrivilege.signers)
+inline ::protocol::Signer* OperationSetPrivilege::add_signers() {
+  // @@protoc_insertion_point(field_add:protocol.OperationSetPrivilege.signers)
   return signers_.Add();
 }
 inline ::google::protobuf::RepeatedPtrField< ::protocol::Signer >*
-AccountPrivilege::mutable_signers() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.AccountPrivilege.signers)
+OperationSetPrivilege::mutable_signers() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.OperationSetPrivilege.signers)
   return &signers_;
 }
 inline const ::google::protobuf::RepeatedPtrField< ::protocol::Signer >&
-AccountPrivilege::signers() const {
-  // @@protoc_insertion_point(field_list:protocol.AccountPrivilege.signers)
+OperationSetPrivilege::signers() const {
+  // @@protoc_insertion_point(field_list:protocol.OperationSetPrivilege.signers)
   return signers_;
 }
 
-// optional .protocol.AccountThreshold thresholds = 3;
-inline bool AccountPrivilege::has_thresholds() const {
-  return !_is_default_instance_ && thresholds_ != NULL;
+// optional string tx_threshold = 3;
+inline void OperationSetPrivilege::clear_tx_threshold() {
+  tx_threshold_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void AccountPrivilege::clear_thresholds() {
-  if (GetArenaNoVirtual() == NULL && thresholds_ != NULL) delete thresholds_;
-  thresholds_ = NULL;
+inline const ::std::string& OperationSetPrivilege::tx_threshold() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationSetPrivilege.tx_threshold)
+  return tx_threshold_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::protocol::AccountThreshold& AccountPrivilege::thresholds() const {
-  // @@protoc_insertion_point(field_get:protocol.AccountPrivilege.thresholds)
-  return thresholds_ != NULL ? *thresholds_ : *default_instance_->thresholds_;
+inline void OperationSetPrivilege::set_tx_threshold(const ::std::string& value) {
+  
+  tx_threshold_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.OperationSetPrivilege.tx_threshold)
 }
-inline ::protocol::AccountThreshold* AccountPrivilege::mutable_thresholds() {
+inline void OperationSetPrivilege::set_tx_threshold(const char* value) {
   
-  if (thresholds_ == NULL) {
-    thresholds_ = new ::protocol::AccountThreshold;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.AccountPrivilege.thresholds)
-  return thresholds_;
+  tx_threshold_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.OperationSetPrivilege.tx_threshold)
 }
-inline ::protocol::AccountThreshold* AccountPrivilege::release_thresholds() {
-  // @@protoc_insertion_point(field_release:protocol.AccountPrivilege.thresholds)
+inline void OperationSetPrivilege::set_tx_threshold(const char* value, size_t size) {
   
-  ::protocol::AccountThreshold* temp = thresholds_;
-  thresholds_ = NULL;
-  return temp;
+  tx_threshold_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.OperationSetPrivilege.tx_threshold)
 }
-inline void AccountPrivilege::set_allocated_thresholds(::protocol::AccountThreshold* thresholds) {
-  delete thresholds_;
-  thresholds_ = thresholds;
-  if (thresholds) {
+inline ::std::string* OperationSetPrivilege::mutable_tx_threshold() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.OperationSetPrivilege.tx_threshold)
+  return tx_threshold_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* OperationSetPrivilege::release_tx_threshold() {
+  // @@protoc_insertion_point(field_release:protocol.OperationSetPrivilege.tx_threshold)
+  
+  return tx_threshold_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void OperationSetPrivilege::set_allocated_tx_threshold(::std::string* tx_threshold) {
+  if (tx_threshold != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.AccountPrivilege.thresholds)
-}
-
-// -------------------------------------------------------------------
-
-// AccountThreshold
-
-// optional int64 tx_threshold = 1;
-inline void AccountThreshold::clear_tx_threshold() {
-  tx_threshold_ = GOOGLE_LONGLONG(0);
-}
-inline ::google::protobuf::int64 AccountThreshold::tx_threshold() const {
-  // @@protoc_insertion_point(field_get:protocol.AccountThreshold.tx_threshold)
-  return tx_threshold_;
-}
-inline void AccountThreshold::set_tx_threshold(::google::protobuf::int64 value) {
-  
-  tx_threshold_ = value;
-  // @@protoc_insertion_point(field_set:protocol.AccountThreshold.tx_threshold)
+  tx_threshold_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), tx_threshold);
+  // @@protoc_insertion_point(field_set_allocated:protocol.OperationSetPrivilege.tx_threshold)
 }
 
-// repeated .protocol.OperationTypeThreshold type_thresholds = 2;
-inline int AccountThreshold::type_thresholds_size() const {
+// repeated .protocol.OperationTypeThreshold type_thresholds = 4;
+inline int OperationSetPrivilege::type_thresholds_size() const {
   return type_thresholds_.size();
 }
-inline void AccountThreshold::clear_type_thresholds() {
+inline void OperationSetPrivilege::clear_type_thresholds() {
   type_thresholds_.Clear();
 }
-inline const ::protocol::OperationTypeThreshold& AccountThreshold::type_thresholds(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.AccountThreshold.type_thresholds)
+inline const ::protocol::OperationTypeThreshold& OperationSetPrivilege::type_thresholds(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.OperationSetPrivilege.type_thresholds)
   return type_thresholds_.Get(index);
 }
-inline ::protocol::OperationTypeThreshold* AccountThreshold::mutable_type_thresholds(int index) {
-  // @@protoc_insertion_point(field_mutable:protocol.AccountThreshold.type_thresholds)
+inline ::protocol::OperationTypeThreshold* OperationSetPrivilege::mutable_type_thresholds(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.OperationSetPrivilege.type_thresholds)
   return type_thresholds_.Mutable(index);
 }
-inline ::protocol::OperationTypeThreshold* AccountThreshold::add_type_thresholds() {
-  // @@protoc_insertion_point(field_add:protocol.AccountThreshold.type_thresholds)
+inline ::protocol::OperationTypeThreshold* OperationSetPrivilege::add_type_thresholds() {
+  // @@protoc_insertion_point(field_add:protocol.OperationSetPrivilege.type_thresholds)
   return type_thresholds_.Add();
 }
 inline ::google::protobuf::RepeatedPtrField< ::protocol::OperationTypeThreshold >*
-AccountThreshold::mutable_type_thresholds() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.AccountThreshold.type_thresholds)
+OperationSetPrivilege::mutable_type_thresholds() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.OperationSetPrivilege.type_thresholds)
   return &type_thresholds_;
 }
 inline const ::google::protobuf::RepeatedPtrField< ::protocol::OperationTypeThreshold >&
-AccountThreshold::type_thresholds() const {
-  // @@protoc_insertion_point(field_list:protocol.AccountThreshold.type_thresholds)
+OperationSetPrivilege::type_thresholds() const {
+  // @@protoc_insertion_point(field_list:protocol.OperationSetPrivilege.type_thresholds)
   return type_thresholds_;
 }
 
 // -------------------------------------------------------------------
 
-// OperationIssueAsset
+// Operation
 
-// optional string code = 1;
-inline void OperationIssueAsset::clear_code() {
-  code_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// optional .protocol.Operation.Type type = 1;
+inline void Operation::clear_type() {
+  type_ = 0;
 }
-inline const ::std::string& OperationIssueAsset::code() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationIssueAsset.code)
-  return code_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::protocol::Operation_Type Operation::type() const {
+  // @@protoc_insertion_point(field_get:protocol.Operation.type)
+  return static_cast< ::protocol::Operation_Type >(type_);
 }
-inline void OperationIssueAsset::set_code(const ::std::string& value) {
+inline void Operation::set_type(::protocol::Operation_Type value) {
   
-  code_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.OperationIssueAsset.code)
+  type_ = value;
+  // @@protoc_insertion_point(field_set:protocol.Operation.type)
 }
-inline void OperationIssueAsset::set_code(const char* value) {
+
+// optional string source_address = 2;
+inline void Operation::clear_source_address() {
+  source_address_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& Operation::source_address() const {
+  // @@protoc_insertion_point(field_get:protocol.Operation.source_address)
+  return source_address_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void Operation::set_source_address(const ::std::string& value) {
   
-  code_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.OperationIssueAsset.code)
+  source_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.Operation.source_address)
 }
-inline void OperationIssueAsset::set_code(const char* value, size_t size) {
+inline void Operation::set_source_address(const char* value) {
   
-  code_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  source_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.Operation.source_address)
+}
+inline void Operation::set_source_address(const char* value, size_t size) {
+  
+  source_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.OperationIssueAsset.code)
+  // @@protoc_insertion_point(field_set_pointer:protocol.Operation.source_address)
 }
-inline ::std::string* OperationIssueAsset::mutable_code() {
+inline ::std::string* Operation::mutable_source_address() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.OperationIssueAsset.code)
-  return code_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:protocol.Operation.source_address)
+  return source_address_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* OperationIssueAsset::release_code() {
-  // @@protoc_insertion_point(field_release:protocol.OperationIssueAsset.code)
+inline ::std::string* Operation::release_source_address() {
+  // @@protoc_insertion_point(field_release:protocol.Operation.source_address)
   
-  return code_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return source_address_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void OperationIssueAsset::set_allocated_code(::std::string* code) {
-  if (code != NULL) {
+inline void Operation::set_allocated_source_address(::std::string* source_address) {
+  if (source_address != NULL) {
     
   } else {
     
   }
-  code_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), code);
-  // @@protoc_insertion_point(field_set_allocated:protocol.OperationIssueAsset.code)
-}
-
-// optional int64 amount = 2;
-inline void OperationIssueAsset::clear_amount() {
-  amount_ = GOOGLE_LONGLONG(0);
-}
-inline ::google::protobuf::int64 OperationIssueAsset::amount() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationIssueAsset.amount)
-  return amount_;
-}
-inline void OperationIssueAsset::set_amount(::google::protobuf::int64 value) {
-  
-  amount_ = value;
-  // @@protoc_insertion_point(field_set:protocol.OperationIssueAsset.amount)
+  source_address_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), source_address);
+  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.source_address)
 }
 
-// -------------------------------------------------------------------
-
-// OperationPayCoin
-
-// optional string dest_address = 1;
-inline void OperationPayCoin::clear_dest_address() {
-  dest_address_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// optional bytes metadata = 3;
+inline void Operation::clear_metadata() {
+  metadata_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& OperationPayCoin::dest_address() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationPayCoin.dest_address)
-  return dest_address_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::std::string& Operation::metadata() const {
+  // @@protoc_insertion_point(field_get:protocol.Operation.metadata)
+  return metadata_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void OperationPayCoin::set_dest_address(const ::std::string& value) {
+inline void Operation::set_metadata(const ::std::string& value) {
   
-  dest_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.OperationPayCoin.dest_address)
+  metadata_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.Operation.metadata)
 }
-inline void OperationPayCoin::set_dest_address(const char* value) {
+inline void Operation::set_metadata(const char* value) {
   
-  dest_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.OperationPayCoin.dest_address)
+  metadata_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.Operation.metadata)
 }
-inline void OperationPayCoin::set_dest_address(const char* value, size_t size) {
+inline void Operation::set_metadata(const void* value, size_t size) {
   
-  dest_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  metadata_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.OperationPayCoin.dest_address)
+  // @@protoc_insertion_point(field_set_pointer:protocol.Operation.metadata)
 }
-inline ::std::string* OperationPayCoin::mutable_dest_address() {
+inline ::std::string* Operation::mutable_metadata() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.OperationPayCoin.dest_address)
-  return dest_address_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:protocol.Operation.metadata)
+  return metadata_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* OperationPayCoin::release_dest_address() {
-  // @@protoc_insertion_point(field_release:protocol.OperationPayCoin.dest_address)
+inline ::std::string* Operation::release_metadata() {
+  // @@protoc_insertion_point(field_release:protocol.Operation.metadata)
   
-  return dest_address_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return metadata_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void OperationPayCoin::set_allocated_dest_address(::std::string* dest_address) {
-  if (dest_address != NULL) {
+inline void Operation::set_allocated_metadata(::std::string* metadata) {
+  if (metadata != NULL) {
     
   } else {
     
   }
-  dest_address_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), dest_address);
-  // @@protoc_insertion_point(field_set_allocated:protocol.OperationPayCoin.dest_address)
+  metadata_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), metadata);
+  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.metadata)
 }
 
-// optional int64 amount = 2;
-inline void OperationPayCoin::clear_amount() {
-  amount_ = GOOGLE_LONGLONG(0);
+// optional .protocol.OperationCreateAccount create_account = 4;
+inline bool Operation::has_create_account() const {
+  return !_is_default_instance_ && create_account_ != NULL;
 }
-inline ::google::protobuf::int64 OperationPayCoin::amount() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationPayCoin.amount)
-  return amount_;
+inline void Operation::clear_create_account() {
+  if (GetArenaNoVirtual() == NULL && create_account_ != NULL) delete create_account_;
+  create_account_ = NULL;
 }
-inline void OperationPayCoin::set_amount(::google::protobuf::int64 value) {
+inline const ::protocol::OperationCreateAccount& Operation::create_account() const {
+  // @@protoc_insertion_point(field_get:protocol.Operation.create_account)
+  return create_account_ != NULL ? *create_account_ : *default_instance_->create_account_;
+}
+inline ::protocol::OperationCreateAccount* Operation::mutable_create_account() {
   
-  amount_ = value;
-  // @@protoc_insertion_point(field_set:protocol.OperationPayCoin.amount)
+  if (create_account_ == NULL) {
+    create_account_ = new ::protocol::OperationCreateAccount;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.Operation.create_account)
+  return create_account_;
 }
-
-// optional string input = 3;
-inline void OperationPayCoin::clear_input() {
-  input_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::protocol::OperationCreateAccount* Operation::release_create_account() {
+  // @@protoc_insertion_point(field_release:protocol.Operation.create_account)
+  
+  ::protocol::OperationCreateAccount* temp = create_account_;
+  create_account_ = NULL;
+  return temp;
 }
-inline const ::std::string& OperationPayCoin::input() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationPayCoin.input)
-  return input_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Operation::set_allocated_create_account(::protocol::OperationCreateAccount* create_account) {
+  delete create_account_;
+  create_account_ = create_account;
+  if (create_account) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.create_account)
 }
-inline void OperationPayCoin::set_input(const ::std::string& value) {
-  
-  input_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.OperationPayCoin.input)
+
+// optional .protocol.OperationIssueAsset issue_asset = 5;
+inline bool Operation::has_issue_asset() const {
+  return !_is_default_instance_ && issue_asset_ != NULL;
 }
-inline void OperationPayCoin::set_input(const char* value) {
-  
-  input_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.OperationPayCoin.input)
+inline void Operation::clear_issue_asset() {
+  if (GetArenaNoVirtual() == NULL && issue_asset_ != NULL) delete issue_asset_;
+  issue_asset_ = NULL;
 }
-inline void OperationPayCoin::set_input(const char* value, size_t size) {
-  
-  input_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.OperationPayCoin.input)
+inline const ::protocol::OperationIssueAsset& Operation::issue_asset() const {
+  // @@protoc_insertion_point(field_get:protocol.Operation.issue_asset)
+  return issue_asset_ != NULL ? *issue_asset_ : *default_instance_->issue_asset_;
 }
-inline ::std::string* OperationPayCoin::mutable_input() {
+inline ::protocol::OperationIssueAsset* Operation::mutable_issue_asset() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.OperationPayCoin.input)
-  return input_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (issue_asset_ == NULL) {
+    issue_asset_ = new ::protocol::OperationIssueAsset;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.Operation.issue_asset)
+  return issue_asset_;
 }
-inline ::std::string* OperationPayCoin::release_input() {
-  // @@protoc_insertion_point(field_release:protocol.OperationPayCoin.input)
+inline ::protocol::OperationIssueAsset* Operation::release_issue_asset() {
+  // @@protoc_insertion_point(field_release:protocol.Operation.issue_asset)
   
-  return input_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::protocol::OperationIssueAsset* temp = issue_asset_;
+  issue_asset_ = NULL;
+  return temp;
 }
-inline void OperationPayCoin::set_allocated_input(::std::string* input) {
-  if (input != NULL) {
+inline void Operation::set_allocated_issue_asset(::protocol::OperationIssueAsset* issue_asset) {
+  delete issue_asset_;
+  issue_asset_ = issue_asset;
+  if (issue_asset) {
     
   } else {
     
   }
-  input_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), input);
-  // @@protoc_insertion_point(field_set_allocated:protocol.OperationPayCoin.input)
+  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.issue_asset)
 }
 
-// -------------------------------------------------------------------
-
-// OperationSetSignerWeight
-
-// optional int64 master_weight = 1;
-inline void OperationSetSignerWeight::clear_master_weight() {
-  master_weight_ = GOOGLE_LONGLONG(0);
+// optional .protocol.OperationPayAsset pay_asset = 6;
+inline bool Operation::has_pay_asset() const {
+  return !_is_default_instance_ && pay_asset_ != NULL;
 }
-inline ::google::protobuf::int64 OperationSetSignerWeight::master_weight() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationSetSignerWeight.master_weight)
-  return master_weight_;
+inline void Operation::clear_pay_asset() {
+  if (GetArenaNoVirtual() == NULL && pay_asset_ != NULL) delete pay_asset_;
+  pay_asset_ = NULL;
 }
-inline void OperationSetSignerWeight::set_master_weight(::google::protobuf::int64 value) {
-  
-  master_weight_ = value;
-  // @@protoc_insertion_point(field_set:protocol.OperationSetSignerWeight.master_weight)
+inline const ::protocol::OperationPayAsset& Operation::pay_asset() const {
+  // @@protoc_insertion_point(field_get:protocol.Operation.pay_asset)
+  return pay_asset_ != NULL ? *pay_asset_ : *default_instance_->pay_asset_;
 }
-
-// repeated .protocol.Signer signers = 2;
-inline int OperationSetSignerWeight::signers_size() const {
-  return signers_.size();
+inline ::protocol::OperationPayAsset* Operation::mutable_pay_asset() {
+  
+  if (pay_asset_ == NULL) {
+    pay_asset_ = new ::protocol::OperationPayAsset;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.Operation.pay_asset)
+  return pay_asset_;
 }
-inline void OperationSetSignerWeight::clear_signers() {
-  signers_.Clear();
+inline ::protocol::OperationPayAsset* Operation::release_pay_asset() {
+  // @@protoc_insertion_point(field_release:protocol.Operation.pay_asset)
+  
+  ::protocol::OperationPayAsset* temp = pay_asset_;
+  pay_asset_ = NULL;
+  return temp;
 }
-inline const ::protocol::Signer& OperationSetSignerWeight::signers(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.OperationSetSignerWeight.signers)
-  return signers_.Get(index);
+inline void Operation::set_allocated_pay_asset(::protocol::OperationPayAsset* pay_asset) {
+  delete pay_asset_;
+  pay_asset_ = pay_asset;
+  if (pay_asset) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.pay_asset)
 }
-inline ::protocol::Signer* OperationSetSignerWeight::mutable_signers(int index) {
-  // @@protoc_insertion_point(field_mutable:protocol.OperationSetSignerWeight.signers)
-  return signers_.Mutable(index);
+
+// optional .protocol.OperationSetMetadata set_metadata = 7;
+inline bool Operation::has_set_metadata() const {
+  return !_is_default_instance_ && set_metadata_ != NULL;
 }
-inline ::protocol::Signer* OperationSetSignerWeight::add_signers() {
-  // @@protoc_insertion_point(field_add:protocol.OperationSetSignerWeight.signers)
-  return signers_.Add();
+inline void Operation::clear_set_metadata() {
+  if (GetArenaNoVirtual() == NULL && set_metadata_ != NULL) delete set_metadata_;
+  set_metadata_ = NULL;
 }
-inline ::google::protobuf::RepeatedPtrField< ::protocol::Signer >*
-OperationSetSignerWeight::mutable_signers() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.OperationSetSignerWeight.signers)
-  return &signers_;
+inline const ::protocol::OperationSetMetadata& Operation::set_metadata() const {
+  // @@protoc_insertion_point(field_get:protocol.Operation.set_metadata)
+  return set_metadata_ != NULL ? *set_metadata_ : *default_instance_->set_metadata_;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::protocol::Signer >&
-OperationSetSignerWeight::signers() const {
-  // @@protoc_insertion_point(field_list:protocol.OperationSetSignerWeight.signers)
-  return signers_;
+inline ::protocol::OperationSetMetadata* Operation::mutable_set_metadata() {
+  
+  if (set_metadata_ == NULL) {
+    set_metadata_ = new ::protocol::OperationSetMetadata;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.Operation.set_metadata)
+  return set_metadata_;
 }
-
-// -------------------------------------------------------------------
-
-// OperationLog
-
-// optional string topic = 1;
-inline void OperationLog::clear_topic() {
-  topic_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::protocol::OperationSetMetadata* Operation::release_set_metadata() {
+  // @@protoc_insertion_point(field_release:protocol.Operation.set_metadata)
+  
+  ::protocol::OperationSetMetadata* temp = set_metadata_;
+  set_metadata_ = NULL;
+  return temp;
 }
-inline const ::std::string& OperationLog::topic() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationLog.topic)
-  return topic_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Operation::set_allocated_set_metadata(::protocol::OperationSetMetadata* set_metadata) {
+  delete set_metadata_;
+  set_metadata_ = set_metadata;
+  if (set_metadata) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.set_metadata)
 }
-inline void OperationLog::set_topic(const ::std::string& value) {
-  
-  topic_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.OperationLog.topic)
+
+// optional .protocol.OperationSetSignerWeight set_signer_weight = 8;
+inline bool Operation::has_set_signer_weight() const {
+  return !_is_default_instance_ && set_signer_weight_ != NULL;
 }
-inline void OperationLog::set_topic(const char* value) {
-  
-  topic_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.OperationLog.topic)
+inline void Operation::clear_set_signer_weight() {
+  if (GetArenaNoVirtual() == NULL && set_signer_weight_ != NULL) delete set_signer_weight_;
+  set_signer_weight_ = NULL;
 }
-inline void OperationLog::set_topic(const char* value, size_t size) {
-  
-  topic_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.OperationLog.topic)
+inline const ::protocol::OperationSetSignerWeight& Operation::set_signer_weight() const {
+  // @@protoc_insertion_point(field_get:protocol.Operation.set_signer_weight)
+  return set_signer_weight_ != NULL ? *set_signer_weight_ : *default_instance_->set_signer_weight_;
 }
-inline ::std::string* OperationLog::mutable_topic() {
+inline ::protocol::OperationSetSignerWeight* Operation::mutable_set_signer_weight() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.OperationLog.topic)
-  return topic_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (set_signer_weight_ == NULL) {
+    set_signer_weight_ = new ::protocol::OperationSetSignerWeight;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.Operation.set_signer_weight)
+  return set_signer_weight_;
 }
-inline ::std::string* OperationLog::release_topic() {
-  // @@protoc_insertion_point(field_release:protocol.OperationLog.topic)
+inline ::protocol::OperationSetSignerWeight* Operation::release_set_signer_weight() {
+  // @@protoc_insertion_point(field_release:protocol.Operation.set_signer_weight)
   
-  return topic_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::protocol::OperationSetSignerWeight* temp = set_signer_weight_;
+  set_signer_weight_ = NULL;
+  return temp;
 }
-inline void OperationLog::set_allocated_topic(::std::string* topic) {
-  if (topic != NULL) {
+inline void Operation::set_allocated_set_signer_weight(::protocol::OperationSetSignerWeight* set_signer_weight) {
+  delete set_signer_weight_;
+  set_signer_weight_ = set_signer_weight;
+  if (set_signer_weight) {
     
   } else {
     
   }
-  topic_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), topic);
-  // @@protoc_insertion_point(field_set_allocated:protocol.OperationLog.topic)
+  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.set_signer_weight)
 }
 
-// repeated string datas = 2;
-inline int OperationLog::datas_size() const {
-  return datas_.size();
-}
-inline void OperationLog::clear_datas() {
-  datas_.Clear();
-}
-inline const ::std::string& OperationLog::datas(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.OperationLog.datas)
-  return datas_.Get(index);
-}
-inline ::std::string* OperationLog::mutable_datas(int index) {
-  // @@protoc_insertion_point(field_mutable:protocol.OperationLog.datas)
-  return datas_.Mutable(index);
-}
-inline void OperationLog::set_datas(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:protocol.OperationLog.datas)
-  datas_.Mutable(index)->assign(value);
-}
-inline void OperationLog::set_datas(int index, const char* value) {
-  datas_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:protocol.OperationLog.datas)
-}
-inline void OperationLog::set_datas(int index, const char* value, size_t size) {
-  datas_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:protocol.OperationLog.datas)
-}
-inline ::std::string* OperationLog::add_datas() {
-  // @@protoc_insertion_point(field_add_mutable:protocol.OperationLog.datas)
-  return datas_.Add();
+// optional .protocol.OperationSetThreshold set_threshold = 9;
+inline bool Operation::has_set_threshold() const {
+  return !_is_default_instance_ && set_threshold_ != NULL;
 }
-inline void OperationLog::add_datas(const ::std::string& value) {
-  datas_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:protocol.OperationLog.datas)
+inline void Operation::clear_set_threshold() {
+  if (GetArenaNoVirtual() == NULL && set_threshold_ != NULL) delete set_threshold_;
+  set_threshold_ = NULL;
 }
-inline void OperationLog::add_datas(const char* value) {
-  datas_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:protocol.OperationLog.datas)
+inline const ::protocol::OperationSetThreshold& Operation::set_threshold() const {
+  // @@protoc_insertion_point(field_get:protocol.Operation.set_threshold)
+  return set_threshold_ != NULL ? *set_threshold_ : *default_instance_->set_threshold_;
 }
-inline void OperationLog::add_datas(const char* value, size_t size) {
-  datas_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:protocol.OperationLog.datas)
+inline ::protocol::OperationSetThreshold* Operation::mutable_set_threshold() {
+  
+  if (set_threshold_ == NULL) {
+    set_threshold_ = new ::protocol::OperationSetThreshold;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.Operation.set_threshold)
+  return set_threshold_;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-OperationLog::datas() const {
-  // @@protoc_insertion_point(field_list:protocol.OperationLog.datas)
-  return datas_;
+inline ::protocol::OperationSetThreshold* Operation::release_set_threshold() {
+  // @@protoc_insertion_point(field_release:protocol.Operation.set_threshold)
+  
+  ::protocol::OperationSetThreshold* temp = set_threshold_;
+  set_threshold_ = NULL;
+  return temp;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-OperationLog::mutable_datas() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.OperationLog.datas)
-  return &datas_;
+inline void Operation::set_allocated_set_threshold(::protocol::OperationSetThreshold* set_threshold) {
+  delete set_threshold_;
+  set_threshold_ = set_threshold;
+  if (set_threshold) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.set_threshold)
 }
 
-// -------------------------------------------------------------------
-
-// OperationSetPrivilege
-
-// optional string master_weight = 1;
-inline void OperationSetPrivilege::clear_master_weight() {
-  master_weight_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& OperationSetPrivilege::master_weight() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationSetPrivilege.master_weight)
-  return master_weight_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void OperationSetPrivilege::set_master_weight(const ::std::string& value) {
-  
-  master_weight_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.OperationSetPrivilege.master_weight)
+// optional .protocol.OperationPayCoin pay_coin = 10;
+inline bool Operation::has_pay_coin() const {
+  return !_is_default_instance_ && pay_coin_ != NULL;
 }
-inline void OperationSetPrivilege::set_master_weight(const char* value) {
-  
-  master_weight_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.OperationSetPrivilege.master_weight)
+inline void Operation::clear_pay_coin() {
+  if (GetArenaNoVirtual() == NULL && pay_coin_ != NULL) delete pay_coin_;
+  pay_coin_ = NULL;
 }
-inline void OperationSetPrivilege::set_master_weight(const char* value, size_t size) {
-  
-  master_weight_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.OperationSetPrivilege.master_weight)
+inline const ::protocol::OperationPayCoin& Operation::pay_coin() const {
+  // @@protoc_insertion_point(field_get:protocol.Operation.pay_coin)
+  return pay_coin_ != NULL ? *pay_coin_ : *default_instance_->pay_coin_;
 }
-inline ::std::string* OperationSetPrivilege::mutable_master_weight() {
+inline ::protocol::OperationPayCoin* Operation::mutable_pay_coin() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.OperationSetPrivilege.master_weight)
-  return master_weight_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (pay_coin_ == NULL) {
+    pay_coin_ = new ::protocol::OperationPayCoin;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.Operation.pay_coin)
+  return pay_coin_;
 }
-inline ::std::string* OperationSetPrivilege::release_master_weight() {
-  // @@protoc_insertion_point(field_release:protocol.OperationSetPrivilege.master_weight)
+inline ::protocol::OperationPayCoin* Operation::release_pay_coin() {
+  // @@protoc_insertion_point(field_release:protocol.Operation.pay_coin)
   
-  return master_weight_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::protocol::OperationPayCoin* temp = pay_coin_;
+  pay_coin_ = NULL;
+  return temp;
 }
-inline void OperationSetPrivilege::set_allocated_master_weight(::std::string* master_weight) {
-  if (master_weight != NULL) {
+inline void Operation::set_allocated_pay_coin(::protocol::OperationPayCoin* pay_coin) {
+  delete pay_coin_;
+  pay_coin_ = pay_coin;
+  if (pay_coin) {
     
   } else {
     
   }
-  master_weight_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), master_weight);
-  // @@protoc_insertion_point(field_set_allocated:protocol.OperationSetPrivilege.master_weight)
+  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.pay_coin)
 }
 
-// repeated .protocol.Signer signers = 2;
-inline int OperationSetPrivilege::signers_size() const {
-  return signers_.size();
-}
-inline void OperationSetPrivilege::clear_signers() {
-  signers_.Clear();
+// optional .protocol.OperationLog log = 11;
+inline bool Operation::has_log() const {
+  return !_is_default_instance_ && log_ != NULL;
 }
-inline const ::protocol::Signer& OperationSetPrivilege::signers(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.OperationSetPrivilege.signers)
-  return signers_.Get(index);
+inline void Operation::clear_log() {
+  if (GetArenaNoVirtual() == NULL && log_ != NULL) delete log_;
+  log_ = NULL;
 }
-inline ::protocol::Signer* OperationSetPrivilege::mutable_signers(int index) {
-  // @@protoc_insertion_point(field_mutable:protocol.OperationSetPrivilege.signers)
-  return signers_.Mutable(index);
+inline const ::protocol::OperationLog& Operation::log() const {
+  // @@protoc_insertion_point(field_get:protocol.Operation.log)
+  return log_ != NULL ? *log_ : *default_instance_->log_;
 }
-inline ::protocol::Signer* OperationSetPrivilege::add_signers() {
-  // @@protoc_insertion_point(field_add:protocol.OperationSetPrivilege.signers)
-  return signers_.Add();
+inline ::protocol::OperationLog* Operation::mutable_log() {
+  
+  if (log_ == NULL) {
+    log_ = new ::protocol::OperationLog;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.Operation.log)
+  return log_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::protocol::Signer >*
-OperationSetPrivilege::mutable_signers() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.OperationSetPrivilege.signers)
-  return &signers_;
+inline ::protocol::OperationLog* Operation::release_log() {
+  // @@protoc_insertion_point(field_release:protocol.Operation.log)
+  
+  ::protocol::OperationLog* temp = log_;
+  log_ = NULL;
+  return temp;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::protocol::Signer >&
-OperationSetPrivilege::signers() const {
-  // @@protoc_insertion_point(field_list:protocol.OperationSetPrivilege.signers)
-  return signers_;
+inline void Operation::set_allocated_log(::protocol::OperationLog* log) {
+  delete log_;
+  log_ = log;
+  if (log) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.log)
 }
 
-// optional string tx_threshold = 3;
-inline void OperationSetPrivilege::clear_tx_threshold() {
-  tx_threshold_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// optional .protocol.OperationSetPrivilege set_privilege = 12;
+inline bool Operation::has_set_privilege() const {
+  return !_is_default_instance_ && set_privilege_ != NULL;
 }
-inline const ::std::string& OperationSetPrivilege::tx_threshold() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationSetPrivilege.tx_threshold)
-  return tx_threshold_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Operation::clear_set_privilege() {
+  if (GetArenaNoVirtual() == NULL && set_privilege_ != NULL) delete set_privilege_;
+  set_privilege_ = NULL;
 }
-inline void OperationSetPrivilege::set_tx_threshold(const ::std::string& value) {
-  
-  tx_threshold_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.OperationSetPrivilege.tx_threshold)
+inline const ::protocol::OperationSetPrivilege& Operation::set_privilege() const {
+  // @@protoc_insertion_point(field_get:protocol.Operation.set_privilege)
+  return set_privilege_ != NULL ? *set_privilege_ : *default_instance_->set_privilege_;
 }
-inline void OperationSetPrivilege::set_tx_threshold(const char* value) {
+inline ::protocol::OperationSetPrivilege* Operation::mutable_set_privilege() {
   
-  tx_threshold_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.OperationSetPrivilege.tx_threshold)
+  if (set_privilege_ == NULL) {
+    set_privilege_ = new ::protocol::OperationSetPrivilege;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.Operation.set_privilege)
+  return set_privilege_;
 }
-inline void OperationSetPrivilege::set_tx_threshold(const char* value, size_t size) {
+inline ::protocol::OperationSetPrivilege* Operation::release_set_privilege() {
+  // @@protoc_insertion_point(field_release:protocol.Operation.set_privilege)
   
-  tx_threshold_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.OperationSetPrivilege.tx_threshold)
+  ::protocol::OperationSetPrivilege* temp = set_privilege_;
+  set_privilege_ = NULL;
+  return temp;
 }
-inline ::std::string* OperationSetPrivilege::mutable_tx_threshold() {
-  
-  // @@protoc_insertion_point(field_mutable:protocol.OperationSetPrivilege.tx_threshold)
-  return tx_threshold_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void Operation::set_allocated_set_privilege(::protocol::OperationSetPrivilege* set_privilege) {
+  delete set_privilege_;
+  set_privilege_ = set_privilege;
+  if (set_privilege) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.set_privilege)
+}
+
+// -------------------------------------------------------------------
+
+// OperationSetThreshold
+
+// optional int64 tx_threshold = 1;
+inline void OperationSetThreshold::clear_tx_threshold() {
+  tx_threshold_ = GOOGLE_LONGLONG(0);
 }
-inline ::std::string* OperationSetPrivilege::release_tx_threshold() {
-  // @@protoc_insertion_point(field_release:protocol.OperationSetPrivilege.tx_threshold)
-  
-  return tx_threshold_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::google::protobuf::int64 OperationSetThreshold::tx_threshold() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationSetThreshold.tx_threshold)
+  return tx_threshold_;
 }
-inline void OperationSetPrivilege::set_allocated_tx_threshold(::std::string* tx_threshold) {
-  if (tx_threshold != NULL) {
-    
-  } else {
-    
-  }
-  tx_threshold_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), tx_threshold);
-  // @@protoc_insertion_point(field_set_allocated:protocol.OperationSetPrivilege.tx_threshold)
+inline void OperationSetThreshold::set_tx_threshold(::google::protobuf::int64 value) {
+  
+  tx_threshold_ = value;
+  // @@protoc_insertion_point(field_set:protocol.OperationSetThreshold.tx_threshold)
 }
 
-// repeated .protocol.OperationTypeThreshold type_thresholds = 4;
-inline int OperationSetPrivilege::type_thresholds_size() const {
+// repeated .protocol.OperationTypeThreshold type_thresholds = 2;
+inline int OperationSetThreshold::type_thresholds_size() const {
   return type_thresholds_.size();
 }
-inline void OperationSetPrivilege::clear_type_thresholds() {
+inline void OperationSetThreshold::clear_type_thresholds() {
   type_thresholds_.Clear();
 }
-inline const ::protocol::OperationTypeThreshold& OperationSetPrivilege::type_thresholds(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.OperationSetPrivilege.type_thresholds)
+inline const ::protocol::OperationTypeThreshold& OperationSetThreshold::type_thresholds(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.OperationSetThreshold.type_thresholds)
   return type_thresholds_.Get(index);
 }
-inline ::protocol::OperationTypeThreshold* OperationSetPrivilege::mutable_type_thresholds(int index) {
-  // @@protoc_insertion_point(field_mutable:protocol.OperationSetPrivilege.type_thresholds)
+inline ::protocol::OperationTypeThreshold* OperationSetThreshold::mutable_type_thresholds(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.OperationSetThreshold.type_thresholds)
   return type_thresholds_.Mutable(index);
 }
-inline ::protocol::OperationTypeThreshold* OperationSetPrivilege::add_type_thresholds() {
-  // @@protoc_insertion_point(field_add:protocol.OperationSetPrivilege.type_thresholds)
+inline ::protocol::OperationTypeThreshold* OperationSetThreshold::add_type_thresholds() {
+  // @@protoc_insertion_point(field_add:protocol.OperationSetThreshold.type_thresholds)
   return type_thresholds_.Add();
 }
 inline ::google::protobuf::RepeatedPtrField< ::protocol::OperationTypeThreshold >*
-OperationSetPrivilege::mutable_type_thresholds() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.OperationSetPrivilege.type_thresholds)
+OperationSetThreshold::mutable_type_thresholds() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.OperationSetThreshold.type_thresholds)
   return &type_thresholds_;
 }
 inline const ::google::protobuf::RepeatedPtrField< ::protocol::OperationTypeThreshold >&
-OperationSetPrivilege::type_thresholds() const {
-  // @@protoc_insertion_point(field_list:protocol.OperationSetPrivilege.type_thresholds)
+OperationSetThreshold::type_thresholds() const {
+  // @@protoc_insertion_point(field_list:protocol.OperationSetThreshold.type_thresholds)
   return type_thresholds_;
 }
 
 // -------------------------------------------------------------------
 
-// Operation
-
-// optional .protocol.Operation.Type type = 1;
-inline void Operation::clear_type() {
-  type_ = 0;
-}
-inline ::protocol::Operation_Type Operation::type() const {
-  // @@protoc_insertion_point(field_get:protocol.Operation.type)
-  return static_cast< ::protocol::Operation_Type >(type_);
-}
-inline void Operation::set_type(::protocol::Operation_Type value) {
-  
-  type_ = value;
-  // @@protoc_insertion_point(field_set:protocol.Operation.type)
-}
+// Transaction
 
-// optional string source_address = 2;
-inline void Operation::clear_source_address() {
+// optional string source_address = 1;
+inline void Transaction::clear_source_address() {
   source_address_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& Operation::source_address() const {
-  // @@protoc_insertion_point(field_get:protocol.Operation.source_address)
+inline const ::std::string& Transaction::source_address() const {
+  // @@protoc_insertion_point(field_get:protocol.Transaction.source_address)
   return source_address_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Operation::set_source_address(const ::std::string& value) {
+inline void Transaction::set_source_address(const ::std::string& value) {
   
   source_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.Operation.source_address)
+  // @@protoc_insertion_point(field_set:protocol.Transaction.source_address)
 }
-inline void Operation::set_source_address(const char* value) {
+inline void Transaction::set_source_address(const char* value) {
   
   source_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.Operation.source_address)
+  // @@protoc_insertion_point(field_set_char:protocol.Transaction.source_address)
 }
-inline void Operation::set_source_address(const char* value, size_t size) {
+inline void Transaction::set_source_address(const char* value, size_t size) {
   
   source_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.Operation.source_address)
+  // @@protoc_insertion_point(field_set_pointer:protocol.Transaction.source_address)
 }
-inline ::std::string* Operation::mutable_source_address() {
+inline ::std::string* Transaction::mutable_source_address() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.Operation.source_address)
+  // @@protoc_insertion_point(field_mutable:protocol.Transaction.source_address)
   return source_address_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* Operation::release_source_address() {
-  // @@protoc_insertion_point(field_release:protocol.Operation.source_address)
+inline ::std::string* Transaction::release_source_address() {
+  // @@protoc_insertion_point(field_release:protocol.Transaction.source_address)
   
   return source_address_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Operation::set_allocated_source_address(::std::string* source_address) {
+inline void Transaction::set_allocated_source_address(::std::string* source_address) {
   if (source_address != NULL) {
     
   } else {
     
   }
   source_address_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), source_address);
-  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.source_address)
+  // @@protoc_insertion_point(field_set_allocated:protocol.Transaction.source_address)
 }
 
-// optional bytes metadata = 3;
-inline void Operation::clear_metadata() {
+// optional int64 nonce = 2;
+inline void Transaction::clear_nonce() {
+  nonce_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 Transaction::nonce() const {
+  // @@protoc_insertion_point(field_get:protocol.Transaction.nonce)
+  return nonce_;
+}
+inline void Transaction::set_nonce(::google::protobuf::int64 value) {
+  
+  nonce_ = value;
+  // @@protoc_insertion_point(field_set:protocol.Transaction.nonce)
+}
+
+// optional int64 fee_limit = 3;
+inline void Transaction::clear_fee_limit() {
+  fee_limit_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 Transaction::fee_limit() const {
+  // @@protoc_insertion_point(field_get:protocol.Transaction.fee_limit)
+  return fee_limit_;
+}
+inline void Transaction::set_fee_limit(::google::protobuf::int64 value) {
+  
+  fee_limit_ = value;
+  // @@protoc_insertion_point(field_set:protocol.Transaction.fee_limit)
+}
+
+// optional int64 gas_price = 4;
+inline void Transaction::clear_gas_price() {
+  gas_price_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 Transaction::gas_price() const {
+  // @@protoc_insertion_point(field_get:protocol.Transaction.gas_price)
+  return gas_price_;
+}
+inline void Transaction::set_gas_price(::google::protobuf::int64 value) {
+  
+  gas_price_ = value;
+  // @@protoc_insertion_point(field_set:protocol.Transaction.gas_price)
+}
+
+// optional int64 ceil_ledger_seq = 5;
+inline void Transaction::clear_ceil_ledger_seq() {
+  ceil_ledger_seq_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 Transaction::ceil_ledger_seq() const {
+  // @@protoc_insertion_point(field_get:protocol.Transaction.ceil_ledger_seq)
+  return ceil_ledger_seq_;
+}
+inline void Transaction::set_ceil_ledger_seq(::google::protobuf::int64 value) {
+  
+  ceil_ledger_seq_ = value;
+  // @@protoc_insertion_point(field_set:protocol.Transaction.ceil_ledger_seq)
+}
+
+// optional bytes metadata = 6;
+inline void Transaction::clear_metadata() {
   metadata_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& Operation::metadata() const {
-  // @@protoc_insertion_point(field_get:protocol.Operation.metadata)
+inline const ::std::string& Transaction::metadata() const {
+  // @@protoc_insertion_point(field_get:protocol.Transaction.metadata)
   return metadata_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Operation::set_metadata(const ::std::string& value) {
+inline void Transaction::set_metadata(const ::std::string& value) {
   
   metadata_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.Operation.metadata)
+  // @@protoc_insertion_point(field_set:protocol.Transaction.metadata)
 }
-inline void Operation::set_metadata(const char* value) {
+inline void Transaction::set_metadata(const char* value) {
   
   metadata_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.Operation.metadata)
+  // @@protoc_insertion_point(field_set_char:protocol.Transaction.metadata)
 }
-inline void Operation::set_metadata(const void* value, size_t size) {
+inline void Transaction::set_metadata(const void* value, size_t size) {
   
   metadata_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.Operation.metadata)
+  // @@protoc_insertion_point(field_set_pointer:protocol.Transaction.metadata)
 }
-inline ::std::string* Operation::mutable_metadata() {
+inline ::std::string* Transaction::mutable_metadata() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.Operation.metadata)
+  // @@protoc_insertion_point(field_mutable:protocol.Transaction.metadata)
   return metadata_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* Operation::release_metadata() {
-  // @@protoc_insertion_point(field_release:protocol.Operation.metadata)
+inline ::std::string* Transaction::release_metadata() {
+  // @@protoc_insertion_point(field_release:protocol.Transaction.metadata)
   
   return metadata_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Operation::set_allocated_metadata(::std::string* metadata) {
+inline void Transaction::set_allocated_metadata(::std::string* metadata) {
   if (metadata != NULL) {
     
   } else {
     
   }
   metadata_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), metadata);
-  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.metadata)
+  // @@protoc_insertion_point(field_set_allocated:protocol.Transaction.metadata)
 }
 
-// optional .protocol.OperationCreateAccount create_account = 4;
-inline bool Operation::has_create_account() const {
-  return !_is_default_instance_ && create_account_ != NULL;
+// repeated .protocol.Operation operations = 7;
+inline int Transaction::operations_size() const {
+  return operations_.size();
 }
-inline void Operation::clear_create_account() {
-  if (GetArenaNoVirtual() == NULL && create_account_ != NULL) delete create_account_;
-  create_account_ = NULL;
+inline void Transaction::clear_operations() {
+  operations_.Clear();
 }
-inline const ::protocol::OperationCreateAccount& Operation::create_account() const {
-  // @@protoc_insertion_point(field_get:protocol.Operation.create_account)
-  return create_account_ != NULL ? *create_account_ : *default_instance_->create_account_;
+inline const ::protocol::Operation& Transaction::operations(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.Transaction.operations)
+  return operations_.Get(index);
 }
-inline ::protocol::OperationCreateAccount* Operation::mutable_create_account() {
-  
-  if (create_account_ == NULL) {
-    create_account_ = new ::protocol::OperationCreateAccount;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.Operation.create_account)
-  return create_account_;
+inline ::protocol::Operation* Transaction::mutable_operations(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.Transaction.operations)
+  return operations_.Mutable(index);
 }
-inline ::protocol::OperationCreateAccount* Operation::release_create_account() {
-  // @@protoc_insertion_point(field_release:protocol.Operation.create_account)
+inline ::protocol::Operation* Transaction::add_operations() {
+  // @@protoc_insertion_point(field_add:protocol.Transaction.operations)
+  return operations_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::protocol::Operation >*
+Transaction::mutable_operations() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.Transaction.operations)
+  return &operations_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protocol::Operation >&
+Transaction::operations() const {
+  // @@protoc_insertion_point(field_list:protocol.Transaction.operations)
+  return operations_;
+}
+
+// optional int64 chain_id = 8;
+inline void Transaction::clear_chain_id() {
+  chain_id_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 Transaction::chain_id() const {
+  // @@protoc_insertion_point(field_get:protocol.Transaction.chain_id)
+  return chain_id_;
+}
+inline void Transaction::set_chain_id(::google::protobuf::int64 value) {
   
-  ::protocol::OperationCreateAccount* temp = create_account_;
-  create_account_ = NULL;
-  return temp;
+  chain_id_ = value;
+  // @@protoc_insertion_point(field_set:protocol.Transaction.chain_id)
 }
-inline void Operation::set_allocated_create_account(::protocol::OperationCreateAccount* create_account) {
-  delete create_account_;
-  create_account_ = create_account;
-  if (create_account) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.create_account)
+
+// -------------------------------------------------------------------
+
+// Signer
+
+// optional string address = 1;
+inline void Signer::clear_address() {
+  address_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-
-// optional .protocol.OperationIssueAsset issue_asset = 5;
-inline bool Operation::has_issue_asset() const {
-  return !_is_default_instance_ && issue_asset_ != NULL;
+inline const ::std::string& Signer::address() const {
+  // @@protoc_insertion_point(field_get:protocol.Signer.address)
+  return address_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Operation::clear_issue_asset() {
-  if (GetArenaNoVirtual() == NULL && issue_asset_ != NULL) delete issue_asset_;
-  issue_asset_ = NULL;
+inline void Signer::set_address(const ::std::string& value) {
+  
+  address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.Signer.address)
 }
-inline const ::protocol::OperationIssueAsset& Operation::issue_asset() const {
-  // @@protoc_insertion_point(field_get:protocol.Operation.issue_asset)
-  return issue_asset_ != NULL ? *issue_asset_ : *default_instance_->issue_asset_;
+inline void Signer::set_address(const char* value) {
+  
+  address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.Signer.address)
 }
-inline ::protocol::OperationIssueAsset* Operation::mutable_issue_asset() {
+inline void Signer::set_address(const char* value, size_t size) {
   
-  if (issue_asset_ == NULL) {
-    issue_asset_ = new ::protocol::OperationIssueAsset;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.Operation.issue_asset)
-  return issue_asset_;
+  address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.Signer.address)
 }
-inline ::protocol::OperationIssueAsset* Operation::release_issue_asset() {
-  // @@protoc_insertion_point(field_release:protocol.Operation.issue_asset)
+inline ::std::string* Signer::mutable_address() {
   
-  ::protocol::OperationIssueAsset* temp = issue_asset_;
-  issue_asset_ = NULL;
-  return temp;
+  // @@protoc_insertion_point(field_mutable:protocol.Signer.address)
+  return address_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Operation::set_allocated_issue_asset(::protocol::OperationIssueAsset* issue_asset) {
-  delete issue_asset_;
-  issue_asset_ = issue_asset;
-  if (issue_asset) {
+inline ::std::string* Signer::release_address() {
+  // @@protoc_insertion_point(field_release:protocol.Signer.address)
+  
+  return address_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void Signer::set_allocated_address(::std::string* address) {
+  if (address != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.issue_asset)
+  address_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), address);
+  // @@protoc_insertion_point(field_set_allocated:protocol.Signer.address)
 }
 
-// optional .protocol.OperationPayAsset pay_asset = 6;
-inline bool Operation::has_pay_asset() const {
-  return !_is_default_instance_ && pay_asset_ != NULL;
-}
-inline void Operation::clear_pay_asset() {
-  if (GetArenaNoVirtual() == NULL && pay_asset_ != NULL) delete pay_asset_;
-  pay_asset_ = NULL;
+// optional int64 weight = 2;
+inline void Signer::clear_weight() {
+  weight_ = GOOGLE_LONGLONG(0);
 }
-inline const ::protocol::OperationPayAsset& Operation::pay_asset() const {
-  // @@protoc_insertion_point(field_get:protocol.Operation.pay_asset)
-  return pay_asset_ != NULL ? *pay_asset_ : *default_instance_->pay_asset_;
+inline ::google::protobuf::int64 Signer::weight() const {
+  // @@protoc_insertion_point(field_get:protocol.Signer.weight)
+  return weight_;
 }
-inline ::protocol::OperationPayAsset* Operation::mutable_pay_asset() {
+inline void Signer::set_weight(::google::protobuf::int64 value) {
   
-  if (pay_asset_ == NULL) {
-    pay_asset_ = new ::protocol::OperationPayAsset;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.Operation.pay_asset)
-  return pay_asset_;
+  weight_ = value;
+  // @@protoc_insertion_point(field_set:protocol.Signer.weight)
 }
-inline ::protocol::OperationPayAsset* Operation::release_pay_asset() {
-  // @@protoc_insertion_point(field_release:protocol.Operation.pay_asset)
-  
-  ::protocol::OperationPayAsset* temp = pay_asset_;
-  pay_asset_ = NULL;
-  return temp;
+
+// -------------------------------------------------------------------
+
+// Trigger_OperationTrigger
+
+// optional bytes hash = 1;
+inline void Trigger_OperationTrigger::clear_hash() {
+  hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Operation::set_allocated_pay_asset(::protocol::OperationPayAsset* pay_asset) {
-  delete pay_asset_;
-  pay_asset_ = pay_asset;
-  if (pay_asset) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.pay_asset)
+inline const ::std::string& Trigger_OperationTrigger::hash() const {
+  // @@protoc_insertion_point(field_get:protocol.Trigger.OperationTrigger.hash)
+  return hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-
-// optional .protocol.OperationSetMetadata set_metadata = 7;
-inline bool Operation::has_set_metadata() const {
-  return !_is_default_instance_ && set_metadata_ != NULL;
+inline void Trigger_OperationTrigger::set_hash(const ::std::string& value) {
+  
+  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.Trigger.OperationTrigger.hash)
 }
-inline void Operation::clear_set_metadata() {
-  if (GetArenaNoVirtual() == NULL && set_metadata_ != NULL) delete set_metadata_;
-  set_metadata_ = NULL;
+inline void Trigger_OperationTrigger::set_hash(const char* value) {
+  
+  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.Trigger.OperationTrigger.hash)
 }
-inline const ::protocol::OperationSetMetadata& Operation::set_metadata() const {
-  // @@protoc_insertion_point(field_get:protocol.Operation.set_metadata)
-  return set_metadata_ != NULL ? *set_metadata_ : *default_instance_->set_metadata_;
+inline void Trigger_OperationTrigger::set_hash(const void* value, size_t size) {
+  
+  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.Trigger.OperationTrigger.hash)
 }
-inline ::protocol::OperationSetMetadata* Operation::mutable_set_metadata() {
+inline ::std::string* Trigger_OperationTrigger::mutable_hash() {
   
-  if (set_metadata_ == NULL) {
-    set_metadata_ = new ::protocol::OperationSetMetadata;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.Operation.set_metadata)
-  return set_metadata_;
+  // @@protoc_insertion_point(field_mutable:protocol.Trigger.OperationTrigger.hash)
+  return hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::protocol::OperationSetMetadata* Operation::release_set_metadata() {
-  // @@protoc_insertion_point(field_release:protocol.Operation.set_metadata)
+inline ::std::string* Trigger_OperationTrigger::release_hash() {
+  // @@protoc_insertion_point(field_release:protocol.Trigger.OperationTrigger.hash)
   
-  ::protocol::OperationSetMetadata* temp = set_metadata_;
-  set_metadata_ = NULL;
-  return temp;
+  return hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Operation::set_allocated_set_metadata(::protocol::OperationSetMetadata* set_metadata) {
-  delete set_metadata_;
-  set_metadata_ = set_metadata;
-  if (set_metadata) {
+inline void Trigger_OperationTrigger::set_allocated_hash(::std::string* hash) {
+  if (hash != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.set_metadata)
+  hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hash);
+  // @@protoc_insertion_point(field_set_allocated:protocol.Trigger.OperationTrigger.hash)
 }
 
-// optional .protocol.OperationSetSignerWeight set_signer_weight = 8;
-inline bool Operation::has_set_signer_weight() const {
-  return !_is_default_instance_ && set_signer_weight_ != NULL;
-}
-inline void Operation::clear_set_signer_weight() {
-  if (GetArenaNoVirtual() == NULL && set_signer_weight_ != NULL) delete set_signer_weight_;
-  set_signer_weight_ = NULL;
+// optional int64 index = 2;
+inline void Trigger_OperationTrigger::clear_index() {
+  index_ = GOOGLE_LONGLONG(0);
 }
-inline const ::protocol::OperationSetSignerWeight& Operation::set_signer_weight() const {
-  // @@protoc_insertion_point(field_get:protocol.Operation.set_signer_weight)
-  return set_signer_weight_ != NULL ? *set_signer_weight_ : *default_instance_->set_signer_weight_;
+inline ::google::protobuf::int64 Trigger_OperationTrigger::index() const {
+  // @@protoc_insertion_point(field_get:protocol.Trigger.OperationTrigger.index)
+  return index_;
 }
-inline ::protocol::OperationSetSignerWeight* Operation::mutable_set_signer_weight() {
+inline void Trigger_OperationTrigger::set_index(::google::protobuf::int64 value) {
   
-  if (set_signer_weight_ == NULL) {
-    set_signer_weight_ = new ::protocol::OperationSetSignerWeight;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.Operation.set_signer_weight)
-  return set_signer_weight_;
+  index_ = value;
+  // @@protoc_insertion_point(field_set:protocol.Trigger.OperationTrigger.index)
 }
-inline ::protocol::OperationSetSignerWeight* Operation::release_set_signer_weight() {
-  // @@protoc_insertion_point(field_release:protocol.Operation.set_signer_weight)
+
+// -------------------------------------------------------------------
+
+// Trigger
+
+// optional .protocol.Trigger.TransactionType transaction_type = 1;
+inline void Trigger::clear_transaction_type() {
+  transaction_type_ = 0;
+}
+inline ::protocol::Trigger_TransactionType Trigger::transaction_type() const {
+  // @@protoc_insertion_point(field_get:protocol.Trigger.transaction_type)
+  return static_cast< ::protocol::Trigger_TransactionType >(transaction_type_);
+}
+inline void Trigger::set_transaction_type(::protocol::Trigger_TransactionType value) {
   
-  ::protocol::OperationSetSignerWeight* temp = set_signer_weight_;
-  set_signer_weight_ = NULL;
-  return temp;
+  transaction_type_ = value;
+  // @@protoc_insertion_point(field_set:protocol.Trigger.transaction_type)
 }
-inline void Operation::set_allocated_set_signer_weight(::protocol::OperationSetSignerWeight* set_signer_weight) {
-  delete set_signer_weight_;
-  set_signer_weight_ = set_signer_weight;
-  if (set_signer_weight) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.set_signer_weight)
+
+// optional int64 ledger_seq = 2;
+inline void Trigger::clear_ledger_seq() {
+  ledger_seq_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 Trigger::ledger_seq() const {
+  // @@protoc_insertion_point(field_get:protocol.Trigger.ledger_seq)
+  return ledger_seq_;
+}
+inline void Trigger::set_ledger_seq(::google::protobuf::int64 value) {
+  
+  ledger_seq_ = value;
+  // @@protoc_insertion_point(field_set:protocol.Trigger.ledger_seq)
 }
 
-// optional .protocol.OperationSetThreshold set_threshold = 9;
-inline bool Operation::has_set_threshold() const {
-  return !_is_default_instance_ && set_threshold_ != NULL;
+// optional .protocol.Trigger.OperationTrigger transaction = 3;
+inline bool Trigger::has_transaction() const {
+  return !_is_default_instance_ && transaction_ != NULL;
 }
-inline void Operation::clear_set_threshold() {
-  if (GetArenaNoVirtual() == NULL && set_threshold_ != NULL) delete set_threshold_;
-  set_threshold_ = NULL;
+inline void Trigger::clear_transaction() {
+  if (GetArenaNoVirtual() == NULL && transaction_ != NULL) delete transaction_;
+  transaction_ = NULL;
 }
-inline const ::protocol::OperationSetThreshold& Operation::set_threshold() const {
-  // @@protoc_insertion_point(field_get:protocol.Operation.set_threshold)
-  return set_threshold_ != NULL ? *set_threshold_ : *default_instance_->set_threshold_;
+inline const ::protocol::Trigger_OperationTrigger& Trigger::transaction() const {
+  // @@protoc_insertion_point(field_get:protocol.Trigger.transaction)
+  return transaction_ != NULL ? *transaction_ : *default_instance_->transaction_;
 }
-inline ::protocol::OperationSetThreshold* Operation::mutable_set_threshold() {
+inline ::protocol::Trigger_OperationTrigger* Trigger::mutable_transaction() {
   
-  if (set_threshold_ == NULL) {
-    set_threshold_ = new ::protocol::OperationSetThreshold;
+  if (transaction_ == NULL) {
+    transaction_ = new ::protocol::Trigger_OperationTrigger;
   }
-  // @@protoc_insertion_point(field_mutable:protocol.Operation.set_threshold)
-  return set_threshold_;
+  // @@protoc_insertion_point(field_mutable:protocol.Trigger.transaction)
+  return transaction_;
 }
-inline ::protocol::OperationSetThreshold* Operation::release_set_threshold() {
-  // @@protoc_insertion_point(field_release:protocol.Operation.set_threshold)
-  
-  ::protocol::OperationSetThreshold* temp = set_threshold_;
-  set_threshold_ = NULL;
+inline ::protocol::Trigger_OperationTrigger* Trigger::release_transaction() {
+  // @@protoc_insertion_point(field_release:protocol.Trigger.transaction)
+  
+  ::protocol::Trigger_OperationTrigger* temp = transaction_;
+  transaction_ = NULL;
   return temp;
 }
-inline void Operation::set_allocated_set_threshold(::protocol::OperationSetThreshold* set_threshold) {
-  delete set_threshold_;
-  set_threshold_ = set_threshold;
-  if (set_threshold) {
+inline void Trigger::set_allocated_transaction(::protocol::Trigger_OperationTrigger* transaction) {
+  delete transaction_;
+  transaction_ = transaction;
+  if (transaction) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.set_threshold)
+  // @@protoc_insertion_point(field_set_allocated:protocol.Trigger.transaction)
 }
 
-// optional .protocol.OperationPayCoin pay_coin = 10;
-inline bool Operation::has_pay_coin() const {
-  return !_is_default_instance_ && pay_coin_ != NULL;
+// -------------------------------------------------------------------
+
+// TransactionEnv
+
+// optional .protocol.Transaction transaction = 1;
+inline bool TransactionEnv::has_transaction() const {
+  return !_is_default_instance_ && transaction_ != NULL;
 }
-inline void Operation::clear_pay_coin() {
-  if (GetArenaNoVirtual() == NULL && pay_coin_ != NULL) delete pay_coin_;
-  pay_coin_ = NULL;
+inline void TransactionEnv::clear_transaction() {
+  if (GetArenaNoVirtual() == NULL && transaction_ != NULL) delete transaction_;
+  transaction_ = NULL;
 }
-inline const ::protocol::OperationPayCoin& Operation::pay_coin() const {
-  // @@protoc_insertion_point(field_get:protocol.Operation.pay_coin)
-  return pay_coin_ != NULL ? *pay_coin_ : *default_instance_->pay_coin_;
+inline const ::protocol::Transaction& TransactionEnv::transaction() const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionEnv.transaction)
+  return transaction_ != NULL ? *transaction_ : *default_instance_->transaction_;
 }
-inline ::protocol::OperationPayCoin* Operation::mutable_pay_coin() {
+inline ::protocol::Transaction* TransactionEnv::mutable_transaction() {
   
-  if (pay_coin_ == NULL) {
-    pay_coin_ = new ::protocol::OperationPayCoin;
+  if (transaction_ == NULL) {
+    transaction_ = new ::protocol::Transaction;
   }
-  // @@protoc_insertion_point(field_mutable:protocol.Operation.pay_coin)
-  return pay_coin_;
+  // @@protoc_insertion_point(field_mutable:protocol.TransactionEnv.transaction)
+  return transaction_;
 }
-inline ::protocol::OperationPayCoin* Operation::release_pay_coin() {
-  // @@protoc_insertion_point(field_release:protocol.Operation.pay_coin)
+inline ::protocol::Transaction* TransactionEnv::release_transaction() {
+  // @@protoc_insertion_point(field_release:protocol.TransactionEnv.transaction)
   
-  ::protocol::OperationPayCoin* temp = pay_coin_;
-  pay_coin_ = NULL;
+  ::protocol::Transaction* temp = transaction_;
+  transaction_ = NULL;
   return temp;
 }
-inline void Operation::set_allocated_pay_coin(::protocol::OperationPayCoin* pay_coin) {
-  delete pay_coin_;
-  pay_coin_ = pay_coin;
-  if (pay_coin) {
+inline void TransactionEnv::set_allocated_transaction(::protocol::Transaction* transaction) {
+  delete transaction_;
+  transaction_ = transaction;
+  if (transaction) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.pay_coin)
+  // @@protoc_insertion_point(field_set_allocated:protocol.TransactionEnv.transaction)
 }
 
-// optional .protocol.OperationLog log = 11;
-inline bool Operation::has_log() const {
-  return !_is_default_instance_ && log_ != NULL;
+// repeated .protocol.Signature signatures = 2;
+inline int TransactionEnv::signatures_size() const {
+  return signatures_.size();
 }
-inline void Operation::clear_log() {
-  if (GetArenaNoVirtual() == NULL && log_ != NULL) delete log_;
-  log_ = NULL;
+inline void TransactionEnv::clear_signatures() {
+  signatures_.Clear();
 }
-inline const ::protocol::OperationLog& Operation::log() const {
-  // @@protoc_insertion_point(field_get:protocol.Operation.log)
-  return log_ != NULL ? *log_ : *default_instance_->log_;
+inline const ::protocol::Signature& TransactionEnv::signatures(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionEnv.signatures)
+  return signatures_.Get(index);
 }
-inline ::protocol::OperationLog* Operation::mutable_log() {
-  
-  if (log_ == NULL) {
-    log_ = new ::protocol::OperationLog;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.Operation.log)
-  return log_;
+inline ::protocol::Signature* TransactionEnv::mutable_signatures(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.TransactionEnv.signatures)
+  return signatures_.Mutable(index);
 }
-inline ::protocol::OperationLog* Operation::release_log() {
-  // @@protoc_insertion_point(field_release:protocol.Operation.log)
-  
-  ::protocol::OperationLog* temp = log_;
-  log_ = NULL;
-  return temp;
+inline ::protocol::Signature* TransactionEnv::add_signatures() {
+  // @@protoc_insertion_point(field_add:protocol.TransactionEnv.signatures)
+  return signatures_.Add();
 }
-inline void Operation::set_allocated_log(::protocol::OperationLog* log) {
-  delete log_;
-  log_ = log;
-  if (log) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.log)
+inline ::google::protobuf::RepeatedPtrField< ::protocol::Signature >*
+TransactionEnv::mutable_signatures() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.TransactionEnv.signatures)
+  return &signatures_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protocol::Signature >&
+TransactionEnv::signatures() const {
+  // @@protoc_insertion_point(field_list:protocol.TransactionEnv.signatures)
+  return signatures_;
 }
 
-// optional .protocol.OperationSetPrivilege set_privilege = 12;
-inline bool Operation::has_set_privilege() const {
-  return !_is_default_instance_ && set_privilege_ != NULL;
+// optional .protocol.Trigger trigger = 3;
+inline bool TransactionEnv::has_trigger() const {
+  return !_is_default_instance_ && trigger_ != NULL;
 }
-inline void Operation::clear_set_privilege() {
-  if (GetArenaNoVirtual() == NULL && set_privilege_ != NULL) delete set_privilege_;
-  set_privilege_ = NULL;
+inline void TransactionEnv::clear_trigger() {
+  if (GetArenaNoVirtual() == NULL && trigger_ != NULL) delete trigger_;
+  trigger_ = NULL;
 }
-inline const ::protocol::OperationSetPrivilege& Operation::set_privilege() const {
-  // @@protoc_insertion_point(field_get:protocol.Operation.set_privilege)
-  return set_privilege_ != NULL ? *set_privilege_ : *default_instance_->set_privilege_;
+inline const ::protocol::Trigger& TransactionEnv::trigger() const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionEnv.trigger)
+  return trigger_ != NULL ? *trigger_ : *default_instance_->trigger_;
 }
-inline ::protocol::OperationSetPrivilege* Operation::mutable_set_privilege() {
+inline ::protocol::Trigger* TransactionEnv::mutable_trigger() {
   
-  if (set_privilege_ == NULL) {
-    set_privilege_ = new ::protocol::OperationSetPrivilege;
+  if (trigger_ == NULL) {
+    trigger_ = new ::protocol::Trigger;
   }
-  // @@protoc_insertion_point(field_mutable:protocol.Operation.set_privilege)
-  return set_privilege_;
+  // @@protoc_insertion_point(field_mutable:protocol.TransactionEnv.trigger)
+  return trigger_;
 }
-inline ::protocol::OperationSetPrivilege* Operation::release_set_privilege() {
-  // @@protoc_insertion_point(field_release:protocol.Operation.set_privilege)
+inline ::protocol::Trigger* TransactionEnv::release_trigger() {
+  // @@protoc_insertion_point(field_release:protocol.TransactionEnv.trigger)
   
-  ::protocol::OperationSetPrivilege* temp = set_privilege_;
-  set_privilege_ = NULL;
+  ::protocol::Trigger* temp = trigger_;
+  trigger_ = NULL;
   return temp;
 }
-inline void Operation::set_allocated_set_privilege(::protocol::OperationSetPrivilege* set_privilege) {
-  delete set_privilege_;
-  set_privilege_ = set_privilege;
-  if (set_privilege) {
+inline void TransactionEnv::set_allocated_trigger(::protocol::Trigger* trigger) {
+  delete trigger_;
+  trigger_ = trigger;
+  if (trigger) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.Operation.set_privilege)
+  // @@protoc_insertion_point(field_set_allocated:protocol.TransactionEnv.trigger)
 }
 
 // -------------------------------------------------------------------
 
-// OperationSetThreshold
+// TransactionEnvStore
 
-// optional int64 tx_threshold = 1;
-inline void OperationSetThreshold::clear_tx_threshold() {
-  tx_threshold_ = GOOGLE_LONGLONG(0);
-}
-inline ::google::protobuf::int64 OperationSetThreshold::tx_threshold() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationSetThreshold.tx_threshold)
-  return tx_threshold_;
+// optional .protocol.TransactionEnv transaction_env = 1;
+inline bool TransactionEnvStore::has_transaction_env() const {
+  return !_is_default_instance_ && transaction_env_ != NULL;
 }
-inline void OperationSetThreshold::set_tx_threshold(::google::protobuf::int64 value) {
-  
-  tx_threshold_ = value;
-  // @@protoc_insertion_point(field_set:protocol.OperationSetThreshold.tx_threshold)
+inline void TransactionEnvStore::clear_transaction_env() {
+  if (GetArenaNoVirtual() == NULL && transaction_env_ != NULL) delete transaction_env_;
+  transaction_env_ = NULL;
 }
-
-// repeated .protocol.OperationTypeThreshold type_thresholds = 2;
-inline int OperationSetThreshold::type_thresholds_size() const {
-  return type_thresholds_.size();
+inline const ::protocol::TransactionEnv& TransactionEnvStore::transaction_env() const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionEnvStore.transaction_env)
+  return transaction_env_ != NULL ? *transaction_env_ : *default_instance_->transaction_env_;
 }
-inline void OperationSetThreshold::clear_type_thresholds() {
-  type_thresholds_.Clear();
+inline ::protocol::TransactionEnv* TransactionEnvStore::mutable_transaction_env() {
+  
+  if (transaction_env_ == NULL) {
+    transaction_env_ = new ::protocol::TransactionEnv;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.TransactionEnvStore.transaction_env)
+  return transaction_env_;
 }
-inline const ::protocol::OperationTypeThreshold& OperationSetThreshold::type_thresholds(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.OperationSetThreshold.type_thresholds)
-  return type_thresholds_.Get(index);
+inline ::protocol::TransactionEnv* TransactionEnvStore::release_transaction_env() {
+  // @@protoc_insertion_point(field_release:protocol.TransactionEnvStore.transaction_env)
+  
+  ::protocol::TransactionEnv* temp = transaction_env_;
+  transaction_env_ = NULL;
+  return temp;
 }
-inline ::protocol::OperationTypeThreshold* OperationSetThreshold::mutable_type_thresholds(int index) {
-  // @@protoc_insertion_point(field_mutable:protocol.OperationSetThreshold.type_thresholds)
-  return type_thresholds_.Mutable(index);
+inline void TransactionEnvStore::set_allocated_transaction_env(::protocol::TransactionEnv* transaction_env) {
+  delete transaction_env_;
+  transaction_env_ = transaction_env;
+  if (transaction_env) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.TransactionEnvStore.transaction_env)
 }
-inline ::protocol::OperationTypeThreshold* OperationSetThreshold::add_type_thresholds() {
-  // @@protoc_insertion_point(field_add:protocol.OperationSetThreshold.type_thresholds)
-  return type_thresholds_.Add();
+
+// optional int32 error_code = 2;
+inline void TransactionEnvStore::clear_error_code() {
+  error_code_ = 0;
 }
-inline ::google::protobuf::RepeatedPtrField< ::protocol::OperationTypeThreshold >*
-OperationSetThreshold::mutable_type_thresholds() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.OperationSetThreshold.type_thresholds)
-  return &type_thresholds_;
+inline ::google::protobuf::int32 TransactionEnvStore::error_code() const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionEnvStore.error_code)
+  return error_code_;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::protocol::OperationTypeThreshold >&
-OperationSetThreshold::type_thresholds() const {
-  // @@protoc_insertion_point(field_list:protocol.OperationSetThreshold.type_thresholds)
-  return type_thresholds_;
+inline void TransactionEnvStore::set_error_code(::google::protobuf::int32 value) {
+  
+  error_code_ = value;
+  // @@protoc_insertion_point(field_set:protocol.TransactionEnvStore.error_code)
 }
 
-// -------------------------------------------------------------------
-
-// Transaction
-
-// optional string source_address = 1;
-inline void Transaction::clear_source_address() {
-  source_address_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// optional string error_desc = 3;
+inline void TransactionEnvStore::clear_error_desc() {
+  error_desc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& Transaction::source_address() const {
-  // @@protoc_insertion_point(field_get:protocol.Transaction.source_address)
-  return source_address_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::std::string& TransactionEnvStore::error_desc() const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionEnvStore.error_desc)
+  return error_desc_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Transaction::set_source_address(const ::std::string& value) {
+inline void TransactionEnvStore::set_error_desc(const ::std::string& value) {
   
-  source_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.Transaction.source_address)
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.TransactionEnvStore.error_desc)
 }
-inline void Transaction::set_source_address(const char* value) {
+inline void TransactionEnvStore::set_error_desc(const char* value) {
   
-  source_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.Transaction.source_address)
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.TransactionEnvStore.error_desc)
 }
-inline void Transaction::set_source_address(const char* value, size_t size) {
+inline void TransactionEnvStore::set_error_desc(const char* value, size_t size) {
   
-  source_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.Transaction.source_address)
+  // @@protoc_insertion_point(field_set_pointer:protocol.TransactionEnvStore.error_desc)
 }
-inline ::std::string* Transaction::mutable_source_address() {
+inline ::std::string* TransactionEnvStore::mutable_error_desc() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.Transaction.source_address)
-  return source_address_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:protocol.TransactionEnvStore.error_desc)
+  return error_desc_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* Transaction::release_source_address() {
-  // @@protoc_insertion_point(field_release:protocol.Transaction.source_address)
+inline ::std::string* TransactionEnvStore::release_error_desc() {
+  // @@protoc_insertion_point(field_release:protocol.TransactionEnvStore.error_desc)
   
-  return source_address_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return error_desc_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Transaction::set_allocated_source_address(::std::string* source_address) {
-  if (source_address != NULL) {
+inline void TransactionEnvStore::set_allocated_error_desc(::std::string* error_desc) {
+  if (error_desc != NULL) {
     
   } else {
     
   }
-  source_address_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), source_address);
-  // @@protoc_insertion_point(field_set_allocated:protocol.Transaction.source_address)
-}
-
-// optional int64 nonce = 2;
-inline void Transaction::clear_nonce() {
-  nonce_ = GOOGLE_LONGLONG(0);
-}
-inline ::google::protobuf::int64 Transaction::nonce() const {
-  // @@protoc_insertion_point(field_get:protocol.Transaction.nonce)
-  return nonce_;
-}
-inline void Transaction::set_nonce(::google::protobuf::int64 value) {
-  
-  nonce_ = value;
-  // @@protoc_insertion_point(field_set:protocol.Transaction.nonce)
-}
-
-// optional int64 fee_limit = 3;
-inline void Transaction::clear_fee_limit() {
-  fee_limit_ = GOOGLE_LONGLONG(0);
-}
-inline ::google::protobuf::int64 Transaction::fee_limit() const {
-  // @@protoc_insertion_point(field_get:protocol.Transaction.fee_limit)
-  return fee_limit_;
-}
-inline void Transaction::set_fee_limit(::google::protobuf::int64 value) {
-  
-  fee_limit_ = value;
-  // @@protoc_insertion_point(field_set:protocol.Transaction.fee_limit)
+  error_desc_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_desc);
+  // @@protoc_insertion_point(field_set_allocated:protocol.TransactionEnvStore.error_desc)
 }
 
-// optional int64 gas_price = 4;
-inline void Transaction::clear_gas_price() {
-  gas_price_ = GOOGLE_LONGLONG(0);
+// optional int64 ledger_seq = 4;
+inline void TransactionEnvStore::clear_ledger_seq() {
+  ledger_seq_ = GOOGLE_LONGLONG(0);
 }
-inline ::google::protobuf::int64 Transaction::gas_price() const {
-  // @@protoc_insertion_point(field_get:protocol.Transaction.gas_price)
-  return gas_price_;
+inline ::google::protobuf::int64 TransactionEnvStore::ledger_seq() const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionEnvStore.ledger_seq)
+  return ledger_seq_;
 }
-inline void Transaction::set_gas_price(::google::protobuf::int64 value) {
+inline void TransactionEnvStore::set_ledger_seq(::google::protobuf::int64 value) {
   
-  gas_price_ = value;
-  // @@protoc_insertion_point(field_set:protocol.Transaction.gas_price)
+  ledger_seq_ = value;
+  // @@protoc_insertion_point(field_set:protocol.TransactionEnvStore.ledger_seq)
 }
 
-// optional int64 ceil_ledger_seq = 5;
-inline void Transaction::clear_ceil_ledger_seq() {
-  ceil_ledger_seq_ = GOOGLE_LONGLONG(0);
+// optional int64 close_time = 5;
+inline void TransactionEnvStore::clear_close_time() {
+  close_time_ = GOOGLE_LONGLONG(0);
 }
-inline ::google::protobuf::int64 Transaction::ceil_ledger_seq() const {
-  // @@protoc_insertion_point(field_get:protocol.Transaction.ceil_ledger_seq)
-  return ceil_ledger_seq_;
+inline ::google::protobuf::int64 TransactionEnvStore::close_time() const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionEnvStore.close_time)
+  return close_time_;
 }
-inline void Transaction::set_ceil_ledger_seq(::google::protobuf::int64 value) {
+inline void TransactionEnvStore::set_close_time(::google::protobuf::int64 value) {
   
-  ceil_ledger_seq_ = value;
-  // @@protoc_insertion_point(field_set:protocol.Transaction.ceil_ledger_seq)
+  close_time_ = value;
+  // @@protoc_insertion_point(field_set:protocol.TransactionEnvStore.close_time)
 }
 
-// optional bytes metadata = 6;
-inline void Transaction::clear_metadata() {
-  metadata_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// optional bytes hash = 6;
+inline void TransactionEnvStore::clear_hash() {
+  hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& Transaction::metadata() const {
-  // @@protoc_insertion_point(field_get:protocol.Transaction.metadata)
-  return metadata_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::std::string& TransactionEnvStore::hash() const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionEnvStore.hash)
+  return hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Transaction::set_metadata(const ::std::string& value) {
+inline void TransactionEnvStore::set_hash(const ::std::string& value) {
   
-  metadata_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.Transaction.metadata)
+  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.TransactionEnvStore.hash)
 }
-inline void Transaction::set_metadata(const char* value) {
+inline void TransactionEnvStore::set_hash(const char* value) {
   
-  metadata_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.Transaction.metadata)
+  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.TransactionEnvStore.hash)
 }
-inline void Transaction::set_metadata(const void* value, size_t size) {
+inline void TransactionEnvStore::set_hash(const void* value, size_t size) {
   
-  metadata_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.Transaction.metadata)
+  // @@protoc_insertion_point(field_set_pointer:protocol.TransactionEnvStore.hash)
 }
-inline ::std::string* Transaction::mutable_metadata() {
+inline ::std::string* TransactionEnvStore::mutable_hash() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.Transaction.metadata)
-  return metadata_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:protocol.TransactionEnvStore.hash)
+  return hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* Transaction::release_metadata() {
-  // @@protoc_insertion_point(field_release:protocol.Transaction.metadata)
+inline ::std::string* TransactionEnvStore::release_hash() {
+  // @@protoc_insertion_point(field_release:protocol.TransactionEnvStore.hash)
   
-  return metadata_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void Transaction::set_allocated_metadata(::std::string* metadata) {
-  if (metadata != NULL) {
+inline void TransactionEnvStore::set_allocated_hash(::std::string* hash) {
+  if (hash != NULL) {
     
   } else {
     
   }
-  metadata_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), metadata);
-  // @@protoc_insertion_point(field_set_allocated:protocol.Transaction.metadata)
-}
-
-// repeated .protocol.Operation operations = 7;
-inline int Transaction::operations_size() const {
-  return operations_.size();
-}
-inline void Transaction::clear_operations() {
-  operations_.Clear();
-}
-inline const ::protocol::Operation& Transaction::operations(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.Transaction.operations)
-  return operations_.Get(index);
-}
-inline ::protocol::Operation* Transaction::mutable_operations(int index) {
-  // @@protoc_insertion_point(field_mutable:protocol.Transaction.operations)
-  return operations_.Mutable(index);
-}
-inline ::protocol::Operation* Transaction::add_operations() {
-  // @@protoc_insertion_point(field_add:protocol.Transaction.operations)
-  return operations_.Add();
-}
-inline ::google::protobuf::RepeatedPtrField< ::protocol::Operation >*
-Transaction::mutable_operations() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.Transaction.operations)
-  return &operations_;
-}
-inline const ::google::protobuf::RepeatedPtrField< ::protocol::Operation >&
-Transaction::operations() const {
-  // @@protoc_insertion_point(field_list:protocol.Transaction.operations)
-  return operations_;
+  hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hash);
+  // @@protoc_insertion_point(field_set_allocated:protocol.TransactionEnvStore.hash)
 }
 
-// optional int64 chain_id = 8;
-inline void Transaction::clear_chain_id() {
-  chain_id_ = GOOGLE_LONGLONG(0);
+// optional int64 actual_fee = 7;
+inline void TransactionEnvStore::clear_actual_fee() {
+  actual_fee_ = GOOGLE_LONGLONG(0);
 }
-inline ::google::protobuf::int64 Transaction::chain_id() const {
-  // @@protoc_insertion_point(field_get:protocol.Transaction.chain_id)
-  return chain_id_;
+inline ::google::protobuf::int64 TransactionEnvStore::actual_fee() const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionEnvStore.actual_fee)
+  return actual_fee_;
 }
-inline void Transaction::set_chain_id(::google::protobuf::int64 value) {
+inline void TransactionEnvStore::set_actual_fee(::google::protobuf::int64 value) {
   
-  chain_id_ = value;
-  // @@protoc_insertion_point(field_set:protocol.Transaction.chain_id)
+  actual_fee_ = value;
+  // @@protoc_insertion_point(field_set:protocol.TransactionEnvStore.actual_fee)
 }
 
-// -------------------------------------------------------------------
-
-// Signer
-
-// optional string address = 1;
-inline void Signer::clear_address() {
-  address_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// repeated bytes contract_tx_hashes = 8;
+inline int TransactionEnvStore::contract_tx_hashes_size() const {
+  return contract_tx_hashes_.size();
 }
-inline const ::std::string& Signer::address() const {
-  // @@protoc_insertion_point(field_get:protocol.Signer.address)
-  return address_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void TransactionEnvStore::clear_contract_tx_hashes() {
+  contract_tx_hashes_.Clear();
 }
-inline void Signer::set_address(const ::std::string& value) {
-  
-  address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.Signer.address)
+inline const ::std::string& TransactionEnvStore::contract_tx_hashes(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionEnvStore.contract_tx_hashes)
+  return contract_tx_hashes_.Get(index);
 }
-inline void Signer::set_address(const char* value) {
-  
-  address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.Signer.address)
+inline ::std::string* TransactionEnvStore::mutable_contract_tx_hashes(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.TransactionEnvStore.contract_tx_hashes)
+  return contract_tx_hashes_.Mutable(index);
 }
-inline void Signer::set_address(const char* value, size_t size) {
-  
-  address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.Signer.address)
+inline void TransactionEnvStore::set_contract_tx_hashes(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.TransactionEnvStore.contract_tx_hashes)
+  contract_tx_hashes_.Mutable(index)->assign(value);
 }
-inline ::std::string* Signer::mutable_address() {
-  
-  // @@protoc_insertion_point(field_mutable:protocol.Signer.address)
-  return address_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void TransactionEnvStore::set_contract_tx_hashes(int index, const char* value) {
+  contract_tx_hashes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.TransactionEnvStore.contract_tx_hashes)
 }
-inline ::std::string* Signer::release_address() {
-  // @@protoc_insertion_point(field_release:protocol.Signer.address)
-  
-  return address_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void TransactionEnvStore::set_contract_tx_hashes(int index, const void* value, size_t size) {
+  contract_tx_hashes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protocol.TransactionEnvStore.contract_tx_hashes)
+}
+inline ::std::string* TransactionEnvStore::add_contract_tx_hashes() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.TransactionEnvStore.contract_tx_hashes)
+  return contract_tx_hashes_.Add();
 }
-inline void Signer::set_allocated_address(::std::string* address) {
-  if (address != NULL) {
-    
-  } else {
-    
-  }
-  address_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), address);
-  // @@protoc_insertion_point(field_set_allocated:protocol.Signer.address)
+inline void TransactionEnvStore::add_contract_tx_hashes(const ::std::string& value) {
+  contract_tx_hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.TransactionEnvStore.contract_tx_hashes)
 }
-
-// optional int64 weight = 2;
-inline void Signer::clear_weight() {
-  weight_ = GOOGLE_LONGLONG(0);
+inline void TransactionEnvStore::add_contract_tx_hashes(const char* value) {
+  contract_tx_hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.TransactionEnvStore.contract_tx_hashes)
 }
-inline ::google::protobuf::int64 Signer::weight() const {
-  // @@protoc_insertion_point(field_get:protocol.Signer.weight)
-  return weight_;
+inline void TransactionEnvStore::add_contract_tx_hashes(const void* value, size_t size) {
+  contract_tx_hashes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.TransactionEnvStore.contract_tx_hashes)
 }
-inline void Signer::set_weight(::google::protobuf::int64 value) {
-  
-  weight_ = value;
-  // @@protoc_insertion_point(field_set:protocol.Signer.weight)
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TransactionEnvStore::contract_tx_hashes() const {
+  // @@protoc_insertion_point(field_list:protocol.TransactionEnvStore.contract_tx_hashes)
+  return contract_tx_hashes_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+TransactionEnvStore::mutable_contract_tx_hashes() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.TransactionEnvStore.contract_tx_hashes)
+  return &contract_tx_hashes_;
 }
 
 // -------------------------------------------------------------------
 
-// Trigger_OperationTrigger
+// TransactionEnvSet
 
-// optional bytes hash = 1;
-inline void Trigger_OperationTrigger::clear_hash() {
-  hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& Trigger_OperationTrigger::hash() const {
-  // @@protoc_insertion_point(field_get:protocol.Trigger.OperationTrigger.hash)
-  return hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void Trigger_OperationTrigger::set_hash(const ::std::string& value) {
-  
-  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.Trigger.OperationTrigger.hash)
-}
-inline void Trigger_OperationTrigger::set_hash(const char* value) {
-  
-  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.Trigger.OperationTrigger.hash)
-}
-inline void Trigger_OperationTrigger::set_hash(const void* value, size_t size) {
-  
-  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.Trigger.OperationTrigger.hash)
+// repeated .protocol.TransactionEnv txs = 2;
+inline int TransactionEnvSet::txs_size() const {
+  return txs_.size();
 }
-inline ::std::string* Trigger_OperationTrigger::mutable_hash() {
-  
-  // @@protoc_insertion_point(field_mutable:protocol.Trigger.OperationTrigger.hash)
-  return hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void TransactionEnvSet::clear_txs() {
+  txs_.Clear();
 }
-inline ::std::string* Trigger_OperationTrigger::release_hash() {
-  // @@protoc_insertion_point(field_release:protocol.Trigger.OperationTrigger.hash)
-  
-  return hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::protocol::TransactionEnv& TransactionEnvSet::txs(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionEnvSet.txs)
+  return txs_.Get(index);
 }
-inline void Trigger_OperationTrigger::set_allocated_hash(::std::string* hash) {
-  if (hash != NULL) {
-    
-  } else {
-    
-  }
-  hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hash);
-  // @@protoc_insertion_point(field_set_allocated:protocol.Trigger.OperationTrigger.hash)
+inline ::protocol::TransactionEnv* TransactionEnvSet::mutable_txs(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.TransactionEnvSet.txs)
+  return txs_.Mutable(index);
 }
-
-// optional int64 index = 2;
-inline void Trigger_OperationTrigger::clear_index() {
-  index_ = GOOGLE_LONGLONG(0);
+inline ::protocol::TransactionEnv* TransactionEnvSet::add_txs() {
+  // @@protoc_insertion_point(field_add:protocol.TransactionEnvSet.txs)
+  return txs_.Add();
 }
-inline ::google::protobuf::int64 Trigger_OperationTrigger::index() const {
-  // @@protoc_insertion_point(field_get:protocol.Trigger.OperationTrigger.index)
-  return index_;
+inline ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnv >*
+TransactionEnvSet::mutable_txs() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.TransactionEnvSet.txs)
+  return &txs_;
 }
-inline void Trigger_OperationTrigger::set_index(::google::protobuf::int64 value) {
-  
-  index_ = value;
-  // @@protoc_insertion_point(field_set:protocol.Trigger.OperationTrigger.index)
+inline const ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnv >&
+TransactionEnvSet::txs() const {
+  // @@protoc_insertion_point(field_list:protocol.TransactionEnvSet.txs)
+  return txs_;
 }
 
 // -------------------------------------------------------------------
 
-// Trigger
+// ConsensusValueValidation
 
-// optional .protocol.Trigger.TransactionType transaction_type = 1;
-inline void Trigger::clear_transaction_type() {
-  transaction_type_ = 0;
+// repeated int32 expire_tx_ids = 1;
+inline int ConsensusValueValidation::expire_tx_ids_size() const {
+  return expire_tx_ids_.size();
 }
-inline ::protocol::Trigger_TransactionType Trigger::transaction_type() const {
-  // @@protoc_insertion_point(field_get:protocol.Trigger.transaction_type)
-  return static_cast< ::protocol::Trigger_TransactionType >(transaction_type_);
+inline void ConsensusValueValidation::clear_expire_tx_ids() {
+  expire_tx_ids_.Clear();
 }
-inline void Trigger::set_transaction_type(::protocol::Trigger_TransactionType value) {
-  
-  transaction_type_ = value;
-  // @@protoc_insertion_point(field_set:protocol.Trigger.transaction_type)
+inline ::google::protobuf::int32 ConsensusValueValidation::expire_tx_ids(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.ConsensusValueValidation.expire_tx_ids)
+  return expire_tx_ids_.Get(index);
+}
+inline void ConsensusValueValidation::set_expire_tx_ids(int index, ::google::protobuf::int32 value) {
+  expire_tx_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protocol.ConsensusValueValidation.expire_tx_ids)
+}
+inline void ConsensusValueValidation::add_expire_tx_ids(::google::protobuf::int32 value) {
+  expire_tx_ids_.Add(value);
+  // @@protoc_insertion_point(field_add:protocol.ConsensusValueValidation.expire_tx_ids)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+ConsensusValueValidation::expire_tx_ids() const {
+  // @@protoc_insertion_point(field_list:protocol.ConsensusValueValidation.expire_tx_ids)
+  return expire_tx_ids_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+ConsensusValueValidation::mutable_expire_tx_ids() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.ConsensusValueValidation.expire_tx_ids)
+  return &expire_tx_ids_;
 }
 
-// optional int64 ledger_seq = 2;
-inline void Trigger::clear_ledger_seq() {
-  ledger_seq_ = GOOGLE_LONGLONG(0);
+// repeated int32 error_tx_ids = 2;
+inline int ConsensusValueValidation::error_tx_ids_size() const {
+  return error_tx_ids_.size();
 }
-inline ::google::protobuf::int64 Trigger::ledger_seq() const {
-  // @@protoc_insertion_point(field_get:protocol.Trigger.ledger_seq)
-  return ledger_seq_;
+inline void ConsensusValueValidation::clear_error_tx_ids() {
+  error_tx_ids_.Clear();
 }
-inline void Trigger::set_ledger_seq(::google::protobuf::int64 value) {
-  
-  ledger_seq_ = value;
-  // @@protoc_insertion_point(field_set:protocol.Trigger.ledger_seq)
+inline ::google::protobuf::int32 ConsensusValueValidation::error_tx_ids(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.ConsensusValueValidation.error_tx_ids)
+  return error_tx_ids_.Get(index);
+}
+inline void ConsensusValueValidation::set_error_tx_ids(int index, ::google::protobuf::int32 value) {
+  error_tx_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protocol.ConsensusValueValidation.error_tx_ids)
+}
+inline void ConsensusValueValidation::add_error_tx_ids(::google::protobuf::int32 value) {
+  error_tx_ids_.Add(value);
+  // @@protoc_insertion_point(field_add:protocol.ConsensusValueValidation.error_tx_ids)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+ConsensusValueValidation::error_tx_ids() const {
+  // @@protoc_insertion_point(field_list:protocol.ConsensusValueValidation.error_tx_ids)
+  return error_tx_ids_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+ConsensusValueValidation::mutable_error_tx_ids() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.ConsensusValueValidation.error_tx_ids)
+  return &error_tx_ids_;
 }
 
-// optional .protocol.Trigger.OperationTrigger transaction = 3;
-inline bool Trigger::has_transaction() const {
-  return !_is_default_instance_ && transaction_ != NULL;
+// -------------------------------------------------------------------
+
+// ConsensusValue
+
+// optional .protocol.TransactionEnvSet txset = 1;
+inline bool ConsensusValue::has_txset() const {
+  return !_is_default_instance_ && txset_ != NULL;
 }
-inline void Trigger::clear_transaction() {
-  if (GetArenaNoVirtual() == NULL && transaction_ != NULL) delete transaction_;
-  transaction_ = NULL;
+inline void ConsensusValue::clear_txset() {
+  if (GetArenaNoVirtual() == NULL && txset_ != NULL) delete txset_;
+  txset_ = NULL;
 }
-inline const ::protocol::Trigger_OperationTrigger& Trigger::transaction() const {
-  // @@protoc_insertion_point(field_get:protocol.Trigger.transaction)
-  return transaction_ != NULL ? *transaction_ : *default_instance_->transaction_;
+inline const ::protocol::TransactionEnvSet& ConsensusValue::txset() const {
+  // @@protoc_insertion_point(field_get:protocol.ConsensusValue.txset)
+  return txset_ != NULL ? *txset_ : *default_instance_->txset_;
 }
-inline ::protocol::Trigger_OperationTrigger* Trigger::mutable_transaction() {
+inline ::protocol::TransactionEnvSet* ConsensusValue::mutable_txset() {
   
-  if (transaction_ == NULL) {
-    transaction_ = new ::protocol::Trigger_OperationTrigger;
+  if (txset_ == NULL) {
+    txset_ = new ::protocol::TransactionEnvSet;
   }
-  // @@protoc_insertion_point(field_mutable:protocol.Trigger.transaction)
-  return transaction_;
+  // @@protoc_insertion_point(field_mutable:protocol.ConsensusValue.txset)
+  return txset_;
 }
-inline ::protocol::Trigger_OperationTrigger* Trigger::release_transaction() {
-  // @@protoc_insertion_point(field_release:protocol.Trigger.transaction)
+inline ::protocol::TransactionEnvSet* ConsensusValue::release_txset() {
+  // @@protoc_insertion_point(field_release:protocol.ConsensusValue.txset)
   
-  ::protocol::Trigger_OperationTrigger* temp = transaction_;
-  transaction_ = NULL;
+  ::protocol::TransactionEnvSet* temp = txset_;
+  txset_ = NULL;
   return temp;
 }
-inline void Trigger::set_allocated_transaction(::protocol::Trigger_OperationTrigger* transaction) {
-  delete transaction_;
-  transaction_ = transaction;
-  if (transaction) {
+inline void ConsensusValue::set_allocated_txset(::protocol::TransactionEnvSet* txset) {
+  delete txset_;
+  txset_ = txset;
+  if (txset) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.Trigger.transaction)
+  // @@protoc_insertion_point(field_set_allocated:protocol.ConsensusValue.txset)
 }
 
-// -------------------------------------------------------------------
-
-// TransactionEnv
+// optional int64 close_time = 2;
+inline void ConsensusValue::clear_close_time() {
+  close_time_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 ConsensusValue::close_time() const {
+  // @@protoc_insertion_point(field_get:protocol.ConsensusValue.close_time)
+  return close_time_;
+}
+inline void ConsensusValue::set_close_time(::google::protobuf::int64 value) {
+  
+  close_time_ = value;
+  // @@protoc_insertion_point(field_set:protocol.ConsensusValue.close_time)
+}
 
-// optional .protocol.Transaction transaction = 1;
-inline bool TransactionEnv::has_transaction() const {
-  return !_is_default_instance_ && transaction_ != NULL;
+// optional bytes previous_proof = 3;
+inline void ConsensusValue::clear_previous_proof() {
+  previous_proof_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void TransactionEnv::clear_transaction() {
-  if (GetArenaNoVirtual() == NULL && transaction_ != NULL) delete transaction_;
-  transaction_ = NULL;
+inline const ::std::string& ConsensusValue::previous_proof() const {
+  // @@protoc_insertion_point(field_get:protocol.ConsensusValue.previous_proof)
+  return previous_proof_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::protocol::Transaction& TransactionEnv::transaction() const {
-  // @@protoc_insertion_point(field_get:protocol.TransactionEnv.transaction)
-  return transaction_ != NULL ? *transaction_ : *default_instance_->transaction_;
+inline void ConsensusValue::set_previous_proof(const ::std::string& value) {
+  
+  previous_proof_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.ConsensusValue.previous_proof)
 }
-inline ::protocol::Transaction* TransactionEnv::mutable_transaction() {
+inline void ConsensusValue::set_previous_proof(const char* value) {
   
-  if (transaction_ == NULL) {
-    transaction_ = new ::protocol::Transaction;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.TransactionEnv.transaction)
-  return transaction_;
+  previous_proof_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.ConsensusValue.previous_proof)
 }
-inline ::protocol::Transaction* TransactionEnv::release_transaction() {
-  // @@protoc_insertion_point(field_release:protocol.TransactionEnv.transaction)
+inline void ConsensusValue::set_previous_proof(const void* value, size_t size) {
   
-  ::protocol::Transaction* temp = transaction_;
-  transaction_ = NULL;
-  return temp;
+  previous_proof_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.ConsensusValue.previous_proof)
 }
-inline void TransactionEnv::set_allocated_transaction(::protocol::Transaction* transaction) {
-  delete transaction_;
-  transaction_ = transaction;
-  if (transaction) {
+inline ::std::string* ConsensusValue::mutable_previous_proof() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.ConsensusValue.previous_proof)
+  return previous_proof_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* ConsensusValue::release_previous_proof() {
+  // @@protoc_insertion_point(field_release:protocol.ConsensusValue.previous_proof)
+  
+  return previous_proof_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void ConsensusValue::set_allocated_previous_proof(::std::string* previous_proof) {
+  if (previous_proof != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.TransactionEnv.transaction)
+  previous_proof_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), previous_proof);
+  // @@protoc_insertion_point(field_set_allocated:protocol.ConsensusValue.previous_proof)
 }
 
-// repeated .protocol.Signature signatures = 2;
-inline int TransactionEnv::signatures_size() const {
-  return signatures_.size();
-}
-inline void TransactionEnv::clear_signatures() {
-  signatures_.Clear();
-}
-inline const ::protocol::Signature& TransactionEnv::signatures(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.TransactionEnv.signatures)
-  return signatures_.Get(index);
+// optional int64 ledger_seq = 4;
+inline void ConsensusValue::clear_ledger_seq() {
+  ledger_seq_ = GOOGLE_LONGLONG(0);
 }
-inline ::protocol::Signature* TransactionEnv::mutable_signatures(int index) {
-  // @@protoc_insertion_point(field_mutable:protocol.TransactionEnv.signatures)
-  return signatures_.Mutable(index);
+inline ::google::protobuf::int64 ConsensusValue::ledger_seq() const {
+  // @@protoc_insertion_point(field_get:protocol.ConsensusValue.ledger_seq)
+  return ledger_seq_;
 }
-inline ::protocol::Signature* TransactionEnv::add_signatures() {
-  // @@protoc_insertion_point(field_add:protocol.TransactionEnv.signatures)
-  return signatures_.Add();
+inline void ConsensusValue::set_ledger_seq(::google::protobuf::int64 value) {
+  
+  ledger_seq_ = value;
+  // @@protoc_insertion_point(field_set:protocol.ConsensusValue.ledger_seq)
 }
-inline ::google::protobuf::RepeatedPtrField< ::protocol::Signature >*
-TransactionEnv::mutable_signatures() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.TransactionEnv.signatures)
-  return &signatures_;
+
+// optional bytes previous_ledger_hash = 5;
+inline void ConsensusValue::clear_previous_ledger_hash() {
+  previous_ledger_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::google::protobuf::RepeatedPtrField< ::protocol::Signature >&
-TransactionEnv::signatures() const {
-  // @@protoc_insertion_point(field_list:protocol.TransactionEnv.signatures)
-  return signatures_;
+inline const ::std::string& ConsensusValue::previous_ledger_hash() const {
+  // @@protoc_insertion_point(field_get:protocol.ConsensusValue.previous_ledger_hash)
+  return previous_ledger_hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-
-// optional .protocol.Trigger trigger = 3;
-inline bool TransactionEnv::has_trigger() const {
-  return !_is_default_instance_ && trigger_ != NULL;
+inline void ConsensusValue::set_previous_ledger_hash(const ::std::string& value) {
+  
+  previous_ledger_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.ConsensusValue.previous_ledger_hash)
 }
-inline void TransactionEnv::clear_trigger() {
-  if (GetArenaNoVirtual() == NULL && trigger_ != NULL) delete trigger_;
-  trigger_ = NULL;
+inline void ConsensusValue::set_previous_ledger_hash(const char* value) {
+  
+  previous_ledger_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.ConsensusValue.previous_ledger_hash)
 }
-inline const ::protocol::Trigger& TransactionEnv::trigger() const {
-  // @@protoc_insertion_point(field_get:protocol.TransactionEnv.trigger)
-  return trigger_ != NULL ? *trigger_ : *default_instance_->trigger_;
+inline void ConsensusValue::set_previous_ledger_hash(const void* value, size_t size) {
+  
+  previous_ledger_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.ConsensusValue.previous_ledger_hash)
 }
-inline ::protocol::Trigger* TransactionEnv::mutable_trigger() {
+inline ::std::string* ConsensusValue::mutable_previous_ledger_hash() {
   
-  if (trigger_ == NULL) {
-    trigger_ = new ::protocol::Trigger;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.TransactionEnv.trigger)
-  return trigger_;
+  // @@protoc_insertion_point(field_mutable:protocol.ConsensusValue.previous_ledger_hash)
+  return previous_ledger_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::protocol::Trigger* TransactionEnv::release_trigger() {
-  // @@protoc_insertion_point(field_release:protocol.TransactionEnv.trigger)
+inline ::std::string* ConsensusValue::release_previous_ledger_hash() {
+  // @@protoc_insertion_point(field_release:protocol.ConsensusValue.previous_ledger_hash)
   
-  ::protocol::Trigger* temp = trigger_;
-  trigger_ = NULL;
-  return temp;
+  return previous_ledger_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void TransactionEnv::set_allocated_trigger(::protocol::Trigger* trigger) {
-  delete trigger_;
-  trigger_ = trigger;
-  if (trigger) {
+inline void ConsensusValue::set_allocated_previous_ledger_hash(::std::string* previous_ledger_hash) {
+  if (previous_ledger_hash != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.TransactionEnv.trigger)
+  previous_ledger_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), previous_ledger_hash);
+  // @@protoc_insertion_point(field_set_allocated:protocol.ConsensusValue.previous_ledger_hash)
 }
 
-// -------------------------------------------------------------------
-
-// TransactionEnvStore
-
-// optional .protocol.TransactionEnv transaction_env = 1;
-inline bool TransactionEnvStore::has_transaction_env() const {
-  return !_is_default_instance_ && transaction_env_ != NULL;
+// optional .protocol.LedgerUpgrade ledger_upgrade = 6;
+inline bool ConsensusValue::has_ledger_upgrade() const {
+  return !_is_default_instance_ && ledger_upgrade_ != NULL;
 }
-inline void TransactionEnvStore::clear_transaction_env() {
-  if (GetArenaNoVirtual() == NULL && transaction_env_ != NULL) delete transaction_env_;
-  transaction_env_ = NULL;
+inline void ConsensusValue::clear_ledger_upgrade() {
+  if (GetArenaNoVirtual() == NULL && ledger_upgrade_ != NULL) delete ledger_upgrade_;
+  ledger_upgrade_ = NULL;
 }
-inline const ::protocol::TransactionEnv& TransactionEnvStore::transaction_env() const {
-  // @@protoc_insertion_point(field_get:protocol.TransactionEnvStore.transaction_env)
-  return transaction_env_ != NULL ? *transaction_env_ : *default_instance_->transaction_env_;
+inline const ::protocol::LedgerUpgrade& ConsensusValue::ledger_upgrade() const {
+  // @@protoc_insertion_point(field_get:protocol.ConsensusValue.ledger_upgrade)
+  return ledger_upgrade_ != NULL ? *ledger_upgrade_ : *default_instance_->ledger_upgrade_;
 }
-inline ::protocol::TransactionEnv* TransactionEnvStore::mutable_transaction_env() {
+inline ::protocol::LedgerUpgrade* ConsensusValue::mutable_ledger_upgrade() {
   
-  if (transaction_env_ == NULL) {
-    transaction_env_ = new ::protocol::TransactionEnv;
+  if (ledger_upgrade_ == NULL) {
+    ledger_upgrade_ = new ::protocol::LedgerUpgrade;
   }
-  // @@protoc_insertion_point(field_mutable:protocol.TransactionEnvStore.transaction_env)
-  return transaction_env_;
+  // @@protoc_insertion_point(field_mutable:protocol.ConsensusValue.ledger_upgrade)
+  return ledger_upgrade_;
 }
-inline ::protocol::TransactionEnv* TransactionEnvStore::release_transaction_env() {
-  // @@protoc_insertion_point(field_release:protocol.TransactionEnvStore.transaction_env)
+inline ::protocol::LedgerUpgrade* ConsensusValue::release_ledger_upgrade() {
+  // @@protoc_insertion_point(field_release:protocol.ConsensusValue.ledger_upgrade)
   
-  ::protocol::TransactionEnv* temp = transaction_env_;
-  transaction_env_ = NULL;
+  ::protocol::LedgerUpgrade* temp = ledger_upgrade_;
+  ledger_upgrade_ = NULL;
   return temp;
 }
-inline void TransactionEnvStore::set_allocated_transaction_env(::protocol::TransactionEnv* transaction_env) {
-  delete transaction_env_;
-  transaction_env_ = transaction_env;
-  if (transaction_env) {
+inline void ConsensusValue::set_allocated_ledger_upgrade(::protocol::LedgerUpgrade* ledger_upgrade) {
+  delete ledger_upgrade_;
+  ledger_upgrade_ = ledger_upgrade;
+  if (ledger_upgrade) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.TransactionEnvStore.transaction_env)
-}
-
-// optional int32 error_code = 2;
-inline void TransactionEnvStore::clear_error_code() {
-  error_code_ = 0;
-}
-inline ::google::protobuf::int32 TransactionEnvStore::error_code() const {
-  // @@protoc_insertion_point(field_get:protocol.TransactionEnvStore.error_code)
-  return error_code_;
-}
-inline void TransactionEnvStore::set_error_code(::google::protobuf::int32 value) {
-  
-  error_code_ = value;
-  // @@protoc_insertion_point(field_set:protocol.TransactionEnvStore.error_code)
+  // @@protoc_insertion_point(field_set_allocated:protocol.ConsensusValue.ledger_upgrade)
 }
 
-// optional string error_desc = 3;
-inline void TransactionEnvStore::clear_error_desc() {
-  error_desc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& TransactionEnvStore::error_desc() const {
-  // @@protoc_insertion_point(field_get:protocol.TransactionEnvStore.error_desc)
-  return error_desc_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void TransactionEnvStore::set_error_desc(const ::std::string& value) {
-  
-  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.TransactionEnvStore.error_desc)
+// optional .protocol.ConsensusValueValidation validation = 7;
+inline bool ConsensusValue::has_validation() const {
+  return !_is_default_instance_ && validation_ != NULL;
 }
-inline void TransactionEnvStore::set_error_desc(const char* value) {
-  
-  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.TransactionEnvStore.error_desc)
+inline void ConsensusValue::clear_validation() {
+  if (GetArenaNoVirtual() == NULL && validation_ != NULL) delete validation_;
+  validation_ = NULL;
 }
-inline void TransactionEnvStore::set_error_desc(const char* value, size_t size) {
-  
-  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.TransactionEnvStore.error_desc)
+inline const ::protocol::ConsensusValueValidation& ConsensusValue::validation() const {
+  // @@protoc_insertion_point(field_get:protocol.ConsensusValue.validation)
+  return validation_ != NULL ? *validation_ : *default_instance_->validation_;
 }
-inline ::std::string* TransactionEnvStore::mutable_error_desc() {
+inline ::protocol::ConsensusValueValidation* ConsensusValue::mutable_validation() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.TransactionEnvStore.error_desc)
-  return error_desc_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (validation_ == NULL) {
+    validation_ = new ::protocol::ConsensusValueValidation;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.ConsensusValue.validation)
+  return validation_;
 }
-inline ::std::string* TransactionEnvStore::release_error_desc() {
-  // @@protoc_insertion_point(field_release:protocol.TransactionEnvStore.error_desc)
+inline ::protocol::ConsensusValueValidation* ConsensusValue::release_validation() {
+  // @@protoc_insertion_point(field_release:protocol.ConsensusValue.validation)
   
-  return error_desc_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void TransactionEnvStore::set_allocated_error_desc(::std::string* error_desc) {
-  if (error_desc != NULL) {
+  ::protocol::ConsensusValueValidation* temp = validation_;
+  validation_ = NULL;
+  return temp;
+}
+inline void ConsensusValue::set_allocated_validation(::protocol::ConsensusValueValidation* validation) {
+  delete validation_;
+  validation_ = validation;
+  if (validation) {
     
   } else {
     
   }
-  error_desc_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_desc);
-  // @@protoc_insertion_point(field_set_allocated:protocol.TransactionEnvStore.error_desc)
+  // @@protoc_insertion_point(field_set_allocated:protocol.ConsensusValue.validation)
 }
 
-// optional int64 ledger_seq = 4;
-inline void TransactionEnvStore::clear_ledger_seq() {
-  ledger_seq_ = GOOGLE_LONGLONG(0);
-}
-inline ::google::protobuf::int64 TransactionEnvStore::ledger_seq() const {
-  // @@protoc_insertion_point(field_get:protocol.TransactionEnvStore.ledger_seq)
-  return ledger_seq_;
-}
-inline void TransactionEnvStore::set_ledger_seq(::google::protobuf::int64 value) {
-  
-  ledger_seq_ = value;
-  // @@protoc_insertion_point(field_set:protocol.TransactionEnvStore.ledger_seq)
-}
+// -------------------------------------------------------------------
 
-// optional int64 close_time = 5;
-inline void TransactionEnvStore::clear_close_time() {
-  close_time_ = GOOGLE_LONGLONG(0);
+// Contract
+
+// optional .protocol.Contract.ContractType type = 1;
+inline void Contract::clear_type() {
+  type_ = 0;
 }
-inline ::google::protobuf::int64 TransactionEnvStore::close_time() const {
-  // @@protoc_insertion_point(field_get:protocol.TransactionEnvStore.close_time)
-  return close_time_;
+inline ::protocol::Contract_ContractType Contract::type() const {
+  // @@protoc_insertion_point(field_get:protocol.Contract.type)
+  return static_cast< ::protocol::Contract_ContractType >(type_);
 }
-inline void TransactionEnvStore::set_close_time(::google::protobuf::int64 value) {
+inline void Contract::set_type(::protocol::Contract_ContractType value) {
   
-  close_time_ = value;
-  // @@protoc_insertion_point(field_set:protocol.TransactionEnvStore.close_time)
+  type_ = value;
+  // @@protoc_insertion_point(field_set:protocol.Contract.type)
 }
 
-// optional bytes hash = 6;
-inline void TransactionEnvStore::clear_hash() {
-  hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// optional string payload = 2;
+inline void Contract::clear_payload() {
+  payload_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& TransactionEnvStore::hash() const {
-  // @@protoc_insertion_point(field_get:protocol.TransactionEnvStore.hash)
-  return hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::std::string& Contract::payload() const {
+  // @@protoc_insertion_point(field_get:protocol.Contract.payload)
+  return payload_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void TransactionEnvStore::set_hash(const ::std::string& value) {
+inline void Contract::set_payload(const ::std::string& value) {
   
-  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.TransactionEnvStore.hash)
+  payload_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.Contract.payload)
 }
-inline void TransactionEnvStore::set_hash(const char* value) {
+inline void Contract::set_payload(const char* value) {
   
-  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.TransactionEnvStore.hash)
+  payload_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.Contract.payload)
 }
-inline void TransactionEnvStore::set_hash(const void* value, size_t size) {
+inline void Contract::set_payload(const char* value, size_t size) {
   
-  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  payload_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.TransactionEnvStore.hash)
+  // @@protoc_insertion_point(field_set_pointer:protocol.Contract.payload)
 }
-inline ::std::string* TransactionEnvStore::mutable_hash() {
+inline ::std::string* Contract::mutable_payload() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.TransactionEnvStore.hash)
-  return hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:protocol.Contract.payload)
+  return payload_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* TransactionEnvStore::release_hash() {
-  // @@protoc_insertion_point(field_release:protocol.TransactionEnvStore.hash)
+inline ::std::string* Contract::release_payload() {
+  // @@protoc_insertion_point(field_release:protocol.Contract.payload)
   
-  return hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return payload_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void TransactionEnvStore::set_allocated_hash(::std::string* hash) {
-  if (hash != NULL) {
+inline void Contract::set_allocated_payload(::std::string* payload) {
+  if (payload != NULL) {
     
   } else {
     
   }
-  hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hash);
-  // @@protoc_insertion_point(field_set_allocated:protocol.TransactionEnvStore.hash)
+  payload_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), payload);
+  // @@protoc_insertion_point(field_set_allocated:protocol.Contract.payload)
 }
 
-// optional int64 actual_fee = 7;
-inline void TransactionEnvStore::clear_actual_fee() {
-  actual_fee_ = GOOGLE_LONGLONG(0);
+// -------------------------------------------------------------------
+
+// OperationCreateAccount
+
+// optional string dest_address = 1;
+inline void OperationCreateAccount::clear_dest_address() {
+  dest_address_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::google::protobuf::int64 TransactionEnvStore::actual_fee() const {
-  // @@protoc_insertion_point(field_get:protocol.TransactionEnvStore.actual_fee)
-  return actual_fee_;
+inline const ::std::string& OperationCreateAccount::dest_address() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationCreateAccount.dest_address)
+  return dest_address_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void TransactionEnvStore::set_actual_fee(::google::protobuf::int64 value) {
+inline void OperationCreateAccount::set_dest_address(const ::std::string& value) {
   
-  actual_fee_ = value;
-  // @@protoc_insertion_point(field_set:protocol.TransactionEnvStore.actual_fee)
+  dest_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.OperationCreateAccount.dest_address)
 }
-
-// repeated bytes contract_tx_hashes = 8;
-inline int TransactionEnvStore::contract_tx_hashes_size() const {
-  return contract_tx_hashes_.size();
+inline void OperationCreateAccount::set_dest_address(const char* value) {
+  
+  dest_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.OperationCreateAccount.dest_address)
 }
-inline void TransactionEnvStore::clear_contract_tx_hashes() {
-  contract_tx_hashes_.Clear();
+inline void OperationCreateAccount::set_dest_address(const char* value, size_t size) {
+  
+  dest_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.OperationCreateAccount.dest_address)
 }
-inline const ::std::string& TransactionEnvStore::contract_tx_hashes(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.TransactionEnvStore.contract_tx_hashes)
-  return contract_tx_hashes_.Get(index);
+inline ::std::string* OperationCreateAccount::mutable_dest_address() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.OperationCreateAccount.dest_address)
+  return dest_address_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* TransactionEnvStore::mutable_contract_tx_hashes(int index) {
-  // @@protoc_insertion_point(field_mutable:protocol.TransactionEnvStore.contract_tx_hashes)
-  return contract_tx_hashes_.Mutable(index);
+inline ::std::string* OperationCreateAccount::release_dest_address() {
+  // @@protoc_insertion_point(field_release:protocol.OperationCreateAccount.dest_address)
+  
+  return dest_address_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void TransactionEnvStore::set_contract_tx_hashes(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:protocol.TransactionEnvStore.contract_tx_hashes)
-  contract_tx_hashes_.Mutable(index)->assign(value);
+inline void OperationCreateAccount::set_allocated_dest_address(::std::string* dest_address) {
+  if (dest_address != NULL) {
+    
+  } else {
+    
+  }
+  dest_address_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), dest_address);
+  // @@protoc_insertion_point(field_set_allocated:protocol.OperationCreateAccount.dest_address)
 }
-inline void TransactionEnvStore::set_contract_tx_hashes(int index, const char* value) {
-  contract_tx_hashes_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:protocol.TransactionEnvStore.contract_tx_hashes)
+
+// optional .protocol.Contract contract = 2;
+inline bool OperationCreateAccount::has_contract() const {
+  return !_is_default_instance_ && contract_ != NULL;
 }
-inline void TransactionEnvStore::set_contract_tx_hashes(int index, const void* value, size_t size) {
-  contract_tx_hashes_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:protocol.TransactionEnvStore.contract_tx_hashes)
+inline void OperationCreateAccount::clear_contract() {
+  if (GetArenaNoVirtual() == NULL && contract_ != NULL) delete contract_;
+  contract_ = NULL;
 }
-inline ::std::string* TransactionEnvStore::add_contract_tx_hashes() {
-  // @@protoc_insertion_point(field_add_mutable:protocol.TransactionEnvStore.contract_tx_hashes)
-  return contract_tx_hashes_.Add();
+inline const ::protocol::Contract& OperationCreateAccount::contract() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationCreateAccount.contract)
+  return contract_ != NULL ? *contract_ : *default_instance_->contract_;
 }
-inline void TransactionEnvStore::add_contract_tx_hashes(const ::std::string& value) {
-  contract_tx_hashes_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:protocol.TransactionEnvStore.contract_tx_hashes)
+inline ::protocol::Contract* OperationCreateAccount::mutable_contract() {
+  
+  if (contract_ == NULL) {
+    contract_ = new ::protocol::Contract;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.OperationCreateAccount.contract)
+  return contract_;
 }
-inline void TransactionEnvStore::add_contract_tx_hashes(const char* value) {
-  contract_tx_hashes_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:protocol.TransactionEnvStore.contract_tx_hashes)
+inline ::protocol::Contract* OperationCreateAccount::release_contract() {
+  // @@protoc_insertion_point(field_release:protocol.OperationCreateAccount.contract)
+  
+  ::protocol::Contract* temp = contract_;
+  contract_ = NULL;
+  return temp;
 }
-inline void TransactionEnvStore::add_contract_tx_hashes(const void* value, size_t size) {
-  contract_tx_hashes_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:protocol.TransactionEnvStore.contract_tx_hashes)
+inline void OperationCreateAccount::set_allocated_contract(::protocol::Contract* contract) {
+  delete contract_;
+  contract_ = contract;
+  if (contract) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.OperationCreateAccount.contract)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
-TransactionEnvStore::contract_tx_hashes() const {
-  // @@protoc_insertion_point(field_list:protocol.TransactionEnvStore.contract_tx_hashes)
-  return contract_tx_hashes_;
+
+// optional .protocol.AccountPrivilege priv = 3;
+inline bool OperationCreateAccount::has_priv() const {
+  return !_is_default_instance_ && priv_ != NULL;
 }
-inline ::google::protobuf::RepeatedPtrField< ::std::string>*
-TransactionEnvStore::mutable_contract_tx_hashes() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.TransactionEnvStore.contract_tx_hashes)
-  return &contract_tx_hashes_;
+inline void OperationCreateAccount::clear_priv() {
+  if (GetArenaNoVirtual() == NULL && priv_ != NULL) delete priv_;
+  priv_ = NULL;
 }
-
-// -------------------------------------------------------------------
-
-// TransactionEnvSet
-
-// repeated .protocol.TransactionEnv txs = 2;
-inline int TransactionEnvSet::txs_size() const {
-  return txs_.size();
+inline const ::protocol::AccountPrivilege& OperationCreateAccount::priv() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationCreateAccount.priv)
+  return priv_ != NULL ? *priv_ : *default_instance_->priv_;
 }
-inline void TransactionEnvSet::clear_txs() {
-  txs_.Clear();
+inline ::protocol::AccountPrivilege* OperationCreateAccount::mutable_priv() {
+  
+  if (priv_ == NULL) {
+    priv_ = new ::protocol::AccountPrivilege;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.OperationCreateAccount.priv)
+  return priv_;
 }
-inline const ::protocol::TransactionEnv& TransactionEnvSet::txs(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.TransactionEnvSet.txs)
-  return txs_.Get(index);
+inline ::protocol::AccountPrivilege* OperationCreateAccount::release_priv() {
+  // @@protoc_insertion_point(field_release:protocol.OperationCreateAccount.priv)
+  
+  ::protocol::AccountPrivilege* temp = priv_;
+  priv_ = NULL;
+  return temp;
 }
-inline ::protocol::TransactionEnv* TransactionEnvSet::mutable_txs(int index) {
-  // @@protoc_insertion_point(field_mutable:protocol.TransactionEnvSet.txs)
-  return txs_.Mutable(index);
+inline void OperationCreateAccount::set_allocated_priv(::protocol::AccountPrivilege* priv) {
+  delete priv_;
+  priv_ = priv;
+  if (priv) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.OperationCreateAccount.priv)
 }
-inline ::protocol::TransactionEnv* TransactionEnvSet::add_txs() {
-  // @@protoc_insertion_point(field_add:protocol.TransactionEnvSet.txs)
-  return txs_.Add();
+
+// repeated .protocol.KeyPair metadatas = 4;
+inline int OperationCreateAccount::metadatas_size() const {
+  return metadatas_.size();
 }
-inline ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnv >*
-TransactionEnvSet::mutable_txs() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.TransactionEnvSet.txs)
-  return &txs_;
+inline void OperationCreateAccount::clear_metadatas() {
+  metadatas_.Clear();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnv >&
-TransactionEnvSet::txs() const {
-  // @@protoc_insertion_point(field_list:protocol.TransactionEnvSet.txs)
-  return txs_;
+inline const ::protocol::KeyPair& OperationCreateAccount::metadatas(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.OperationCreateAccount.metadatas)
+  return metadatas_.Get(index);
 }
-
-// -------------------------------------------------------------------
-
-// ConsensusValueValidation
-
-// repeated int32 expire_tx_ids = 1;
-inline int ConsensusValueValidation::expire_tx_ids_size() const {
-  return expire_tx_ids_.size();
+inline ::protocol::KeyPair* OperationCreateAccount::mutable_metadatas(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.OperationCreateAccount.metadatas)
+  return metadatas_.Mutable(index);
 }
-inline void ConsensusValueValidation::clear_expire_tx_ids() {
-  expire_tx_ids_.Clear();
+inline ::protocol::KeyPair* OperationCreateAccount::add_metadatas() {
+  // @@protoc_insertion_point(field_add:protocol.OperationCreateAccount.metadatas)
+  return metadatas_.Add();
 }
-inline ::google::protobuf::int32 ConsensusValueValidation::expire_tx_ids(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.ConsensusValueValidation.expire_tx_ids)
-  return expire_tx_ids_.Get(index);
+inline ::google::protobuf::RepeatedPtrField< ::protocol::KeyPair >*
+OperationCreateAccount::mutable_metadatas() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.OperationCreateAccount.metadatas)
+  return &metadatas_;
 }
-inline void ConsensusValueValidation::set_expire_tx_ids(int index, ::google::protobuf::int32 value) {
-  expire_tx_ids_.Set(index, value);
-  // @@protoc_insertion_point(field_set:protocol.ConsensusValueValidation.expire_tx_ids)
+inline const ::google::protobuf::RepeatedPtrField< ::protocol::KeyPair >&
+OperationCreateAccount::metadatas() const {
+  // @@protoc_insertion_point(field_list:protocol.OperationCreateAccount.metadatas)
+  return metadatas_;
 }
-inline void ConsensusValueValidation::add_expire_tx_ids(::google::protobuf::int32 value) {
-  expire_tx_ids_.Add(value);
-  // @@protoc_insertion_point(field_add:protocol.ConsensusValueValidation.expire_tx_ids)
+
+// optional int64 init_balance = 5;
+inline void OperationCreateAccount::clear_init_balance() {
+  init_balance_ = GOOGLE_LONGLONG(0);
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-ConsensusValueValidation::expire_tx_ids() const {
-  // @@protoc_insertion_point(field_list:protocol.ConsensusValueValidation.expire_tx_ids)
-  return expire_tx_ids_;
+inline ::google::protobuf::int64 OperationCreateAccount::init_balance() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationCreateAccount.init_balance)
+  return init_balance_;
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-ConsensusValueValidation::mutable_expire_tx_ids() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.ConsensusValueValidation.expire_tx_ids)
-  return &expire_tx_ids_;
+inline void OperationCreateAccount::set_init_balance(::google::protobuf::int64 value) {
+  
+  init_balance_ = value;
+  // @@protoc_insertion_point(field_set:protocol.OperationCreateAccount.init_balance)
 }
 
-// repeated int32 error_tx_ids = 2;
-inline int ConsensusValueValidation::error_tx_ids_size() const {
-  return error_tx_ids_.size();
+// optional string init_input = 6;
+inline void OperationCreateAccount::clear_init_input() {
+  init_input_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void ConsensusValueValidation::clear_error_tx_ids() {
-  error_tx_ids_.Clear();
+inline const ::std::string& OperationCreateAccount::init_input() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationCreateAccount.init_input)
+  return init_input_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::google::protobuf::int32 ConsensusValueValidation::error_tx_ids(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.ConsensusValueValidation.error_tx_ids)
-  return error_tx_ids_.Get(index);
+inline void OperationCreateAccount::set_init_input(const ::std::string& value) {
+  
+  init_input_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.OperationCreateAccount.init_input)
 }
-inline void ConsensusValueValidation::set_error_tx_ids(int index, ::google::protobuf::int32 value) {
-  error_tx_ids_.Set(index, value);
-  // @@protoc_insertion_point(field_set:protocol.ConsensusValueValidation.error_tx_ids)
+inline void OperationCreateAccount::set_init_input(const char* value) {
+  
+  init_input_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.OperationCreateAccount.init_input)
 }
-inline void ConsensusValueValidation::add_error_tx_ids(::google::protobuf::int32 value) {
-  error_tx_ids_.Add(value);
-  // @@protoc_insertion_point(field_add:protocol.ConsensusValueValidation.error_tx_ids)
+inline void OperationCreateAccount::set_init_input(const char* value, size_t size) {
+  
+  init_input_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.OperationCreateAccount.init_input)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-ConsensusValueValidation::error_tx_ids() const {
-  // @@protoc_insertion_point(field_list:protocol.ConsensusValueValidation.error_tx_ids)
-  return error_tx_ids_;
+inline ::std::string* OperationCreateAccount::mutable_init_input() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.OperationCreateAccount.init_input)
+  return init_input_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-ConsensusValueValidation::mutable_error_tx_ids() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.ConsensusValueValidation.error_tx_ids)
-  return &error_tx_ids_;
+inline ::std::string* OperationCreateAccount::release_init_input() {
+  // @@protoc_insertion_point(field_release:protocol.OperationCreateAccount.init_input)
+  
+  return init_input_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void OperationCreateAccount::set_allocated_init_input(::std::string* init_input) {
+  if (init_input != NULL) {
+    
+  } else {
+    
+  }
+  init_input_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), init_input);
+  // @@protoc_insertion_point(field_set_allocated:protocol.OperationCreateAccount.init_input)
 }
 
 // -------------------------------------------------------------------
 
-// ConsensusValue
+// OperationSetMetadata
 
-// optional .protocol.TransactionEnvSet txset = 1;
-inline bool ConsensusValue::has_txset() const {
-  return !_is_default_instance_ && txset_ != NULL;
+// optional string key = 1;
+inline void OperationSetMetadata::clear_key() {
+  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void ConsensusValue::clear_txset() {
-  if (GetArenaNoVirtual() == NULL && txset_ != NULL) delete txset_;
-  txset_ = NULL;
+inline const ::std::string& OperationSetMetadata::key() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationSetMetadata.key)
+  return key_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::protocol::TransactionEnvSet& ConsensusValue::txset() const {
-  // @@protoc_insertion_point(field_get:protocol.ConsensusValue.txset)
-  return txset_ != NULL ? *txset_ : *default_instance_->txset_;
+inline void OperationSetMetadata::set_key(const ::std::string& value) {
+  
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.OperationSetMetadata.key)
 }
-inline ::protocol::TransactionEnvSet* ConsensusValue::mutable_txset() {
+inline void OperationSetMetadata::set_key(const char* value) {
   
-  if (txset_ == NULL) {
-    txset_ = new ::protocol::TransactionEnvSet;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.ConsensusValue.txset)
-  return txset_;
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.OperationSetMetadata.key)
 }
-inline ::protocol::TransactionEnvSet* ConsensusValue::release_txset() {
-  // @@protoc_insertion_point(field_release:protocol.ConsensusValue.txset)
+inline void OperationSetMetadata::set_key(const char* value, size_t size) {
   
-  ::protocol::TransactionEnvSet* temp = txset_;
-  txset_ = NULL;
-  return temp;
+  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.OperationSetMetadata.key)
 }
-inline void ConsensusValue::set_allocated_txset(::protocol::TransactionEnvSet* txset) {
-  delete txset_;
-  txset_ = txset;
-  if (txset) {
+inline ::std::string* OperationSetMetadata::mutable_key() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.OperationSetMetadata.key)
+  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* OperationSetMetadata::release_key() {
+  // @@protoc_insertion_point(field_release:protocol.OperationSetMetadata.key)
+  
+  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void OperationSetMetadata::set_allocated_key(::std::string* key) {
+  if (key != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.ConsensusValue.txset)
+  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
+  // @@protoc_insertion_point(field_set_allocated:protocol.OperationSetMetadata.key)
 }
 
-// optional int64 close_time = 2;
-inline void ConsensusValue::clear_close_time() {
-  close_time_ = GOOGLE_LONGLONG(0);
+// optional string value = 2;
+inline void OperationSetMetadata::clear_value() {
+  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::google::protobuf::int64 ConsensusValue::close_time() const {
-  // @@protoc_insertion_point(field_get:protocol.ConsensusValue.close_time)
-  return close_time_;
+inline const ::std::string& OperationSetMetadata::value() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationSetMetadata.value)
+  return value_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void ConsensusValue::set_close_time(::google::protobuf::int64 value) {
+inline void OperationSetMetadata::set_value(const ::std::string& value) {
   
-  close_time_ = value;
-  // @@protoc_insertion_point(field_set:protocol.ConsensusValue.close_time)
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.OperationSetMetadata.value)
 }
-
-// optional bytes previous_proof = 3;
-inline void ConsensusValue::clear_previous_proof() {
-  previous_proof_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void OperationSetMetadata::set_value(const char* value) {
+  
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.OperationSetMetadata.value)
 }
-inline const ::std::string& ConsensusValue::previous_proof() const {
-  // @@protoc_insertion_point(field_get:protocol.ConsensusValue.previous_proof)
-  return previous_proof_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void OperationSetMetadata::set_value(const char* value, size_t size) {
+  
+  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.OperationSetMetadata.value)
 }
-inline void ConsensusValue::set_previous_proof(const ::std::string& value) {
+inline ::std::string* OperationSetMetadata::mutable_value() {
   
-  previous_proof_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.ConsensusValue.previous_proof)
+  // @@protoc_insertion_point(field_mutable:protocol.OperationSetMetadata.value)
+  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void ConsensusValue::set_previous_proof(const char* value) {
+inline ::std::string* OperationSetMetadata::release_value() {
+  // @@protoc_insertion_point(field_release:protocol.OperationSetMetadata.value)
   
-  previous_proof_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.ConsensusValue.previous_proof)
+  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void OperationSetMetadata::set_allocated_value(::std::string* value) {
+  if (value != NULL) {
+    
+  } else {
+    
+  }
+  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set_allocated:protocol.OperationSetMetadata.value)
+}
+
+// optional int64 version = 3;
+inline void OperationSetMetadata::clear_version() {
+  version_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 OperationSetMetadata::version() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationSetMetadata.version)
+  return version_;
 }
-inline void ConsensusValue::set_previous_proof(const void* value, size_t size) {
+inline void OperationSetMetadata::set_version(::google::protobuf::int64 value) {
   
-  previous_proof_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.ConsensusValue.previous_proof)
+  version_ = value;
+  // @@protoc_insertion_point(field_set:protocol.OperationSetMetadata.version)
 }
-inline ::std::string* ConsensusValue::mutable_previous_proof() {
-  
-  // @@protoc_insertion_point(field_mutable:protocol.ConsensusValue.previous_proof)
-  return previous_proof_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+// optional bool delete_flag = 4;
+inline void OperationSetMetadata::clear_delete_flag() {
+  delete_flag_ = false;
 }
-inline ::std::string* ConsensusValue::release_previous_proof() {
-  // @@protoc_insertion_point(field_release:protocol.ConsensusValue.previous_proof)
-  
-  return previous_proof_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline bool OperationSetMetadata::delete_flag() const {
+  // @@protoc_insertion_point(field_get:protocol.OperationSetMetadata.delete_flag)
+  return delete_flag_;
 }
-inline void ConsensusValue::set_allocated_previous_proof(::std::string* previous_proof) {
-  if (previous_proof != NULL) {
-    
-  } else {
-    
-  }
-  previous_proof_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), previous_proof);
-  // @@protoc_insertion_point(field_set_allocated:protocol.ConsensusValue.previous_proof)
+inline void OperationSetMetadata::set_delete_flag(bool value) {
+  
+  delete_flag_ = value;
+  // @@protoc_insertion_point(field_set:protocol.OperationSetMetadata.delete_flag)
 }
 
-// optional int64 ledger_seq = 4;
-inline void ConsensusValue::clear_ledger_seq() {
-  ledger_seq_ = GOOGLE_LONGLONG(0);
+// -------------------------------------------------------------------
+
+// AccountResponse
+
+// optional int32 error_code = 1;
+inline void AccountResponse::clear_error_code() {
+  error_code_ = 0;
 }
-inline ::google::protobuf::int64 ConsensusValue::ledger_seq() const {
-  // @@protoc_insertion_point(field_get:protocol.ConsensusValue.ledger_seq)
-  return ledger_seq_;
+inline ::google::protobuf::int32 AccountResponse::error_code() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountResponse.error_code)
+  return error_code_;
 }
-inline void ConsensusValue::set_ledger_seq(::google::protobuf::int64 value) {
+inline void AccountResponse::set_error_code(::google::protobuf::int32 value) {
   
-  ledger_seq_ = value;
-  // @@protoc_insertion_point(field_set:protocol.ConsensusValue.ledger_seq)
+  error_code_ = value;
+  // @@protoc_insertion_point(field_set:protocol.AccountResponse.error_code)
 }
 
-// optional bytes previous_ledger_hash = 5;
-inline void ConsensusValue::clear_previous_ledger_hash() {
-  previous_ledger_hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// optional string error_desc = 2;
+inline void AccountResponse::clear_error_desc() {
+  error_desc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& ConsensusValue::previous_ledger_hash() const {
-  // @@protoc_insertion_point(field_get:protocol.ConsensusValue.previous_ledger_hash)
-  return previous_ledger_hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::std::string& AccountResponse::error_desc() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountResponse.error_desc)
+  return error_desc_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void ConsensusValue::set_previous_ledger_hash(const ::std::string& value) {
+inline void AccountResponse::set_error_desc(const ::std::string& value) {
   
-  previous_ledger_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.ConsensusValue.previous_ledger_hash)
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.AccountResponse.error_desc)
 }
-inline void ConsensusValue::set_previous_ledger_hash(const char* value) {
+inline void AccountResponse::set_error_desc(const char* value) {
   
-  previous_ledger_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.ConsensusValue.previous_ledger_hash)
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.AccountResponse.error_desc)
 }
-inline void ConsensusValue::set_previous_ledger_hash(const void* value, size_t size) {
+inline void AccountResponse::set_error_desc(const char* value, size_t size) {
   
-  previous_ledger_hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.ConsensusValue.previous_ledger_hash)
+  // @@protoc_insertion_point(field_set_pointer:protocol.AccountResponse.error_desc)
 }
-inline ::std::string* ConsensusValue::mutable_previous_ledger_hash() {
+inline ::std::string* AccountResponse::mutable_error_desc() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.ConsensusValue.previous_ledger_hash)
-  return previous_ledger_hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:protocol.AccountResponse.error_desc)
+  return error_desc_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* ConsensusValue::release_previous_ledger_hash() {
-  // @@protoc_insertion_point(field_release:protocol.ConsensusValue.previous_ledger_hash)
+inline ::std::string* AccountResponse::release_error_desc() {
+  // @@protoc_insertion_point(field_release:protocol.AccountResponse.error_desc)
   
-  return previous_ledger_hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return error_desc_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void ConsensusValue::set_allocated_previous_ledger_hash(::std::string* previous_ledger_hash) {
-  if (previous_ledger_hash != NULL) {
+inline void AccountResponse::set_allocated_error_desc(::std::string* error_desc) {
+  if (error_desc != NULL) {
     
   } else {
     
   }
-  previous_ledger_hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), previous_ledger_hash);
-  // @@protoc_insertion_point(field_set_allocated:protocol.ConsensusValue.previous_ledger_hash)
+  error_desc_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_desc);
+  // @@protoc_insertion_point(field_set_allocated:protocol.AccountResponse.error_desc)
 }
 
-// optional .protocol.LedgerUpgrade ledger_upgrade = 6;
-inline bool ConsensusValue::has_ledger_upgrade() const {
-  return !_is_default_instance_ && ledger_upgrade_ != NULL;
+// optional .protocol.Account account = 3;
+inline bool AccountResponse::has_account() const {
+  return !_is_default_instance_ && account_ != NULL;
 }
-inline void ConsensusValue::clear_ledger_upgrade() {
-  if (GetArenaNoVirtual() == NULL && ledger_upgrade_ != NULL) delete ledger_upgrade_;
-  ledger_upgrade_ = NULL;
+inline void AccountResponse::clear_account() {
+  if (GetArenaNoVirtual() == NULL && account_ != NULL) delete account_;
+  account_ = NULL;
 }
-inline const ::protocol::LedgerUpgrade& ConsensusValue::ledger_upgrade() const {
-  // @@protoc_insertion_point(field_get:protocol.ConsensusValue.ledger_upgrade)
-  return ledger_upgrade_ != NULL ? *ledger_upgrade_ : *default_instance_->ledger_upgrade_;
+inline const ::protocol::Account& AccountResponse::account() const {
+  // @@protoc_insertion_point(field_get:protocol.AccountResponse.account)
+  return account_ != NULL ? *account_ : *default_instance_->account_;
 }
-inline ::protocol::LedgerUpgrade* ConsensusValue::mutable_ledger_upgrade() {
+inline ::protocol::Account* AccountResponse::mutable_account() {
   
-  if (ledger_upgrade_ == NULL) {
-    ledger_upgrade_ = new ::protocol::LedgerUpgrade;
+  if (account_ == NULL) {
+    account_ = new ::protocol::Account;
   }
-  // @@protoc_insertion_point(field_mutable:protocol.ConsensusValue.ledger_upgrade)
-  return ledger_upgrade_;
+  // @@protoc_insertion_point(field_mutable:protocol.AccountResponse.account)
+  return account_;
 }
-inline ::protocol::LedgerUpgrade* ConsensusValue::release_ledger_upgrade() {
-  // @@protoc_insertion_point(field_release:protocol.ConsensusValue.ledger_upgrade)
+inline ::protocol::Account* AccountResponse::release_account() {
+  // @@protoc_insertion_point(field_release:protocol.AccountResponse.account)
   
-  ::protocol::LedgerUpgrade* temp = ledger_upgrade_;
-  ledger_upgrade_ = NULL;
+  ::protocol::Account* temp = account_;
+  account_ = NULL;
   return temp;
 }
-inline void ConsensusValue::set_allocated_ledger_upgrade(::protocol::LedgerUpgrade* ledger_upgrade) {
-  delete ledger_upgrade_;
-  ledger_upgrade_ = ledger_upgrade;
-  if (ledger_upgrade) {
+inline void AccountResponse::set_allocated_account(::protocol::Account* account) {
+  delete account_;
+  account_ = account;
+  if (account) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.ConsensusValue.ledger_upgrade)
+  // @@protoc_insertion_point(field_set_allocated:protocol.AccountResponse.account)
 }
 
-// optional .protocol.ConsensusValueValidation validation = 7;
-inline bool ConsensusValue::has_validation() const {
-  return !_is_default_instance_ && validation_ != NULL;
-}
-inline void ConsensusValue::clear_validation() {
-  if (GetArenaNoVirtual() == NULL && validation_ != NULL) delete validation_;
-  validation_ = NULL;
-}
-inline const ::protocol::ConsensusValueValidation& ConsensusValue::validation() const {
-  // @@protoc_insertion_point(field_get:protocol.ConsensusValue.validation)
-  return validation_ != NULL ? *validation_ : *default_instance_->validation_;
+// repeated .protocol.AssetStore assets = 4;
+inline int AccountResponse::assets_size() const {
+  return assets_.size();
 }
-inline ::protocol::ConsensusValueValidation* ConsensusValue::mutable_validation() {
-  
-  if (validation_ == NULL) {
-    validation_ = new ::protocol::ConsensusValueValidation;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.ConsensusValue.validation)
-  return validation_;
+inline void AccountResponse::clear_assets() {
+  assets_.Clear();
 }
-inline ::protocol::ConsensusValueValidation* ConsensusValue::release_validation() {
-  // @@protoc_insertion_point(field_release:protocol.ConsensusValue.validation)
-  
-  ::protocol::ConsensusValueValidation* temp = validation_;
-  validation_ = NULL;
-  return temp;
+inline const ::protocol::AssetStore& AccountResponse::assets(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.AccountResponse.assets)
+  return assets_.Get(index);
 }
-inline void ConsensusValue::set_allocated_validation(::protocol::ConsensusValueValidation* validation) {
-  delete validation_;
-  validation_ = validation;
-  if (validation) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:protocol.ConsensusValue.validation)
+inline ::protocol::AssetStore* AccountResponse::mutable_assets(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.AccountResponse.assets)
+  return assets_.Mutable(index);
 }
-
-// -------------------------------------------------------------------
-
-// Contract
-
-// optional .protocol.Contract.ContractType type = 1;
-inline void Contract::clear_type() {
-  type_ = 0;
+inline ::protocol::AssetStore* AccountResponse::add_assets() {
+  // @@protoc_insertion_point(field_add:protocol.AccountResponse.assets)
+  return assets_.Add();
 }
-inline ::protocol::Contract_ContractType Contract::type() const {
-  // @@protoc_insertion_point(field_get:protocol.Contract.type)
-  return static_cast< ::protocol::Contract_ContractType >(type_);
+inline ::google::protobuf::RepeatedPtrField< ::protocol::AssetStore >*
+AccountResponse::mutable_assets() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.AccountResponse.assets)
+  return &assets_;
 }
-inline void Contract::set_type(::protocol::Contract_ContractType value) {
-  
-  type_ = value;
-  // @@protoc_insertion_point(field_set:protocol.Contract.type)
+inline const ::google::protobuf::RepeatedPtrField< ::protocol::AssetStore >&
+AccountResponse::assets() const {
+  // @@protoc_insertion_point(field_list:protocol.AccountResponse.assets)
+  return assets_;
 }
 
-// optional string payload = 2;
-inline void Contract::clear_payload() {
-  payload_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& Contract::payload() const {
-  // @@protoc_insertion_point(field_get:protocol.Contract.payload)
-  return payload_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// repeated .protocol.KeyPair metadatas = 5;
+inline int AccountResponse::metadatas_size() const {
+  return metadatas_.size();
 }
-inline void Contract::set_payload(const ::std::string& value) {
-  
-  payload_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.Contract.payload)
+inline void AccountResponse::clear_metadatas() {
+  metadatas_.Clear();
 }
-inline void Contract::set_payload(const char* value) {
-  
-  payload_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.Contract.payload)
+inline const ::protocol::KeyPair& AccountResponse::metadatas(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.AccountResponse.metadatas)
+  return metadatas_.Get(index);
 }
-inline void Contract::set_payload(const char* value, size_t size) {
-  
-  payload_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.Contract.payload)
+inline ::protocol::KeyPair* AccountResponse::mutable_metadatas(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.AccountResponse.metadatas)
+  return metadatas_.Mutable(index);
 }
-inline ::std::string* Contract::mutable_payload() {
-  
-  // @@protoc_insertion_point(field_mutable:protocol.Contract.payload)
-  return payload_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::protocol::KeyPair* AccountResponse::add_metadatas() {
+  // @@protoc_insertion_point(field_add:protocol.AccountResponse.metadatas)
+  return metadatas_.Add();
 }
-inline ::std::string* Contract::release_payload() {
-  // @@protoc_insertion_point(field_release:protocol.Contract.payload)
-  
-  return payload_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::google::protobuf::RepeatedPtrField< ::protocol::KeyPair >*
+AccountResponse::mutable_metadatas() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.AccountResponse.metadatas)
+  return &metadatas_;
 }
-inline void Contract::set_allocated_payload(::std::string* payload) {
-  if (payload != NULL) {
-    
-  } else {
-    
-  }
-  payload_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), payload);
-  // @@protoc_insertion_point(field_set_allocated:protocol.Contract.payload)
+inline const ::google::protobuf::RepeatedPtrField< ::protocol::KeyPair >&
+AccountResponse::metadatas() const {
+  // @@protoc_insertion_point(field_list:protocol.AccountResponse.metadatas)
+  return metadatas_;
 }
 
 // -------------------------------------------------------------------
 
-// OperationCreateAccount
+// LedgerResponse
 
-// optional string dest_address = 1;
-inline void OperationCreateAccount::clear_dest_address() {
-  dest_address_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// optional int32 error_code = 1;
+inline void LedgerResponse::clear_error_code() {
+  error_code_ = 0;
 }
-inline const ::std::string& OperationCreateAccount::dest_address() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationCreateAccount.dest_address)
-  return dest_address_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::google::protobuf::int32 LedgerResponse::error_code() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerResponse.error_code)
+  return error_code_;
 }
-inline void OperationCreateAccount::set_dest_address(const ::std::string& value) {
+inline void LedgerResponse::set_error_code(::google::protobuf::int32 value) {
   
-  dest_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.OperationCreateAccount.dest_address)
+  error_code_ = value;
+  // @@protoc_insertion_point(field_set:protocol.LedgerResponse.error_code)
 }
-inline void OperationCreateAccount::set_dest_address(const char* value) {
-  
-  dest_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.OperationCreateAccount.dest_address)
+
+// optional string error_desc = 2;
+inline void LedgerResponse::clear_error_desc() {
+  error_desc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void OperationCreateAccount::set_dest_address(const char* value, size_t size) {
-  
-  dest_address_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.OperationCreateAccount.dest_address)
+inline const ::std::string& LedgerResponse::error_desc() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerResponse.error_desc)
+  return error_desc_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* OperationCreateAccount::mutable_dest_address() {
+inline void LedgerResponse::set_error_desc(const ::std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:protocol.OperationCreateAccount.dest_address)
-  return dest_address_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.LedgerResponse.error_desc)
 }
-inline ::std::string* OperationCreateAccount::release_dest_address() {
-  // @@protoc_insertion_point(field_release:protocol.OperationCreateAccount.dest_address)
+inline void LedgerResponse::set_error_desc(const char* value) {
   
-  return dest_address_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void OperationCreateAccount::set_allocated_dest_address(::std::string* dest_address) {
-  if (dest_address != NULL) {
-    
-  } else {
-    
-  }
-  dest_address_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), dest_address);
-  // @@protoc_insertion_point(field_set_allocated:protocol.OperationCreateAccount.dest_address)
-}
-
-// optional .protocol.Contract contract = 2;
-inline bool OperationCreateAccount::has_contract() const {
-  return !_is_default_instance_ && contract_ != NULL;
-}
-inline void OperationCreateAccount::clear_contract() {
-  if (GetArenaNoVirtual() == NULL && contract_ != NULL) delete contract_;
-  contract_ = NULL;
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.LedgerResponse.error_desc)
 }
-inline const ::protocol::Contract& OperationCreateAccount::contract() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationCreateAccount.contract)
-  return contract_ != NULL ? *contract_ : *default_instance_->contract_;
+inline void LedgerResponse::set_error_desc(const char* value, size_t size) {
+  
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.LedgerResponse.error_desc)
 }
-inline ::protocol::Contract* OperationCreateAccount::mutable_contract() {
+inline ::std::string* LedgerResponse::mutable_error_desc() {
   
-  if (contract_ == NULL) {
-    contract_ = new ::protocol::Contract;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.OperationCreateAccount.contract)
-  return contract_;
+  // @@protoc_insertion_point(field_mutable:protocol.LedgerResponse.error_desc)
+  return error_desc_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::protocol::Contract* OperationCreateAccount::release_contract() {
-  // @@protoc_insertion_point(field_release:protocol.OperationCreateAccount.contract)
+inline ::std::string* LedgerResponse::release_error_desc() {
+  // @@protoc_insertion_point(field_release:protocol.LedgerResponse.error_desc)
   
-  ::protocol::Contract* temp = contract_;
-  contract_ = NULL;
-  return temp;
+  return error_desc_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void OperationCreateAccount::set_allocated_contract(::protocol::Contract* contract) {
-  delete contract_;
-  contract_ = contract;
-  if (contract) {
+inline void LedgerResponse::set_allocated_error_desc(::std::string* error_desc) {
+  if (error_desc != NULL) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.OperationCreateAccount.contract)
+  error_desc_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_desc);
+  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerResponse.error_desc)
 }
 
-// optional .protocol.AccountPrivilege priv = 3;
-inline bool OperationCreateAccount::has_priv() const {
-  return !_is_default_instance_ && priv_ != NULL;
+// optional .protocol.LedgerHeader header = 3;
+inline bool LedgerResponse::has_header() const {
+  return !_is_default_instance_ && header_ != NULL;
 }
-inline void OperationCreateAccount::clear_priv() {
-  if (GetArenaNoVirtual() == NULL && priv_ != NULL) delete priv_;
-  priv_ = NULL;
+inline void LedgerResponse::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
 }
-inline const ::protocol::AccountPrivilege& OperationCreateAccount::priv() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationCreateAccount.priv)
-  return priv_ != NULL ? *priv_ : *default_instance_->priv_;
+inline const ::protocol::LedgerHeader& LedgerResponse::header() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerResponse.header)
+  return header_ != NULL ? *header_ : *default_instance_->header_;
 }
-inline ::protocol::AccountPrivilege* OperationCreateAccount::mutable_priv() {
+inline ::protocol::LedgerHeader* LedgerResponse::mutable_header() {
   
-  if (priv_ == NULL) {
-    priv_ = new ::protocol::AccountPrivilege;
+  if (header_ == NULL) {
+    header_ = new ::protocol::LedgerHeader;
   }
-  // @@protoc_insertion_point(field_mutable:protocol.OperationCreateAccount.priv)
-  return priv_;
+  // @@protoc_insertion_point(field_mutable:protocol.LedgerResponse.header)
+  return header_;
 }
-inline ::protocol::AccountPrivilege* OperationCreateAccount::release_priv() {
-  // @@protoc_insertion_point(field_release:protocol.OperationCreateAccount.priv)
+inline ::protocol::LedgerHeader* LedgerResponse::release_header() {
+  // @@protoc_insertion_point(field_release:protocol.LedgerResponse.header)
   
-  ::protocol::AccountPrivilege* temp = priv_;
-  priv_ = NULL;
+  ::protocol::LedgerHeader* temp = header_;
+  header_ = NULL;
   return temp;
 }
-inline void OperationCreateAccount::set_allocated_priv(::protocol::AccountPrivilege* priv) {
-  delete priv_;
-  priv_ = priv;
-  if (priv) {
+inline void LedgerResponse::set_allocated_header(::protocol::LedgerHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_set_allocated:protocol.OperationCreateAccount.priv)
+  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerResponse.header)
 }
 
-// repeated .protocol.KeyPair metadatas = 4;
-inline int OperationCreateAccount::metadatas_size() const {
-  return metadatas_.size();
+// repeated .protocol.TransactionEnvStore transactions = 4;
+inline int LedgerResponse::transactions_size() const {
+  return transactions_.size();
 }
-inline void OperationCreateAccount::clear_metadatas() {
-  metadatas_.Clear();
+inline void LedgerResponse::clear_transactions() {
+  transactions_.Clear();
 }
-inline const ::protocol::KeyPair& OperationCreateAccount::metadatas(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.OperationCreateAccount.metadatas)
-  return metadatas_.Get(index);
+inline const ::protocol::TransactionEnvStore& LedgerResponse::transactions(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerResponse.transactions)
+  return transactions_.Get(index);
 }
-inline ::protocol::KeyPair* OperationCreateAccount::mutable_metadatas(int index) {
-  // @@protoc_insertion_point(field_mutable:protocol.OperationCreateAccount.metadatas)
-  return metadatas_.Mutable(index);
+inline ::protocol::TransactionEnvStore* LedgerResponse::mutable_transactions(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.LedgerResponse.transactions)
+  return transactions_.Mutable(index);
 }
-inline ::protocol::KeyPair* OperationCreateAccount::add_metadatas() {
-  // @@protoc_insertion_point(field_add:protocol.OperationCreateAccount.metadatas)
-  return metadatas_.Add();
+inline ::protocol::TransactionEnvStore* LedgerResponse::add_transactions() {
+  // @@protoc_insertion_point(field_add:protocol.LedgerResponse.transactions)
+  return transactions_.Add();
 }
-inline ::google::protobuf::RepeatedPtrField< ::protocol::KeyPair >*
-OperationCreateAccount::mutable_metadatas() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.OperationCreateAccount.metadatas)
-  return &metadatas_;
+inline ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >*
+LedgerResponse::mutable_transactions() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.LedgerResponse.transactions)
+  return &transactions_;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::protocol::KeyPair >&
-OperationCreateAccount::metadatas() const {
-  // @@protoc_insertion_point(field_list:protocol.OperationCreateAccount.metadatas)
-  return metadatas_;
+inline const ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >&
+LedgerResponse::transactions() const {
+  // @@protoc_insertion_point(field_list:protocol.LedgerResponse.transactions)
+  return transactions_;
 }
 
-// optional int64 init_balance = 5;
-inline void OperationCreateAccount::clear_init_balance() {
-  init_balance_ = GOOGLE_LONGLONG(0);
+// -------------------------------------------------------------------
+
+// TransactionResponse
+
+// optional int32 error_code = 1;
+inline void TransactionResponse::clear_error_code() {
+  error_code_ = 0;
 }
-inline ::google::protobuf::int64 OperationCreateAccount::init_balance() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationCreateAccount.init_balance)
-  return init_balance_;
+inline ::google::protobuf::int32 TransactionResponse::error_code() const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionResponse.error_code)
+  return error_code_;
 }
-inline void OperationCreateAccount::set_init_balance(::google::protobuf::int64 value) {
+inline void TransactionResponse::set_error_code(::google::protobuf::int32 value) {
   
-  init_balance_ = value;
-  // @@protoc_insertion_point(field_set:protocol.OperationCreateAccount.init_balance)
+  error_code_ = value;
+  // @@protoc_insertion_point(field_set:protocol.TransactionResponse.error_code)
 }
 
-// optional string init_input = 6;
-inline void OperationCreateAccount::clear_init_input() {
-  init_input_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// optional string error_desc = 2;
+inline void TransactionResponse::clear_error_desc() {
+  error_desc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& OperationCreateAccount::init_input() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationCreateAccount.init_input)
-  return init_input_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::std::string& TransactionResponse::error_desc() const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionResponse.error_desc)
+  return error_desc_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void OperationCreateAccount::set_init_input(const ::std::string& value) {
+inline void TransactionResponse::set_error_desc(const ::std::string& value) {
   
-  init_input_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.OperationCreateAccount.init_input)
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.TransactionResponse.error_desc)
 }
-inline void OperationCreateAccount::set_init_input(const char* value) {
+inline void TransactionResponse::set_error_desc(const char* value) {
   
-  init_input_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.OperationCreateAccount.init_input)
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.TransactionResponse.error_desc)
 }
-inline void OperationCreateAccount::set_init_input(const char* value, size_t size) {
+inline void TransactionResponse::set_error_desc(const char* value, size_t size) {
   
-  init_input_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.OperationCreateAccount.init_input)
+  // @@protoc_insertion_point(field_set_pointer:protocol.TransactionResponse.error_desc)
 }
-inline ::std::string* OperationCreateAccount::mutable_init_input() {
+inline ::std::string* TransactionResponse::mutable_error_desc() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.OperationCreateAccount.init_input)
-  return init_input_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:protocol.TransactionResponse.error_desc)
+  return error_desc_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* OperationCreateAccount::release_init_input() {
-  // @@protoc_insertion_point(field_release:protocol.OperationCreateAccount.init_input)
+inline ::std::string* TransactionResponse::release_error_desc() {
+  // @@protoc_insertion_point(field_release:protocol.TransactionResponse.error_desc)
   
-  return init_input_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return error_desc_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void OperationCreateAccount::set_allocated_init_input(::std::string* init_input) {
-  if (init_input != NULL) {
+inline void TransactionResponse::set_allocated_error_desc(::std::string* error_desc) {
+  if (error_desc != NULL) {
     
   } else {
     
   }
-  init_input_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), init_input);
-  // @@protoc_insertion_point(field_set_allocated:protocol.OperationCreateAccount.init_input)
+  error_desc_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_desc);
+  // @@protoc_insertion_point(field_set_allocated:protocol.TransactionResponse.error_desc)
+}
+
+// optional int64 total_count = 3;
+inline void TransactionResponse::clear_total_count() {
+  total_count_ = GOOGLE_LONGLONG(0);
+}
+inline ::google::protobuf::int64 TransactionResponse::total_count() const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionResponse.total_count)
+  return total_count_;
+}
+inline void TransactionResponse::set_total_count(::google::protobuf::int64 value) {
+  
+  total_count_ = value;
+  // @@protoc_insertion_point(field_set:protocol.TransactionResponse.total_count)
+}
+
+// repeated .protocol.TransactionEnvStore transactions = 4;
+inline int TransactionResponse::transactions_size() const {
+  return transactions_.size();
+}
+inline void TransactionResponse::clear_transactions() {
+  transactions_.Clear();
+}
+inline const ::protocol::TransactionEnvStore& TransactionResponse::transactions(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionResponse.transactions)
+  return transactions_.Get(index);
+}
+inline ::protocol::TransactionEnvStore* TransactionResponse::mutable_transactions(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.TransactionResponse.transactions)
+  return transactions_.Mutable(index);
+}
+inline ::protocol::TransactionEnvStore* TransactionResponse::add_transactions() {
+  // @@protoc_insertion_point(field_add:protocol.TransactionResponse.transactions)
+  return transactions_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >*
+TransactionResponse::mutable_transactions() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.TransactionResponse.transactions)
+  return &transactions_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >&
+TransactionResponse::transactions() const {
+  // @@protoc_insertion_point(field_list:protocol.TransactionResponse.transactions)
+  return transactions_;
 }
 
 // -------------------------------------------------------------------
 
-// OperationSetMetadata
+// SubmitTransactionResponse_Result
 
-// optional string key = 1;
-inline void OperationSetMetadata::clear_key() {
-  key_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// optional bytes hash = 1;
+inline void SubmitTransactionResponse_Result::clear_hash() {
+  hash_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline const ::std::string& OperationSetMetadata::key() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationSetMetadata.key)
-  return key_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::std::string& SubmitTransactionResponse_Result::hash() const {
+  // @@protoc_insertion_point(field_get:protocol.SubmitTransactionResponse.Result.hash)
+  return hash_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void OperationSetMetadata::set_key(const ::std::string& value) {
+inline void SubmitTransactionResponse_Result::set_hash(const ::std::string& value) {
   
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.OperationSetMetadata.key)
+  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.SubmitTransactionResponse.Result.hash)
 }
-inline void OperationSetMetadata::set_key(const char* value) {
+inline void SubmitTransactionResponse_Result::set_hash(const char* value) {
   
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.OperationSetMetadata.key)
+  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.SubmitTransactionResponse.Result.hash)
 }
-inline void OperationSetMetadata::set_key(const char* value, size_t size) {
+inline void SubmitTransactionResponse_Result::set_hash(const void* value, size_t size) {
   
-  key_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  hash_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.OperationSetMetadata.key)
+  // @@protoc_insertion_point(field_set_pointer:protocol.SubmitTransactionResponse.Result.hash)
 }
-inline ::std::string* OperationSetMetadata::mutable_key() {
+inline ::std::string* SubmitTransactionResponse_Result::mutable_hash() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.OperationSetMetadata.key)
-  return key_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:protocol.SubmitTransactionResponse.Result.hash)
+  return hash_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* OperationSetMetadata::release_key() {
-  // @@protoc_insertion_point(field_release:protocol.OperationSetMetadata.key)
+inline ::std::string* SubmitTransactionResponse_Result::release_hash() {
+  // @@protoc_insertion_point(field_release:protocol.SubmitTransactionResponse.Result.hash)
   
-  return key_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return hash_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void OperationSetMetadata::set_allocated_key(::std::string* key) {
-  if (key != NULL) {
+inline void SubmitTransactionResponse_Result::set_allocated_hash(::std::string* hash) {
+  if (hash != NULL) {
     
   } else {
     
   }
-  key_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), key);
-  // @@protoc_insertion_point(field_set_allocated:protocol.OperationSetMetadata.key)
+  hash_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), hash);
+  // @@protoc_insertion_point(field_set_allocated:protocol.SubmitTransactionResponse.Result.hash)
 }
 
-// optional string value = 2;
-inline void OperationSetMetadata::clear_value() {
-  value_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// optional int32 error_code = 2;
+inline void SubmitTransactionResponse_Result::clear_error_code() {
+  error_code_ = 0;
 }
-inline const ::std::string& OperationSetMetadata::value() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationSetMetadata.value)
-  return value_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::google::protobuf::int32 SubmitTransactionResponse_Result::error_code() const {
+  // @@protoc_insertion_point(field_get:protocol.SubmitTransactionResponse.Result.error_code)
+  return error_code_;
 }
-inline void OperationSetMetadata::set_value(const ::std::string& value) {
+inline void SubmitTransactionResponse_Result::set_error_code(::google::protobuf::int32 value) {
   
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.OperationSetMetadata.value)
+  error_code_ = value;
+  // @@protoc_insertion_point(field_set:protocol.SubmitTransactionResponse.Result.error_code)
 }
-inline void OperationSetMetadata::set_value(const char* value) {
+
+// optional string error_desc = 3;
+inline void SubmitTransactionResponse_Result::clear_error_desc() {
+  error_desc_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline const ::std::string& SubmitTransactionResponse_Result::error_desc() const {
+  // @@protoc_insertion_point(field_get:protocol.SubmitTransactionResponse.Result.error_desc)
+  return error_desc_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void SubmitTransactionResponse_Result::set_error_desc(const ::std::string& value) {
   
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.OperationSetMetadata.value)
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.SubmitTransactionResponse.Result.error_desc)
 }
-inline void OperationSetMetadata::set_value(const char* value, size_t size) {
+inline void SubmitTransactionResponse_Result::set_error_desc(const char* value) {
   
-  value_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.SubmitTransactionResponse.Result.error_desc)
+}
+inline void SubmitTransactionResponse_Result::set_error_desc(const char* value, size_t size) {
+  
+  error_desc_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
       ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.OperationSetMetadata.value)
+  // @@protoc_insertion_point(field_set_pointer:protocol.SubmitTransactionResponse.Result.error_desc)
 }
-inline ::std::string* OperationSetMetadata::mutable_value() {
+inline ::std::string* SubmitTransactionResponse_Result::mutable_error_desc() {
   
-  // @@protoc_insertion_point(field_mutable:protocol.OperationSetMetadata.value)
-  return value_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  // @@protoc_insertion_point(field_mutable:protocol.SubmitTransactionResponse.Result.error_desc)
+  return error_desc_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline ::std::string* OperationSetMetadata::release_value() {
-  // @@protoc_insertion_point(field_release:protocol.OperationSetMetadata.value)
+inline ::std::string* SubmitTransactionResponse_Result::release_error_desc() {
+  // @@protoc_insertion_point(field_release:protocol.SubmitTransactionResponse.Result.error_desc)
   
-  return value_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return error_desc_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 }
-inline void OperationSetMetadata::set_allocated_value(::std::string* value) {
-  if (value != NULL) {
+inline void SubmitTransactionResponse_Result::set_allocated_error_desc(::std::string* error_desc) {
+  if (error_desc != NULL) {
     
   } else {
     
   }
-  value_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set_allocated:protocol.OperationSetMetadata.value)
+  error_desc_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_desc);
+  // @@protoc_insertion_point(field_set_allocated:protocol.SubmitTransactionResponse.Result.error_desc)
 }
 
-// optional int64 version = 3;
-inline void OperationSetMetadata::clear_version() {
-  version_ = GOOGLE_LONGLONG(0);
+// -------------------------------------------------------------------
+
+// SubmitTransactionResponse
+
+// optional int32 success_count = 1;
+inline void SubmitTransactionResponse::clear_success_count() {
+  success_count_ = 0;
 }
-inline ::google::protobuf::int64 OperationSetMetadata::version() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationSetMetadata.version)
-  return version_;
+inline ::google::protobuf::int32 SubmitTransactionResponse::success_count() const {
+  // @@protoc_insertion_point(field_get:protocol.SubmitTransactionResponse.success_count)
+  return success_count_;
 }
-inline void OperationSetMetadata::set_version(::google::protobuf::int64 value) {
+inline void SubmitTransactionResponse::set_success_count(::google::protobuf::int32 value) {
   
-  version_ = value;
-  // @@protoc_insertion_point(field_set:protocol.OperationSetMetadata.version)
+  success_count_ = value;
+  // @@protoc_insertion_point(field_set:protocol.SubmitTransactionResponse.success_count)
 }
 
-// optional bool delete_flag = 4;
-inline void OperationSetMetadata::clear_delete_flag() {
-  delete_flag_ = false;
+// repeated .protocol.SubmitTransactionResponse.Result results = 2;
+inline int SubmitTransactionResponse::results_size() const {
+  return results_.size();
 }
-inline bool OperationSetMetadata::delete_flag() const {
-  // @@protoc_insertion_point(field_get:protocol.OperationSetMetadata.delete_flag)
-  return delete_flag_;
+inline void SubmitTransactionResponse::clear_results() {
+  results_.Clear();
 }
-inline void OperationSetMetadata::set_delete_flag(bool value) {
-  
-  delete_flag_ = value;
-  // @@protoc_insertion_point(field_set:protocol.OperationSetMetadata.delete_flag)
+inline const ::protocol::SubmitTransactionResponse_Result& SubmitTransactionResponse::results(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.SubmitTransactionResponse.results)
+  return results_.Get(index);
+}
+inline ::protocol::SubmitTransactionResponse_Result* SubmitTransactionResponse::mutable_results(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.SubmitTransactionResponse.results)
+  return results_.Mutable(index);
+}
+inline ::protocol::SubmitTransactionResponse_Result* SubmitTransactionResponse::add_results() {
+  // @@protoc_insertion_point(field_add:protocol.SubmitTransactionResponse.results)
+  return results_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::protocol::SubmitTransactionResponse_Result >*
+SubmitTransactionResponse::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.SubmitTransactionResponse.results)
+  return &results_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protocol::SubmitTransactionResponse_Result >&
+SubmitTransactionResponse::results() const {
+  // @@protoc_insertion_point(field_list:protocol.SubmitTransactionResponse.results)
+  return results_;
 }
 
 #endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -7632,6 +8751,16 @@ inline void OperationSetMetadata::set_delete_flag(bool value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -102,11 +102,12 @@ void protobuf_AssignDesc_common_2eproto() {
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LedgerUpgrade, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LedgerUpgrade, _is_default_instance_));
   WsMessage_descriptor_ = file->message_type(3);
-  static const int WsMessage_offsets_[4] = {
+  static const int WsMessage_offsets_[5] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(WsMessage, type_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(WsMessage, request_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(WsMessage, sequence_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(WsMessage, data_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(WsMessage, compressed_),
   };
   WsMessage_reflection_ =
     ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
@@ -207,42 +208,42 @@ void protobuf_AddDesc_common_2eproto() {
     "\"2\n\tSignature\022\022\n\npublic_key\030\001 \001(\t\022\021\n\tsig"
     "n_data\030\002 \001(\014\"T\n\rLedgerUpgrade\022\032\n\022new_led"
     "ger_version\030\001 \001(\003\022\025\n\rnew_validator\030\002 \001(\t"
-    "\022\020\n\010chain_id\030\003 \001(\003\"J\n\tWsMessage\022\014\n\004type\030"
+    "\022\020\n\010chain_id\030\003 \001(\003\"^\n\tWsMessage\022\014\n\004type\030"
     "\001 \001(\003\022\017\n\007request\030\002 \001(\010\022\020\n\010sequence\030\003 \001(\003"
-    "\022\014\n\004data\030\004 \001(\014\"\025\n\004Ping\022\r\n\005nonce\030\001 \001(\003\"\025\n"
-    "\004Pong\022\r\n\005nonce\030\001 \001(\003*\317\t\n\tERRORCODE\022\023\n\017ER"
-    "RCODE_SUCCESS\020\000\022\032\n\026ERRCODE_INTERNAL_ERRO"
-    "R\020\001\022\035\n\031ERRCODE_INVALID_PARAMETER\020\002\022\031\n\025ER"
-    "RCODE_ALREADY_EXIST\020\003\022\025\n\021ERRCODE_NOT_EXI"
-    "ST\020\004\022\026\n\022ERRCODE_TX_TIMEOUT\020\005\022\031\n\025ERRCODE_"
-    "ACCESS_DENIED\020\006\022\031\n\025ERRCODE_MATH_OVERFLOW"
-    "\020\007\022\'\n#ERRCODE_EXPR_CONDITION_RESULT_FALS"
-    "E\020\024\022\'\n#ERRCODE_EXPR_CONDITION_SYNTAX_ERR"
-    "OR\020\025\022\032\n\026ERRCODE_INVALID_PUBKEY\020Z\022\032\n\026ERRC"
-    "ODE_INVALID_PRIKEY\020[\022\031\n\025ERRCODE_ASSET_IN"
-    "VALID\020\\\022\035\n\031ERRCODE_INVALID_SIGNATURE\020]\022\033"
-    "\n\027ERRCODE_INVALID_ADDRESS\020^\022\036\n\032ERRCODE_M"
-    "ISSING_OPERATIONS\020a\022\037\n\033ERRCODE_TOO_MANY_"
-    "OPERATIONS\020b\022\030\n\024ERRCODE_BAD_SEQUENCE\020c\022\037"
-    "\n\033ERRCODE_ACCOUNT_LOW_RESERVE\020d\022$\n ERRCO"
-    "DE_ACCOUNT_SOURCEDEST_EQUAL\020e\022\036\n\032ERRCODE"
-    "_ACCOUNT_DEST_EXIST\020f\022\035\n\031ERRCODE_ACCOUNT"
-    "_NOT_EXIST\020g\022%\n!ERRCODE_ACCOUNT_ASSET_LO"
-    "W_RESERVE\020h\022*\n&ERRCODE_ACCOUNT_ASSET_AMO"
-    "UNT_TOO_LARGE\020i\022$\n ERRCODE_ACCOUNT_INIT_"
-    "LOW_RESERVE\020j\022\032\n\026ERRCODE_FEE_NOT_ENOUGH\020"
-    "o\022\027\n\023ERRCODE_FEE_INVALID\020p\022\032\n\026ERRCODE_OU"
-    "T_OF_TXCACHE\020r\022\034\n\030ERRCODE_WEIGHT_NOT_VAL"
-    "ID\020x\022\037\n\033ERRCODE_THRESHOLD_NOT_VALID\020y\022 \n"
-    "\033ERRCODE_INVALID_DATAVERSION\020\220\001\022\034\n\027ERRCO"
-    "DE_TX_SIZE_TOO_BIG\020\222\001\022\"\n\035ERRCODE_CONTRAC"
-    "T_EXECUTE_FAIL\020\227\001\022\"\n\035ERRCODE_CONTRACT_SY"
-    "NTAX_ERROR\020\230\001\022(\n#ERRCODE_CONTRACT_TOO_MA"
-    "NY_RECURSION\020\231\001\022+\n&ERRCODE_CONTRACT_TOO_"
-    "MANY_TRANSACTIONS\020\232\001\022%\n ERRCODE_CONTRACT"
-    "_EXECUTE_EXPIRED\020\233\001\022!\n\034ERRCODE_TX_INSERT"
-    "_QUEUE_FAIL\020\240\001B\"\n io.bumo.sdk.core.exten"
-    "d.protobufb\006proto3", 1618);
+    "\022\014\n\004data\030\004 \001(\014\022\022\n\ncompressed\030\005 \001(\010\"\025\n\004Pi"
+    "ng\022\r\n\005nonce\030\001 \001(\003\"\025\n\004Pong\022\r\n\005nonce\030\001 \001(\003"
+    "*\317\t\n\tERRORCODE\022\023\n\017ERRCODE_SUCCESS\020\000\022\032\n\026E"
+    "RRCODE_INTERNAL_ERROR\020\001\022\035\n\031ERRCODE_INVAL"
+    "ID_PARAMETER\020\002\022\031\n\025ERRCODE_ALREADY_EXIST\020"
+    "\003\022\025\n\021ERRCODE_NOT_EXIST\020\004\022\026\n\022ERRCODE_TX_T"
+    "IMEOUT\020\005\022\031\n\025ERRCODE_ACCESS_DENIED\020\006\022\031\n\025E"
+    "RRCODE_MATH_OVERFLOW\020\007\022\'\n#ERRCODE_EXPR_C"
+    "ONDITION_RESULT_FALSE\020\024\022\'\n#ERRCODE_EXPR_"
+    "CONDITION_SYNTAX_ERROR\020\025\022\032\n\026ERRCODE_INVA"
+    "LID_PUBKEY\020Z\022\032\n\026ERRCODE_INVALID_PRIKEY\020["
+    "\022\031\n\025ERRCODE_ASSET_INVALID\020\\\022\035\n\031ERRCODE_I"
+    "NVALID_SIGNATURE\020]\022\033\n\027ERRCODE_INVALID_AD"
+    "DRESS\020^\022\036\n\032ERRCODE_MISSING_OPERATIONS\020a\022"
+    "\037\n\033ERRCODE_TOO_MANY_OPERATIONS\020b\022\030\n\024ERRC"
+    "ODE_BAD_SEQUENCE\020c\022\037\n\033ERRCODE_ACCOUNT_LO"
+    "W_RESERVE\020d\022$\n ERRCODE_ACCOUNT_SOURCEDES"
+    "T_EQUAL\020e\022\036\n\032ERRCODE_ACCOUNT_DEST_EXIST\020"
+    "f\022\035\n\031ERRCODE_ACCOUNT_NOT_EXIST\020g\022%\n!ERRC"
+    "ODE_ACCOUNT_ASSET_LOW_RESERVE\020h\022*\n&ERRCO"
+    "DE_ACCOUNT_ASSET_AMOUNT_TOO_LARGE\020i\022$\n E"
+    "RRCODE_ACCOUNT_INIT_LOW_RESERVE\020j\022\032\n\026ERR"
+    "CODE_FEE_NOT_ENOUGH\020o\022\027\n\023ERRCODE_FEE_INV"
+    "ALID\020p\022\032\n\026ERRCODE_OUT_OF_TXCACHE\020r\022\034\n\030ER"
+    "RCODE_WEIGHT_NOT_VALID\020x\022\037\n\033ERRCODE_THRE"
+    "SHOLD_NOT_VALID\020y\022 \n\033ERRCODE_INVALID_DAT"
+    "AVERSION\020\220\001\022\034\n\027ERRCODE_TX_SIZE_TOO_BIG\020\222"
+    "\001\022\"\n\035ERRCODE_CONTRACT_EXECUTE_FAIL\020\227\001\022\"\n"
+    "\035ERRCODE_CONTRACT_SYNTAX_ERROR\020\230\001\022(\n#ERR"
+    "CODE_CONTRACT_TOO_MANY_RECURSION\020\231\001\022+\n&E"
+    "RRCODE_CONTRACT_TOO_MANY_TRANSACTIONS\020\232\001"
+    "\022%\n ERRCODE_CONTRACT_EXECUTE_EXPIRED\020\233\001\022"
+    "!\n\034ERRCODE_TX_INSERT_QUEUE_FAIL\020\240\001B\"\n io"
+    ".bumo.sdk.core.extend.protobufb\006proto3", 1638);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "common.proto", &protobuf_RegisterTypes);
   KeyPair::default_instance_ = new KeyPair();
@@ -1519,6 +1520,7 @@ const int WsMessage::kTypeFieldNumber;
 const int WsMessage::kRequestFieldNumber;
 const int WsMessage::kSequenceFieldNumber;
 const int WsMessage::kDataFieldNumber;
+const int WsMessage::kCompressedFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 WsMessage::WsMessage()
@@ -1547,6 +1549,7 @@ void WsMessage::SharedCtor() {
   request_ = false;
   sequence_ = GOOGLE_LONGLONG(0);
   data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  compressed_ = false;
 }
 
 WsMessage::~WsMessage() {
@@ -1604,7 +1607,7 @@ void WsMessage::Clear() {
 } while (0)
 
   ZR_(type_, sequence_);
-  request_ = false;
+  ZR_(request_, compressed_);
   data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
 
 #undef ZR_HELPER_
@@ -1675,6 +1678,21 @@ bool WsMessage::MergePartialFromCodedStream(
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(40)) goto parse_compressed;
+        break;
+      }
+
+      // optional bool compressed = 5;
+      case 5: {
+        if (tag == 40) {
+         parse_compressed:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &compressed_)));
+
+        } else {
+          goto handle_unusual;
+        }
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -1724,6 +1742,11 @@ void WsMessage::SerializeWithCachedSizes(
       4, this->data(), output);
   }
 
+  // optional bool compressed = 5;
+  if (this->compressed() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(5, this->compressed(), output);
+  }
+
   // @@protoc_insertion_point(serialize_end:protocol.WsMessage)
 }
 
@@ -1752,6 +1775,11 @@ void WsMessage::SerializeWithCachedSizes(
         4, this->data(), target);
   }
 
+  // optional bool compressed = 5;
+  if (this->compressed() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(5, this->compressed(), target);
+  }
+
   // @@protoc_insertion_point(serialize_to_array_end:protocol.WsMessage)
   return target;
 }
@@ -1786,6 +1814,11 @@ int WsMessage::ByteSize() const {
         this->data());
   }
 
+  // optional bool compressed = 5;
+  if (this->compressed() != 0) {
+    total_size += 1 + 1;
+  }
+
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = total_size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
@@ -1827,6 +1860,9 @@ void WsMessage::MergeFrom(const WsMessage& from) {
 
     data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
   }
+  if (from.compressed() != 0) {
+    set_compressed(from.compressed());
+  }
 }
 
 void WsMessage::CopyFrom(const ::google::protobuf::Message& from) {
@@ -1857,6 +1893,7 @@ void WsMessage::InternalSwap(WsMessage* other) {
   std::swap(request_, other->request_);
   std::swap(sequence_, other->sequence_);
   data_.Swap(&other->data_);
+  std::swap(compressed_, other->compressed_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   std::swap(_cached_size_, other->_cached_size_);
 }
@@ -1958,6 +1995,20 @@ void WsMessage::clear_data() {
   // @@protoc_insertion_point(field_set_allocated:protocol.WsMessage.data)
 }
 
+// optional bool compressed = 5;
+void WsMessage::clear_compressed() {
+  compressed_ = false;
+}
+ bool WsMessage::compressed() const {
+  // @@protoc_insertion_point(field_get:protocol.WsMessage.compressed)
+  return compressed_;
+}
+ void WsMessage::set_compressed(bool value) {
+  
+  compressed_ = value;
+  // @@protoc_insertion_point(field_set:protocol.WsMessage.compressed)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -498,6 +498,12 @@ class WsMessage : public ::google::protobuf::Message /* @@protoc_insertion_point
   ::std::string* release_data();
   void set_allocated_data(::std::string* data);
 
+  // optional bool compressed = 5;
+  void clear_compressed();
+  static const int kCompressedFieldNumber = 5;
+  bool compressed() const;
+  void set_compressed(bool value);
+
   // @@protoc_insertion_point(class_scope:protocol.WsMessage)
  private:
 
@@ -507,6 +513,7 @@ class WsMessage : public ::google::protobuf::Message /* @@protoc_insertion_point
   ::google::protobuf::int64 sequence_;
   ::google::protobuf::internal::ArenaStringPtr data_;
   bool request_;
+  bool compressed_;
   mutable int _cached_size_;
   friend void  protobuf_AddDesc_common_2eproto();
   friend void protobuf_AssignDesc_common_2eproto();
@@ -1047,6 +1054,20 @@ inline void WsMessage::set_allocated_data(::std::string* data) {
   // @@protoc_insertion_point(field_set_allocated:protocol.WsMessage.data)
 }
 
+// optional bool compressed = 5;
+inline void WsMessage::clear_compressed() {
+  compressed_ = false;
+}
+inline bool WsMessage::compressed() const {
+  // @@protoc_insertion_point(field_get:protocol.WsMessage.compressed)
+  return compressed_;
+}
+inline void WsMessage::set_compressed(bool value) {
+  
+  compressed_ = value;
+  // @@protoc_insertion_point(field_set:protocol.WsMessage.compressed)
+}
+
 // -------------------------------------------------------------------
 
 // Ping
@@ -43,6 +43,12 @@ const ::google::protobuf::EnumDescriptor* Ledgers_SyncCode_descriptor_ = NULL;
 const ::google::protobuf::Descriptor* DontHave_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   DontHave_reflection_ = NULL;
+const ::google::protobuf::Descriptor* TransactionInventory_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  TransactionInventory_reflection_ = NULL;
+const ::google::protobuf::Descriptor* GetTransactions_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  GetTransactions_reflection_ = NULL;
 const ::google::protobuf::Descriptor* LedgerUpgradeNotify_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   LedgerUpgradeNotify_reflection_ = NULL;
@@ -61,6 +67,12 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* ChainSubscribeTx_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   ChainSubscribeTx_reflection_ = NULL;
+const ::google::protobuf::Descriptor* ChainSubscribeEvent_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  ChainSubscribeEvent_reflection_ = NULL;
+const ::google::protobuf::Descriptor* ChainLedgerClose_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  ChainLedgerClose_reflection_ = NULL;
 const ::google::protobuf::Descriptor* ChainResponse_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   ChainResponse_reflection_ = NULL;
@@ -85,7 +97,7 @@ void protobuf_AssignDesc_overlay_2eproto() {
       "overlay.proto");
   GOOGLE_CHECK(file != NULL);
   Hello_descriptor_ = file->message_type(0);
-  static const int Hello_offsets_[7] = {
+  static const int Hello_offsets_[8] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hello, network_id_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hello, ledger_version_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hello, overlay_version_),
@@ -93,6 +105,7 @@ void protobuf_AssignDesc_overlay_2eproto() {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hello, listening_port_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hello, node_address_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hello, node_rand_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Hello, compress_enabled_),
   };
   Hello_reflection_ =
     ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
@@ -210,7 +223,37 @@ void protobuf_AssignDesc_overlay_2eproto() {
       sizeof(DontHave),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DontHave, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DontHave, _is_default_instance_));
-  LedgerUpgradeNotify_descriptor_ = file->message_type(7);
+  TransactionInventory_descriptor_ = file->message_type(7);
+  static const int TransactionInventory_offsets_[1] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TransactionInventory, hashes_),
+  };
+  TransactionInventory_reflection_ =
+    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
+      TransactionInventory_descriptor_,
+      TransactionInventory::default_instance_,
+      TransactionInventory_offsets_,
+      -1,
+      -1,
+      -1,
+      sizeof(TransactionInventory),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TransactionInventory, _internal_metadata_),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TransactionInventory, _is_default_instance_));
+  GetTransactions_descriptor_ = file->message_type(8);
+  static const int GetTransactions_offsets_[1] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetTransactions, hashes_),
+  };
+  GetTransactions_reflection_ =
+    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
+      GetTransactions_descriptor_,
+      GetTransactions::default_instance_,
+      GetTransactions_offsets_,
+      -1,
+      -1,
+      -1,
+      sizeof(GetTransactions),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetTransactions, _internal_metadata_),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GetTransactions, _is_default_instance_));
+  LedgerUpgradeNotify_descriptor_ = file->message_type(9);
   static const int LedgerUpgradeNotify_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LedgerUpgradeNotify, nonce_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LedgerUpgradeNotify, upgrade_),
@@ -227,7 +270,7 @@ void protobuf_AssignDesc_overlay_2eproto() {
       sizeof(LedgerUpgradeNotify),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LedgerUpgradeNotify, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LedgerUpgradeNotify, _is_default_instance_));
-  EntryList_descriptor_ = file->message_type(8);
+  EntryList_descriptor_ = file->message_type(10);
   static const int EntryList_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EntryList, entry_),
   };
@@ -242,7 +285,7 @@ void protobuf_AssignDesc_overlay_2eproto() {
       sizeof(EntryList),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EntryList, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(EntryList, _is_default_instance_));
-  ChainHello_descriptor_ = file->message_type(9);
+  ChainHello_descriptor_ = file->message_type(11);
   static const int ChainHello_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainHello, api_list_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainHello, timestamp_),
@@ -258,7 +301,7 @@ void protobuf_AssignDesc_overlay_2eproto() {
       sizeof(ChainHello),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainHello, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainHello, _is_default_instance_));
-  ChainStatus_descriptor_ = file->message_type(10);
+  ChainStatus_descriptor_ = file->message_type(12);
   static const int ChainStatus_offsets_[5] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainStatus, self_addr_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainStatus, ledger_version_),
@@ -277,7 +320,7 @@ void protobuf_AssignDesc_overlay_2eproto() {
       sizeof(ChainStatus),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainStatus, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainStatus, _is_default_instance_));
-  ChainPeerMessage_descriptor_ = file->message_type(11);
+  ChainPeerMessage_descriptor_ = file->message_type(13);
   static const int ChainPeerMessage_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainPeerMessage, src_peer_addr_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainPeerMessage, des_peer_addrs_),
@@ -294,7 +337,7 @@ void protobuf_AssignDesc_overlay_2eproto() {
       sizeof(ChainPeerMessage),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainPeerMessage, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainPeerMessage, _is_default_instance_));
-  ChainSubscribeTx_descriptor_ = file->message_type(12);
+  ChainSubscribeTx_descriptor_ = file->message_type(14);
   static const int ChainSubscribeTx_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainSubscribeTx, address_),
   };
@@ -309,7 +352,41 @@ void protobuf_AssignDesc_overlay_2eproto() {
       sizeof(ChainSubscribeTx),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainSubscribeTx, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainSubscribeTx, _is_default_instance_));
-  ChainResponse_descriptor_ = file->message_type(13);
+  ChainSubscribeEvent_descriptor_ = file->message_type(15);
+  static const int ChainSubscribeEvent_offsets_[4] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainSubscribeEvent, accounts_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainSubscribeEvent, contracts_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainSubscribeEvent, topics_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainSubscribeEvent, ledger_close_),
+  };
+  ChainSubscribeEvent_reflection_ =
+    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
+      ChainSubscribeEvent_descriptor_,
+      ChainSubscribeEvent::default_instance_,
+      ChainSubscribeEvent_offsets_,
+      -1,
+      -1,
+      -1,
+      sizeof(ChainSubscribeEvent),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainSubscribeEvent, _internal_metadata_),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainSubscribeEvent, _is_default_instance_));
+  ChainLedgerClose_descriptor_ = file->message_type(16);
+  static const int ChainLedgerClose_offsets_[2] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainLedgerClose, header_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainLedgerClose, transactions_),
+  };
+  ChainLedgerClose_reflection_ =
+    ::google::protobuf::internal::GeneratedMessageReflection::NewGeneratedMessageReflection(
+      ChainLedgerClose_descriptor_,
+      ChainLedgerClose::default_instance_,
+      ChainLedgerClose_offsets_,
+      -1,
+      -1,
+      -1,
+      sizeof(ChainLedgerClose),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainLedgerClose, _internal_metadata_),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainLedgerClose, _is_default_instance_));
+  ChainResponse_descriptor_ = file->message_type(17);
   static const int ChainResponse_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainResponse, error_code_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainResponse, error_desc_),
@@ -325,7 +402,7 @@ void protobuf_AssignDesc_overlay_2eproto() {
       sizeof(ChainResponse),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainResponse, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainResponse, _is_default_instance_));
-  ChainTxStatus_descriptor_ = file->message_type(14);
+  ChainTxStatus_descriptor_ = file->message_type(18);
   static const int ChainTxStatus_offsets_[9] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainTxStatus, status_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainTxStatus, tx_hash_),
@@ -349,7 +426,7 @@ void protobuf_AssignDesc_overlay_2eproto() {
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainTxStatus, _internal_metadata_),
       GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainTxStatus, _is_default_instance_));
   ChainTxStatus_TxStatus_descriptor_ = ChainTxStatus_descriptor_->enum_type(0);
-  ChainInfoMessage_descriptor_ = file->message_type(15);
+  ChainInfoMessage_descriptor_ = file->message_type(19);
   static const int ChainInfoMessage_offsets_[2] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainInfoMessage, seq_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ChainInfoMessage, address_),
@@ -394,6 +471,10 @@ void protobuf_RegisterTypes(const ::std::string&) {
       Ledgers_descriptor_, &Ledgers::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
       DontHave_descriptor_, &DontHave::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+      TransactionInventory_descriptor_, &TransactionInventory::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+      GetTransactions_descriptor_, &GetTransactions::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
       LedgerUpgradeNotify_descriptor_, &LedgerUpgradeNotify::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
@@ -406,6 +487,10 @@ void protobuf_RegisterTypes(const ::std::string&) {
       ChainPeerMessage_descriptor_, &ChainPeerMessage::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
       ChainSubscribeTx_descriptor_, &ChainSubscribeTx::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+      ChainSubscribeEvent_descriptor_, &ChainSubscribeEvent::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+      ChainLedgerClose_descriptor_, &ChainLedgerClose::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
       ChainResponse_descriptor_, &ChainResponse::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
@@ -431,6 +516,10 @@ void protobuf_ShutdownFile_overlay_2eproto() {
   delete Ledgers_reflection_;
   delete DontHave::default_instance_;
   delete DontHave_reflection_;
+  delete TransactionInventory::default_instance_;
+  delete TransactionInventory_reflection_;
+  delete GetTransactions::default_instance_;
+  delete GetTransactions_reflection_;
   delete LedgerUpgradeNotify::default_instance_;
   delete LedgerUpgradeNotify_reflection_;
   delete EntryList::default_instance_;
@@ -443,6 +532,10 @@ void protobuf_ShutdownFile_overlay_2eproto() {
   delete ChainPeerMessage_reflection_;
   delete ChainSubscribeTx::default_instance_;
   delete ChainSubscribeTx_reflection_;
+  delete ChainSubscribeEvent::default_instance_;
+  delete ChainSubscribeEvent_reflection_;
+  delete ChainLedgerClose::default_instance_;
+  delete ChainLedgerClose_reflection_;
   delete ChainResponse::default_instance_;
   delete ChainResponse_reflection_;
   delete ChainTxStatus::default_instance_;
@@ -462,63 +555,74 @@ void protobuf_AddDesc_overlay_2eproto() {
   ::protocol::protobuf_AddDesc_chain_2eproto();
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
     "\n\roverlay.proto\022\010protocol\032\014common.proto\032"
-    "\013chain.proto\"\243\001\n\005Hello\022\022\n\nnetwork_id\030\001 \001"
+    "\013chain.proto\"\275\001\n\005Hello\022\022\n\nnetwork_id\030\001 \001"
     "(\003\022\026\n\016ledger_version\030\002 \001(\003\022\027\n\017overlay_ve"
     "rsion\030\003 \001(\003\022\024\n\014bumo_version\030\004 \001(\t\022\026\n\016lis"
     "tening_port\030\005 \001(\003\022\024\n\014node_address\030\006 \001(\t\022"
-    "\021\n\tnode_rand\030\007 \001(\t\"L\n\rHelloResponse\022\'\n\ne"
-    "rror_code\030\001 \001(\0162\023.protocol.ERRORCODE\022\022\n\n"
-    "error_desc\030\002 \001(\t\"}\n\004Peer\022\n\n\002ip\030\001 \001(\t\022\014\n\004"
-    "port\030\002 \001(\003\022\024\n\014num_failures\030\003 \001(\003\022\031\n\021next"
-    "_attempt_time\030\004 \001(\003\022\023\n\013active_time\030\005 \001(\003"
-    "\022\025\n\rconnection_id\030\006 \001(\003\"&\n\005Peers\022\035\n\005peer"
-    "s\030\001 \003(\0132\016.protocol.Peer\"M\n\nGetLedgers\022\r\n"
-    "\005begin\030\001 \001(\003\022\013\n\003end\030\002 \001(\003\022\021\n\ttimestamp\030\003"
-    " \001(\003\022\020\n\010chain_id\030\004 \001(\003\"\361\001\n\007Ledgers\022(\n\006va"
-    "lues\030\001 \003(\0132\030.protocol.ConsensusValue\022-\n\t"
-    "sync_code\030\002 \001(\0162\032.protocol.Ledgers.SyncC"
-    "ode\022\017\n\007max_seq\030\003 \001(\003\022\r\n\005proof\030\004 \001(\014\022\020\n\010c"
-    "hain_id\030\005 \001(\003\"[\n\010SyncCode\022\006\n\002OK\020\000\022\017\n\013OUT"
-    "_OF_SYNC\020\001\022\022\n\016OUT_OF_LEDGERS\020\002\022\010\n\004BUSY\020\003"
-    "\022\n\n\006REFUSE\020\004\022\014\n\010INTERNAL\020\005\"&\n\010DontHave\022\014"
-    "\n\004type\030\001 \001(\003\022\014\n\004hash\030\002 \001(\014\"v\n\023LedgerUpgr"
-    "adeNotify\022\r\n\005nonce\030\001 \001(\003\022(\n\007upgrade\030\002 \001("
-    "\0132\027.protocol.LedgerUpgrade\022&\n\tsignature\030"
-    "\003 \001(\0132\023.protocol.Signature\"\032\n\tEntryList\022"
-    "\r\n\005entry\030\001 \003(\014\"M\n\nChainHello\022,\n\010api_list"
-    "\030\001 \003(\0162\032.protocol.ChainMessageType\022\021\n\tti"
-    "mestamp\030\002 \001(\003\"z\n\013ChainStatus\022\021\n\tself_add"
-    "r\030\001 \001(\t\022\026\n\016ledger_version\030\002 \001(\003\022\027\n\017monit"
-    "or_version\030\003 \001(\003\022\024\n\014bumo_version\030\004 \001(\t\022\021"
-    "\n\ttimestamp\030\005 \001(\003\"O\n\020ChainPeerMessage\022\025\n"
-    "\rsrc_peer_addr\030\001 \001(\t\022\026\n\016des_peer_addrs\030\002"
-    " \003(\t\022\014\n\004data\030\003 \001(\014\"#\n\020ChainSubscribeTx\022\017"
-    "\n\007address\030\001 \003(\t\"7\n\rChainResponse\022\022\n\nerro"
-    "r_code\030\001 \001(\005\022\022\n\nerror_desc\030\002 \001(\t\"\325\002\n\rCha"
-    "inTxStatus\0220\n\006status\030\001 \001(\0162 .protocol.Ch"
-    "ainTxStatus.TxStatus\022\017\n\007tx_hash\030\002 \001(\t\022\026\n"
-    "\016source_address\030\003 \001(\t\022\032\n\022source_account_"
-    "seq\030\004 \001(\003\022\022\n\nledger_seq\030\005 \001(\003\022\027\n\017new_acc"
-    "ount_seq\030\006 \001(\003\022\'\n\nerror_code\030\007 \001(\0162\023.pro"
-    "tocol.ERRORCODE\022\022\n\nerror_desc\030\010 \001(\t\022\021\n\tt"
-    "imestamp\030\t \001(\003\"P\n\010TxStatus\022\r\n\tUNDEFINED\020"
-    "\000\022\r\n\tCONFIRMED\020\001\022\013\n\007PENDING\020\002\022\014\n\010COMPLET"
-    "E\020\003\022\013\n\007FAILURE\020\004\"0\n\020ChainInfoMessage\022\013\n\003"
-    "seq\030\001 \001(\003\022\017\n\007address\030\002 \001(\t*\203\002\n\024OVERLAY_M"
-    "ESSAGE_TYPE\022\030\n\024OVERLAY_MSGTYPE_NONE\020\000\022\030\n"
-    "\024OVERLAY_MSGTYPE_PING\020\001\022\031\n\025OVERLAY_MSGTY"
-    "PE_HELLO\020\002\022\031\n\025OVERLAY_MSGTYPE_PEERS\020\003\022\037\n"
-    "\033OVERLAY_MSGTYPE_TRANSACTION\020\004\022\033\n\027OVERLA"
-    "Y_MSGTYPE_LEDGERS\020\005\022\030\n\024OVERLAY_MSGTYPE_P"
-    "BFT\020\006\022)\n%OVERLAY_MSGTYPE_LEDGER_UPGRADE_"
-    "NOTIFY\020\007*\372\001\n\020ChainMessageType\022\023\n\017CHAIN_T"
-    "YPE_NONE\020\000\022\017\n\013CHAIN_HELLO\020\n\022\023\n\017CHAIN_TX_"
-    "STATUS\020\013\022\025\n\021CHAIN_PEER_ONLINE\020\014\022\026\n\022CHAIN"
-    "_PEER_OFFLINE\020\r\022\026\n\022CHAIN_PEER_MESSAGE\020\016\022"
-    "\033\n\027CHAIN_SUBMITTRANSACTION\020\017\022\027\n\023CHAIN_LE"
-    "DGER_HEADER\020\020\022\026\n\022CHAIN_SUBSCRIBE_TX\020\021\022\026\n"
-    "\022CHAIN_TX_ENV_STORE\020\022B\"\n io.bumo.sdk.cor"
-    "e.extend.protobufb\006proto3", 2305);
+    "\021\n\tnode_rand\030\007 \001(\t\022\030\n\020compress_enabled\030\010"
+    " \001(\010\"L\n\rHelloResponse\022\'\n\nerror_code\030\001 \001("
+    "\0162\023.protocol.ERRORCODE\022\022\n\nerror_desc\030\002 \001"
+    "(\t\"}\n\004Peer\022\n\n\002ip\030\001 \001(\t\022\014\n\004port\030\002 \001(\003\022\024\n\014"
+    "num_failures\030\003 \001(\003\022\031\n\021next_attempt_time\030"
+    "\004 \001(\003\022\023\n\013active_time\030\005 \001(\003\022\025\n\rconnection"
+    "_id\030\006 \001(\003\"&\n\005Peers\022\035\n\005peers\030\001 \003(\0132\016.prot"
+    "ocol.Peer\"M\n\nGetLedgers\022\r\n\005begin\030\001 \001(\003\022\013"
+    "\n\003end\030\002 \001(\003\022\021\n\ttimestamp\030\003 \001(\003\022\020\n\010chain_"
+    "id\030\004 \001(\003\"\361\001\n\007Ledgers\022(\n\006values\030\001 \003(\0132\030.p"
+    "rotocol.ConsensusValue\022-\n\tsync_code\030\002 \001("
+    "\0162\032.protocol.Ledgers.SyncCode\022\017\n\007max_seq"
+    "\030\003 \001(\003\022\r\n\005proof\030\004 \001(\014\022\020\n\010chain_id\030\005 \001(\003\""
+    "[\n\010SyncCode\022\006\n\002OK\020\000\022\017\n\013OUT_OF_SYNC\020\001\022\022\n\016"
+    "OUT_OF_LEDGERS\020\002\022\010\n\004BUSY\020\003\022\n\n\006REFUSE\020\004\022\014"
+    "\n\010INTERNAL\020\005\"&\n\010DontHave\022\014\n\004type\030\001 \001(\003\022\014"
+    "\n\004hash\030\002 \001(\014\"&\n\024TransactionInventory\022\016\n\006"
+    "hashes\030\001 \003(\014\"!\n\017GetTransactions\022\016\n\006hashe"
+    "s\030\001 \003(\014\"v\n\023LedgerUpgradeNotify\022\r\n\005nonce\030"
+    "\001 \001(\003\022(\n\007upgrade\030\002 \001(\0132\027.protocol.Ledger"
+    "Upgrade\022&\n\tsignature\030\003 \001(\0132\023.protocol.Si"
+    "gnature\"\032\n\tEntryList\022\r\n\005entry\030\001 \003(\014\"M\n\nC"
+    "hainHello\022,\n\010api_list\030\001 \003(\0162\032.protocol.C"
+    "hainMessageType\022\021\n\ttimestamp\030\002 \001(\003\"z\n\013Ch"
+    "ainStatus\022\021\n\tself_addr\030\001 \001(\t\022\026\n\016ledger_v"
+    "ersion\030\002 \001(\003\022\027\n\017monitor_version\030\003 \001(\003\022\024\n"
+    "\014bumo_version\030\004 \001(\t\022\021\n\ttimestamp\030\005 \001(\003\"O"
+    "\n\020ChainPeerMessage\022\025\n\rsrc_peer_addr\030\001 \001("
+    "\t\022\026\n\016des_peer_addrs\030\002 \003(\t\022\014\n\004data\030\003 \001(\014\""
+    "#\n\020ChainSubscribeTx\022\017\n\007address\030\001 \003(\t\"`\n\023"
+    "ChainSubscribeEvent\022\020\n\010accounts\030\001 \003(\t\022\021\n"
+    "\tcontracts\030\002 \003(\t\022\016\n\006topics\030\003 \003(\t\022\024\n\014ledg"
+    "er_close\030\004 \001(\010\"o\n\020ChainLedgerClose\022&\n\006he"
+    "ader\030\001 \001(\0132\026.protocol.LedgerHeader\0223\n\014tr"
+    "ansactions\030\002 \003(\0132\035.protocol.TransactionE"
+    "nvStore\"7\n\rChainResponse\022\022\n\nerror_code\030\001"
+    " \001(\005\022\022\n\nerror_desc\030\002 \001(\t\"\325\002\n\rChainTxStat"
+    "us\0220\n\006status\030\001 \001(\0162 .protocol.ChainTxSta"
+    "tus.TxStatus\022\017\n\007tx_hash\030\002 \001(\t\022\026\n\016source_"
+    "address\030\003 \001(\t\022\032\n\022source_account_seq\030\004 \001("
+    "\003\022\022\n\nledger_seq\030\005 \001(\003\022\027\n\017new_account_seq"
+    "\030\006 \001(\003\022\'\n\nerror_code\030\007 \001(\0162\023.protocol.ER"
+    "RORCODE\022\022\n\nerror_desc\030\010 \001(\t\022\021\n\ttimestamp"
+    "\030\t \001(\003\"P\n\010TxStatus\022\r\n\tUNDEFINED\020\000\022\r\n\tCON"
+    "FIRMED\020\001\022\013\n\007PENDING\020\002\022\014\n\010COMPLETE\020\003\022\013\n\007F"
+    "AILURE\020\004\"0\n\020ChainInfoMessage\022\013\n\003seq\030\001 \001("
+    "\003\022\017\n\007address\030\002 \001(\t*\324\002\n\024OVERLAY_MESSAGE_T"
+    "YPE\022\030\n\024OVERLAY_MSGTYPE_NONE\020\000\022\030\n\024OVERLAY"
+    "_MSGTYPE_PING\020\001\022\031\n\025OVERLAY_MSGTYPE_HELLO"
+    "\020\002\022\031\n\025OVERLAY_MSGTYPE_PEERS\020\003\022\037\n\033OVERLAY"
+    "_MSGTYPE_TRANSACTION\020\004\022\033\n\027OVERLAY_MSGTYP"
+    "E_LEDGERS\020\005\022\030\n\024OVERLAY_MSGTYPE_PBFT\020\006\022)\n"
+    "%OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY\020\007"
+    "\022)\n%OVERLAY_MSGTYPE_TRANSACTION_INVENTOR"
+    "Y\020\010\022$\n OVERLAY_MSGTYPE_GET_TRANSACTIONS\020"
+    "\t*\255\002\n\020ChainMessageType\022\023\n\017CHAIN_TYPE_NON"
+    "E\020\000\022\017\n\013CHAIN_HELLO\020\n\022\023\n\017CHAIN_TX_STATUS\020"
+    "\013\022\025\n\021CHAIN_PEER_ONLINE\020\014\022\026\n\022CHAIN_PEER_O"
+    "FFLINE\020\r\022\026\n\022CHAIN_PEER_MESSAGE\020\016\022\033\n\027CHAI"
+    "N_SUBMITTRANSACTION\020\017\022\027\n\023CHAIN_LEDGER_HE"
+    "ADER\020\020\022\026\n\022CHAIN_SUBSCRIBE_TX\020\021\022\026\n\022CHAIN_"
+    "TX_ENV_STORE\020\022\022\031\n\025CHAIN_SUBSCRIBE_EVENT\020"
+    "\023\022\026\n\022CHAIN_LEDGER_CLOSE\020\024B\"\n io.bumo.sdk"
+    ".core.extend.protobufb\006proto3", 2749);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "overlay.proto", &protobuf_RegisterTypes);
   Hello::default_instance_ = new Hello();
@@ -528,12 +632,16 @@ void protobuf_AddDesc_overlay_2eproto() {
   GetLedgers::default_instance_ = new GetLedgers();
   Ledgers::default_instance_ = new Ledgers();
   DontHave::default_instance_ = new DontHave();
+  TransactionInventory::default_instance_ = new TransactionInventory();
+  GetTransactions::default_instance_ = new GetTransactions();
   LedgerUpgradeNotify::default_instance_ = new LedgerUpgradeNotify();
   EntryList::default_instance_ = new EntryList();
   ChainHello::default_instance_ = new ChainHello();
   ChainStatus::default_instance_ = new ChainStatus();
   ChainPeerMessage::default_instance_ = new ChainPeerMessage();
   ChainSubscribeTx::default_instance_ = new ChainSubscribeTx();
+  ChainSubscribeEvent::default_instance_ = new ChainSubscribeEvent();
+  ChainLedgerClose::default_instance_ = new ChainLedgerClose();
   ChainResponse::default_instance_ = new ChainResponse();
   ChainTxStatus::default_instance_ = new ChainTxStatus();
   ChainInfoMessage::default_instance_ = new ChainInfoMessage();
@@ -544,12 +652,16 @@ void protobuf_AddDesc_overlay_2eproto() {
   GetLedgers::default_instance_->InitAsDefaultInstance();
   Ledgers::default_instance_->InitAsDefaultInstance();
   DontHave::default_instance_->InitAsDefaultInstance();
+  TransactionInventory::default_instance_->InitAsDefaultInstance();
+  GetTransactions::default_instance_->InitAsDefaultInstance();
   LedgerUpgradeNotify::default_instance_->InitAsDefaultInstance();
   EntryList::default_instance_->InitAsDefaultInstance();
   ChainHello::default_instance_->InitAsDefaultInstance();
   ChainStatus::default_instance_->InitAsDefaultInstance();
   ChainPeerMessage::default_instance_->InitAsDefaultInstance();
   ChainSubscribeTx::default_instance_->InitAsDefaultInstance();
+  ChainSubscribeEvent::default_instance_->InitAsDefaultInstance();
+  ChainLedgerClose::default_instance_->InitAsDefaultInstance();
   ChainResponse::default_instance_->InitAsDefaultInstance();
   ChainTxStatus::default_instance_->InitAsDefaultInstance();
   ChainInfoMessage::default_instance_->InitAsDefaultInstance();
@@ -576,6 +688,8 @@ bool OVERLAY_MESSAGE_TYPE_IsValid(int value) {
     case 5:
     case 6:
     case 7:
+    case 8:
+    case 9:
       return true;
     default:
       return false;
@@ -598,6 +712,8 @@ bool ChainMessageType_IsValid(int value) {
     case 16:
     case 17:
     case 18:
+    case 19:
+    case 20:
       return true;
     default:
       return false;
@@ -615,6 +731,7 @@ const int Hello::kBumoVersionFieldNumber;
 const int Hello::kListeningPortFieldNumber;
 const int Hello::kNodeAddressFieldNumber;
 const int Hello::kNodeRandFieldNumber;
+const int Hello::kCompressEnabledFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
 Hello::Hello()
@@ -646,6 +763,7 @@ void Hello::SharedCtor() {
   listening_port_ = GOOGLE_LONGLONG(0);
   node_address_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   node_rand_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  compress_enabled_ = false;
 }
 
 Hello::~Hello() {
@@ -709,6 +827,7 @@ void Hello::Clear() {
   listening_port_ = GOOGLE_LONGLONG(0);
   node_address_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   node_rand_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  compress_enabled_ = false;
 
 #undef ZR_HELPER_
 #undef ZR_
@@ -831,6 +950,21 @@ bool Hello::MergePartialFromCodedStream(
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(64)) goto parse_compress_enabled;
+        break;
+      }
+
+      // optional bool compress_enabled = 8;
+      case 8: {
+        if (tag == 64) {
+         parse_compress_enabled:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &compress_enabled_)));
+
+        } else {
+          goto handle_unusual;
+        }
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -909,6 +1043,11 @@ void Hello::SerializeWithCachedSizes(
       7, this->node_rand(), output);
   }
 
+  // optional bool compress_enabled = 8;
+  if (this->compress_enabled() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(8, this->compress_enabled(), output);
+  }
+
   // @@protoc_insertion_point(serialize_end:protocol.Hello)
 }
 
@@ -968,6 +1107,11 @@ void Hello::SerializeWithCachedSizes(
         7, this->node_rand(), target);
   }
 
+  // optional bool compress_enabled = 8;
+  if (this->compress_enabled() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(8, this->compress_enabled(), target);
+  }
+
   // @@protoc_insertion_point(serialize_to_array_end:protocol.Hello)
   return target;
 }
@@ -1025,6 +1169,11 @@ int Hello::ByteSize() const {
         this->node_rand());
   }
 
+  // optional bool compress_enabled = 8;
+  if (this->compress_enabled() != 0) {
+    total_size += 1 + 1;
+  }
+
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = total_size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
@@ -1077,6 +1226,9 @@ void Hello::MergeFrom(const Hello& from) {
 
     node_rand_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.node_rand_);
   }
+  if (from.compress_enabled() != 0) {
+    set_compress_enabled(from.compress_enabled());
+  }
 }
 
 void Hello::CopyFrom(const ::google::protobuf::Message& from) {
@@ -1110,6 +1262,7 @@ void Hello::InternalSwap(Hello* other) {
   std::swap(listening_port_, other->listening_port_);
   node_address_.Swap(&other->node_address_);
   node_rand_.Swap(&other->node_rand_);
+  std::swap(compress_enabled_, other->compress_enabled_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   std::swap(_cached_size_, other->_cached_size_);
 }
@@ -1313,6 +1466,20 @@ void Hello::clear_node_rand() {
   // @@protoc_insertion_point(field_set_allocated:protocol.Hello.node_rand)
 }
 
+// optional bool compress_enabled = 8;
+void Hello::clear_compress_enabled() {
+  compress_enabled_ = false;
+}
+ bool Hello::compress_enabled() const {
+  // @@protoc_insertion_point(field_get:protocol.Hello.compress_enabled)
+  return compress_enabled_;
+}
+ void Hello::set_compress_enabled(bool value) {
+  
+  compress_enabled_ = value;
+  // @@protoc_insertion_point(field_set:protocol.Hello.compress_enabled)
+}
+
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
 
 // ===================================================================
@@ -3771,131 +3938,93 @@ void DontHave::clear_hash() {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int LedgerUpgradeNotify::kNonceFieldNumber;
-const int LedgerUpgradeNotify::kUpgradeFieldNumber;
-const int LedgerUpgradeNotify::kSignatureFieldNumber;
+const int TransactionInventory::kHashesFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-LedgerUpgradeNotify::LedgerUpgradeNotify()
+TransactionInventory::TransactionInventory()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:protocol.LedgerUpgradeNotify)
+  // @@protoc_insertion_point(constructor:protocol.TransactionInventory)
 }
 
-void LedgerUpgradeNotify::InitAsDefaultInstance() {
+void TransactionInventory::InitAsDefaultInstance() {
   _is_default_instance_ = true;
-  upgrade_ = const_cast< ::protocol::LedgerUpgrade*>(&::protocol::LedgerUpgrade::default_instance());
-  signature_ = const_cast< ::protocol::Signature*>(&::protocol::Signature::default_instance());
 }
 
-LedgerUpgradeNotify::LedgerUpgradeNotify(const LedgerUpgradeNotify& from)
+TransactionInventory::TransactionInventory(const TransactionInventory& from)
   : ::google::protobuf::Message(),
     _internal_metadata_(NULL) {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:protocol.LedgerUpgradeNotify)
+  // @@protoc_insertion_point(copy_constructor:protocol.TransactionInventory)
 }
 
-void LedgerUpgradeNotify::SharedCtor() {
+void TransactionInventory::SharedCtor() {
     _is_default_instance_ = false;
+  ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
-  nonce_ = GOOGLE_LONGLONG(0);
-  upgrade_ = NULL;
-  signature_ = NULL;
 }
 
-LedgerUpgradeNotify::~LedgerUpgradeNotify() {
-  // @@protoc_insertion_point(destructor:protocol.LedgerUpgradeNotify)
+TransactionInventory::~TransactionInventory() {
+  // @@protoc_insertion_point(destructor:protocol.TransactionInventory)
   SharedDtor();
 }
 
-void LedgerUpgradeNotify::SharedDtor() {
+void TransactionInventory::SharedDtor() {
   if (this != default_instance_) {
-    delete upgrade_;
-    delete signature_;
   }
 }
 
-void LedgerUpgradeNotify::SetCachedSize(int size) const {
+void TransactionInventory::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* LedgerUpgradeNotify::descriptor() {
+const ::google::protobuf::Descriptor* TransactionInventory::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return LedgerUpgradeNotify_descriptor_;
+  return TransactionInventory_descriptor_;
 }
 
-const LedgerUpgradeNotify& LedgerUpgradeNotify::default_instance() {
+const TransactionInventory& TransactionInventory::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_overlay_2eproto();
   return *default_instance_;
 }
 
-LedgerUpgradeNotify* LedgerUpgradeNotify::default_instance_ = NULL;
+TransactionInventory* TransactionInventory::default_instance_ = NULL;
 
-LedgerUpgradeNotify* LedgerUpgradeNotify::New(::google::protobuf::Arena* arena) const {
-  LedgerUpgradeNotify* n = new LedgerUpgradeNotify;
+TransactionInventory* TransactionInventory::New(::google::protobuf::Arena* arena) const {
+  TransactionInventory* n = new TransactionInventory;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void LedgerUpgradeNotify::Clear() {
-// @@protoc_insertion_point(message_clear_start:protocol.LedgerUpgradeNotify)
-  nonce_ = GOOGLE_LONGLONG(0);
-  if (GetArenaNoVirtual() == NULL && upgrade_ != NULL) delete upgrade_;
-  upgrade_ = NULL;
-  if (GetArenaNoVirtual() == NULL && signature_ != NULL) delete signature_;
-  signature_ = NULL;
+void TransactionInventory::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.TransactionInventory)
+  hashes_.Clear();
 }
 
-bool LedgerUpgradeNotify::MergePartialFromCodedStream(
+bool TransactionInventory::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:protocol.LedgerUpgradeNotify)
+  // @@protoc_insertion_point(parse_start:protocol.TransactionInventory)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional int64 nonce = 1;
+      // repeated bytes hashes = 1;
       case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &nonce_)));
-
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_upgrade;
-        break;
-      }
-
-      // optional .protocol.LedgerUpgrade upgrade = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_upgrade:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_upgrade()));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(26)) goto parse_signature;
-        break;
-      }
-
-      // optional .protocol.Signature signature = 3;
-      case 3: {
-        if (tag == 26) {
-         parse_signature:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_signature()));
+        if (tag == 10) {
+         parse_hashes:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->add_hashes()));
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(10)) goto parse_hashes;
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -3913,86 +4042,48 @@ bool LedgerUpgradeNotify::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:protocol.LedgerUpgradeNotify)
+  // @@protoc_insertion_point(parse_success:protocol.TransactionInventory)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:protocol.LedgerUpgradeNotify)
+  // @@protoc_insertion_point(parse_failure:protocol.TransactionInventory)
   return false;
 #undef DO_
 }
 
-void LedgerUpgradeNotify::SerializeWithCachedSizes(
+void TransactionInventory::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:protocol.LedgerUpgradeNotify)
-  // optional int64 nonce = 1;
-  if (this->nonce() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(1, this->nonce(), output);
-  }
-
-  // optional .protocol.LedgerUpgrade upgrade = 2;
-  if (this->has_upgrade()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, *this->upgrade_, output);
-  }
-
-  // optional .protocol.Signature signature = 3;
-  if (this->has_signature()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, *this->signature_, output);
+  // @@protoc_insertion_point(serialize_start:protocol.TransactionInventory)
+  // repeated bytes hashes = 1;
+  for (int i = 0; i < this->hashes_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      1, this->hashes(i), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:protocol.LedgerUpgradeNotify)
+  // @@protoc_insertion_point(serialize_end:protocol.TransactionInventory)
 }
 
-::google::protobuf::uint8* LedgerUpgradeNotify::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* TransactionInventory::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:protocol.LedgerUpgradeNotify)
-  // optional int64 nonce = 1;
-  if (this->nonce() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(1, this->nonce(), target);
-  }
-
-  // optional .protocol.LedgerUpgrade upgrade = 2;
-  if (this->has_upgrade()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        2, *this->upgrade_, false, target);
-  }
-
-  // optional .protocol.Signature signature = 3;
-  if (this->has_signature()) {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.TransactionInventory)
+  // repeated bytes hashes = 1;
+  for (int i = 0; i < this->hashes_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageNoVirtualToArray(
-        3, *this->signature_, false, target);
+      WriteBytesToArray(1, this->hashes(i), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:protocol.LedgerUpgradeNotify)
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.TransactionInventory)
   return target;
 }
 
-int LedgerUpgradeNotify::ByteSize() const {
-// @@protoc_insertion_point(message_byte_size_start:protocol.LedgerUpgradeNotify)
+int TransactionInventory::ByteSize() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.TransactionInventory)
   int total_size = 0;
 
-  // optional int64 nonce = 1;
-  if (this->nonce() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->nonce());
-  }
-
-  // optional .protocol.LedgerUpgrade upgrade = 2;
-  if (this->has_upgrade()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->upgrade_);
-  }
-
-  // optional .protocol.Signature signature = 3;
-  if (this->has_signature()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        *this->signature_);
+  // repeated bytes hashes = 1;
+  total_size += 1 * this->hashes_size();
+  for (int i = 0; i < this->hashes_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::BytesSize(
+      this->hashes(i));
   }
 
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
@@ -4001,169 +4092,124 @@ int LedgerUpgradeNotify::ByteSize() const {
   return total_size;
 }
 
-void LedgerUpgradeNotify::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.LedgerUpgradeNotify)
+void TransactionInventory::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protocol.TransactionInventory)
   if (GOOGLE_PREDICT_FALSE(&from == this)) {
     ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
   }
-  const LedgerUpgradeNotify* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const LedgerUpgradeNotify>(
+  const TransactionInventory* source = 
+      ::google::protobuf::internal::DynamicCastToGenerated<const TransactionInventory>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.LedgerUpgradeNotify)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.TransactionInventory)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.LedgerUpgradeNotify)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.TransactionInventory)
     MergeFrom(*source);
   }
 }
 
-void LedgerUpgradeNotify::MergeFrom(const LedgerUpgradeNotify& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.LedgerUpgradeNotify)
+void TransactionInventory::MergeFrom(const TransactionInventory& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protocol.TransactionInventory)
   if (GOOGLE_PREDICT_FALSE(&from == this)) {
     ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
   }
-  if (from.nonce() != 0) {
-    set_nonce(from.nonce());
-  }
-  if (from.has_upgrade()) {
-    mutable_upgrade()->::protocol::LedgerUpgrade::MergeFrom(from.upgrade());
-  }
-  if (from.has_signature()) {
-    mutable_signature()->::protocol::Signature::MergeFrom(from.signature());
-  }
+  hashes_.MergeFrom(from.hashes_);
 }
 
-void LedgerUpgradeNotify::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.LedgerUpgradeNotify)
+void TransactionInventory::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protocol.TransactionInventory)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void LedgerUpgradeNotify::CopyFrom(const LedgerUpgradeNotify& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:protocol.LedgerUpgradeNotify)
+void TransactionInventory::CopyFrom(const TransactionInventory& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.TransactionInventory)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool LedgerUpgradeNotify::IsInitialized() const {
+bool TransactionInventory::IsInitialized() const {
 
   return true;
 }
 
-void LedgerUpgradeNotify::Swap(LedgerUpgradeNotify* other) {
+void TransactionInventory::Swap(TransactionInventory* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void LedgerUpgradeNotify::InternalSwap(LedgerUpgradeNotify* other) {
-  std::swap(nonce_, other->nonce_);
-  std::swap(upgrade_, other->upgrade_);
-  std::swap(signature_, other->signature_);
+void TransactionInventory::InternalSwap(TransactionInventory* other) {
+  hashes_.UnsafeArenaSwap(&other->hashes_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata LedgerUpgradeNotify::GetMetadata() const {
+::google::protobuf::Metadata TransactionInventory::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = LedgerUpgradeNotify_descriptor_;
-  metadata.reflection = LedgerUpgradeNotify_reflection_;
+  metadata.descriptor = TransactionInventory_descriptor_;
+  metadata.reflection = TransactionInventory_reflection_;
   return metadata;
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// LedgerUpgradeNotify
+// TransactionInventory
 
-// optional int64 nonce = 1;
-void LedgerUpgradeNotify::clear_nonce() {
-  nonce_ = GOOGLE_LONGLONG(0);
+// repeated bytes hashes = 1;
+int TransactionInventory::hashes_size() const {
+  return hashes_.size();
 }
- ::google::protobuf::int64 LedgerUpgradeNotify::nonce() const {
-  // @@protoc_insertion_point(field_get:protocol.LedgerUpgradeNotify.nonce)
-  return nonce_;
+void TransactionInventory::clear_hashes() {
+  hashes_.Clear();
 }
- void LedgerUpgradeNotify::set_nonce(::google::protobuf::int64 value) {
-  
-  nonce_ = value;
-  // @@protoc_insertion_point(field_set:protocol.LedgerUpgradeNotify.nonce)
+ const ::std::string& TransactionInventory::hashes(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionInventory.hashes)
+  return hashes_.Get(index);
 }
-
-// optional .protocol.LedgerUpgrade upgrade = 2;
-bool LedgerUpgradeNotify::has_upgrade() const {
-  return !_is_default_instance_ && upgrade_ != NULL;
+ ::std::string* TransactionInventory::mutable_hashes(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.TransactionInventory.hashes)
+  return hashes_.Mutable(index);
 }
-void LedgerUpgradeNotify::clear_upgrade() {
-  if (GetArenaNoVirtual() == NULL && upgrade_ != NULL) delete upgrade_;
-  upgrade_ = NULL;
+ void TransactionInventory::set_hashes(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.TransactionInventory.hashes)
+  hashes_.Mutable(index)->assign(value);
 }
-const ::protocol::LedgerUpgrade& LedgerUpgradeNotify::upgrade() const {
-  // @@protoc_insertion_point(field_get:protocol.LedgerUpgradeNotify.upgrade)
-  return upgrade_ != NULL ? *upgrade_ : *default_instance_->upgrade_;
+ void TransactionInventory::set_hashes(int index, const char* value) {
+  hashes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.TransactionInventory.hashes)
 }
-::protocol::LedgerUpgrade* LedgerUpgradeNotify::mutable_upgrade() {
-  
-  if (upgrade_ == NULL) {
-    upgrade_ = new ::protocol::LedgerUpgrade;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.LedgerUpgradeNotify.upgrade)
-  return upgrade_;
+ void TransactionInventory::set_hashes(int index, const void* value, size_t size) {
+  hashes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protocol.TransactionInventory.hashes)
 }
-::protocol::LedgerUpgrade* LedgerUpgradeNotify::release_upgrade() {
-  // @@protoc_insertion_point(field_release:protocol.LedgerUpgradeNotify.upgrade)
-  
-  ::protocol::LedgerUpgrade* temp = upgrade_;
-  upgrade_ = NULL;
-  return temp;
+ ::std::string* TransactionInventory::add_hashes() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.TransactionInventory.hashes)
+  return hashes_.Add();
 }
-void LedgerUpgradeNotify::set_allocated_upgrade(::protocol::LedgerUpgrade* upgrade) {
-  delete upgrade_;
-  upgrade_ = upgrade;
-  if (upgrade) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerUpgradeNotify.upgrade)
+ void TransactionInventory::add_hashes(const ::std::string& value) {
+  hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.TransactionInventory.hashes)
 }
-
-// optional .protocol.Signature signature = 3;
-bool LedgerUpgradeNotify::has_signature() const {
-  return !_is_default_instance_ && signature_ != NULL;
-}
-void LedgerUpgradeNotify::clear_signature() {
-  if (GetArenaNoVirtual() == NULL && signature_ != NULL) delete signature_;
-  signature_ = NULL;
-}
-const ::protocol::Signature& LedgerUpgradeNotify::signature() const {
-  // @@protoc_insertion_point(field_get:protocol.LedgerUpgradeNotify.signature)
-  return signature_ != NULL ? *signature_ : *default_instance_->signature_;
+ void TransactionInventory::add_hashes(const char* value) {
+  hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.TransactionInventory.hashes)
 }
-::protocol::Signature* LedgerUpgradeNotify::mutable_signature() {
-  
-  if (signature_ == NULL) {
-    signature_ = new ::protocol::Signature;
-  }
-  // @@protoc_insertion_point(field_mutable:protocol.LedgerUpgradeNotify.signature)
-  return signature_;
+ void TransactionInventory::add_hashes(const void* value, size_t size) {
+  hashes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.TransactionInventory.hashes)
 }
-::protocol::Signature* LedgerUpgradeNotify::release_signature() {
-  // @@protoc_insertion_point(field_release:protocol.LedgerUpgradeNotify.signature)
-  
-  ::protocol::Signature* temp = signature_;
-  signature_ = NULL;
-  return temp;
+ const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TransactionInventory::hashes() const {
+  // @@protoc_insertion_point(field_list:protocol.TransactionInventory.hashes)
+  return hashes_;
 }
-void LedgerUpgradeNotify::set_allocated_signature(::protocol::Signature* signature) {
-  delete signature_;
-  signature_ = signature;
-  if (signature) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerUpgradeNotify.signature)
+ ::google::protobuf::RepeatedPtrField< ::std::string>*
+TransactionInventory::mutable_hashes() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.TransactionInventory.hashes)
+  return &hashes_;
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -4171,93 +4217,93 @@ void LedgerUpgradeNotify::set_allocated_signature(::protocol::Signature* signatu
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int EntryList::kEntryFieldNumber;
+const int GetTransactions::kHashesFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-EntryList::EntryList()
+GetTransactions::GetTransactions()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:protocol.EntryList)
+  // @@protoc_insertion_point(constructor:protocol.GetTransactions)
 }
 
-void EntryList::InitAsDefaultInstance() {
+void GetTransactions::InitAsDefaultInstance() {
   _is_default_instance_ = true;
 }
 
-EntryList::EntryList(const EntryList& from)
+GetTransactions::GetTransactions(const GetTransactions& from)
   : ::google::protobuf::Message(),
     _internal_metadata_(NULL) {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:protocol.EntryList)
+  // @@protoc_insertion_point(copy_constructor:protocol.GetTransactions)
 }
 
-void EntryList::SharedCtor() {
+void GetTransactions::SharedCtor() {
     _is_default_instance_ = false;
   ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
 }
 
-EntryList::~EntryList() {
-  // @@protoc_insertion_point(destructor:protocol.EntryList)
+GetTransactions::~GetTransactions() {
+  // @@protoc_insertion_point(destructor:protocol.GetTransactions)
   SharedDtor();
 }
 
-void EntryList::SharedDtor() {
+void GetTransactions::SharedDtor() {
   if (this != default_instance_) {
   }
 }
 
-void EntryList::SetCachedSize(int size) const {
+void GetTransactions::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* EntryList::descriptor() {
+const ::google::protobuf::Descriptor* GetTransactions::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return EntryList_descriptor_;
+  return GetTransactions_descriptor_;
 }
 
-const EntryList& EntryList::default_instance() {
+const GetTransactions& GetTransactions::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_overlay_2eproto();
   return *default_instance_;
 }
 
-EntryList* EntryList::default_instance_ = NULL;
+GetTransactions* GetTransactions::default_instance_ = NULL;
 
-EntryList* EntryList::New(::google::protobuf::Arena* arena) const {
-  EntryList* n = new EntryList;
+GetTransactions* GetTransactions::New(::google::protobuf::Arena* arena) const {
+  GetTransactions* n = new GetTransactions;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void EntryList::Clear() {
-// @@protoc_insertion_point(message_clear_start:protocol.EntryList)
-  entry_.Clear();
+void GetTransactions::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.GetTransactions)
+  hashes_.Clear();
 }
 
-bool EntryList::MergePartialFromCodedStream(
+bool GetTransactions::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:protocol.EntryList)
+  // @@protoc_insertion_point(parse_start:protocol.GetTransactions)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated bytes entry = 1;
+      // repeated bytes hashes = 1;
       case 1: {
         if (tag == 10) {
-         parse_entry:
+         parse_hashes:
           DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->add_entry()));
+                input, this->add_hashes()));
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(10)) goto parse_entry;
+        if (input->ExpectTag(10)) goto parse_hashes;
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -4275,48 +4321,48 @@ bool EntryList::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:protocol.EntryList)
+  // @@protoc_insertion_point(parse_success:protocol.GetTransactions)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:protocol.EntryList)
+  // @@protoc_insertion_point(parse_failure:protocol.GetTransactions)
   return false;
 #undef DO_
 }
 
-void EntryList::SerializeWithCachedSizes(
+void GetTransactions::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:protocol.EntryList)
-  // repeated bytes entry = 1;
-  for (int i = 0; i < this->entry_size(); i++) {
+  // @@protoc_insertion_point(serialize_start:protocol.GetTransactions)
+  // repeated bytes hashes = 1;
+  for (int i = 0; i < this->hashes_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      1, this->entry(i), output);
+      1, this->hashes(i), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:protocol.EntryList)
+  // @@protoc_insertion_point(serialize_end:protocol.GetTransactions)
 }
 
-::google::protobuf::uint8* EntryList::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* GetTransactions::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:protocol.EntryList)
-  // repeated bytes entry = 1;
-  for (int i = 0; i < this->entry_size(); i++) {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.GetTransactions)
+  // repeated bytes hashes = 1;
+  for (int i = 0; i < this->hashes_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
-      WriteBytesToArray(1, this->entry(i), target);
+      WriteBytesToArray(1, this->hashes(i), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:protocol.EntryList)
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.GetTransactions)
   return target;
 }
 
-int EntryList::ByteSize() const {
-// @@protoc_insertion_point(message_byte_size_start:protocol.EntryList)
+int GetTransactions::ByteSize() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.GetTransactions)
   int total_size = 0;
 
-  // repeated bytes entry = 1;
-  total_size += 1 * this->entry_size();
-  for (int i = 0; i < this->entry_size(); i++) {
+  // repeated bytes hashes = 1;
+  total_size += 1 * this->hashes_size();
+  for (int i = 0; i < this->hashes_size(); i++) {
     total_size += ::google::protobuf::internal::WireFormatLite::BytesSize(
-      this->entry(i));
+      this->hashes(i));
   }
 
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
@@ -4325,124 +4371,124 @@ int EntryList::ByteSize() const {
   return total_size;
 }
 
-void EntryList::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.EntryList)
+void GetTransactions::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protocol.GetTransactions)
   if (GOOGLE_PREDICT_FALSE(&from == this)) {
     ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
   }
-  const EntryList* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const EntryList>(
+  const GetTransactions* source = 
+      ::google::protobuf::internal::DynamicCastToGenerated<const GetTransactions>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.EntryList)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.GetTransactions)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.EntryList)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.GetTransactions)
     MergeFrom(*source);
   }
 }
 
-void EntryList::MergeFrom(const EntryList& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.EntryList)
+void GetTransactions::MergeFrom(const GetTransactions& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protocol.GetTransactions)
   if (GOOGLE_PREDICT_FALSE(&from == this)) {
     ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
   }
-  entry_.MergeFrom(from.entry_);
+  hashes_.MergeFrom(from.hashes_);
 }
 
-void EntryList::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.EntryList)
+void GetTransactions::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protocol.GetTransactions)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void EntryList::CopyFrom(const EntryList& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:protocol.EntryList)
+void GetTransactions::CopyFrom(const GetTransactions& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.GetTransactions)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool EntryList::IsInitialized() const {
+bool GetTransactions::IsInitialized() const {
 
   return true;
 }
 
-void EntryList::Swap(EntryList* other) {
+void GetTransactions::Swap(GetTransactions* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void EntryList::InternalSwap(EntryList* other) {
-  entry_.UnsafeArenaSwap(&other->entry_);
+void GetTransactions::InternalSwap(GetTransactions* other) {
+  hashes_.UnsafeArenaSwap(&other->hashes_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata EntryList::GetMetadata() const {
+::google::protobuf::Metadata GetTransactions::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = EntryList_descriptor_;
-  metadata.reflection = EntryList_reflection_;
+  metadata.descriptor = GetTransactions_descriptor_;
+  metadata.reflection = GetTransactions_reflection_;
   return metadata;
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// EntryList
+// GetTransactions
 
-// repeated bytes entry = 1;
-int EntryList::entry_size() const {
-  return entry_.size();
+// repeated bytes hashes = 1;
+int GetTransactions::hashes_size() const {
+  return hashes_.size();
 }
-void EntryList::clear_entry() {
-  entry_.Clear();
+void GetTransactions::clear_hashes() {
+  hashes_.Clear();
 }
- const ::std::string& EntryList::entry(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.EntryList.entry)
-  return entry_.Get(index);
+ const ::std::string& GetTransactions::hashes(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.GetTransactions.hashes)
+  return hashes_.Get(index);
 }
- ::std::string* EntryList::mutable_entry(int index) {
-  // @@protoc_insertion_point(field_mutable:protocol.EntryList.entry)
-  return entry_.Mutable(index);
+ ::std::string* GetTransactions::mutable_hashes(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.GetTransactions.hashes)
+  return hashes_.Mutable(index);
 }
- void EntryList::set_entry(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:protocol.EntryList.entry)
-  entry_.Mutable(index)->assign(value);
+ void GetTransactions::set_hashes(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.GetTransactions.hashes)
+  hashes_.Mutable(index)->assign(value);
 }
- void EntryList::set_entry(int index, const char* value) {
-  entry_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:protocol.EntryList.entry)
+ void GetTransactions::set_hashes(int index, const char* value) {
+  hashes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.GetTransactions.hashes)
 }
- void EntryList::set_entry(int index, const void* value, size_t size) {
-  entry_.Mutable(index)->assign(
+ void GetTransactions::set_hashes(int index, const void* value, size_t size) {
+  hashes_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:protocol.EntryList.entry)
+  // @@protoc_insertion_point(field_set_pointer:protocol.GetTransactions.hashes)
 }
- ::std::string* EntryList::add_entry() {
-  // @@protoc_insertion_point(field_add_mutable:protocol.EntryList.entry)
-  return entry_.Add();
+ ::std::string* GetTransactions::add_hashes() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.GetTransactions.hashes)
+  return hashes_.Add();
 }
- void EntryList::add_entry(const ::std::string& value) {
-  entry_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:protocol.EntryList.entry)
+ void GetTransactions::add_hashes(const ::std::string& value) {
+  hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.GetTransactions.hashes)
 }
- void EntryList::add_entry(const char* value) {
-  entry_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:protocol.EntryList.entry)
+ void GetTransactions::add_hashes(const char* value) {
+  hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.GetTransactions.hashes)
 }
- void EntryList::add_entry(const void* value, size_t size) {
-  entry_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:protocol.EntryList.entry)
+ void GetTransactions::add_hashes(const void* value, size_t size) {
+  hashes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.GetTransactions.hashes)
 }
  const ::google::protobuf::RepeatedPtrField< ::std::string>&
-EntryList::entry() const {
-  // @@protoc_insertion_point(field_list:protocol.EntryList.entry)
-  return entry_;
+GetTransactions::hashes() const {
+  // @@protoc_insertion_point(field_list:protocol.GetTransactions.hashes)
+  return hashes_;
 }
  ::google::protobuf::RepeatedPtrField< ::std::string>*
-EntryList::mutable_entry() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.EntryList.entry)
-  return &entry_;
+GetTransactions::mutable_hashes() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.GetTransactions.hashes)
+  return &hashes_;
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -4450,120 +4496,128 @@ EntryList::mutable_entry() {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ChainHello::kApiListFieldNumber;
-const int ChainHello::kTimestampFieldNumber;
+const int LedgerUpgradeNotify::kNonceFieldNumber;
+const int LedgerUpgradeNotify::kUpgradeFieldNumber;
+const int LedgerUpgradeNotify::kSignatureFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-ChainHello::ChainHello()
+LedgerUpgradeNotify::LedgerUpgradeNotify()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:protocol.ChainHello)
+  // @@protoc_insertion_point(constructor:protocol.LedgerUpgradeNotify)
 }
 
-void ChainHello::InitAsDefaultInstance() {
+void LedgerUpgradeNotify::InitAsDefaultInstance() {
   _is_default_instance_ = true;
+  upgrade_ = const_cast< ::protocol::LedgerUpgrade*>(&::protocol::LedgerUpgrade::default_instance());
+  signature_ = const_cast< ::protocol::Signature*>(&::protocol::Signature::default_instance());
 }
 
-ChainHello::ChainHello(const ChainHello& from)
+LedgerUpgradeNotify::LedgerUpgradeNotify(const LedgerUpgradeNotify& from)
   : ::google::protobuf::Message(),
     _internal_metadata_(NULL) {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:protocol.ChainHello)
+  // @@protoc_insertion_point(copy_constructor:protocol.LedgerUpgradeNotify)
 }
 
-void ChainHello::SharedCtor() {
+void LedgerUpgradeNotify::SharedCtor() {
     _is_default_instance_ = false;
   _cached_size_ = 0;
-  timestamp_ = GOOGLE_LONGLONG(0);
+  nonce_ = GOOGLE_LONGLONG(0);
+  upgrade_ = NULL;
+  signature_ = NULL;
 }
 
-ChainHello::~ChainHello() {
-  // @@protoc_insertion_point(destructor:protocol.ChainHello)
+LedgerUpgradeNotify::~LedgerUpgradeNotify() {
+  // @@protoc_insertion_point(destructor:protocol.LedgerUpgradeNotify)
   SharedDtor();
 }
 
-void ChainHello::SharedDtor() {
+void LedgerUpgradeNotify::SharedDtor() {
   if (this != default_instance_) {
+    delete upgrade_;
+    delete signature_;
   }
 }
 
-void ChainHello::SetCachedSize(int size) const {
+void LedgerUpgradeNotify::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* ChainHello::descriptor() {
+const ::google::protobuf::Descriptor* LedgerUpgradeNotify::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return ChainHello_descriptor_;
+  return LedgerUpgradeNotify_descriptor_;
 }
 
-const ChainHello& ChainHello::default_instance() {
+const LedgerUpgradeNotify& LedgerUpgradeNotify::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_overlay_2eproto();
   return *default_instance_;
 }
 
-ChainHello* ChainHello::default_instance_ = NULL;
+LedgerUpgradeNotify* LedgerUpgradeNotify::default_instance_ = NULL;
 
-ChainHello* ChainHello::New(::google::protobuf::Arena* arena) const {
-  ChainHello* n = new ChainHello;
+LedgerUpgradeNotify* LedgerUpgradeNotify::New(::google::protobuf::Arena* arena) const {
+  LedgerUpgradeNotify* n = new LedgerUpgradeNotify;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void ChainHello::Clear() {
-// @@protoc_insertion_point(message_clear_start:protocol.ChainHello)
-  timestamp_ = GOOGLE_LONGLONG(0);
-  api_list_.Clear();
+void LedgerUpgradeNotify::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.LedgerUpgradeNotify)
+  nonce_ = GOOGLE_LONGLONG(0);
+  if (GetArenaNoVirtual() == NULL && upgrade_ != NULL) delete upgrade_;
+  upgrade_ = NULL;
+  if (GetArenaNoVirtual() == NULL && signature_ != NULL) delete signature_;
+  signature_ = NULL;
 }
 
-bool ChainHello::MergePartialFromCodedStream(
+bool LedgerUpgradeNotify::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:protocol.ChainHello)
+  // @@protoc_insertion_point(parse_start:protocol.LedgerUpgradeNotify)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .protocol.ChainMessageType api_list = 1;
+      // optional int64 nonce = 1;
       case 1: {
-        if (tag == 10) {
-          ::google::protobuf::uint32 length;
-          DO_(input->ReadVarint32(&length));
-          ::google::protobuf::io::CodedInputStream::Limit limit = input->PushLimit(length);
-          while (input->BytesUntilLimit() > 0) {
-            int value;
-            DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-            add_api_list(static_cast< ::protocol::ChainMessageType >(value));
-          }
-          input->PopLimit(limit);
-        } else if (tag == 8) {
-          int value;
+        if (tag == 8) {
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          add_api_list(static_cast< ::protocol::ChainMessageType >(value));
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &nonce_)));
+
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(16)) goto parse_timestamp;
+        if (input->ExpectTag(18)) goto parse_upgrade;
         break;
       }
 
-      // optional int64 timestamp = 2;
+      // optional .protocol.LedgerUpgrade upgrade = 2;
       case 2: {
-        if (tag == 16) {
-         parse_timestamp:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &timestamp_)));
+        if (tag == 18) {
+         parse_upgrade:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_upgrade()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(26)) goto parse_signature;
+        break;
+      }
 
+      // optional .protocol.Signature signature = 3;
+      case 3: {
+        if (tag == 26) {
+         parse_signature:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_signature()));
         } else {
           goto handle_unusual;
         }
@@ -4584,89 +4638,86 @@ bool ChainHello::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:protocol.ChainHello)
+  // @@protoc_insertion_point(parse_success:protocol.LedgerUpgradeNotify)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:protocol.ChainHello)
+  // @@protoc_insertion_point(parse_failure:protocol.LedgerUpgradeNotify)
   return false;
 #undef DO_
 }
 
-void ChainHello::SerializeWithCachedSizes(
+void LedgerUpgradeNotify::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:protocol.ChainHello)
-  // repeated .protocol.ChainMessageType api_list = 1;
-  if (this->api_list_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(
-      1,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      output);
-    output->WriteVarint32(_api_list_cached_byte_size_);
+  // @@protoc_insertion_point(serialize_start:protocol.LedgerUpgradeNotify)
+  // optional int64 nonce = 1;
+  if (this->nonce() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(1, this->nonce(), output);
   }
-  for (int i = 0; i < this->api_list_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnumNoTag(
-      this->api_list(i), output);
+
+  // optional .protocol.LedgerUpgrade upgrade = 2;
+  if (this->has_upgrade()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, *this->upgrade_, output);
   }
 
-  // optional int64 timestamp = 2;
-  if (this->timestamp() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->timestamp(), output);
+  // optional .protocol.Signature signature = 3;
+  if (this->has_signature()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, *this->signature_, output);
   }
 
-  // @@protoc_insertion_point(serialize_end:protocol.ChainHello)
+  // @@protoc_insertion_point(serialize_end:protocol.LedgerUpgradeNotify)
 }
 
-::google::protobuf::uint8* ChainHello::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* LedgerUpgradeNotify::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:protocol.ChainHello)
-  // repeated .protocol.ChainMessageType api_list = 1;
-  if (this->api_list_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      1,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(    _api_list_cached_byte_size_, target);
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.LedgerUpgradeNotify)
+  // optional int64 nonce = 1;
+  if (this->nonce() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(1, this->nonce(), target);
   }
-  for (int i = 0; i < this->api_list_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumNoTagToArray(
-      this->api_list(i), target);
+
+  // optional .protocol.LedgerUpgrade upgrade = 2;
+  if (this->has_upgrade()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        2, *this->upgrade_, false, target);
   }
 
-  // optional int64 timestamp = 2;
-  if (this->timestamp() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->timestamp(), target);
+  // optional .protocol.Signature signature = 3;
+  if (this->has_signature()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        3, *this->signature_, false, target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:protocol.ChainHello)
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.LedgerUpgradeNotify)
   return target;
 }
 
-int ChainHello::ByteSize() const {
-// @@protoc_insertion_point(message_byte_size_start:protocol.ChainHello)
+int LedgerUpgradeNotify::ByteSize() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.LedgerUpgradeNotify)
   int total_size = 0;
 
-  // optional int64 timestamp = 2;
-  if (this->timestamp() != 0) {
+  // optional int64 nonce = 1;
+  if (this->nonce() != 0) {
     total_size += 1 +
       ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->timestamp());
+        this->nonce());
   }
 
-  // repeated .protocol.ChainMessageType api_list = 1;
-  {
-    int data_size = 0;
-    for (int i = 0; i < this->api_list_size(); i++) {
-      data_size += ::google::protobuf::internal::WireFormatLite::EnumSize(
-        this->api_list(i));
-    }
-    if (data_size > 0) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
-    }
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _api_list_cached_byte_size_ = data_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
-    total_size += data_size;
+  // optional .protocol.LedgerUpgrade upgrade = 2;
+  if (this->has_upgrade()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->upgrade_);
+  }
+
+  // optional .protocol.Signature signature = 3;
+  if (this->has_signature()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->signature_);
   }
 
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
@@ -4675,309 +4726,263 @@ int ChainHello::ByteSize() const {
   return total_size;
 }
 
-void ChainHello::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.ChainHello)
+void LedgerUpgradeNotify::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protocol.LedgerUpgradeNotify)
   if (GOOGLE_PREDICT_FALSE(&from == this)) {
     ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
   }
-  const ChainHello* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const ChainHello>(
+  const LedgerUpgradeNotify* source = 
+      ::google::protobuf::internal::DynamicCastToGenerated<const LedgerUpgradeNotify>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.ChainHello)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.LedgerUpgradeNotify)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.ChainHello)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.LedgerUpgradeNotify)
     MergeFrom(*source);
   }
 }
 
-void ChainHello::MergeFrom(const ChainHello& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.ChainHello)
+void LedgerUpgradeNotify::MergeFrom(const LedgerUpgradeNotify& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protocol.LedgerUpgradeNotify)
   if (GOOGLE_PREDICT_FALSE(&from == this)) {
     ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
   }
-  api_list_.MergeFrom(from.api_list_);
-  if (from.timestamp() != 0) {
-    set_timestamp(from.timestamp());
+  if (from.nonce() != 0) {
+    set_nonce(from.nonce());
+  }
+  if (from.has_upgrade()) {
+    mutable_upgrade()->::protocol::LedgerUpgrade::MergeFrom(from.upgrade());
+  }
+  if (from.has_signature()) {
+    mutable_signature()->::protocol::Signature::MergeFrom(from.signature());
   }
 }
 
-void ChainHello::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.ChainHello)
+void LedgerUpgradeNotify::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protocol.LedgerUpgradeNotify)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ChainHello::CopyFrom(const ChainHello& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:protocol.ChainHello)
+void LedgerUpgradeNotify::CopyFrom(const LedgerUpgradeNotify& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.LedgerUpgradeNotify)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ChainHello::IsInitialized() const {
+bool LedgerUpgradeNotify::IsInitialized() const {
 
   return true;
 }
 
-void ChainHello::Swap(ChainHello* other) {
+void LedgerUpgradeNotify::Swap(LedgerUpgradeNotify* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void ChainHello::InternalSwap(ChainHello* other) {
-  api_list_.UnsafeArenaSwap(&other->api_list_);
-  std::swap(timestamp_, other->timestamp_);
+void LedgerUpgradeNotify::InternalSwap(LedgerUpgradeNotify* other) {
+  std::swap(nonce_, other->nonce_);
+  std::swap(upgrade_, other->upgrade_);
+  std::swap(signature_, other->signature_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata ChainHello::GetMetadata() const {
+::google::protobuf::Metadata LedgerUpgradeNotify::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ChainHello_descriptor_;
-  metadata.reflection = ChainHello_reflection_;
+  metadata.descriptor = LedgerUpgradeNotify_descriptor_;
+  metadata.reflection = LedgerUpgradeNotify_reflection_;
   return metadata;
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ChainHello
+// LedgerUpgradeNotify
 
-// repeated .protocol.ChainMessageType api_list = 1;
-int ChainHello::api_list_size() const {
-  return api_list_.size();
-}
-void ChainHello::clear_api_list() {
-  api_list_.Clear();
-}
- ::protocol::ChainMessageType ChainHello::api_list(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.ChainHello.api_list)
-  return static_cast< ::protocol::ChainMessageType >(api_list_.Get(index));
-}
- void ChainHello::set_api_list(int index, ::protocol::ChainMessageType value) {
-  api_list_.Set(index, value);
-  // @@protoc_insertion_point(field_set:protocol.ChainHello.api_list)
-}
- void ChainHello::add_api_list(::protocol::ChainMessageType value) {
-  api_list_.Add(value);
-  // @@protoc_insertion_point(field_add:protocol.ChainHello.api_list)
+// optional int64 nonce = 1;
+void LedgerUpgradeNotify::clear_nonce() {
+  nonce_ = GOOGLE_LONGLONG(0);
 }
- const ::google::protobuf::RepeatedField<int>&
-ChainHello::api_list() const {
-  // @@protoc_insertion_point(field_list:protocol.ChainHello.api_list)
-  return api_list_;
+ ::google::protobuf::int64 LedgerUpgradeNotify::nonce() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerUpgradeNotify.nonce)
+  return nonce_;
 }
- ::google::protobuf::RepeatedField<int>*
-ChainHello::mutable_api_list() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.ChainHello.api_list)
-  return &api_list_;
+ void LedgerUpgradeNotify::set_nonce(::google::protobuf::int64 value) {
+  
+  nonce_ = value;
+  // @@protoc_insertion_point(field_set:protocol.LedgerUpgradeNotify.nonce)
 }
 
-// optional int64 timestamp = 2;
-void ChainHello::clear_timestamp() {
-  timestamp_ = GOOGLE_LONGLONG(0);
+// optional .protocol.LedgerUpgrade upgrade = 2;
+bool LedgerUpgradeNotify::has_upgrade() const {
+  return !_is_default_instance_ && upgrade_ != NULL;
 }
- ::google::protobuf::int64 ChainHello::timestamp() const {
-  // @@protoc_insertion_point(field_get:protocol.ChainHello.timestamp)
-  return timestamp_;
+void LedgerUpgradeNotify::clear_upgrade() {
+  if (GetArenaNoVirtual() == NULL && upgrade_ != NULL) delete upgrade_;
+  upgrade_ = NULL;
 }
- void ChainHello::set_timestamp(::google::protobuf::int64 value) {
+const ::protocol::LedgerUpgrade& LedgerUpgradeNotify::upgrade() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerUpgradeNotify.upgrade)
+  return upgrade_ != NULL ? *upgrade_ : *default_instance_->upgrade_;
+}
+::protocol::LedgerUpgrade* LedgerUpgradeNotify::mutable_upgrade() {
   
-  timestamp_ = value;
-  // @@protoc_insertion_point(field_set:protocol.ChainHello.timestamp)
+  if (upgrade_ == NULL) {
+    upgrade_ = new ::protocol::LedgerUpgrade;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.LedgerUpgradeNotify.upgrade)
+  return upgrade_;
 }
-
-#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
-
-// ===================================================================
-
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ChainStatus::kSelfAddrFieldNumber;
-const int ChainStatus::kLedgerVersionFieldNumber;
-const int ChainStatus::kMonitorVersionFieldNumber;
-const int ChainStatus::kBumoVersionFieldNumber;
-const int ChainStatus::kTimestampFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-ChainStatus::ChainStatus()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:protocol.ChainStatus)
+::protocol::LedgerUpgrade* LedgerUpgradeNotify::release_upgrade() {
+  // @@protoc_insertion_point(field_release:protocol.LedgerUpgradeNotify.upgrade)
+  
+  ::protocol::LedgerUpgrade* temp = upgrade_;
+  upgrade_ = NULL;
+  return temp;
 }
-
-void ChainStatus::InitAsDefaultInstance() {
-  _is_default_instance_ = true;
+void LedgerUpgradeNotify::set_allocated_upgrade(::protocol::LedgerUpgrade* upgrade) {
+  delete upgrade_;
+  upgrade_ = upgrade;
+  if (upgrade) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerUpgradeNotify.upgrade)
 }
 
-ChainStatus::ChainStatus(const ChainStatus& from)
-  : ::google::protobuf::Message(),
-    _internal_metadata_(NULL) {
-  SharedCtor();
-  MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:protocol.ChainStatus)
+// optional .protocol.Signature signature = 3;
+bool LedgerUpgradeNotify::has_signature() const {
+  return !_is_default_instance_ && signature_ != NULL;
+}
+void LedgerUpgradeNotify::clear_signature() {
+  if (GetArenaNoVirtual() == NULL && signature_ != NULL) delete signature_;
+  signature_ = NULL;
+}
+const ::protocol::Signature& LedgerUpgradeNotify::signature() const {
+  // @@protoc_insertion_point(field_get:protocol.LedgerUpgradeNotify.signature)
+  return signature_ != NULL ? *signature_ : *default_instance_->signature_;
+}
+::protocol::Signature* LedgerUpgradeNotify::mutable_signature() {
+  
+  if (signature_ == NULL) {
+    signature_ = new ::protocol::Signature;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.LedgerUpgradeNotify.signature)
+  return signature_;
+}
+::protocol::Signature* LedgerUpgradeNotify::release_signature() {
+  // @@protoc_insertion_point(field_release:protocol.LedgerUpgradeNotify.signature)
+  
+  ::protocol::Signature* temp = signature_;
+  signature_ = NULL;
+  return temp;
+}
+void LedgerUpgradeNotify::set_allocated_signature(::protocol::Signature* signature) {
+  delete signature_;
+  signature_ = signature;
+  if (signature) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.LedgerUpgradeNotify.signature)
 }
 
-void ChainStatus::SharedCtor() {
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int EntryList::kEntryFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+EntryList::EntryList()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protocol.EntryList)
+}
+
+void EntryList::InitAsDefaultInstance() {
+  _is_default_instance_ = true;
+}
+
+EntryList::EntryList(const EntryList& from)
+  : ::google::protobuf::Message(),
+    _internal_metadata_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:protocol.EntryList)
+}
+
+void EntryList::SharedCtor() {
     _is_default_instance_ = false;
   ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
-  self_addr_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ledger_version_ = GOOGLE_LONGLONG(0);
-  monitor_version_ = GOOGLE_LONGLONG(0);
-  bumo_version_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  timestamp_ = GOOGLE_LONGLONG(0);
 }
 
-ChainStatus::~ChainStatus() {
-  // @@protoc_insertion_point(destructor:protocol.ChainStatus)
+EntryList::~EntryList() {
+  // @@protoc_insertion_point(destructor:protocol.EntryList)
   SharedDtor();
 }
 
-void ChainStatus::SharedDtor() {
-  self_addr_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  bumo_version_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void EntryList::SharedDtor() {
   if (this != default_instance_) {
   }
 }
 
-void ChainStatus::SetCachedSize(int size) const {
+void EntryList::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* ChainStatus::descriptor() {
+const ::google::protobuf::Descriptor* EntryList::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return ChainStatus_descriptor_;
+  return EntryList_descriptor_;
 }
 
-const ChainStatus& ChainStatus::default_instance() {
+const EntryList& EntryList::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_overlay_2eproto();
   return *default_instance_;
 }
 
-ChainStatus* ChainStatus::default_instance_ = NULL;
+EntryList* EntryList::default_instance_ = NULL;
 
-ChainStatus* ChainStatus::New(::google::protobuf::Arena* arena) const {
-  ChainStatus* n = new ChainStatus;
+EntryList* EntryList::New(::google::protobuf::Arena* arena) const {
+  EntryList* n = new EntryList;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void ChainStatus::Clear() {
-// @@protoc_insertion_point(message_clear_start:protocol.ChainStatus)
-#if defined(__clang__)
-#define ZR_HELPER_(f) \
-  _Pragma("clang diagnostic push") \
-  _Pragma("clang diagnostic ignored \"-Winvalid-offsetof\"") \
-  __builtin_offsetof(ChainStatus, f) \
-  _Pragma("clang diagnostic pop")
-#else
-#define ZR_HELPER_(f) reinterpret_cast<char*>(\
-  &reinterpret_cast<ChainStatus*>(16)->f)
-#endif
-
-#define ZR_(first, last) do {\
-  ::memset(&first, 0,\
-           ZR_HELPER_(last) - ZR_HELPER_(first) + sizeof(last));\
-} while (0)
-
-  ZR_(ledger_version_, monitor_version_);
-  self_addr_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  bumo_version_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  timestamp_ = GOOGLE_LONGLONG(0);
-
-#undef ZR_HELPER_
-#undef ZR_
-
+void EntryList::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.EntryList)
+  entry_.Clear();
 }
 
-bool ChainStatus::MergePartialFromCodedStream(
+bool EntryList::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:protocol.ChainStatus)
+  // @@protoc_insertion_point(parse_start:protocol.EntryList)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional string self_addr = 1;
+      // repeated bytes entry = 1;
       case 1: {
         if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_self_addr()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->self_addr().data(), this->self_addr().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "protocol.ChainStatus.self_addr"));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(16)) goto parse_ledger_version;
-        break;
-      }
-
-      // optional int64 ledger_version = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_ledger_version:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &ledger_version_)));
-
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(24)) goto parse_monitor_version;
-        break;
-      }
-
-      // optional int64 monitor_version = 3;
-      case 3: {
-        if (tag == 24) {
-         parse_monitor_version:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &monitor_version_)));
-
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(34)) goto parse_bumo_version;
-        break;
-      }
-
-      // optional string bumo_version = 4;
-      case 4: {
-        if (tag == 34) {
-         parse_bumo_version:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_bumo_version()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->bumo_version().data(), this->bumo_version().length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "protocol.ChainStatus.bumo_version"));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(40)) goto parse_timestamp;
-        break;
-      }
-
-      // optional int64 timestamp = 5;
-      case 5: {
-        if (tag == 40) {
-         parse_timestamp:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &timestamp_)));
-
+         parse_entry:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->add_entry()));
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(10)) goto parse_entry;
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -4995,136 +5000,1718 @@ bool ChainStatus::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:protocol.ChainStatus)
+  // @@protoc_insertion_point(parse_success:protocol.EntryList)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:protocol.ChainStatus)
+  // @@protoc_insertion_point(parse_failure:protocol.EntryList)
   return false;
 #undef DO_
 }
 
-void ChainStatus::SerializeWithCachedSizes(
+void EntryList::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:protocol.ChainStatus)
-  // optional string self_addr = 1;
-  if (this->self_addr().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->self_addr().data(), this->self_addr().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "protocol.ChainStatus.self_addr");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->self_addr(), output);
+  // @@protoc_insertion_point(serialize_start:protocol.EntryList)
+  // repeated bytes entry = 1;
+  for (int i = 0; i < this->entry_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      1, this->entry(i), output);
   }
 
-  // optional int64 ledger_version = 2;
-  if (this->ledger_version() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->ledger_version(), output);
-  }
+  // @@protoc_insertion_point(serialize_end:protocol.EntryList)
+}
 
-  // optional int64 monitor_version = 3;
-  if (this->monitor_version() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->monitor_version(), output);
+::google::protobuf::uint8* EntryList::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.EntryList)
+  // repeated bytes entry = 1;
+  for (int i = 0; i < this->entry_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteBytesToArray(1, this->entry(i), target);
   }
 
-  // optional string bumo_version = 4;
-  if (this->bumo_version().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->bumo_version().data(), this->bumo_version().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "protocol.ChainStatus.bumo_version");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      4, this->bumo_version(), output);
-  }
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.EntryList)
+  return target;
+}
 
-  // optional int64 timestamp = 5;
-  if (this->timestamp() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(5, this->timestamp(), output);
+int EntryList::ByteSize() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.EntryList)
+  int total_size = 0;
+
+  // repeated bytes entry = 1;
+  total_size += 1 * this->entry_size();
+  for (int i = 0; i < this->entry_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::BytesSize(
+      this->entry(i));
   }
 
-  // @@protoc_insertion_point(serialize_end:protocol.ChainStatus)
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void EntryList::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protocol.EntryList)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  const EntryList* source = 
+      ::google::protobuf::internal::DynamicCastToGenerated<const EntryList>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.EntryList)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.EntryList)
+    MergeFrom(*source);
+  }
+}
+
+void EntryList::MergeFrom(const EntryList& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protocol.EntryList)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  entry_.MergeFrom(from.entry_);
+}
+
+void EntryList::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protocol.EntryList)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void EntryList::CopyFrom(const EntryList& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.EntryList)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EntryList::IsInitialized() const {
+
+  return true;
+}
+
+void EntryList::Swap(EntryList* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void EntryList::InternalSwap(EntryList* other) {
+  entry_.UnsafeArenaSwap(&other->entry_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata EntryList::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = EntryList_descriptor_;
+  metadata.reflection = EntryList_reflection_;
+  return metadata;
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// EntryList
+
+// repeated bytes entry = 1;
+int EntryList::entry_size() const {
+  return entry_.size();
+}
+void EntryList::clear_entry() {
+  entry_.Clear();
+}
+ const ::std::string& EntryList::entry(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.EntryList.entry)
+  return entry_.Get(index);
+}
+ ::std::string* EntryList::mutable_entry(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.EntryList.entry)
+  return entry_.Mutable(index);
+}
+ void EntryList::set_entry(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.EntryList.entry)
+  entry_.Mutable(index)->assign(value);
+}
+ void EntryList::set_entry(int index, const char* value) {
+  entry_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.EntryList.entry)
+}
+ void EntryList::set_entry(int index, const void* value, size_t size) {
+  entry_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protocol.EntryList.entry)
+}
+ ::std::string* EntryList::add_entry() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.EntryList.entry)
+  return entry_.Add();
+}
+ void EntryList::add_entry(const ::std::string& value) {
+  entry_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.EntryList.entry)
+}
+ void EntryList::add_entry(const char* value) {
+  entry_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.EntryList.entry)
+}
+ void EntryList::add_entry(const void* value, size_t size) {
+  entry_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.EntryList.entry)
+}
+ const ::google::protobuf::RepeatedPtrField< ::std::string>&
+EntryList::entry() const {
+  // @@protoc_insertion_point(field_list:protocol.EntryList.entry)
+  return entry_;
+}
+ ::google::protobuf::RepeatedPtrField< ::std::string>*
+EntryList::mutable_entry() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.EntryList.entry)
+  return &entry_;
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ChainHello::kApiListFieldNumber;
+const int ChainHello::kTimestampFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ChainHello::ChainHello()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protocol.ChainHello)
+}
+
+void ChainHello::InitAsDefaultInstance() {
+  _is_default_instance_ = true;
+}
+
+ChainHello::ChainHello(const ChainHello& from)
+  : ::google::protobuf::Message(),
+    _internal_metadata_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:protocol.ChainHello)
+}
+
+void ChainHello::SharedCtor() {
+    _is_default_instance_ = false;
+  _cached_size_ = 0;
+  timestamp_ = GOOGLE_LONGLONG(0);
+}
+
+ChainHello::~ChainHello() {
+  // @@protoc_insertion_point(destructor:protocol.ChainHello)
+  SharedDtor();
+}
+
+void ChainHello::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void ChainHello::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* ChainHello::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return ChainHello_descriptor_;
+}
+
+const ChainHello& ChainHello::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_overlay_2eproto();
+  return *default_instance_;
+}
+
+ChainHello* ChainHello::default_instance_ = NULL;
+
+ChainHello* ChainHello::New(::google::protobuf::Arena* arena) const {
+  ChainHello* n = new ChainHello;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void ChainHello::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.ChainHello)
+  timestamp_ = GOOGLE_LONGLONG(0);
+  api_list_.Clear();
+}
+
+bool ChainHello::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protocol.ChainHello)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated .protocol.ChainMessageType api_list = 1;
+      case 1: {
+        if (tag == 10) {
+          ::google::protobuf::uint32 length;
+          DO_(input->ReadVarint32(&length));
+          ::google::protobuf::io::CodedInputStream::Limit limit = input->PushLimit(length);
+          while (input->BytesUntilLimit() > 0) {
+            int value;
+            DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+            add_api_list(static_cast< ::protocol::ChainMessageType >(value));
+          }
+          input->PopLimit(limit);
+        } else if (tag == 8) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          add_api_list(static_cast< ::protocol::ChainMessageType >(value));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(16)) goto parse_timestamp;
+        break;
+      }
+
+      // optional int64 timestamp = 2;
+      case 2: {
+        if (tag == 16) {
+         parse_timestamp:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &timestamp_)));
+
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protocol.ChainHello)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protocol.ChainHello)
+  return false;
+#undef DO_
+}
+
+void ChainHello::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protocol.ChainHello)
+  // repeated .protocol.ChainMessageType api_list = 1;
+  if (this->api_list_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(
+      1,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      output);
+    output->WriteVarint32(_api_list_cached_byte_size_);
+  }
+  for (int i = 0; i < this->api_list_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnumNoTag(
+      this->api_list(i), output);
+  }
+
+  // optional int64 timestamp = 2;
+  if (this->timestamp() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->timestamp(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:protocol.ChainHello)
+}
+
+::google::protobuf::uint8* ChainHello::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.ChainHello)
+  // repeated .protocol.ChainMessageType api_list = 1;
+  if (this->api_list_size() > 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
+      1,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(    _api_list_cached_byte_size_, target);
+  }
+  for (int i = 0; i < this->api_list_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumNoTagToArray(
+      this->api_list(i), target);
+  }
+
+  // optional int64 timestamp = 2;
+  if (this->timestamp() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->timestamp(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.ChainHello)
+  return target;
+}
+
+int ChainHello::ByteSize() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.ChainHello)
+  int total_size = 0;
+
+  // optional int64 timestamp = 2;
+  if (this->timestamp() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int64Size(
+        this->timestamp());
+  }
+
+  // repeated .protocol.ChainMessageType api_list = 1;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->api_list_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::EnumSize(
+        this->api_list(i));
+    }
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _api_list_cached_byte_size_ = data_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void ChainHello::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protocol.ChainHello)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  const ChainHello* source = 
+      ::google::protobuf::internal::DynamicCastToGenerated<const ChainHello>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.ChainHello)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.ChainHello)
+    MergeFrom(*source);
+  }
+}
+
+void ChainHello::MergeFrom(const ChainHello& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protocol.ChainHello)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  api_list_.MergeFrom(from.api_list_);
+  if (from.timestamp() != 0) {
+    set_timestamp(from.timestamp());
+  }
+}
+
+void ChainHello::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protocol.ChainHello)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ChainHello::CopyFrom(const ChainHello& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.ChainHello)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChainHello::IsInitialized() const {
+
+  return true;
+}
+
+void ChainHello::Swap(ChainHello* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void ChainHello::InternalSwap(ChainHello* other) {
+  api_list_.UnsafeArenaSwap(&other->api_list_);
+  std::swap(timestamp_, other->timestamp_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata ChainHello::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = ChainHello_descriptor_;
+  metadata.reflection = ChainHello_reflection_;
+  return metadata;
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// ChainHello
+
+// repeated .protocol.ChainMessageType api_list = 1;
+int ChainHello::api_list_size() const {
+  return api_list_.size();
+}
+void ChainHello::clear_api_list() {
+  api_list_.Clear();
+}
+ ::protocol::ChainMessageType ChainHello::api_list(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.ChainHello.api_list)
+  return static_cast< ::protocol::ChainMessageType >(api_list_.Get(index));
+}
+ void ChainHello::set_api_list(int index, ::protocol::ChainMessageType value) {
+  api_list_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protocol.ChainHello.api_list)
+}
+ void ChainHello::add_api_list(::protocol::ChainMessageType value) {
+  api_list_.Add(value);
+  // @@protoc_insertion_point(field_add:protocol.ChainHello.api_list)
+}
+ const ::google::protobuf::RepeatedField<int>&
+ChainHello::api_list() const {
+  // @@protoc_insertion_point(field_list:protocol.ChainHello.api_list)
+  return api_list_;
+}
+ ::google::protobuf::RepeatedField<int>*
+ChainHello::mutable_api_list() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.ChainHello.api_list)
+  return &api_list_;
+}
+
+// optional int64 timestamp = 2;
+void ChainHello::clear_timestamp() {
+  timestamp_ = GOOGLE_LONGLONG(0);
+}
+ ::google::protobuf::int64 ChainHello::timestamp() const {
+  // @@protoc_insertion_point(field_get:protocol.ChainHello.timestamp)
+  return timestamp_;
+}
+ void ChainHello::set_timestamp(::google::protobuf::int64 value) {
+  
+  timestamp_ = value;
+  // @@protoc_insertion_point(field_set:protocol.ChainHello.timestamp)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ChainStatus::kSelfAddrFieldNumber;
+const int ChainStatus::kLedgerVersionFieldNumber;
+const int ChainStatus::kMonitorVersionFieldNumber;
+const int ChainStatus::kBumoVersionFieldNumber;
+const int ChainStatus::kTimestampFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ChainStatus::ChainStatus()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protocol.ChainStatus)
+}
+
+void ChainStatus::InitAsDefaultInstance() {
+  _is_default_instance_ = true;
+}
+
+ChainStatus::ChainStatus(const ChainStatus& from)
+  : ::google::protobuf::Message(),
+    _internal_metadata_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:protocol.ChainStatus)
+}
+
+void ChainStatus::SharedCtor() {
+    _is_default_instance_ = false;
+  ::google::protobuf::internal::GetEmptyString();
+  _cached_size_ = 0;
+  self_addr_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ledger_version_ = GOOGLE_LONGLONG(0);
+  monitor_version_ = GOOGLE_LONGLONG(0);
+  bumo_version_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  timestamp_ = GOOGLE_LONGLONG(0);
+}
+
+ChainStatus::~ChainStatus() {
+  // @@protoc_insertion_point(destructor:protocol.ChainStatus)
+  SharedDtor();
+}
+
+void ChainStatus::SharedDtor() {
+  self_addr_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  bumo_version_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (this != default_instance_) {
+  }
+}
+
+void ChainStatus::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* ChainStatus::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return ChainStatus_descriptor_;
+}
+
+const ChainStatus& ChainStatus::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_overlay_2eproto();
+  return *default_instance_;
+}
+
+ChainStatus* ChainStatus::default_instance_ = NULL;
+
+ChainStatus* ChainStatus::New(::google::protobuf::Arena* arena) const {
+  ChainStatus* n = new ChainStatus;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void ChainStatus::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.ChainStatus)
+#if defined(__clang__)
+#define ZR_HELPER_(f) \
+  _Pragma("clang diagnostic push") \
+  _Pragma("clang diagnostic ignored \"-Winvalid-offsetof\"") \
+  __builtin_offsetof(ChainStatus, f) \
+  _Pragma("clang diagnostic pop")
+#else
+#define ZR_HELPER_(f) reinterpret_cast<char*>(\
+  &reinterpret_cast<ChainStatus*>(16)->f)
+#endif
+
+#define ZR_(first, last) do {\
+  ::memset(&first, 0,\
+           ZR_HELPER_(last) - ZR_HELPER_(first) + sizeof(last));\
+} while (0)
+
+  ZR_(ledger_version_, monitor_version_);
+  self_addr_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  bumo_version_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  timestamp_ = GOOGLE_LONGLONG(0);
+
+#undef ZR_HELPER_
+#undef ZR_
+
+}
+
+bool ChainStatus::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protocol.ChainStatus)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional string self_addr = 1;
+      case 1: {
+        if (tag == 10) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_self_addr()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->self_addr().data(), this->self_addr().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "protocol.ChainStatus.self_addr"));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(16)) goto parse_ledger_version;
+        break;
+      }
+
+      // optional int64 ledger_version = 2;
+      case 2: {
+        if (tag == 16) {
+         parse_ledger_version:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &ledger_version_)));
+
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(24)) goto parse_monitor_version;
+        break;
+      }
+
+      // optional int64 monitor_version = 3;
+      case 3: {
+        if (tag == 24) {
+         parse_monitor_version:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &monitor_version_)));
+
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(34)) goto parse_bumo_version;
+        break;
+      }
+
+      // optional string bumo_version = 4;
+      case 4: {
+        if (tag == 34) {
+         parse_bumo_version:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_bumo_version()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->bumo_version().data(), this->bumo_version().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "protocol.ChainStatus.bumo_version"));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(40)) goto parse_timestamp;
+        break;
+      }
+
+      // optional int64 timestamp = 5;
+      case 5: {
+        if (tag == 40) {
+         parse_timestamp:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &timestamp_)));
+
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protocol.ChainStatus)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protocol.ChainStatus)
+  return false;
+#undef DO_
+}
+
+void ChainStatus::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protocol.ChainStatus)
+  // optional string self_addr = 1;
+  if (this->self_addr().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->self_addr().data(), this->self_addr().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.ChainStatus.self_addr");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->self_addr(), output);
+  }
+
+  // optional int64 ledger_version = 2;
+  if (this->ledger_version() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->ledger_version(), output);
+  }
+
+  // optional int64 monitor_version = 3;
+  if (this->monitor_version() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(3, this->monitor_version(), output);
+  }
+
+  // optional string bumo_version = 4;
+  if (this->bumo_version().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->bumo_version().data(), this->bumo_version().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.ChainStatus.bumo_version");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      4, this->bumo_version(), output);
+  }
+
+  // optional int64 timestamp = 5;
+  if (this->timestamp() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(5, this->timestamp(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:protocol.ChainStatus)
+}
+
+::google::protobuf::uint8* ChainStatus::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.ChainStatus)
+  // optional string self_addr = 1;
+  if (this->self_addr().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->self_addr().data(), this->self_addr().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.ChainStatus.self_addr");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->self_addr(), target);
+  }
+
+  // optional int64 ledger_version = 2;
+  if (this->ledger_version() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->ledger_version(), target);
+  }
+
+  // optional int64 monitor_version = 3;
+  if (this->monitor_version() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->monitor_version(), target);
+  }
+
+  // optional string bumo_version = 4;
+  if (this->bumo_version().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->bumo_version().data(), this->bumo_version().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.ChainStatus.bumo_version");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        4, this->bumo_version(), target);
+  }
+
+  // optional int64 timestamp = 5;
+  if (this->timestamp() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(5, this->timestamp(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.ChainStatus)
+  return target;
+}
+
+int ChainStatus::ByteSize() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.ChainStatus)
+  int total_size = 0;
+
+  // optional string self_addr = 1;
+  if (this->self_addr().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->self_addr());
+  }
+
+  // optional int64 ledger_version = 2;
+  if (this->ledger_version() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int64Size(
+        this->ledger_version());
+  }
+
+  // optional int64 monitor_version = 3;
+  if (this->monitor_version() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int64Size(
+        this->monitor_version());
+  }
+
+  // optional string bumo_version = 4;
+  if (this->bumo_version().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->bumo_version());
+  }
+
+  // optional int64 timestamp = 5;
+  if (this->timestamp() != 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int64Size(
+        this->timestamp());
+  }
+
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void ChainStatus::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protocol.ChainStatus)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  const ChainStatus* source = 
+      ::google::protobuf::internal::DynamicCastToGenerated<const ChainStatus>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.ChainStatus)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.ChainStatus)
+    MergeFrom(*source);
+  }
+}
+
+void ChainStatus::MergeFrom(const ChainStatus& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protocol.ChainStatus)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  if (from.self_addr().size() > 0) {
+
+    self_addr_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.self_addr_);
+  }
+  if (from.ledger_version() != 0) {
+    set_ledger_version(from.ledger_version());
+  }
+  if (from.monitor_version() != 0) {
+    set_monitor_version(from.monitor_version());
+  }
+  if (from.bumo_version().size() > 0) {
+
+    bumo_version_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.bumo_version_);
+  }
+  if (from.timestamp() != 0) {
+    set_timestamp(from.timestamp());
+  }
+}
+
+void ChainStatus::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protocol.ChainStatus)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ChainStatus::CopyFrom(const ChainStatus& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.ChainStatus)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChainStatus::IsInitialized() const {
+
+  return true;
+}
+
+void ChainStatus::Swap(ChainStatus* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void ChainStatus::InternalSwap(ChainStatus* other) {
+  self_addr_.Swap(&other->self_addr_);
+  std::swap(ledger_version_, other->ledger_version_);
+  std::swap(monitor_version_, other->monitor_version_);
+  bumo_version_.Swap(&other->bumo_version_);
+  std::swap(timestamp_, other->timestamp_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata ChainStatus::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = ChainStatus_descriptor_;
+  metadata.reflection = ChainStatus_reflection_;
+  return metadata;
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// ChainStatus
+
+// optional string self_addr = 1;
+void ChainStatus::clear_self_addr() {
+  self_addr_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ const ::std::string& ChainStatus::self_addr() const {
+  // @@protoc_insertion_point(field_get:protocol.ChainStatus.self_addr)
+  return self_addr_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void ChainStatus::set_self_addr(const ::std::string& value) {
+  
+  self_addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.ChainStatus.self_addr)
+}
+ void ChainStatus::set_self_addr(const char* value) {
+  
+  self_addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.ChainStatus.self_addr)
+}
+ void ChainStatus::set_self_addr(const char* value, size_t size) {
+  
+  self_addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.ChainStatus.self_addr)
+}
+ ::std::string* ChainStatus::mutable_self_addr() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.ChainStatus.self_addr)
+  return self_addr_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ ::std::string* ChainStatus::release_self_addr() {
+  // @@protoc_insertion_point(field_release:protocol.ChainStatus.self_addr)
+  
+  return self_addr_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void ChainStatus::set_allocated_self_addr(::std::string* self_addr) {
+  if (self_addr != NULL) {
+    
+  } else {
+    
+  }
+  self_addr_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), self_addr);
+  // @@protoc_insertion_point(field_set_allocated:protocol.ChainStatus.self_addr)
+}
+
+// optional int64 ledger_version = 2;
+void ChainStatus::clear_ledger_version() {
+  ledger_version_ = GOOGLE_LONGLONG(0);
+}
+ ::google::protobuf::int64 ChainStatus::ledger_version() const {
+  // @@protoc_insertion_point(field_get:protocol.ChainStatus.ledger_version)
+  return ledger_version_;
+}
+ void ChainStatus::set_ledger_version(::google::protobuf::int64 value) {
+  
+  ledger_version_ = value;
+  // @@protoc_insertion_point(field_set:protocol.ChainStatus.ledger_version)
+}
+
+// optional int64 monitor_version = 3;
+void ChainStatus::clear_monitor_version() {
+  monitor_version_ = GOOGLE_LONGLONG(0);
+}
+ ::google::protobuf::int64 ChainStatus::monitor_version() const {
+  // @@protoc_insertion_point(field_get:protocol.ChainStatus.monitor_version)
+  return monitor_version_;
+}
+ void ChainStatus::set_monitor_version(::google::protobuf::int64 value) {
+  
+  monitor_version_ = value;
+  // @@protoc_insertion_point(field_set:protocol.ChainStatus.monitor_version)
+}
+
+// optional string bumo_version = 4;
+void ChainStatus::clear_bumo_version() {
+  bumo_version_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ const ::std::string& ChainStatus::bumo_version() const {
+  // @@protoc_insertion_point(field_get:protocol.ChainStatus.bumo_version)
+  return bumo_version_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void ChainStatus::set_bumo_version(const ::std::string& value) {
+  
+  bumo_version_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.ChainStatus.bumo_version)
+}
+ void ChainStatus::set_bumo_version(const char* value) {
+  
+  bumo_version_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.ChainStatus.bumo_version)
+}
+ void ChainStatus::set_bumo_version(const char* value, size_t size) {
+  
+  bumo_version_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.ChainStatus.bumo_version)
+}
+ ::std::string* ChainStatus::mutable_bumo_version() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.ChainStatus.bumo_version)
+  return bumo_version_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ ::std::string* ChainStatus::release_bumo_version() {
+  // @@protoc_insertion_point(field_release:protocol.ChainStatus.bumo_version)
+  
+  return bumo_version_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void ChainStatus::set_allocated_bumo_version(::std::string* bumo_version) {
+  if (bumo_version != NULL) {
+    
+  } else {
+    
+  }
+  bumo_version_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), bumo_version);
+  // @@protoc_insertion_point(field_set_allocated:protocol.ChainStatus.bumo_version)
+}
+
+// optional int64 timestamp = 5;
+void ChainStatus::clear_timestamp() {
+  timestamp_ = GOOGLE_LONGLONG(0);
+}
+ ::google::protobuf::int64 ChainStatus::timestamp() const {
+  // @@protoc_insertion_point(field_get:protocol.ChainStatus.timestamp)
+  return timestamp_;
+}
+ void ChainStatus::set_timestamp(::google::protobuf::int64 value) {
+  
+  timestamp_ = value;
+  // @@protoc_insertion_point(field_set:protocol.ChainStatus.timestamp)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ChainPeerMessage::kSrcPeerAddrFieldNumber;
+const int ChainPeerMessage::kDesPeerAddrsFieldNumber;
+const int ChainPeerMessage::kDataFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ChainPeerMessage::ChainPeerMessage()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protocol.ChainPeerMessage)
+}
+
+void ChainPeerMessage::InitAsDefaultInstance() {
+  _is_default_instance_ = true;
+}
+
+ChainPeerMessage::ChainPeerMessage(const ChainPeerMessage& from)
+  : ::google::protobuf::Message(),
+    _internal_metadata_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:protocol.ChainPeerMessage)
+}
+
+void ChainPeerMessage::SharedCtor() {
+    _is_default_instance_ = false;
+  ::google::protobuf::internal::GetEmptyString();
+  _cached_size_ = 0;
+  src_peer_addr_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+
+ChainPeerMessage::~ChainPeerMessage() {
+  // @@protoc_insertion_point(destructor:protocol.ChainPeerMessage)
+  SharedDtor();
+}
+
+void ChainPeerMessage::SharedDtor() {
+  src_peer_addr_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (this != default_instance_) {
+  }
+}
+
+void ChainPeerMessage::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* ChainPeerMessage::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return ChainPeerMessage_descriptor_;
+}
+
+const ChainPeerMessage& ChainPeerMessage::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_overlay_2eproto();
+  return *default_instance_;
+}
+
+ChainPeerMessage* ChainPeerMessage::default_instance_ = NULL;
+
+ChainPeerMessage* ChainPeerMessage::New(::google::protobuf::Arena* arena) const {
+  ChainPeerMessage* n = new ChainPeerMessage;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void ChainPeerMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.ChainPeerMessage)
+  src_peer_addr_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  des_peer_addrs_.Clear();
+}
+
+bool ChainPeerMessage::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protocol.ChainPeerMessage)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional string src_peer_addr = 1;
+      case 1: {
+        if (tag == 10) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_src_peer_addr()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->src_peer_addr().data(), this->src_peer_addr().length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "protocol.ChainPeerMessage.src_peer_addr"));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_des_peer_addrs;
+        break;
+      }
+
+      // repeated string des_peer_addrs = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_des_peer_addrs:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->add_des_peer_addrs()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->des_peer_addrs(this->des_peer_addrs_size() - 1).data(),
+            this->des_peer_addrs(this->des_peer_addrs_size() - 1).length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "protocol.ChainPeerMessage.des_peer_addrs"));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_des_peer_addrs;
+        if (input->ExpectTag(26)) goto parse_data;
+        break;
+      }
+
+      // optional bytes data = 3;
+      case 3: {
+        if (tag == 26) {
+         parse_data:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_data()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protocol.ChainPeerMessage)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protocol.ChainPeerMessage)
+  return false;
+#undef DO_
+}
+
+void ChainPeerMessage::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protocol.ChainPeerMessage)
+  // optional string src_peer_addr = 1;
+  if (this->src_peer_addr().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->src_peer_addr().data(), this->src_peer_addr().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.ChainPeerMessage.src_peer_addr");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->src_peer_addr(), output);
+  }
+
+  // repeated string des_peer_addrs = 2;
+  for (int i = 0; i < this->des_peer_addrs_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->des_peer_addrs(i).data(), this->des_peer_addrs(i).length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.ChainPeerMessage.des_peer_addrs");
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      2, this->des_peer_addrs(i), output);
+  }
+
+  // optional bytes data = 3;
+  if (this->data().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      3, this->data(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:protocol.ChainPeerMessage)
+}
+
+::google::protobuf::uint8* ChainPeerMessage::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.ChainPeerMessage)
+  // optional string src_peer_addr = 1;
+  if (this->src_peer_addr().size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->src_peer_addr().data(), this->src_peer_addr().length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.ChainPeerMessage.src_peer_addr");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->src_peer_addr(), target);
+  }
+
+  // repeated string des_peer_addrs = 2;
+  for (int i = 0; i < this->des_peer_addrs_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->des_peer_addrs(i).data(), this->des_peer_addrs(i).length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.ChainPeerMessage.des_peer_addrs");
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringToArray(2, this->des_peer_addrs(i), target);
+  }
+
+  // optional bytes data = 3;
+  if (this->data().size() > 0) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        3, this->data(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.ChainPeerMessage)
+  return target;
+}
+
+int ChainPeerMessage::ByteSize() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.ChainPeerMessage)
+  int total_size = 0;
+
+  // optional string src_peer_addr = 1;
+  if (this->src_peer_addr().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::StringSize(
+        this->src_peer_addr());
+  }
+
+  // optional bytes data = 3;
+  if (this->data().size() > 0) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::BytesSize(
+        this->data());
+  }
+
+  // repeated string des_peer_addrs = 2;
+  total_size += 1 * this->des_peer_addrs_size();
+  for (int i = 0; i < this->des_peer_addrs_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->des_peer_addrs(i));
+  }
+
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void ChainPeerMessage::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protocol.ChainPeerMessage)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  const ChainPeerMessage* source = 
+      ::google::protobuf::internal::DynamicCastToGenerated<const ChainPeerMessage>(
+          &from);
+  if (source == NULL) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.ChainPeerMessage)
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.ChainPeerMessage)
+    MergeFrom(*source);
+  }
+}
+
+void ChainPeerMessage::MergeFrom(const ChainPeerMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protocol.ChainPeerMessage)
+  if (GOOGLE_PREDICT_FALSE(&from == this)) {
+    ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
+  }
+  des_peer_addrs_.MergeFrom(from.des_peer_addrs_);
+  if (from.src_peer_addr().size() > 0) {
+
+    src_peer_addr_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.src_peer_addr_);
+  }
+  if (from.data().size() > 0) {
+
+    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  }
+}
+
+void ChainPeerMessage::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protocol.ChainPeerMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ChainPeerMessage::CopyFrom(const ChainPeerMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.ChainPeerMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChainPeerMessage::IsInitialized() const {
+
+  return true;
+}
+
+void ChainPeerMessage::Swap(ChainPeerMessage* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void ChainPeerMessage::InternalSwap(ChainPeerMessage* other) {
+  src_peer_addr_.Swap(&other->src_peer_addr_);
+  des_peer_addrs_.UnsafeArenaSwap(&other->des_peer_addrs_);
+  data_.Swap(&other->data_);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::google::protobuf::Metadata ChainPeerMessage::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = ChainPeerMessage_descriptor_;
+  metadata.reflection = ChainPeerMessage_reflection_;
+  return metadata;
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// ChainPeerMessage
+
+// optional string src_peer_addr = 1;
+void ChainPeerMessage::clear_src_peer_addr() {
+  src_peer_addr_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ const ::std::string& ChainPeerMessage::src_peer_addr() const {
+  // @@protoc_insertion_point(field_get:protocol.ChainPeerMessage.src_peer_addr)
+  return src_peer_addr_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void ChainPeerMessage::set_src_peer_addr(const ::std::string& value) {
+  
+  src_peer_addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.ChainPeerMessage.src_peer_addr)
+}
+ void ChainPeerMessage::set_src_peer_addr(const char* value) {
+  
+  src_peer_addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.ChainPeerMessage.src_peer_addr)
+}
+ void ChainPeerMessage::set_src_peer_addr(const char* value, size_t size) {
+  
+  src_peer_addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.ChainPeerMessage.src_peer_addr)
+}
+ ::std::string* ChainPeerMessage::mutable_src_peer_addr() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.ChainPeerMessage.src_peer_addr)
+  return src_peer_addr_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ ::std::string* ChainPeerMessage::release_src_peer_addr() {
+  // @@protoc_insertion_point(field_release:protocol.ChainPeerMessage.src_peer_addr)
+  
+  return src_peer_addr_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void ChainPeerMessage::set_allocated_src_peer_addr(::std::string* src_peer_addr) {
+  if (src_peer_addr != NULL) {
+    
+  } else {
+    
+  }
+  src_peer_addr_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), src_peer_addr);
+  // @@protoc_insertion_point(field_set_allocated:protocol.ChainPeerMessage.src_peer_addr)
 }
 
-::google::protobuf::uint8* ChainStatus::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:protocol.ChainStatus)
-  // optional string self_addr = 1;
-  if (this->self_addr().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->self_addr().data(), this->self_addr().length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "protocol.ChainStatus.self_addr");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->self_addr(), target);
+// repeated string des_peer_addrs = 2;
+int ChainPeerMessage::des_peer_addrs_size() const {
+  return des_peer_addrs_.size();
+}
+void ChainPeerMessage::clear_des_peer_addrs() {
+  des_peer_addrs_.Clear();
+}
+ const ::std::string& ChainPeerMessage::des_peer_addrs(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.ChainPeerMessage.des_peer_addrs)
+  return des_peer_addrs_.Get(index);
+}
+ ::std::string* ChainPeerMessage::mutable_des_peer_addrs(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.ChainPeerMessage.des_peer_addrs)
+  return des_peer_addrs_.Mutable(index);
+}
+ void ChainPeerMessage::set_des_peer_addrs(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.ChainPeerMessage.des_peer_addrs)
+  des_peer_addrs_.Mutable(index)->assign(value);
+}
+ void ChainPeerMessage::set_des_peer_addrs(int index, const char* value) {
+  des_peer_addrs_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.ChainPeerMessage.des_peer_addrs)
+}
+ void ChainPeerMessage::set_des_peer_addrs(int index, const char* value, size_t size) {
+  des_peer_addrs_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protocol.ChainPeerMessage.des_peer_addrs)
+}
+ ::std::string* ChainPeerMessage::add_des_peer_addrs() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.ChainPeerMessage.des_peer_addrs)
+  return des_peer_addrs_.Add();
+}
+ void ChainPeerMessage::add_des_peer_addrs(const ::std::string& value) {
+  des_peer_addrs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.ChainPeerMessage.des_peer_addrs)
+}
+ void ChainPeerMessage::add_des_peer_addrs(const char* value) {
+  des_peer_addrs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.ChainPeerMessage.des_peer_addrs)
+}
+ void ChainPeerMessage::add_des_peer_addrs(const char* value, size_t size) {
+  des_peer_addrs_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.ChainPeerMessage.des_peer_addrs)
+}
+ const ::google::protobuf::RepeatedPtrField< ::std::string>&
+ChainPeerMessage::des_peer_addrs() const {
+  // @@protoc_insertion_point(field_list:protocol.ChainPeerMessage.des_peer_addrs)
+  return des_peer_addrs_;
+}
+ ::google::protobuf::RepeatedPtrField< ::std::string>*
+ChainPeerMessage::mutable_des_peer_addrs() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.ChainPeerMessage.des_peer_addrs)
+  return &des_peer_addrs_;
+}
+
+// optional bytes data = 3;
+void ChainPeerMessage::clear_data() {
+  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ const ::std::string& ChainPeerMessage::data() const {
+  // @@protoc_insertion_point(field_get:protocol.ChainPeerMessage.data)
+  return data_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void ChainPeerMessage::set_data(const ::std::string& value) {
+  
+  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protocol.ChainPeerMessage.data)
+}
+ void ChainPeerMessage::set_data(const char* value) {
+  
+  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protocol.ChainPeerMessage.data)
+}
+ void ChainPeerMessage::set_data(const void* value, size_t size) {
+  
+  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protocol.ChainPeerMessage.data)
+}
+ ::std::string* ChainPeerMessage::mutable_data() {
+  
+  // @@protoc_insertion_point(field_mutable:protocol.ChainPeerMessage.data)
+  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ ::std::string* ChainPeerMessage::release_data() {
+  // @@protoc_insertion_point(field_release:protocol.ChainPeerMessage.data)
+  
+  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+ void ChainPeerMessage::set_allocated_data(::std::string* data) {
+  if (data != NULL) {
+    
+  } else {
+    
+  }
+  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
+  // @@protoc_insertion_point(field_set_allocated:protocol.ChainPeerMessage.data)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int ChainSubscribeTx::kAddressFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+ChainSubscribeTx::ChainSubscribeTx()
+  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protocol.ChainSubscribeTx)
+}
+
+void ChainSubscribeTx::InitAsDefaultInstance() {
+  _is_default_instance_ = true;
+}
+
+ChainSubscribeTx::ChainSubscribeTx(const ChainSubscribeTx& from)
+  : ::google::protobuf::Message(),
+    _internal_metadata_(NULL) {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:protocol.ChainSubscribeTx)
+}
+
+void ChainSubscribeTx::SharedCtor() {
+    _is_default_instance_ = false;
+  ::google::protobuf::internal::GetEmptyString();
+  _cached_size_ = 0;
+}
+
+ChainSubscribeTx::~ChainSubscribeTx() {
+  // @@protoc_insertion_point(destructor:protocol.ChainSubscribeTx)
+  SharedDtor();
+}
+
+void ChainSubscribeTx::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void ChainSubscribeTx::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* ChainSubscribeTx::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return ChainSubscribeTx_descriptor_;
+}
+
+const ChainSubscribeTx& ChainSubscribeTx::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_overlay_2eproto();
+  return *default_instance_;
+}
+
+ChainSubscribeTx* ChainSubscribeTx::default_instance_ = NULL;
+
+ChainSubscribeTx* ChainSubscribeTx::New(::google::protobuf::Arena* arena) const {
+  ChainSubscribeTx* n = new ChainSubscribeTx;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void ChainSubscribeTx::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.ChainSubscribeTx)
+  address_.Clear();
+}
+
+bool ChainSubscribeTx::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:protocol.ChainSubscribeTx)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated string address = 1;
+      case 1: {
+        if (tag == 10) {
+         parse_address:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->add_address()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->address(this->address_size() - 1).data(),
+            this->address(this->address_size() - 1).length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "protocol.ChainSubscribeTx.address"));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(10)) goto parse_address;
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
   }
+success:
+  // @@protoc_insertion_point(parse_success:protocol.ChainSubscribeTx)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protocol.ChainSubscribeTx)
+  return false;
+#undef DO_
+}
 
-  // optional int64 ledger_version = 2;
-  if (this->ledger_version() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->ledger_version(), target);
+void ChainSubscribeTx::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protocol.ChainSubscribeTx)
+  // repeated string address = 1;
+  for (int i = 0; i < this->address_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->address(i).data(), this->address(i).length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.ChainSubscribeTx.address");
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->address(i), output);
   }
 
-  // optional int64 monitor_version = 3;
-  if (this->monitor_version() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(3, this->monitor_version(), target);
-  }
+  // @@protoc_insertion_point(serialize_end:protocol.ChainSubscribeTx)
+}
 
-  // optional string bumo_version = 4;
-  if (this->bumo_version().size() > 0) {
+::google::protobuf::uint8* ChainSubscribeTx::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.ChainSubscribeTx)
+  // repeated string address = 1;
+  for (int i = 0; i < this->address_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->bumo_version().data(), this->bumo_version().length(),
+      this->address(i).data(), this->address(i).length(),
       ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "protocol.ChainStatus.bumo_version");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        4, this->bumo_version(), target);
-  }
-
-  // optional int64 timestamp = 5;
-  if (this->timestamp() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(5, this->timestamp(), target);
+      "protocol.ChainSubscribeTx.address");
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringToArray(1, this->address(i), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:protocol.ChainStatus)
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.ChainSubscribeTx)
   return target;
 }
 
-int ChainStatus::ByteSize() const {
-// @@protoc_insertion_point(message_byte_size_start:protocol.ChainStatus)
+int ChainSubscribeTx::ByteSize() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.ChainSubscribeTx)
   int total_size = 0;
 
-  // optional string self_addr = 1;
-  if (this->self_addr().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->self_addr());
-  }
-
-  // optional int64 ledger_version = 2;
-  if (this->ledger_version() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->ledger_version());
-  }
-
-  // optional int64 monitor_version = 3;
-  if (this->monitor_version() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->monitor_version());
-  }
-
-  // optional string bumo_version = 4;
-  if (this->bumo_version().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->bumo_version());
-  }
-
-  // optional int64 timestamp = 5;
-  if (this->timestamp() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int64Size(
-        this->timestamp());
+  // repeated string address = 1;
+  total_size += 1 * this->address_size();
+  for (int i = 0; i < this->address_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->address(i));
   }
 
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
@@ -5133,219 +6720,124 @@ int ChainStatus::ByteSize() const {
   return total_size;
 }
 
-void ChainStatus::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.ChainStatus)
+void ChainSubscribeTx::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protocol.ChainSubscribeTx)
   if (GOOGLE_PREDICT_FALSE(&from == this)) {
     ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
   }
-  const ChainStatus* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const ChainStatus>(
+  const ChainSubscribeTx* source = 
+      ::google::protobuf::internal::DynamicCastToGenerated<const ChainSubscribeTx>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.ChainStatus)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.ChainSubscribeTx)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.ChainStatus)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.ChainSubscribeTx)
     MergeFrom(*source);
   }
 }
 
-void ChainStatus::MergeFrom(const ChainStatus& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.ChainStatus)
+void ChainSubscribeTx::MergeFrom(const ChainSubscribeTx& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protocol.ChainSubscribeTx)
   if (GOOGLE_PREDICT_FALSE(&from == this)) {
     ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
   }
-  if (from.self_addr().size() > 0) {
-
-    self_addr_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.self_addr_);
-  }
-  if (from.ledger_version() != 0) {
-    set_ledger_version(from.ledger_version());
-  }
-  if (from.monitor_version() != 0) {
-    set_monitor_version(from.monitor_version());
-  }
-  if (from.bumo_version().size() > 0) {
-
-    bumo_version_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.bumo_version_);
-  }
-  if (from.timestamp() != 0) {
-    set_timestamp(from.timestamp());
-  }
+  address_.MergeFrom(from.address_);
 }
 
-void ChainStatus::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.ChainStatus)
+void ChainSubscribeTx::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protocol.ChainSubscribeTx)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ChainStatus::CopyFrom(const ChainStatus& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:protocol.ChainStatus)
+void ChainSubscribeTx::CopyFrom(const ChainSubscribeTx& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.ChainSubscribeTx)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ChainStatus::IsInitialized() const {
+bool ChainSubscribeTx::IsInitialized() const {
 
   return true;
 }
 
-void ChainStatus::Swap(ChainStatus* other) {
+void ChainSubscribeTx::Swap(ChainSubscribeTx* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void ChainStatus::InternalSwap(ChainStatus* other) {
-  self_addr_.Swap(&other->self_addr_);
-  std::swap(ledger_version_, other->ledger_version_);
-  std::swap(monitor_version_, other->monitor_version_);
-  bumo_version_.Swap(&other->bumo_version_);
-  std::swap(timestamp_, other->timestamp_);
+void ChainSubscribeTx::InternalSwap(ChainSubscribeTx* other) {
+  address_.UnsafeArenaSwap(&other->address_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata ChainStatus::GetMetadata() const {
+::google::protobuf::Metadata ChainSubscribeTx::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ChainStatus_descriptor_;
-  metadata.reflection = ChainStatus_reflection_;
+  metadata.descriptor = ChainSubscribeTx_descriptor_;
+  metadata.reflection = ChainSubscribeTx_reflection_;
   return metadata;
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ChainStatus
-
-// optional string self_addr = 1;
-void ChainStatus::clear_self_addr() {
-  self_addr_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& ChainStatus::self_addr() const {
-  // @@protoc_insertion_point(field_get:protocol.ChainStatus.self_addr)
-  return self_addr_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void ChainStatus::set_self_addr(const ::std::string& value) {
-  
-  self_addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.ChainStatus.self_addr)
-}
- void ChainStatus::set_self_addr(const char* value) {
-  
-  self_addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.ChainStatus.self_addr)
-}
- void ChainStatus::set_self_addr(const char* value, size_t size) {
-  
-  self_addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.ChainStatus.self_addr)
-}
- ::std::string* ChainStatus::mutable_self_addr() {
-  
-  // @@protoc_insertion_point(field_mutable:protocol.ChainStatus.self_addr)
-  return self_addr_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- ::std::string* ChainStatus::release_self_addr() {
-  // @@protoc_insertion_point(field_release:protocol.ChainStatus.self_addr)
-  
-  return self_addr_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- void ChainStatus::set_allocated_self_addr(::std::string* self_addr) {
-  if (self_addr != NULL) {
-    
-  } else {
-    
-  }
-  self_addr_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), self_addr);
-  // @@protoc_insertion_point(field_set_allocated:protocol.ChainStatus.self_addr)
-}
-
-// optional int64 ledger_version = 2;
-void ChainStatus::clear_ledger_version() {
-  ledger_version_ = GOOGLE_LONGLONG(0);
-}
- ::google::protobuf::int64 ChainStatus::ledger_version() const {
-  // @@protoc_insertion_point(field_get:protocol.ChainStatus.ledger_version)
-  return ledger_version_;
-}
- void ChainStatus::set_ledger_version(::google::protobuf::int64 value) {
-  
-  ledger_version_ = value;
-  // @@protoc_insertion_point(field_set:protocol.ChainStatus.ledger_version)
-}
+// ChainSubscribeTx
 
-// optional int64 monitor_version = 3;
-void ChainStatus::clear_monitor_version() {
-  monitor_version_ = GOOGLE_LONGLONG(0);
-}
- ::google::protobuf::int64 ChainStatus::monitor_version() const {
-  // @@protoc_insertion_point(field_get:protocol.ChainStatus.monitor_version)
-  return monitor_version_;
+// repeated string address = 1;
+int ChainSubscribeTx::address_size() const {
+  return address_.size();
 }
- void ChainStatus::set_monitor_version(::google::protobuf::int64 value) {
-  
-  monitor_version_ = value;
-  // @@protoc_insertion_point(field_set:protocol.ChainStatus.monitor_version)
+void ChainSubscribeTx::clear_address() {
+  address_.Clear();
 }
-
-// optional string bumo_version = 4;
-void ChainStatus::clear_bumo_version() {
-  bumo_version_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+ const ::std::string& ChainSubscribeTx::address(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.ChainSubscribeTx.address)
+  return address_.Get(index);
 }
- const ::std::string& ChainStatus::bumo_version() const {
-  // @@protoc_insertion_point(field_get:protocol.ChainStatus.bumo_version)
-  return bumo_version_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+ ::std::string* ChainSubscribeTx::mutable_address(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.ChainSubscribeTx.address)
+  return address_.Mutable(index);
 }
- void ChainStatus::set_bumo_version(const ::std::string& value) {
-  
-  bumo_version_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.ChainStatus.bumo_version)
+ void ChainSubscribeTx::set_address(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.ChainSubscribeTx.address)
+  address_.Mutable(index)->assign(value);
 }
- void ChainStatus::set_bumo_version(const char* value) {
-  
-  bumo_version_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.ChainStatus.bumo_version)
+ void ChainSubscribeTx::set_address(int index, const char* value) {
+  address_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.ChainSubscribeTx.address)
 }
- void ChainStatus::set_bumo_version(const char* value, size_t size) {
-  
-  bumo_version_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.ChainStatus.bumo_version)
+ void ChainSubscribeTx::set_address(int index, const char* value, size_t size) {
+  address_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protocol.ChainSubscribeTx.address)
 }
- ::std::string* ChainStatus::mutable_bumo_version() {
-  
-  // @@protoc_insertion_point(field_mutable:protocol.ChainStatus.bumo_version)
-  return bumo_version_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+ ::std::string* ChainSubscribeTx::add_address() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.ChainSubscribeTx.address)
+  return address_.Add();
 }
- ::std::string* ChainStatus::release_bumo_version() {
-  // @@protoc_insertion_point(field_release:protocol.ChainStatus.bumo_version)
-  
-  return bumo_version_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+ void ChainSubscribeTx::add_address(const ::std::string& value) {
+  address_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.ChainSubscribeTx.address)
 }
- void ChainStatus::set_allocated_bumo_version(::std::string* bumo_version) {
-  if (bumo_version != NULL) {
-    
-  } else {
-    
-  }
-  bumo_version_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), bumo_version);
-  // @@protoc_insertion_point(field_set_allocated:protocol.ChainStatus.bumo_version)
+ void ChainSubscribeTx::add_address(const char* value) {
+  address_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.ChainSubscribeTx.address)
 }
-
-// optional int64 timestamp = 5;
-void ChainStatus::clear_timestamp() {
-  timestamp_ = GOOGLE_LONGLONG(0);
+ void ChainSubscribeTx::add_address(const char* value, size_t size) {
+  address_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.ChainSubscribeTx.address)
 }
- ::google::protobuf::int64 ChainStatus::timestamp() const {
-  // @@protoc_insertion_point(field_get:protocol.ChainStatus.timestamp)
-  return timestamp_;
+ const ::google::protobuf::RepeatedPtrField< ::std::string>&
+ChainSubscribeTx::address() const {
+  // @@protoc_insertion_point(field_list:protocol.ChainSubscribeTx.address)
+  return address_;
 }
- void ChainStatus::set_timestamp(::google::protobuf::int64 value) {
-  
-  timestamp_ = value;
-  // @@protoc_insertion_point(field_set:protocol.ChainStatus.timestamp)
+ ::google::protobuf::RepeatedPtrField< ::std::string>*
+ChainSubscribeTx::mutable_address() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.ChainSubscribeTx.address)
+  return &address_;
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -5353,132 +6845,155 @@ void ChainStatus::clear_timestamp() {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ChainPeerMessage::kSrcPeerAddrFieldNumber;
-const int ChainPeerMessage::kDesPeerAddrsFieldNumber;
-const int ChainPeerMessage::kDataFieldNumber;
+const int ChainSubscribeEvent::kAccountsFieldNumber;
+const int ChainSubscribeEvent::kContractsFieldNumber;
+const int ChainSubscribeEvent::kTopicsFieldNumber;
+const int ChainSubscribeEvent::kLedgerCloseFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-ChainPeerMessage::ChainPeerMessage()
+ChainSubscribeEvent::ChainSubscribeEvent()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:protocol.ChainPeerMessage)
+  // @@protoc_insertion_point(constructor:protocol.ChainSubscribeEvent)
 }
 
-void ChainPeerMessage::InitAsDefaultInstance() {
+void ChainSubscribeEvent::InitAsDefaultInstance() {
   _is_default_instance_ = true;
 }
 
-ChainPeerMessage::ChainPeerMessage(const ChainPeerMessage& from)
+ChainSubscribeEvent::ChainSubscribeEvent(const ChainSubscribeEvent& from)
   : ::google::protobuf::Message(),
     _internal_metadata_(NULL) {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:protocol.ChainPeerMessage)
+  // @@protoc_insertion_point(copy_constructor:protocol.ChainSubscribeEvent)
 }
 
-void ChainPeerMessage::SharedCtor() {
+void ChainSubscribeEvent::SharedCtor() {
     _is_default_instance_ = false;
   ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
-  src_peer_addr_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ledger_close_ = false;
 }
 
-ChainPeerMessage::~ChainPeerMessage() {
-  // @@protoc_insertion_point(destructor:protocol.ChainPeerMessage)
+ChainSubscribeEvent::~ChainSubscribeEvent() {
+  // @@protoc_insertion_point(destructor:protocol.ChainSubscribeEvent)
   SharedDtor();
 }
 
-void ChainPeerMessage::SharedDtor() {
-  src_peer_addr_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void ChainSubscribeEvent::SharedDtor() {
   if (this != default_instance_) {
   }
 }
 
-void ChainPeerMessage::SetCachedSize(int size) const {
+void ChainSubscribeEvent::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* ChainPeerMessage::descriptor() {
+const ::google::protobuf::Descriptor* ChainSubscribeEvent::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return ChainPeerMessage_descriptor_;
+  return ChainSubscribeEvent_descriptor_;
 }
 
-const ChainPeerMessage& ChainPeerMessage::default_instance() {
+const ChainSubscribeEvent& ChainSubscribeEvent::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_overlay_2eproto();
   return *default_instance_;
 }
 
-ChainPeerMessage* ChainPeerMessage::default_instance_ = NULL;
+ChainSubscribeEvent* ChainSubscribeEvent::default_instance_ = NULL;
 
-ChainPeerMessage* ChainPeerMessage::New(::google::protobuf::Arena* arena) const {
-  ChainPeerMessage* n = new ChainPeerMessage;
+ChainSubscribeEvent* ChainSubscribeEvent::New(::google::protobuf::Arena* arena) const {
+  ChainSubscribeEvent* n = new ChainSubscribeEvent;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void ChainPeerMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:protocol.ChainPeerMessage)
-  src_peer_addr_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  des_peer_addrs_.Clear();
+void ChainSubscribeEvent::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.ChainSubscribeEvent)
+  ledger_close_ = false;
+  accounts_.Clear();
+  contracts_.Clear();
+  topics_.Clear();
 }
 
-bool ChainPeerMessage::MergePartialFromCodedStream(
+bool ChainSubscribeEvent::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:protocol.ChainPeerMessage)
+  // @@protoc_insertion_point(parse_start:protocol.ChainSubscribeEvent)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional string src_peer_addr = 1;
+      // repeated string accounts = 1;
       case 1: {
         if (tag == 10) {
+         parse_accounts:
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_src_peer_addr()));
+                input, this->add_accounts()));
           DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->src_peer_addr().data(), this->src_peer_addr().length(),
+            this->accounts(this->accounts_size() - 1).data(),
+            this->accounts(this->accounts_size() - 1).length(),
             ::google::protobuf::internal::WireFormatLite::PARSE,
-            "protocol.ChainPeerMessage.src_peer_addr"));
+            "protocol.ChainSubscribeEvent.accounts"));
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(18)) goto parse_des_peer_addrs;
+        if (input->ExpectTag(10)) goto parse_accounts;
+        if (input->ExpectTag(18)) goto parse_contracts;
         break;
       }
 
-      // repeated string des_peer_addrs = 2;
+      // repeated string contracts = 2;
       case 2: {
         if (tag == 18) {
-         parse_des_peer_addrs:
+         parse_contracts:
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_des_peer_addrs()));
+                input, this->add_contracts()));
           DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->des_peer_addrs(this->des_peer_addrs_size() - 1).data(),
-            this->des_peer_addrs(this->des_peer_addrs_size() - 1).length(),
+            this->contracts(this->contracts_size() - 1).data(),
+            this->contracts(this->contracts_size() - 1).length(),
             ::google::protobuf::internal::WireFormatLite::PARSE,
-            "protocol.ChainPeerMessage.des_peer_addrs"));
+            "protocol.ChainSubscribeEvent.contracts"));
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(18)) goto parse_des_peer_addrs;
-        if (input->ExpectTag(26)) goto parse_data;
+        if (input->ExpectTag(18)) goto parse_contracts;
+        if (input->ExpectTag(26)) goto parse_topics;
         break;
       }
 
-      // optional bytes data = 3;
+      // repeated string topics = 3;
       case 3: {
         if (tag == 26) {
-         parse_data:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_data()));
+         parse_topics:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->add_topics()));
+          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+            this->topics(this->topics_size() - 1).data(),
+            this->topics(this->topics_size() - 1).length(),
+            ::google::protobuf::internal::WireFormatLite::PARSE,
+            "protocol.ChainSubscribeEvent.topics"));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(26)) goto parse_topics;
+        if (input->ExpectTag(32)) goto parse_ledger_close;
+        break;
+      }
+
+      // optional bool ledger_close = 4;
+      case 4: {
+        if (tag == 32) {
+         parse_ledger_close:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &ledger_close_)));
+
         } else {
           goto handle_unusual;
         }
@@ -5499,104 +7014,125 @@ bool ChainPeerMessage::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:protocol.ChainPeerMessage)
+  // @@protoc_insertion_point(parse_success:protocol.ChainSubscribeEvent)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:protocol.ChainPeerMessage)
+  // @@protoc_insertion_point(parse_failure:protocol.ChainSubscribeEvent)
   return false;
 #undef DO_
 }
 
-void ChainPeerMessage::SerializeWithCachedSizes(
+void ChainSubscribeEvent::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:protocol.ChainPeerMessage)
-  // optional string src_peer_addr = 1;
-  if (this->src_peer_addr().size() > 0) {
+  // @@protoc_insertion_point(serialize_start:protocol.ChainSubscribeEvent)
+  // repeated string accounts = 1;
+  for (int i = 0; i < this->accounts_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->src_peer_addr().data(), this->src_peer_addr().length(),
+      this->accounts(i).data(), this->accounts(i).length(),
       ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "protocol.ChainPeerMessage.src_peer_addr");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->src_peer_addr(), output);
+      "protocol.ChainSubscribeEvent.accounts");
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->accounts(i), output);
   }
 
-  // repeated string des_peer_addrs = 2;
-  for (int i = 0; i < this->des_peer_addrs_size(); i++) {
+  // repeated string contracts = 2;
+  for (int i = 0; i < this->contracts_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->des_peer_addrs(i).data(), this->des_peer_addrs(i).length(),
+      this->contracts(i).data(), this->contracts(i).length(),
       ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "protocol.ChainPeerMessage.des_peer_addrs");
+      "protocol.ChainSubscribeEvent.contracts");
     ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->des_peer_addrs(i), output);
+      2, this->contracts(i), output);
   }
 
-  // optional bytes data = 3;
-  if (this->data().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      3, this->data(), output);
+  // repeated string topics = 3;
+  for (int i = 0; i < this->topics_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->topics(i).data(), this->topics(i).length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.ChainSubscribeEvent.topics");
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      3, this->topics(i), output);
   }
 
-  // @@protoc_insertion_point(serialize_end:protocol.ChainPeerMessage)
+  // optional bool ledger_close = 4;
+  if (this->ledger_close() != 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->ledger_close(), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:protocol.ChainSubscribeEvent)
 }
 
-::google::protobuf::uint8* ChainPeerMessage::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* ChainSubscribeEvent::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:protocol.ChainPeerMessage)
-  // optional string src_peer_addr = 1;
-  if (this->src_peer_addr().size() > 0) {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.ChainSubscribeEvent)
+  // repeated string accounts = 1;
+  for (int i = 0; i < this->accounts_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->src_peer_addr().data(), this->src_peer_addr().length(),
+      this->accounts(i).data(), this->accounts(i).length(),
       ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "protocol.ChainPeerMessage.src_peer_addr");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->src_peer_addr(), target);
+      "protocol.ChainSubscribeEvent.accounts");
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringToArray(1, this->accounts(i), target);
   }
 
-  // repeated string des_peer_addrs = 2;
-  for (int i = 0; i < this->des_peer_addrs_size(); i++) {
+  // repeated string contracts = 2;
+  for (int i = 0; i < this->contracts_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->des_peer_addrs(i).data(), this->des_peer_addrs(i).length(),
+      this->contracts(i).data(), this->contracts(i).length(),
       ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "protocol.ChainPeerMessage.des_peer_addrs");
+      "protocol.ChainSubscribeEvent.contracts");
     target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(2, this->des_peer_addrs(i), target);
+      WriteStringToArray(2, this->contracts(i), target);
   }
 
-  // optional bytes data = 3;
-  if (this->data().size() > 0) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        3, this->data(), target);
+  // repeated string topics = 3;
+  for (int i = 0; i < this->topics_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+      this->topics(i).data(), this->topics(i).length(),
+      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+      "protocol.ChainSubscribeEvent.topics");
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringToArray(3, this->topics(i), target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:protocol.ChainPeerMessage)
+  // optional bool ledger_close = 4;
+  if (this->ledger_close() != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->ledger_close(), target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.ChainSubscribeEvent)
   return target;
 }
 
-int ChainPeerMessage::ByteSize() const {
-// @@protoc_insertion_point(message_byte_size_start:protocol.ChainPeerMessage)
+int ChainSubscribeEvent::ByteSize() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.ChainSubscribeEvent)
   int total_size = 0;
 
-  // optional string src_peer_addr = 1;
-  if (this->src_peer_addr().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->src_peer_addr());
+  // optional bool ledger_close = 4;
+  if (this->ledger_close() != 0) {
+    total_size += 1 + 1;
   }
 
-  // optional bytes data = 3;
-  if (this->data().size() > 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::BytesSize(
-        this->data());
+  // repeated string accounts = 1;
+  total_size += 1 * this->accounts_size();
+  for (int i = 0; i < this->accounts_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->accounts(i));
   }
 
-  // repeated string des_peer_addrs = 2;
-  total_size += 1 * this->des_peer_addrs_size();
-  for (int i = 0; i < this->des_peer_addrs_size(); i++) {
+  // repeated string contracts = 2;
+  total_size += 1 * this->contracts_size();
+  for (int i = 0; i < this->contracts_size(); i++) {
     total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->des_peer_addrs(i));
+      this->contracts(i));
+  }
+
+  // repeated string topics = 3;
+  total_size += 1 * this->topics_size();
+  for (int i = 0; i < this->topics_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->topics(i));
   }
 
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
@@ -5605,222 +7141,256 @@ int ChainPeerMessage::ByteSize() const {
   return total_size;
 }
 
-void ChainPeerMessage::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.ChainPeerMessage)
+void ChainSubscribeEvent::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protocol.ChainSubscribeEvent)
   if (GOOGLE_PREDICT_FALSE(&from == this)) {
     ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
   }
-  const ChainPeerMessage* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const ChainPeerMessage>(
+  const ChainSubscribeEvent* source = 
+      ::google::protobuf::internal::DynamicCastToGenerated<const ChainSubscribeEvent>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.ChainPeerMessage)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.ChainSubscribeEvent)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.ChainPeerMessage)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.ChainSubscribeEvent)
     MergeFrom(*source);
   }
 }
 
-void ChainPeerMessage::MergeFrom(const ChainPeerMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.ChainPeerMessage)
+void ChainSubscribeEvent::MergeFrom(const ChainSubscribeEvent& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protocol.ChainSubscribeEvent)
   if (GOOGLE_PREDICT_FALSE(&from == this)) {
     ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
   }
-  des_peer_addrs_.MergeFrom(from.des_peer_addrs_);
-  if (from.src_peer_addr().size() > 0) {
-
-    src_peer_addr_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.src_peer_addr_);
-  }
-  if (from.data().size() > 0) {
-
-    data_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.data_);
+  accounts_.MergeFrom(from.accounts_);
+  contracts_.MergeFrom(from.contracts_);
+  topics_.MergeFrom(from.topics_);
+  if (from.ledger_close() != 0) {
+    set_ledger_close(from.ledger_close());
   }
 }
 
-void ChainPeerMessage::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.ChainPeerMessage)
+void ChainSubscribeEvent::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protocol.ChainSubscribeEvent)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ChainPeerMessage::CopyFrom(const ChainPeerMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:protocol.ChainPeerMessage)
+void ChainSubscribeEvent::CopyFrom(const ChainSubscribeEvent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.ChainSubscribeEvent)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ChainPeerMessage::IsInitialized() const {
+bool ChainSubscribeEvent::IsInitialized() const {
 
   return true;
 }
 
-void ChainPeerMessage::Swap(ChainPeerMessage* other) {
+void ChainSubscribeEvent::Swap(ChainSubscribeEvent* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void ChainPeerMessage::InternalSwap(ChainPeerMessage* other) {
-  src_peer_addr_.Swap(&other->src_peer_addr_);
-  des_peer_addrs_.UnsafeArenaSwap(&other->des_peer_addrs_);
-  data_.Swap(&other->data_);
+void ChainSubscribeEvent::InternalSwap(ChainSubscribeEvent* other) {
+  accounts_.UnsafeArenaSwap(&other->accounts_);
+  contracts_.UnsafeArenaSwap(&other->contracts_);
+  topics_.UnsafeArenaSwap(&other->topics_);
+  std::swap(ledger_close_, other->ledger_close_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata ChainPeerMessage::GetMetadata() const {
+::google::protobuf::Metadata ChainSubscribeEvent::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ChainPeerMessage_descriptor_;
-  metadata.reflection = ChainPeerMessage_reflection_;
+  metadata.descriptor = ChainSubscribeEvent_descriptor_;
+  metadata.reflection = ChainSubscribeEvent_reflection_;
   return metadata;
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ChainPeerMessage
+// ChainSubscribeEvent
 
-// optional string src_peer_addr = 1;
-void ChainPeerMessage::clear_src_peer_addr() {
-  src_peer_addr_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
- const ::std::string& ChainPeerMessage::src_peer_addr() const {
-  // @@protoc_insertion_point(field_get:protocol.ChainPeerMessage.src_peer_addr)
-  return src_peer_addr_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// repeated string accounts = 1;
+int ChainSubscribeEvent::accounts_size() const {
+  return accounts_.size();
 }
- void ChainPeerMessage::set_src_peer_addr(const ::std::string& value) {
-  
-  src_peer_addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.ChainPeerMessage.src_peer_addr)
+void ChainSubscribeEvent::clear_accounts() {
+  accounts_.Clear();
 }
- void ChainPeerMessage::set_src_peer_addr(const char* value) {
-  
-  src_peer_addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.ChainPeerMessage.src_peer_addr)
+ const ::std::string& ChainSubscribeEvent::accounts(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.ChainSubscribeEvent.accounts)
+  return accounts_.Get(index);
 }
- void ChainPeerMessage::set_src_peer_addr(const char* value, size_t size) {
-  
-  src_peer_addr_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.ChainPeerMessage.src_peer_addr)
+ ::std::string* ChainSubscribeEvent::mutable_accounts(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.ChainSubscribeEvent.accounts)
+  return accounts_.Mutable(index);
 }
- ::std::string* ChainPeerMessage::mutable_src_peer_addr() {
-  
-  // @@protoc_insertion_point(field_mutable:protocol.ChainPeerMessage.src_peer_addr)
-  return src_peer_addr_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+ void ChainSubscribeEvent::set_accounts(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.ChainSubscribeEvent.accounts)
+  accounts_.Mutable(index)->assign(value);
 }
- ::std::string* ChainPeerMessage::release_src_peer_addr() {
-  // @@protoc_insertion_point(field_release:protocol.ChainPeerMessage.src_peer_addr)
-  
-  return src_peer_addr_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+ void ChainSubscribeEvent::set_accounts(int index, const char* value) {
+  accounts_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.ChainSubscribeEvent.accounts)
 }
- void ChainPeerMessage::set_allocated_src_peer_addr(::std::string* src_peer_addr) {
-  if (src_peer_addr != NULL) {
-    
-  } else {
-    
-  }
-  src_peer_addr_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), src_peer_addr);
-  // @@protoc_insertion_point(field_set_allocated:protocol.ChainPeerMessage.src_peer_addr)
+ void ChainSubscribeEvent::set_accounts(int index, const char* value, size_t size) {
+  accounts_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protocol.ChainSubscribeEvent.accounts)
+}
+ ::std::string* ChainSubscribeEvent::add_accounts() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.ChainSubscribeEvent.accounts)
+  return accounts_.Add();
+}
+ void ChainSubscribeEvent::add_accounts(const ::std::string& value) {
+  accounts_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.ChainSubscribeEvent.accounts)
+}
+ void ChainSubscribeEvent::add_accounts(const char* value) {
+  accounts_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.ChainSubscribeEvent.accounts)
+}
+ void ChainSubscribeEvent::add_accounts(const char* value, size_t size) {
+  accounts_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.ChainSubscribeEvent.accounts)
+}
+ const ::google::protobuf::RepeatedPtrField< ::std::string>&
+ChainSubscribeEvent::accounts() const {
+  // @@protoc_insertion_point(field_list:protocol.ChainSubscribeEvent.accounts)
+  return accounts_;
+}
+ ::google::protobuf::RepeatedPtrField< ::std::string>*
+ChainSubscribeEvent::mutable_accounts() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.ChainSubscribeEvent.accounts)
+  return &accounts_;
 }
 
-// repeated string des_peer_addrs = 2;
-int ChainPeerMessage::des_peer_addrs_size() const {
-  return des_peer_addrs_.size();
+// repeated string contracts = 2;
+int ChainSubscribeEvent::contracts_size() const {
+  return contracts_.size();
 }
-void ChainPeerMessage::clear_des_peer_addrs() {
-  des_peer_addrs_.Clear();
+void ChainSubscribeEvent::clear_contracts() {
+  contracts_.Clear();
 }
- const ::std::string& ChainPeerMessage::des_peer_addrs(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.ChainPeerMessage.des_peer_addrs)
-  return des_peer_addrs_.Get(index);
+ const ::std::string& ChainSubscribeEvent::contracts(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.ChainSubscribeEvent.contracts)
+  return contracts_.Get(index);
 }
- ::std::string* ChainPeerMessage::mutable_des_peer_addrs(int index) {
-  // @@protoc_insertion_point(field_mutable:protocol.ChainPeerMessage.des_peer_addrs)
-  return des_peer_addrs_.Mutable(index);
+ ::std::string* ChainSubscribeEvent::mutable_contracts(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.ChainSubscribeEvent.contracts)
+  return contracts_.Mutable(index);
 }
- void ChainPeerMessage::set_des_peer_addrs(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:protocol.ChainPeerMessage.des_peer_addrs)
-  des_peer_addrs_.Mutable(index)->assign(value);
+ void ChainSubscribeEvent::set_contracts(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.ChainSubscribeEvent.contracts)
+  contracts_.Mutable(index)->assign(value);
 }
- void ChainPeerMessage::set_des_peer_addrs(int index, const char* value) {
-  des_peer_addrs_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:protocol.ChainPeerMessage.des_peer_addrs)
+ void ChainSubscribeEvent::set_contracts(int index, const char* value) {
+  contracts_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.ChainSubscribeEvent.contracts)
 }
- void ChainPeerMessage::set_des_peer_addrs(int index, const char* value, size_t size) {
-  des_peer_addrs_.Mutable(index)->assign(
+ void ChainSubscribeEvent::set_contracts(int index, const char* value, size_t size) {
+  contracts_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:protocol.ChainPeerMessage.des_peer_addrs)
+  // @@protoc_insertion_point(field_set_pointer:protocol.ChainSubscribeEvent.contracts)
 }
- ::std::string* ChainPeerMessage::add_des_peer_addrs() {
-  // @@protoc_insertion_point(field_add_mutable:protocol.ChainPeerMessage.des_peer_addrs)
-  return des_peer_addrs_.Add();
+ ::std::string* ChainSubscribeEvent::add_contracts() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.ChainSubscribeEvent.contracts)
+  return contracts_.Add();
 }
- void ChainPeerMessage::add_des_peer_addrs(const ::std::string& value) {
-  des_peer_addrs_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:protocol.ChainPeerMessage.des_peer_addrs)
+ void ChainSubscribeEvent::add_contracts(const ::std::string& value) {
+  contracts_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.ChainSubscribeEvent.contracts)
 }
- void ChainPeerMessage::add_des_peer_addrs(const char* value) {
-  des_peer_addrs_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:protocol.ChainPeerMessage.des_peer_addrs)
+ void ChainSubscribeEvent::add_contracts(const char* value) {
+  contracts_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.ChainSubscribeEvent.contracts)
 }
- void ChainPeerMessage::add_des_peer_addrs(const char* value, size_t size) {
-  des_peer_addrs_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:protocol.ChainPeerMessage.des_peer_addrs)
+ void ChainSubscribeEvent::add_contracts(const char* value, size_t size) {
+  contracts_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.ChainSubscribeEvent.contracts)
 }
  const ::google::protobuf::RepeatedPtrField< ::std::string>&
-ChainPeerMessage::des_peer_addrs() const {
-  // @@protoc_insertion_point(field_list:protocol.ChainPeerMessage.des_peer_addrs)
-  return des_peer_addrs_;
+ChainSubscribeEvent::contracts() const {
+  // @@protoc_insertion_point(field_list:protocol.ChainSubscribeEvent.contracts)
+  return contracts_;
 }
  ::google::protobuf::RepeatedPtrField< ::std::string>*
-ChainPeerMessage::mutable_des_peer_addrs() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.ChainPeerMessage.des_peer_addrs)
-  return &des_peer_addrs_;
+ChainSubscribeEvent::mutable_contracts() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.ChainSubscribeEvent.contracts)
+  return &contracts_;
 }
 
-// optional bytes data = 3;
-void ChainPeerMessage::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// repeated string topics = 3;
+int ChainSubscribeEvent::topics_size() const {
+  return topics_.size();
 }
- const ::std::string& ChainPeerMessage::data() const {
-  // @@protoc_insertion_point(field_get:protocol.ChainPeerMessage.data)
-  return data_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+void ChainSubscribeEvent::clear_topics() {
+  topics_.Clear();
 }
- void ChainPeerMessage::set_data(const ::std::string& value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:protocol.ChainPeerMessage.data)
+ const ::std::string& ChainSubscribeEvent::topics(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.ChainSubscribeEvent.topics)
+  return topics_.Get(index);
 }
- void ChainPeerMessage::set_data(const char* value) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:protocol.ChainPeerMessage.data)
+ ::std::string* ChainSubscribeEvent::mutable_topics(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.ChainSubscribeEvent.topics)
+  return topics_.Mutable(index);
 }
- void ChainPeerMessage::set_data(const void* value, size_t size) {
-  
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:protocol.ChainPeerMessage.data)
+ void ChainSubscribeEvent::set_topics(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.ChainSubscribeEvent.topics)
+  topics_.Mutable(index)->assign(value);
 }
- ::std::string* ChainPeerMessage::mutable_data() {
-  
-  // @@protoc_insertion_point(field_mutable:protocol.ChainPeerMessage.data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+ void ChainSubscribeEvent::set_topics(int index, const char* value) {
+  topics_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.ChainSubscribeEvent.topics)
 }
- ::std::string* ChainPeerMessage::release_data() {
-  // @@protoc_insertion_point(field_release:protocol.ChainPeerMessage.data)
-  
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+ void ChainSubscribeEvent::set_topics(int index, const char* value, size_t size) {
+  topics_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protocol.ChainSubscribeEvent.topics)
 }
- void ChainPeerMessage::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
-    
-  } else {
-    
-  }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
-  // @@protoc_insertion_point(field_set_allocated:protocol.ChainPeerMessage.data)
+ ::std::string* ChainSubscribeEvent::add_topics() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.ChainSubscribeEvent.topics)
+  return topics_.Add();
+}
+ void ChainSubscribeEvent::add_topics(const ::std::string& value) {
+  topics_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.ChainSubscribeEvent.topics)
+}
+ void ChainSubscribeEvent::add_topics(const char* value) {
+  topics_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.ChainSubscribeEvent.topics)
+}
+ void ChainSubscribeEvent::add_topics(const char* value, size_t size) {
+  topics_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.ChainSubscribeEvent.topics)
+}
+ const ::google::protobuf::RepeatedPtrField< ::std::string>&
+ChainSubscribeEvent::topics() const {
+  // @@protoc_insertion_point(field_list:protocol.ChainSubscribeEvent.topics)
+  return topics_;
+}
+ ::google::protobuf::RepeatedPtrField< ::std::string>*
+ChainSubscribeEvent::mutable_topics() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.ChainSubscribeEvent.topics)
+  return &topics_;
+}
+
+// optional bool ledger_close = 4;
+void ChainSubscribeEvent::clear_ledger_close() {
+  ledger_close_ = false;
+}
+ bool ChainSubscribeEvent::ledger_close() const {
+  // @@protoc_insertion_point(field_get:protocol.ChainSubscribeEvent.ledger_close)
+  return ledger_close_;
+}
+ void ChainSubscribeEvent::set_ledger_close(bool value) {
+  
+  ledger_close_ = value;
+  // @@protoc_insertion_point(field_set:protocol.ChainSubscribeEvent.ledger_close)
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -5828,98 +7398,113 @@ void ChainPeerMessage::clear_data() {
 // ===================================================================
 
 #if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int ChainSubscribeTx::kAddressFieldNumber;
+const int ChainLedgerClose::kHeaderFieldNumber;
+const int ChainLedgerClose::kTransactionsFieldNumber;
 #endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
 
-ChainSubscribeTx::ChainSubscribeTx()
+ChainLedgerClose::ChainLedgerClose()
   : ::google::protobuf::Message(), _internal_metadata_(NULL) {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:protocol.ChainSubscribeTx)
+  // @@protoc_insertion_point(constructor:protocol.ChainLedgerClose)
 }
 
-void ChainSubscribeTx::InitAsDefaultInstance() {
+void ChainLedgerClose::InitAsDefaultInstance() {
   _is_default_instance_ = true;
+  header_ = const_cast< ::protocol::LedgerHeader*>(&::protocol::LedgerHeader::default_instance());
 }
 
-ChainSubscribeTx::ChainSubscribeTx(const ChainSubscribeTx& from)
+ChainLedgerClose::ChainLedgerClose(const ChainLedgerClose& from)
   : ::google::protobuf::Message(),
     _internal_metadata_(NULL) {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:protocol.ChainSubscribeTx)
+  // @@protoc_insertion_point(copy_constructor:protocol.ChainLedgerClose)
 }
 
-void ChainSubscribeTx::SharedCtor() {
+void ChainLedgerClose::SharedCtor() {
     _is_default_instance_ = false;
-  ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
+  header_ = NULL;
 }
 
-ChainSubscribeTx::~ChainSubscribeTx() {
-  // @@protoc_insertion_point(destructor:protocol.ChainSubscribeTx)
+ChainLedgerClose::~ChainLedgerClose() {
+  // @@protoc_insertion_point(destructor:protocol.ChainLedgerClose)
   SharedDtor();
 }
 
-void ChainSubscribeTx::SharedDtor() {
+void ChainLedgerClose::SharedDtor() {
   if (this != default_instance_) {
+    delete header_;
   }
 }
 
-void ChainSubscribeTx::SetCachedSize(int size) const {
+void ChainLedgerClose::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* ChainSubscribeTx::descriptor() {
+const ::google::protobuf::Descriptor* ChainLedgerClose::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return ChainSubscribeTx_descriptor_;
+  return ChainLedgerClose_descriptor_;
 }
 
-const ChainSubscribeTx& ChainSubscribeTx::default_instance() {
+const ChainLedgerClose& ChainLedgerClose::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_overlay_2eproto();
   return *default_instance_;
 }
 
-ChainSubscribeTx* ChainSubscribeTx::default_instance_ = NULL;
+ChainLedgerClose* ChainLedgerClose::default_instance_ = NULL;
 
-ChainSubscribeTx* ChainSubscribeTx::New(::google::protobuf::Arena* arena) const {
-  ChainSubscribeTx* n = new ChainSubscribeTx;
+ChainLedgerClose* ChainLedgerClose::New(::google::protobuf::Arena* arena) const {
+  ChainLedgerClose* n = new ChainLedgerClose;
   if (arena != NULL) {
     arena->Own(n);
   }
   return n;
 }
 
-void ChainSubscribeTx::Clear() {
-// @@protoc_insertion_point(message_clear_start:protocol.ChainSubscribeTx)
-  address_.Clear();
+void ChainLedgerClose::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.ChainLedgerClose)
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
+  transactions_.Clear();
 }
 
-bool ChainSubscribeTx::MergePartialFromCodedStream(
+bool ChainLedgerClose::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:protocol.ChainSubscribeTx)
+  // @@protoc_insertion_point(parse_start:protocol.ChainLedgerClose)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated string address = 1;
+      // optional .protocol.LedgerHeader header = 1;
       case 1: {
         if (tag == 10) {
-         parse_address:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_address()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->address(this->address_size() - 1).data(),
-            this->address(this->address_size() - 1).length(),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "protocol.ChainSubscribeTx.address"));
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_header()));
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(10)) goto parse_address;
+        if (input->ExpectTag(18)) goto parse_transactions;
+        break;
+      }
+
+      // repeated .protocol.TransactionEnvStore transactions = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_transactions:
+          DO_(input->IncrementRecursionDepth());
+         parse_loop_transactions:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtualNoRecursionDepth(
+                input, add_transactions()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_loop_transactions;
+        input->UnsafeDecrementRecursionDepth();
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -5937,56 +7522,70 @@ bool ChainSubscribeTx::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:protocol.ChainSubscribeTx)
+  // @@protoc_insertion_point(parse_success:protocol.ChainLedgerClose)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:protocol.ChainSubscribeTx)
+  // @@protoc_insertion_point(parse_failure:protocol.ChainLedgerClose)
   return false;
 #undef DO_
 }
 
-void ChainSubscribeTx::SerializeWithCachedSizes(
+void ChainLedgerClose::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:protocol.ChainSubscribeTx)
-  // repeated string address = 1;
-  for (int i = 0; i < this->address_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->address(i).data(), this->address(i).length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "protocol.ChainSubscribeTx.address");
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->address(i), output);
+  // @@protoc_insertion_point(serialize_start:protocol.ChainLedgerClose)
+  // optional .protocol.LedgerHeader header = 1;
+  if (this->has_header()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, *this->header_, output);
   }
 
-  // @@protoc_insertion_point(serialize_end:protocol.ChainSubscribeTx)
+  // repeated .protocol.TransactionEnvStore transactions = 2;
+  for (unsigned int i = 0, n = this->transactions_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->transactions(i), output);
+  }
+
+  // @@protoc_insertion_point(serialize_end:protocol.ChainLedgerClose)
 }
 
-::google::protobuf::uint8* ChainSubscribeTx::InternalSerializeWithCachedSizesToArray(
+::google::protobuf::uint8* ChainLedgerClose::InternalSerializeWithCachedSizesToArray(
     bool deterministic, ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:protocol.ChainSubscribeTx)
-  // repeated string address = 1;
-  for (int i = 0; i < this->address_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->address(i).data(), this->address(i).length(),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "protocol.ChainSubscribeTx.address");
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.ChainLedgerClose)
+  // optional .protocol.LedgerHeader header = 1;
+  if (this->has_header()) {
     target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(1, this->address(i), target);
+      InternalWriteMessageNoVirtualToArray(
+        1, *this->header_, false, target);
   }
 
-  // @@protoc_insertion_point(serialize_to_array_end:protocol.ChainSubscribeTx)
+  // repeated .protocol.TransactionEnvStore transactions = 2;
+  for (unsigned int i = 0, n = this->transactions_size(); i < n; i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      InternalWriteMessageNoVirtualToArray(
+        2, this->transactions(i), false, target);
+  }
+
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.ChainLedgerClose)
   return target;
 }
 
-int ChainSubscribeTx::ByteSize() const {
-// @@protoc_insertion_point(message_byte_size_start:protocol.ChainSubscribeTx)
+int ChainLedgerClose::ByteSize() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.ChainLedgerClose)
   int total_size = 0;
 
-  // repeated string address = 1;
-  total_size += 1 * this->address_size();
-  for (int i = 0; i < this->address_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->address(i));
+  // optional .protocol.LedgerHeader header = 1;
+  if (this->has_header()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        *this->header_);
+  }
+
+  // repeated .protocol.TransactionEnvStore transactions = 2;
+  total_size += 1 * this->transactions_size();
+  for (int i = 0; i < this->transactions_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->transactions(i));
   }
 
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
@@ -5995,124 +7594,141 @@ int ChainSubscribeTx::ByteSize() const {
   return total_size;
 }
 
-void ChainSubscribeTx::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.ChainSubscribeTx)
+void ChainLedgerClose::MergeFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:protocol.ChainLedgerClose)
   if (GOOGLE_PREDICT_FALSE(&from == this)) {
     ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
   }
-  const ChainSubscribeTx* source = 
-      ::google::protobuf::internal::DynamicCastToGenerated<const ChainSubscribeTx>(
+  const ChainLedgerClose* source = 
+      ::google::protobuf::internal::DynamicCastToGenerated<const ChainLedgerClose>(
           &from);
   if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.ChainSubscribeTx)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.ChainLedgerClose)
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.ChainSubscribeTx)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.ChainLedgerClose)
     MergeFrom(*source);
   }
 }
 
-void ChainSubscribeTx::MergeFrom(const ChainSubscribeTx& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.ChainSubscribeTx)
+void ChainLedgerClose::MergeFrom(const ChainLedgerClose& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protocol.ChainLedgerClose)
   if (GOOGLE_PREDICT_FALSE(&from == this)) {
     ::google::protobuf::internal::MergeFromFail(__FILE__, __LINE__);
   }
-  address_.MergeFrom(from.address_);
+  transactions_.MergeFrom(from.transactions_);
+  if (from.has_header()) {
+    mutable_header()->::protocol::LedgerHeader::MergeFrom(from.header());
+  }
 }
 
-void ChainSubscribeTx::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.ChainSubscribeTx)
+void ChainLedgerClose::CopyFrom(const ::google::protobuf::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:protocol.ChainLedgerClose)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void ChainSubscribeTx::CopyFrom(const ChainSubscribeTx& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:protocol.ChainSubscribeTx)
+void ChainLedgerClose::CopyFrom(const ChainLedgerClose& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.ChainLedgerClose)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ChainSubscribeTx::IsInitialized() const {
+bool ChainLedgerClose::IsInitialized() const {
 
   return true;
 }
 
-void ChainSubscribeTx::Swap(ChainSubscribeTx* other) {
+void ChainLedgerClose::Swap(ChainLedgerClose* other) {
   if (other == this) return;
   InternalSwap(other);
 }
-void ChainSubscribeTx::InternalSwap(ChainSubscribeTx* other) {
-  address_.UnsafeArenaSwap(&other->address_);
+void ChainLedgerClose::InternalSwap(ChainLedgerClose* other) {
+  std::swap(header_, other->header_);
+  transactions_.UnsafeArenaSwap(&other->transactions_);
   _internal_metadata_.Swap(&other->_internal_metadata_);
   std::swap(_cached_size_, other->_cached_size_);
 }
 
-::google::protobuf::Metadata ChainSubscribeTx::GetMetadata() const {
+::google::protobuf::Metadata ChainLedgerClose::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = ChainSubscribeTx_descriptor_;
-  metadata.reflection = ChainSubscribeTx_reflection_;
+  metadata.descriptor = ChainLedgerClose_descriptor_;
+  metadata.reflection = ChainLedgerClose_reflection_;
   return metadata;
 }
 
 #if PROTOBUF_INLINE_NOT_IN_HEADERS
-// ChainSubscribeTx
+// ChainLedgerClose
 
-// repeated string address = 1;
-int ChainSubscribeTx::address_size() const {
-  return address_.size();
+// optional .protocol.LedgerHeader header = 1;
+bool ChainLedgerClose::has_header() const {
+  return !_is_default_instance_ && header_ != NULL;
 }
-void ChainSubscribeTx::clear_address() {
-  address_.Clear();
+void ChainLedgerClose::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
 }
- const ::std::string& ChainSubscribeTx::address(int index) const {
-  // @@protoc_insertion_point(field_get:protocol.ChainSubscribeTx.address)
-  return address_.Get(index);
+const ::protocol::LedgerHeader& ChainLedgerClose::header() const {
+  // @@protoc_insertion_point(field_get:protocol.ChainLedgerClose.header)
+  return header_ != NULL ? *header_ : *default_instance_->header_;
 }
- ::std::string* ChainSubscribeTx::mutable_address(int index) {
-  // @@protoc_insertion_point(field_mutable:protocol.ChainSubscribeTx.address)
-  return address_.Mutable(index);
+::protocol::LedgerHeader* ChainLedgerClose::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::protocol::LedgerHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.ChainLedgerClose.header)
+  return header_;
 }
- void ChainSubscribeTx::set_address(int index, const ::std::string& value) {
-  // @@protoc_insertion_point(field_set:protocol.ChainSubscribeTx.address)
-  address_.Mutable(index)->assign(value);
+::protocol::LedgerHeader* ChainLedgerClose::release_header() {
+  // @@protoc_insertion_point(field_release:protocol.ChainLedgerClose.header)
+  
+  ::protocol::LedgerHeader* temp = header_;
+  header_ = NULL;
+  return temp;
 }
- void ChainSubscribeTx::set_address(int index, const char* value) {
-  address_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:protocol.ChainSubscribeTx.address)
+void ChainLedgerClose::set_allocated_header(::protocol::LedgerHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.ChainLedgerClose.header)
 }
- void ChainSubscribeTx::set_address(int index, const char* value, size_t size) {
-  address_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:protocol.ChainSubscribeTx.address)
+
+// repeated .protocol.TransactionEnvStore transactions = 2;
+int ChainLedgerClose::transactions_size() const {
+  return transactions_.size();
 }
- ::std::string* ChainSubscribeTx::add_address() {
-  // @@protoc_insertion_point(field_add_mutable:protocol.ChainSubscribeTx.address)
-  return address_.Add();
+void ChainLedgerClose::clear_transactions() {
+  transactions_.Clear();
 }
- void ChainSubscribeTx::add_address(const ::std::string& value) {
-  address_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:protocol.ChainSubscribeTx.address)
+const ::protocol::TransactionEnvStore& ChainLedgerClose::transactions(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.ChainLedgerClose.transactions)
+  return transactions_.Get(index);
 }
- void ChainSubscribeTx::add_address(const char* value) {
-  address_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:protocol.ChainSubscribeTx.address)
+::protocol::TransactionEnvStore* ChainLedgerClose::mutable_transactions(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.ChainLedgerClose.transactions)
+  return transactions_.Mutable(index);
 }
- void ChainSubscribeTx::add_address(const char* value, size_t size) {
-  address_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:protocol.ChainSubscribeTx.address)
+::protocol::TransactionEnvStore* ChainLedgerClose::add_transactions() {
+  // @@protoc_insertion_point(field_add:protocol.ChainLedgerClose.transactions)
+  return transactions_.Add();
 }
- const ::google::protobuf::RepeatedPtrField< ::std::string>&
-ChainSubscribeTx::address() const {
-  // @@protoc_insertion_point(field_list:protocol.ChainSubscribeTx.address)
-  return address_;
+::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >*
+ChainLedgerClose::mutable_transactions() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.ChainLedgerClose.transactions)
+  return &transactions_;
 }
- ::google::protobuf::RepeatedPtrField< ::std::string>*
-ChainSubscribeTx::mutable_address() {
-  // @@protoc_insertion_point(field_mutable_list:protocol.ChainSubscribeTx.address)
-  return &address_;
+const ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >&
+ChainLedgerClose::transactions() const {
+  // @@protoc_insertion_point(field_list:protocol.ChainLedgerClose.transactions)
+  return transactions_;
 }
 
 #endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
@@ -41,20 +41,24 @@ void protobuf_ShutdownFile_overlay_2eproto();
 
 class ChainHello;
 class ChainInfoMessage;
+class ChainLedgerClose;
 class ChainPeerMessage;
 class ChainResponse;
 class ChainStatus;
+class ChainSubscribeEvent;
 class ChainSubscribeTx;
 class ChainTxStatus;
 class DontHave;
 class EntryList;
 class GetLedgers;
+class GetTransactions;
 class Hello;
 class HelloResponse;
 class LedgerUpgradeNotify;
 class Ledgers;
 class Peer;
 class Peers;
+class TransactionInventory;
 
 enum Ledgers_SyncCode {
   Ledgers_SyncCode_OK = 0,
@@ -114,12 +118,14 @@ enum OVERLAY_MESSAGE_TYPE {
   OVERLAY_MSGTYPE_LEDGERS = 5,
   OVERLAY_MSGTYPE_PBFT = 6,
   OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY = 7,
+  OVERLAY_MSGTYPE_TRANSACTION_INVENTORY = 8,
+  OVERLAY_MSGTYPE_GET_TRANSACTIONS = 9,
   OVERLAY_MESSAGE_TYPE_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
   OVERLAY_MESSAGE_TYPE_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
 };
 bool OVERLAY_MESSAGE_TYPE_IsValid(int value);
 const OVERLAY_MESSAGE_TYPE OVERLAY_MESSAGE_TYPE_MIN = OVERLAY_MSGTYPE_NONE;
-const OVERLAY_MESSAGE_TYPE OVERLAY_MESSAGE_TYPE_MAX = OVERLAY_MSGTYPE_LEDGER_UPGRADE_NOTIFY;
+const OVERLAY_MESSAGE_TYPE OVERLAY_MESSAGE_TYPE_MAX = OVERLAY_MSGTYPE_GET_TRANSACTIONS;
 const int OVERLAY_MESSAGE_TYPE_ARRAYSIZE = OVERLAY_MESSAGE_TYPE_MAX + 1;
 
 const ::google::protobuf::EnumDescriptor* OVERLAY_MESSAGE_TYPE_descriptor();
@@ -143,12 +149,14 @@ enum ChainMessageType {
   CHAIN_LEDGER_HEADER = 16,
   CHAIN_SUBSCRIBE_TX = 17,
   CHAIN_TX_ENV_STORE = 18,
+  CHAIN_SUBSCRIBE_EVENT = 19,
+  CHAIN_LEDGER_CLOSE = 20,
   ChainMessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
   ChainMessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
 };
 bool ChainMessageType_IsValid(int value);
 const ChainMessageType ChainMessageType_MIN = CHAIN_TYPE_NONE;
-const ChainMessageType ChainMessageType_MAX = CHAIN_TX_ENV_STORE;
+const ChainMessageType ChainMessageType_MAX = CHAIN_LEDGER_CLOSE;
 const int ChainMessageType_ARRAYSIZE = ChainMessageType_MAX + 1;
 
 const ::google::protobuf::EnumDescriptor* ChainMessageType_descriptor();
@@ -280,6 +288,12 @@ class Hello : public ::google::protobuf::Message /* @@protoc_insertion_point(cla
   ::std::string* release_node_rand();
   void set_allocated_node_rand(::std::string* node_rand);
 
+  // optional bool compress_enabled = 8;
+  void clear_compress_enabled();
+  static const int kCompressEnabledFieldNumber = 8;
+  bool compress_enabled() const;
+  void set_compress_enabled(bool value);
+
   // @@protoc_insertion_point(class_scope:protocol.Hello)
  private:
 
@@ -292,6 +306,7 @@ class Hello : public ::google::protobuf::Message /* @@protoc_insertion_point(cla
   ::google::protobuf::int64 listening_port_;
   ::google::protobuf::internal::ArenaStringPtr node_address_;
   ::google::protobuf::internal::ArenaStringPtr node_rand_;
+  bool compress_enabled_;
   mutable int _cached_size_;
   friend void  protobuf_AddDesc_overlay_2eproto();
   friend void protobuf_AssignDesc_overlay_2eproto();
@@ -958,6 +973,190 @@ class DontHave : public ::google::protobuf::Message /* @@protoc_insertion_point(
 };
 // -------------------------------------------------------------------
 
+class TransactionInventory : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protocol.TransactionInventory) */ {
+ public:
+  TransactionInventory();
+  virtual ~TransactionInventory();
+
+  TransactionInventory(const TransactionInventory& from);
+
+  inline TransactionInventory& operator=(const TransactionInventory& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TransactionInventory& default_instance();
+
+  void Swap(TransactionInventory* other);
+
+  // implements Message ----------------------------------------------
+
+  inline TransactionInventory* New() const { return New(NULL); }
+
+  TransactionInventory* New(::google::protobuf::Arena* arena) const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const TransactionInventory& from);
+  void MergeFrom(const TransactionInventory& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TransactionInventory* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return _internal_metadata_.arena();
+  }
+  inline void* MaybeArenaPtr() const {
+    return _internal_metadata_.raw_arena_ptr();
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated bytes hashes = 1;
+  int hashes_size() const;
+  void clear_hashes();
+  static const int kHashesFieldNumber = 1;
+  const ::std::string& hashes(int index) const;
+  ::std::string* mutable_hashes(int index);
+  void set_hashes(int index, const ::std::string& value);
+  void set_hashes(int index, const char* value);
+  void set_hashes(int index, const void* value, size_t size);
+  ::std::string* add_hashes();
+  void add_hashes(const ::std::string& value);
+  void add_hashes(const char* value);
+  void add_hashes(const void* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& hashes() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_hashes();
+
+  // @@protoc_insertion_point(class_scope:protocol.TransactionInventory)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  bool _is_default_instance_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> hashes_;
+  mutable int _cached_size_;
+  friend void  protobuf_AddDesc_overlay_2eproto();
+  friend void protobuf_AssignDesc_overlay_2eproto();
+  friend void protobuf_ShutdownFile_overlay_2eproto();
+
+  void InitAsDefaultInstance();
+  static TransactionInventory* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class GetTransactions : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protocol.GetTransactions) */ {
+ public:
+  GetTransactions();
+  virtual ~GetTransactions();
+
+  GetTransactions(const GetTransactions& from);
+
+  inline GetTransactions& operator=(const GetTransactions& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const GetTransactions& default_instance();
+
+  void Swap(GetTransactions* other);
+
+  // implements Message ----------------------------------------------
+
+  inline GetTransactions* New() const { return New(NULL); }
+
+  GetTransactions* New(::google::protobuf::Arena* arena) const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const GetTransactions& from);
+  void MergeFrom(const GetTransactions& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(GetTransactions* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return _internal_metadata_.arena();
+  }
+  inline void* MaybeArenaPtr() const {
+    return _internal_metadata_.raw_arena_ptr();
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated bytes hashes = 1;
+  int hashes_size() const;
+  void clear_hashes();
+  static const int kHashesFieldNumber = 1;
+  const ::std::string& hashes(int index) const;
+  ::std::string* mutable_hashes(int index);
+  void set_hashes(int index, const ::std::string& value);
+  void set_hashes(int index, const char* value);
+  void set_hashes(int index, const void* value, size_t size);
+  ::std::string* add_hashes();
+  void add_hashes(const ::std::string& value);
+  void add_hashes(const char* value);
+  void add_hashes(const void* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& hashes() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_hashes();
+
+  // @@protoc_insertion_point(class_scope:protocol.GetTransactions)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  bool _is_default_instance_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> hashes_;
+  mutable int _cached_size_;
+  friend void  protobuf_AddDesc_overlay_2eproto();
+  friend void protobuf_AssignDesc_overlay_2eproto();
+  friend void protobuf_ShutdownFile_overlay_2eproto();
+
+  void InitAsDefaultInstance();
+  static GetTransactions* default_instance_;
+};
+// -------------------------------------------------------------------
+
 class LedgerUpgradeNotify : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protocol.LedgerUpgradeNotify) */ {
  public:
   LedgerUpgradeNotify();
@@ -1574,6 +1773,237 @@ class ChainSubscribeTx : public ::google::protobuf::Message /* @@protoc_insertio
 };
 // -------------------------------------------------------------------
 
+class ChainSubscribeEvent : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protocol.ChainSubscribeEvent) */ {
+ public:
+  ChainSubscribeEvent();
+  virtual ~ChainSubscribeEvent();
+
+  ChainSubscribeEvent(const ChainSubscribeEvent& from);
+
+  inline ChainSubscribeEvent& operator=(const ChainSubscribeEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const ChainSubscribeEvent& default_instance();
+
+  void Swap(ChainSubscribeEvent* other);
+
+  // implements Message ----------------------------------------------
+
+  inline ChainSubscribeEvent* New() const { return New(NULL); }
+
+  ChainSubscribeEvent* New(::google::protobuf::Arena* arena) const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const ChainSubscribeEvent& from);
+  void MergeFrom(const ChainSubscribeEvent& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(ChainSubscribeEvent* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return _internal_metadata_.arena();
+  }
+  inline void* MaybeArenaPtr() const {
+    return _internal_metadata_.raw_arena_ptr();
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated string accounts = 1;
+  int accounts_size() const;
+  void clear_accounts();
+  static const int kAccountsFieldNumber = 1;
+  const ::std::string& accounts(int index) const;
+  ::std::string* mutable_accounts(int index);
+  void set_accounts(int index, const ::std::string& value);
+  void set_accounts(int index, const char* value);
+  void set_accounts(int index, const char* value, size_t size);
+  ::std::string* add_accounts();
+  void add_accounts(const ::std::string& value);
+  void add_accounts(const char* value);
+  void add_accounts(const char* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& accounts() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_accounts();
+
+  // repeated string contracts = 2;
+  int contracts_size() const;
+  void clear_contracts();
+  static const int kContractsFieldNumber = 2;
+  const ::std::string& contracts(int index) const;
+  ::std::string* mutable_contracts(int index);
+  void set_contracts(int index, const ::std::string& value);
+  void set_contracts(int index, const char* value);
+  void set_contracts(int index, const char* value, size_t size);
+  ::std::string* add_contracts();
+  void add_contracts(const ::std::string& value);
+  void add_contracts(const char* value);
+  void add_contracts(const char* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& contracts() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_contracts();
+
+  // repeated string topics = 3;
+  int topics_size() const;
+  void clear_topics();
+  static const int kTopicsFieldNumber = 3;
+  const ::std::string& topics(int index) const;
+  ::std::string* mutable_topics(int index);
+  void set_topics(int index, const ::std::string& value);
+  void set_topics(int index, const char* value);
+  void set_topics(int index, const char* value, size_t size);
+  ::std::string* add_topics();
+  void add_topics(const ::std::string& value);
+  void add_topics(const char* value);
+  void add_topics(const char* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& topics() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_topics();
+
+  // optional bool ledger_close = 4;
+  void clear_ledger_close();
+  static const int kLedgerCloseFieldNumber = 4;
+  bool ledger_close() const;
+  void set_ledger_close(bool value);
+
+  // @@protoc_insertion_point(class_scope:protocol.ChainSubscribeEvent)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  bool _is_default_instance_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> accounts_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> contracts_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> topics_;
+  bool ledger_close_;
+  mutable int _cached_size_;
+  friend void  protobuf_AddDesc_overlay_2eproto();
+  friend void protobuf_AssignDesc_overlay_2eproto();
+  friend void protobuf_ShutdownFile_overlay_2eproto();
+
+  void InitAsDefaultInstance();
+  static ChainSubscribeEvent* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class ChainLedgerClose : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protocol.ChainLedgerClose) */ {
+ public:
+  ChainLedgerClose();
+  virtual ~ChainLedgerClose();
+
+  ChainLedgerClose(const ChainLedgerClose& from);
+
+  inline ChainLedgerClose& operator=(const ChainLedgerClose& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const ChainLedgerClose& default_instance();
+
+  void Swap(ChainLedgerClose* other);
+
+  // implements Message ----------------------------------------------
+
+  inline ChainLedgerClose* New() const { return New(NULL); }
+
+  ChainLedgerClose* New(::google::protobuf::Arena* arena) const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const ChainLedgerClose& from);
+  void MergeFrom(const ChainLedgerClose& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
+    return InternalSerializeWithCachedSizesToArray(false, output);
+  }
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(ChainLedgerClose* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return _internal_metadata_.arena();
+  }
+  inline void* MaybeArenaPtr() const {
+    return _internal_metadata_.raw_arena_ptr();
+  }
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional .protocol.LedgerHeader header = 1;
+  bool has_header() const;
+  void clear_header();
+  static const int kHeaderFieldNumber = 1;
+  const ::protocol::LedgerHeader& header() const;
+  ::protocol::LedgerHeader* mutable_header();
+  ::protocol::LedgerHeader* release_header();
+  void set_allocated_header(::protocol::LedgerHeader* header);
+
+  // repeated .protocol.TransactionEnvStore transactions = 2;
+  int transactions_size() const;
+  void clear_transactions();
+  static const int kTransactionsFieldNumber = 2;
+  const ::protocol::TransactionEnvStore& transactions(int index) const;
+  ::protocol::TransactionEnvStore* mutable_transactions(int index);
+  ::protocol::TransactionEnvStore* add_transactions();
+  ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >*
+      mutable_transactions();
+  const ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >&
+      transactions() const;
+
+  // @@protoc_insertion_point(class_scope:protocol.ChainLedgerClose)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
+  bool _is_default_instance_;
+  ::protocol::LedgerHeader* header_;
+  ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore > transactions_;
+  mutable int _cached_size_;
+  friend void  protobuf_AddDesc_overlay_2eproto();
+  friend void protobuf_AssignDesc_overlay_2eproto();
+  friend void protobuf_ShutdownFile_overlay_2eproto();
+
+  void InitAsDefaultInstance();
+  static ChainLedgerClose* default_instance_;
+};
+// -------------------------------------------------------------------
+
 class ChainResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:protocol.ChainResponse) */ {
  public:
   ChainResponse();
@@ -2141,6 +2571,20 @@ inline void Hello::set_allocated_node_rand(::std::string* node_rand) {
   // @@protoc_insertion_point(field_set_allocated:protocol.Hello.node_rand)
 }
 
+// optional bool compress_enabled = 8;
+inline void Hello::clear_compress_enabled() {
+  compress_enabled_ = false;
+}
+inline bool Hello::compress_enabled() const {
+  // @@protoc_insertion_point(field_get:protocol.Hello.compress_enabled)
+  return compress_enabled_;
+}
+inline void Hello::set_compress_enabled(bool value) {
+  
+  compress_enabled_ = value;
+  // @@protoc_insertion_point(field_set:protocol.Hello.compress_enabled)
+}
+
 // -------------------------------------------------------------------
 
 // HelloResponse
@@ -2599,6 +3043,124 @@ inline void DontHave::set_allocated_hash(::std::string* hash) {
 
 // -------------------------------------------------------------------
 
+// TransactionInventory
+
+// repeated bytes hashes = 1;
+inline int TransactionInventory::hashes_size() const {
+  return hashes_.size();
+}
+inline void TransactionInventory::clear_hashes() {
+  hashes_.Clear();
+}
+inline const ::std::string& TransactionInventory::hashes(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.TransactionInventory.hashes)
+  return hashes_.Get(index);
+}
+inline ::std::string* TransactionInventory::mutable_hashes(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.TransactionInventory.hashes)
+  return hashes_.Mutable(index);
+}
+inline void TransactionInventory::set_hashes(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.TransactionInventory.hashes)
+  hashes_.Mutable(index)->assign(value);
+}
+inline void TransactionInventory::set_hashes(int index, const char* value) {
+  hashes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.TransactionInventory.hashes)
+}
+inline void TransactionInventory::set_hashes(int index, const void* value, size_t size) {
+  hashes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protocol.TransactionInventory.hashes)
+}
+inline ::std::string* TransactionInventory::add_hashes() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.TransactionInventory.hashes)
+  return hashes_.Add();
+}
+inline void TransactionInventory::add_hashes(const ::std::string& value) {
+  hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.TransactionInventory.hashes)
+}
+inline void TransactionInventory::add_hashes(const char* value) {
+  hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.TransactionInventory.hashes)
+}
+inline void TransactionInventory::add_hashes(const void* value, size_t size) {
+  hashes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.TransactionInventory.hashes)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TransactionInventory::hashes() const {
+  // @@protoc_insertion_point(field_list:protocol.TransactionInventory.hashes)
+  return hashes_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+TransactionInventory::mutable_hashes() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.TransactionInventory.hashes)
+  return &hashes_;
+}
+
+// -------------------------------------------------------------------
+
+// GetTransactions
+
+// repeated bytes hashes = 1;
+inline int GetTransactions::hashes_size() const {
+  return hashes_.size();
+}
+inline void GetTransactions::clear_hashes() {
+  hashes_.Clear();
+}
+inline const ::std::string& GetTransactions::hashes(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.GetTransactions.hashes)
+  return hashes_.Get(index);
+}
+inline ::std::string* GetTransactions::mutable_hashes(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.GetTransactions.hashes)
+  return hashes_.Mutable(index);
+}
+inline void GetTransactions::set_hashes(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.GetTransactions.hashes)
+  hashes_.Mutable(index)->assign(value);
+}
+inline void GetTransactions::set_hashes(int index, const char* value) {
+  hashes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.GetTransactions.hashes)
+}
+inline void GetTransactions::set_hashes(int index, const void* value, size_t size) {
+  hashes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protocol.GetTransactions.hashes)
+}
+inline ::std::string* GetTransactions::add_hashes() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.GetTransactions.hashes)
+  return hashes_.Add();
+}
+inline void GetTransactions::add_hashes(const ::std::string& value) {
+  hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.GetTransactions.hashes)
+}
+inline void GetTransactions::add_hashes(const char* value) {
+  hashes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.GetTransactions.hashes)
+}
+inline void GetTransactions::add_hashes(const void* value, size_t size) {
+  hashes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.GetTransactions.hashes)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+GetTransactions::hashes() const {
+  // @@protoc_insertion_point(field_list:protocol.GetTransactions.hashes)
+  return hashes_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+GetTransactions::mutable_hashes() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.GetTransactions.hashes)
+  return &hashes_;
+}
+
+// -------------------------------------------------------------------
+
 // LedgerUpgradeNotify
 
 // optional int64 nonce = 1;
@@ -3140,6 +3702,261 @@ ChainSubscribeTx::mutable_address() {
 
 // -------------------------------------------------------------------
 
+// ChainSubscribeEvent
+
+// repeated string accounts = 1;
+inline int ChainSubscribeEvent::accounts_size() const {
+  return accounts_.size();
+}
+inline void ChainSubscribeEvent::clear_accounts() {
+  accounts_.Clear();
+}
+inline const ::std::string& ChainSubscribeEvent::accounts(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.ChainSubscribeEvent.accounts)
+  return accounts_.Get(index);
+}
+inline ::std::string* ChainSubscribeEvent::mutable_accounts(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.ChainSubscribeEvent.accounts)
+  return accounts_.Mutable(index);
+}
+inline void ChainSubscribeEvent::set_accounts(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.ChainSubscribeEvent.accounts)
+  accounts_.Mutable(index)->assign(value);
+}
+inline void ChainSubscribeEvent::set_accounts(int index, const char* value) {
+  accounts_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.ChainSubscribeEvent.accounts)
+}
+inline void ChainSubscribeEvent::set_accounts(int index, const char* value, size_t size) {
+  accounts_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protocol.ChainSubscribeEvent.accounts)
+}
+inline ::std::string* ChainSubscribeEvent::add_accounts() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.ChainSubscribeEvent.accounts)
+  return accounts_.Add();
+}
+inline void ChainSubscribeEvent::add_accounts(const ::std::string& value) {
+  accounts_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.ChainSubscribeEvent.accounts)
+}
+inline void ChainSubscribeEvent::add_accounts(const char* value) {
+  accounts_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.ChainSubscribeEvent.accounts)
+}
+inline void ChainSubscribeEvent::add_accounts(const char* value, size_t size) {
+  accounts_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.ChainSubscribeEvent.accounts)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+ChainSubscribeEvent::accounts() const {
+  // @@protoc_insertion_point(field_list:protocol.ChainSubscribeEvent.accounts)
+  return accounts_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+ChainSubscribeEvent::mutable_accounts() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.ChainSubscribeEvent.accounts)
+  return &accounts_;
+}
+
+// repeated string contracts = 2;
+inline int ChainSubscribeEvent::contracts_size() const {
+  return contracts_.size();
+}
+inline void ChainSubscribeEvent::clear_contracts() {
+  contracts_.Clear();
+}
+inline const ::std::string& ChainSubscribeEvent::contracts(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.ChainSubscribeEvent.contracts)
+  return contracts_.Get(index);
+}
+inline ::std::string* ChainSubscribeEvent::mutable_contracts(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.ChainSubscribeEvent.contracts)
+  return contracts_.Mutable(index);
+}
+inline void ChainSubscribeEvent::set_contracts(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.ChainSubscribeEvent.contracts)
+  contracts_.Mutable(index)->assign(value);
+}
+inline void ChainSubscribeEvent::set_contracts(int index, const char* value) {
+  contracts_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.ChainSubscribeEvent.contracts)
+}
+inline void ChainSubscribeEvent::set_contracts(int index, const char* value, size_t size) {
+  contracts_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protocol.ChainSubscribeEvent.contracts)
+}
+inline ::std::string* ChainSubscribeEvent::add_contracts() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.ChainSubscribeEvent.contracts)
+  return contracts_.Add();
+}
+inline void ChainSubscribeEvent::add_contracts(const ::std::string& value) {
+  contracts_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.ChainSubscribeEvent.contracts)
+}
+inline void ChainSubscribeEvent::add_contracts(const char* value) {
+  contracts_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.ChainSubscribeEvent.contracts)
+}
+inline void ChainSubscribeEvent::add_contracts(const char* value, size_t size) {
+  contracts_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.ChainSubscribeEvent.contracts)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+ChainSubscribeEvent::contracts() const {
+  // @@protoc_insertion_point(field_list:protocol.ChainSubscribeEvent.contracts)
+  return contracts_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+ChainSubscribeEvent::mutable_contracts() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.ChainSubscribeEvent.contracts)
+  return &contracts_;
+}
+
+// repeated string topics = 3;
+inline int ChainSubscribeEvent::topics_size() const {
+  return topics_.size();
+}
+inline void ChainSubscribeEvent::clear_topics() {
+  topics_.Clear();
+}
+inline const ::std::string& ChainSubscribeEvent::topics(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.ChainSubscribeEvent.topics)
+  return topics_.Get(index);
+}
+inline ::std::string* ChainSubscribeEvent::mutable_topics(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.ChainSubscribeEvent.topics)
+  return topics_.Mutable(index);
+}
+inline void ChainSubscribeEvent::set_topics(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protocol.ChainSubscribeEvent.topics)
+  topics_.Mutable(index)->assign(value);
+}
+inline void ChainSubscribeEvent::set_topics(int index, const char* value) {
+  topics_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protocol.ChainSubscribeEvent.topics)
+}
+inline void ChainSubscribeEvent::set_topics(int index, const char* value, size_t size) {
+  topics_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protocol.ChainSubscribeEvent.topics)
+}
+inline ::std::string* ChainSubscribeEvent::add_topics() {
+  // @@protoc_insertion_point(field_add_mutable:protocol.ChainSubscribeEvent.topics)
+  return topics_.Add();
+}
+inline void ChainSubscribeEvent::add_topics(const ::std::string& value) {
+  topics_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protocol.ChainSubscribeEvent.topics)
+}
+inline void ChainSubscribeEvent::add_topics(const char* value) {
+  topics_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protocol.ChainSubscribeEvent.topics)
+}
+inline void ChainSubscribeEvent::add_topics(const char* value, size_t size) {
+  topics_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protocol.ChainSubscribeEvent.topics)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+ChainSubscribeEvent::topics() const {
+  // @@protoc_insertion_point(field_list:protocol.ChainSubscribeEvent.topics)
+  return topics_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+ChainSubscribeEvent::mutable_topics() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.ChainSubscribeEvent.topics)
+  return &topics_;
+}
+
+// optional bool ledger_close = 4;
+inline void ChainSubscribeEvent::clear_ledger_close() {
+  ledger_close_ = false;
+}
+inline bool ChainSubscribeEvent::ledger_close() const {
+  // @@protoc_insertion_point(field_get:protocol.ChainSubscribeEvent.ledger_close)
+  return ledger_close_;
+}
+inline void ChainSubscribeEvent::set_ledger_close(bool value) {
+  
+  ledger_close_ = value;
+  // @@protoc_insertion_point(field_set:protocol.ChainSubscribeEvent.ledger_close)
+}
+
+// -------------------------------------------------------------------
+
+// ChainLedgerClose
+
+// optional .protocol.LedgerHeader header = 1;
+inline bool ChainLedgerClose::has_header() const {
+  return !_is_default_instance_ && header_ != NULL;
+}
+inline void ChainLedgerClose::clear_header() {
+  if (GetArenaNoVirtual() == NULL && header_ != NULL) delete header_;
+  header_ = NULL;
+}
+inline const ::protocol::LedgerHeader& ChainLedgerClose::header() const {
+  // @@protoc_insertion_point(field_get:protocol.ChainLedgerClose.header)
+  return header_ != NULL ? *header_ : *default_instance_->header_;
+}
+inline ::protocol::LedgerHeader* ChainLedgerClose::mutable_header() {
+  
+  if (header_ == NULL) {
+    header_ = new ::protocol::LedgerHeader;
+  }
+  // @@protoc_insertion_point(field_mutable:protocol.ChainLedgerClose.header)
+  return header_;
+}
+inline ::protocol::LedgerHeader* ChainLedgerClose::release_header() {
+  // @@protoc_insertion_point(field_release:protocol.ChainLedgerClose.header)
+  
+  ::protocol::LedgerHeader* temp = header_;
+  header_ = NULL;
+  return temp;
+}
+inline void ChainLedgerClose::set_allocated_header(::protocol::LedgerHeader* header) {
+  delete header_;
+  header_ = header;
+  if (header) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.ChainLedgerClose.header)
+}
+
+// repeated .protocol.TransactionEnvStore transactions = 2;
+inline int ChainLedgerClose::transactions_size() const {
+  return transactions_.size();
+}
+inline void ChainLedgerClose::clear_transactions() {
+  transactions_.Clear();
+}
+inline const ::protocol::TransactionEnvStore& ChainLedgerClose::transactions(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.ChainLedgerClose.transactions)
+  return transactions_.Get(index);
+}
+inline ::protocol::TransactionEnvStore* ChainLedgerClose::mutable_transactions(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.ChainLedgerClose.transactions)
+  return transactions_.Mutable(index);
+}
+inline ::protocol::TransactionEnvStore* ChainLedgerClose::add_transactions() {
+  // @@protoc_insertion_point(field_add:protocol.ChainLedgerClose.transactions)
+  return transactions_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >*
+ChainLedgerClose::mutable_transactions() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.ChainLedgerClose.transactions)
+  return &transactions_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protocol::TransactionEnvStore >&
+ChainLedgerClose::transactions() const {
+  // @@protoc_insertion_point(field_list:protocol.ChainLedgerClose.transactions)
+  return transactions_;
+}
+
+// -------------------------------------------------------------------
+
 // ChainResponse
 
 // optional int32 error_code = 1;
@@ -3513,6 +4330,14 @@ inline void ChainInfoMessage::set_allocated_address(::std::string* address) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -0,0 +1,70 @@
+/*
+	bumo is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	bumo is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with bumo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include <zlib.h>
+#include "compress.h"
+
+bool utils::ZlibCompress(const std::string &input, std::string &output) {
+	uLongf output_size = compressBound((uLong)input.size());
+	std::string temp;
+	temp.resize(output_size);
+
+	int ret = compress2((Bytef *)&temp[0], &output_size, (const Bytef *)input.data(), (uLong)input.size(), Z_BEST_SPEED);
+	if (ret != Z_OK) {
+		return false;
+	}
+
+	temp.resize(output_size);
+	output.swap(temp);
+	return true;
+}
+
+bool utils::ZlibUncompress(const std::string &input, std::string &output, size_t max_size) {
+	z_stream stream;
+	memset(&stream, 0, sizeof(stream));
+	if (inflateInit(&stream) != Z_OK) {
+		return false;
+	}
+
+	std::string temp;
+	char buffer[16 * 1024];
+	stream.next_in = (Bytef *)input.data();
+	stream.avail_in = (uInt)input.size();
+
+	int ret = Z_OK;
+	do {
+		stream.next_out = (Bytef *)buffer;
+		stream.avail_out = sizeof(buffer);
+		ret = inflate(&stream, Z_NO_FLUSH);
+		if (ret != Z_OK && ret != Z_STREAM_END) {
+			break;
+		}
+
+		temp.append(buffer, sizeof(buffer) - stream.avail_out);
+		if (temp.size() > max_size) {
+			ret = Z_BUF_ERROR;
+			break;
+		}
+	} while (ret != Z_STREAM_END);
+
+	inflateEnd(&stream);
+	if (ret != Z_STREAM_END) {
+		return false;
+	}
+
+	output.swap(temp);
+	return true;
+}
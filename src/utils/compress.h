@@ -0,0 +1,37 @@
+/*
+	bumo is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	bumo is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with bumo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef UTILS_COMPRESS_H_
+#define UTILS_COMPRESS_H_
+
+#include <string>
+
+namespace utils {
+	/*
+		Compresses the input with zlib deflate.
+		Returns true if successful and false otherwise.
+		The output string is only modified if successful.
+	*/
+	bool ZlibCompress(const std::string &input, std::string &output);
+
+	/*
+		Decompresses the zlib input, refusing to produce more than max_size bytes.
+		Returns true if successful and false otherwise.
+		The output string is only modified if successful.
+	*/
+	bool ZlibUncompress(const std::string &input, std::string &output, size_t max_size);
+}
+
+#endif
@@ -220,43 +220,16 @@ namespace utils {
 		SHA256_Final(buf, &sha256);
 	}
 
-	std::string Base58::Encode(const std::string &str_in) {
-		std::string strOut;
-		int zeros = 0;
-		//while (begin != end && *begin == 0)
-		//{
-		//	begin++;
-		//	zeros++;
-		//}
-		std::size_t first_no_zero = 0;
-		for (std::size_t i = 0; i < str_in.size() && str_in.at(i) == 0; i++) {
-			first_no_zero = i;
-			zeros++;
-		}
-
-		std::vector< unsigned char > b58((str_in.size()) * 138 / 100 + 1);
-		for (std::size_t i = first_no_zero; i < str_in.size(); i++) {
-			int carry = (unsigned int)(str_in.at(i) & 0xFF);
-			for (std::vector< unsigned char >::reverse_iterator it = b58.rbegin(); it != b58.rend(); it++) {
-				carry += 256 * (*it);
-				*it = carry % 58;
-				carry /= 58;
-			}
-		}
-
-		std::vector< unsigned char >::iterator it = b58.begin();
-		while (it != b58.end() && *it == 0)
-			it++;
-		strOut = "";
-		strOut.reserve(zeros + (b58.end() - it));
-		strOut.assign(zeros, '1');
-		while (it != b58.end()) {
-			strOut += kBase58Dictionary[*(it++)];
-		}
-		return strOut;
-	}
-
-	int Base58::Decode(const std::string &strIn, std::string &strout) {
+	//Base58 works on 32-bit limbs instead of single digits and bytes: encoding packs the number
+	//in limbs of 58^5 and feeds four input bytes per pass, decoding packs it in limbs of 2^32
+	//and feeds five digits per pass. 58^5 < 2^30, so every limb product fits in 64 bits.
+	//Addresses and keys fit in the stack buffer, longer inputs fall back to the heap.
+	static const uint32_t kBase58LimbBase = 656356768; //58^5
+	static const size_t kBase58StackLimbs = 32;
+
+	//The byte-at-a-time decoder, kept for strings with characters outside the dictionary
+	//so that their (meaningless) output does not change
+	static int DecodeBytewise(const std::string &strIn, std::string &strout) {
 		std::size_t nZeros = 0;
 		for (; nZeros < strIn.size() && strIn.at(nZeros) == kBase58Dictionary[0]; nZeros++);
 		std::size_t left_size = strIn.size() - nZeros;
@@ -278,7 +251,136 @@ namespace utils {
 		for (; k < tmp_str.size() && tmp_str[k] == 0; k++);
 		for (; k < tmp_str.size(); k++)
 			strout.push_back(tmp_str[k]);
-		return nZeros + tmp_str.size() - k;
+		return (int)strout.size();
+	}
+
+	std::string Base58::Encode(const std::string &str_in) {
+		const unsigned char *in = (const unsigned char *)str_in.data();
+		std::size_t size = str_in.size();
+		std::size_t zeros = 0;
+		for (; zeros < size && in[zeros] == 0; zeros++);
+
+		//Limbs are least significant first, about 1.38 digits per byte and 5 digits per limb
+		std::size_t capacity = (size - zeros) * 138 / 100 / 5 + 2;
+		uint32_t stack_limbs[kBase58StackLimbs];
+		std::vector<uint32_t> heap_limbs;
+		uint32_t *limbs = stack_limbs;
+		if (capacity > kBase58StackLimbs) {
+			heap_limbs.resize(capacity);
+			limbs = heap_limbs.data();
+		}
+		std::size_t used = 0;
+
+		std::size_t i = zeros;
+		std::size_t head = (size - zeros) % 4;
+		while (i < size) {
+			std::size_t n = (i == zeros && head != 0) ? head : 4;
+			uint64_t carry = 0;
+			for (std::size_t k = 0; k < n; k++) {
+				carry = (carry << 8) | in[i + k];
+			}
+			i += n;
+
+			uint32_t shift = (uint32_t)(8 * n);
+			for (std::size_t j = 0; j < used; j++) {
+				uint64_t tmp = ((uint64_t)limbs[j] << shift) + carry;
+				limbs[j] = (uint32_t)(tmp % kBase58LimbBase);
+				carry = tmp / kBase58LimbBase;
+			}
+			while (carry > 0) {
+				limbs[used++] = (uint32_t)(carry % kBase58LimbBase);
+				carry /= kBase58LimbBase;
+			}
+		}
+
+		std::string strOut;
+		strOut.reserve(zeros + used * 5);
+		strOut.assign(zeros, '1');
+		if (used > 0) {
+			//The top limb is never zero, print it without its leading zero digits
+			char digits[5];
+			int count = 0;
+			for (uint32_t top = limbs[used - 1]; top > 0; top /= 58) {
+				digits[count++] = kBase58Dictionary[top % 58];
+			}
+			while (count > 0) {
+				strOut.push_back(digits[--count]);
+			}
+			for (std::size_t j = used - 1; j-- > 0;) {
+				uint32_t limb = limbs[j];
+				for (int k = 4; k >= 0; k--) {
+					digits[k] = kBase58Dictionary[limb % 58];
+					limb /= 58;
+				}
+				strOut.append(digits, 5);
+			}
+		}
+		return strOut;
+	}
+
+	int Base58::Decode(const std::string &strIn, std::string &strout) {
+		const unsigned char *in = (const unsigned char *)strIn.data();
+		std::size_t size = strIn.size();
+		std::size_t nZeros = 0;
+		for (; nZeros < size && in[nZeros] == kBase58Dictionary[0]; nZeros++);
+		for (std::size_t i = nZeros; i < size; i++) {
+			if (in[i] & 0x80 || kBase58digits[in[i]] < 0) {
+				return DecodeBytewise(strIn, strout);
+			}
+		}
+
+		//Limbs are least significant first, about 0.733 bytes per digit and 4 bytes per limb
+		std::size_t capacity = (size - nZeros) * 733 / 1000 / 4 + 2;
+		uint32_t stack_limbs[kBase58StackLimbs];
+		std::vector<uint32_t> heap_limbs;
+		uint32_t *limbs = stack_limbs;
+		if (capacity > kBase58StackLimbs) {
+			heap_limbs.resize(capacity);
+			limbs = heap_limbs.data();
+		}
+		std::size_t used = 0;
+
+		std::size_t i = nZeros;
+		std::size_t head = (size - nZeros) % 5;
+		while (i < size) {
+			std::size_t n = (i == nZeros && head != 0) ? head : 5;
+			uint64_t carry = 0;
+			uint64_t multiplier = 1;
+			for (std::size_t k = 0; k < n; k++) {
+				carry = carry * 58 + kBase58digits[in[i + k]];
+				multiplier *= 58;
+			}
+			i += n;
+
+			for (std::size_t j = 0; j < used; j++) {
+				uint64_t tmp = (uint64_t)limbs[j] * multiplier + carry;
+				limbs[j] = (uint32_t)tmp;
+				carry = tmp >> 32;
+			}
+			while (carry > 0) {
+				limbs[used++] = (uint32_t)carry;
+				carry >>= 32;
+			}
+		}
+
+		strout.assign(nZeros, (char)0);
+		if (used > 0) {
+			//Skip the leading zero bytes of the top limb
+			uint32_t top = limbs[used - 1];
+			int shift = 24;
+			for (; (top >> shift) == 0; shift -= 8);
+			for (; shift >= 0; shift -= 8) {
+				strout.push_back((char)(top >> shift));
+			}
+			for (std::size_t j = used - 1; j-- > 0;) {
+				uint32_t limb = limbs[j];
+				strout.push_back((char)(limb >> 24));
+				strout.push_back((char)(limb >> 16));
+				strout.push_back((char)(limb >> 8));
+				strout.push_back((char)limb);
+			}
+		}
+		return (int)strout.size();
 	}
 
 	int Base58::Decode_old(const std::string &strIn, std::string &strOut) {
@@ -543,25 +543,54 @@ namespace utils {
 
 	int EccSm2::verify(EC_GROUP* group, const std::string& pkey, 
 		const std::string& id, const std::string& msg, const std::string& strsig) {
-		std::string px = "";
-		std::string py = "";
+		VerifyKey key(group, pkey, id);
+		return key.Verify(msg, strsig);
+	}
+
+	EccSm2::VerifyKey::VerifyKey(EC_GROUP* group, const std::string& pkey, const std::string& id) {
+		group_ = group;
 		int len = (pkey.size() - 1) / 2;
-		px = pkey.substr(1, len);
-		py = pkey.substr(1 + len, len);
+		std::string px = pkey.substr(1, len);
+		std::string py = pkey.substr(1 + len, len);
+
+		BN_CTX *ctx = BN_CTX_new();
+		BN_CTX_start(ctx);
+		BIGNUM* xp = BN_CTX_get(ctx);
+		BIGNUM* yp = BN_CTX_get(ctx);
+		BN_bin2bn((const unsigned char*)px.c_str(), px.size(), xp);
+		BN_bin2bn((const unsigned char*)py.c_str(), py.size(), yp);
+
+		pub_key_ = EC_POINT_new(group);
+		if (EC_METHOD_get_field_type(EC_GROUP_method_of(group)) == NID_X9_62_prime_field) {
+			EC_POINT_set_affine_coordinates_GFp(group, pub_key_, xp, yp, NULL);
+		}
+		else {
+			EC_POINT_set_affine_coordinates_GF2m(group, pub_key_, xp, yp, NULL);
+		}
+		BN_CTX_end(ctx);
+		BN_CTX_free(ctx);
+
+		//Step 3, the ZA part of _M = ZA||M'
+		za_ = getZA(group, id, pub_key_);
+	}
+
+	EccSm2::VerifyKey::~VerifyKey() {
+		free_ec_point(pub_key_);
+	}
 
+	int EccSm2::VerifyKey::Verify(const std::string& msg, const std::string& strsig) const {
+		EC_GROUP* group = group_;
 		std::string sigr = strsig.substr(0, strsig.size() / 2);
 		std::string sigs = strsig.substr(strsig.size() / 2, strsig.size() / 2);
 
 		int ret = -1;
-		EC_POINT *pub_key = NULL;
 		EC_POINT *point = NULL;
 		BN_CTX *ctx = NULL;
 
 		ECDSA_SIG* sig = NULL;
 
-		std::string M, ZA, stre;
+		std::string M, stre;
 
-		pub_key = EC_POINT_new(group);
 		point = EC_POINT_new(group);
 		unsigned char dgst[32];
 		int dgstlen;
@@ -569,8 +598,6 @@ namespace utils {
 		ctx = BN_CTX_new();
 		BN_CTX_start(ctx);
 
-		BIGNUM* xp = BN_CTX_get(ctx);
-		BIGNUM* yp = BN_CTX_get(ctx);
 		BIGNUM*x1 = BN_CTX_get(ctx);
 		BIGNUM*R = BN_CTX_get(ctx);
 		BIGNUM *order = BN_CTX_get(ctx);
@@ -578,21 +605,11 @@ namespace utils {
 		BIGNUM *t = BN_CTX_get(ctx);
 
 		EC_GROUP_get_order(group, order, ctx);
-		BN_bin2bn((const unsigned char*)px.c_str(), px.size(), xp);
-		BN_bin2bn((const unsigned char*)py.c_str(), py.size(), yp);
-		if (EC_METHOD_get_field_type(EC_GROUP_method_of(group)) == NID_X9_62_prime_field) {
-			EC_POINT_set_affine_coordinates_GFp(group, pub_key, xp, yp, NULL);
-		}
-		else {
-			EC_POINT_set_affine_coordinates_GF2m(group, pub_key, xp, yp, NULL);
-		}
 
 		sig = ECDSA_SIG_new();
 		BN_bin2bn((const unsigned char*)sigr.c_str(), sigr.size(), sig->r);
 		BN_bin2bn((const unsigned char*)sigs.c_str(), sigs.size(), sig->s);
 
-		e = BN_CTX_get(ctx);
-		t = BN_CTX_get(ctx);
 		if (!ctx || !order || !e || !t) {
 			goto end;
 		}
@@ -617,9 +634,8 @@ namespace utils {
 			goto end;
 		}
 
-		//Step 3  Calculate _M = ZA||M'
-		ZA = getZA(group, id, pub_key);
-		M = ZA + msg;
+		//Step 3  Calculate _M = ZA||M', ZA was prepared with the key
+		M = za_ + msg;
 
 		//Step 4  calculate e' = Hv(_M)
 		stre = utils::Sm3::Crypto(M);
@@ -632,7 +648,7 @@ namespace utils {
 
 		//Step 6 calculate point (x',y')=sG + tP  P is public key point
 
-		if (!EC_POINT_mul(group, point, sig->s, pub_key, t, ctx)) {
+		if (!EC_POINT_mul(group, point, sig->s, pub_key_, t, ctx)) {
 			goto end;
 		}
 		if (EC_METHOD_get_field_type(EC_GROUP_method_of(group)) == NID_X9_62_prime_field) {
@@ -661,22 +677,15 @@ namespace utils {
 			ret = 1;
 		}
 		else {
-			//printf("%s:%s\n", BN_bn2hex(R), BN_bn2hex(sig->r));
-			//printf("ZA=%s\n", utils::String::BinToHexString(ZA).c_str());
-			//printf("e=%s\n", utils::String::BinToHexString(stre).c_str());
 			ret = 0;
 		}
 
 	end:
 		free_ec_point(point);
-		free_ec_point(pub_key);
 
 		BN_CTX_end(ctx);
 		BN_CTX_free(ctx);
 		ECDSA_SIG_free(sig);
-		if (ret != 1) {
-			int x = 2;
-		}
 
 		return ret;
 	}
@@ -71,6 +71,25 @@ namespace utils{
 		static int verify(EC_GROUP* group, const std::string& pkey,
 			const std::string& id, const std::string& msg, const std::string& sig);
 
+		//The public key point and the ZA digest of verify only depend on the key and the user ID.
+		//A VerifyKey computes them once; Verify is const and can be called from several threads.
+		class VerifyKey {
+		public:
+			VerifyKey(EC_GROUP* group, const std::string& pkey, const std::string& id);
+			~VerifyKey();
+
+			//Same results as verify: 1 valid, 0 invalid, -1 error
+			int Verify(const std::string& msg, const std::string& sig) const;
+
+		private:
+			VerifyKey(const VerifyKey&);
+			VerifyKey& operator=(const VerifyKey&);
+
+			EC_GROUP* group_;
+			EC_POINT* pub_key_;
+			std::string za_;
+		};
+
 		//group Elliptic curve
 		//id  Identity
 		//pkey  Public key
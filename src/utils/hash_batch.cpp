@@ -0,0 +1,363 @@
+/*
+	bumo is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	bumo is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with bumo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <algorithm>
+#include "hash_batch.h"
+#include "sm3.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define HASH_BATCH_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define HASH_BATCH_AVX2
+#else
+#include <cpuid.h>
+#define HASH_BATCH_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace utils {
+
+	static const size_t kLanes = 8;
+	static const size_t kBlockSize = 64;
+	//A group with fewer messages than this is hashed by the scalar code
+	static const size_t kMinGroupSize = 2;
+
+	static const uint32_t kSm3Init[8] = {
+		0x7380166F, 0x4914B2B9, 0x172442D7, 0xDA8A0600, 0xA96F30BC, 0x163138AA, 0xE38DEE4D, 0xB0FB0E4E
+	};
+
+	static const uint32_t kSha256Init[8] = {
+		0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+	};
+
+	static const uint32_t kSha256K[64] = {
+		0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+		0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+		0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+		0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+		0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+		0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+		0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+		0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+	};
+
+	//The state of a group, word-major so that one row is one vector: state[word][lane]
+	typedef uint32_t LaneState[8][kLanes];
+	typedef void(*CompressX8)(LaneState &state, const unsigned char *blocks[kLanes]);
+
+	//A message seen as its whole blocks followed by a padded tail of one or two blocks.
+	//SM3 and SHA-256 share the padding: 0x80, zeros, then the bit length as 64-bit big endian.
+	struct BatchMessage {
+		size_t index_;
+		const unsigned char *data_;
+		size_t full_blocks_;
+		size_t blocks_;
+		unsigned char tail_[2 * kBlockSize];
+
+		void Init(size_t index, const std::string &input) {
+			index_ = index;
+			data_ = (const unsigned char *)input.data();
+			full_blocks_ = input.size() / kBlockSize;
+
+			size_t rest = input.size() % kBlockSize;
+			size_t tail_blocks = (rest + 9 <= kBlockSize) ? 1 : 2;
+			blocks_ = full_blocks_ + tail_blocks;
+
+			memcpy(tail_, data_ + full_blocks_ * kBlockSize, rest);
+			tail_[rest] = 0x80;
+			size_t end = tail_blocks * kBlockSize;
+			memset(tail_ + rest + 1, 0, end - 8 - rest - 1);
+			uint64_t bits = (uint64_t)input.size() * 8;
+			for (size_t i = 0; i < 8; i++) {
+				tail_[end - 1 - i] = (unsigned char)(bits >> (8 * i));
+			}
+		}
+
+		const unsigned char *Block(size_t i) const {
+			return i < full_blocks_ ? data_ + i * kBlockSize : tail_ + (i - full_blocks_) * kBlockSize;
+		}
+	};
+
+	static inline uint32_t Rotl32(uint32_t x, int n) {
+		return n == 0 ? x : ((x << n) | (x >> (32 - n)));
+	}
+
+	static void StoreDigest(const LaneState &state, size_t lane, std::string &output) {
+		output.resize(32);
+		for (size_t i = 0; i < 8; i++) {
+			uint32_t word = state[i][lane];
+			output[4 * i] = (char)(word >> 24);
+			output[4 * i + 1] = (char)(word >> 16);
+			output[4 * i + 2] = (char)(word >> 8);
+			output[4 * i + 3] = (char)word;
+		}
+	}
+
+	static void ScalarCrypto(HashBatch::Algorithm algorithm, const std::string &input, std::string &output) {
+		if (algorithm == HashBatch::ALGORITHM_SM3) {
+			Sm3::Crypto(input, output);
+		}
+		else {
+			Sha256::Crypto(input, output);
+		}
+	}
+
+#if defined(HASH_BATCH_X86)
+	struct CpuFeatures {
+		bool avx2_;
+		bool sha_;
+
+		CpuFeatures() : avx2_(false), sha_(false) {
+			uint32_t regs[4] = { 0, 0, 0, 0 };
+			Cpuid(0, regs);
+			if (regs[0] < 7) {
+				return;
+			}
+			Cpuid(1, regs);
+			bool osxsave = ((regs[2] >> 27) & 1) != 0;
+			bool avx = ((regs[2] >> 28) & 1) != 0;
+			//The OS must save the YMM registers as well
+			bool ymm = osxsave && avx && (XGetBv() & 6) == 6;
+			Cpuid(7, regs);
+			avx2_ = ymm && ((regs[1] >> 5) & 1) != 0;
+			sha_ = ((regs[1] >> 29) & 1) != 0;
+		}
+
+		static void Cpuid(uint32_t leaf, uint32_t regs[4]) {
+#if defined(_MSC_VER)
+			__cpuidex((int *)regs, (int)leaf, 0);
+#else
+			__cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+		}
+
+		static uint64_t XGetBv() {
+#if defined(_MSC_VER)
+			return _xgetbv(0);
+#else
+			uint32_t eax = 0, edx = 0;
+			__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+			return ((uint64_t)edx << 32) | eax;
+#endif
+		}
+	};
+
+	static const CpuFeatures &GetCpuFeatures() {
+		static CpuFeatures features;
+		return features;
+	}
+
+#define ROTL32X8(x, n) _mm256_or_si256(_mm256_slli_epi32((x), (n)), _mm256_srli_epi32((x), 32 - (n)))
+#define ROTR32X8(x, n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+#define XOR3X8(x, y, z) _mm256_xor_si256(_mm256_xor_si256((x), (y)), (z))
+#define ADD3X8(x, y, z) _mm256_add_epi32(_mm256_add_epi32((x), (y)), (z))
+
+	static inline uint32_t LoadBigEndian(const unsigned char *p) {
+		return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+	}
+
+	HASH_BATCH_AVX2 static __m256i LoadWords(const unsigned char *blocks[kLanes], size_t offset) {
+		return _mm256_set_epi32(
+			(int)LoadBigEndian(blocks[7] + offset), (int)LoadBigEndian(blocks[6] + offset),
+			(int)LoadBigEndian(blocks[5] + offset), (int)LoadBigEndian(blocks[4] + offset),
+			(int)LoadBigEndian(blocks[3] + offset), (int)LoadBigEndian(blocks[2] + offset),
+			(int)LoadBigEndian(blocks[1] + offset), (int)LoadBigEndian(blocks[0] + offset));
+	}
+
+	HASH_BATCH_AVX2 static void Sm3CompressX8(LaneState &state, const unsigned char *blocks[kLanes]) {
+		__m256i w[68];
+		for (int j = 0; j < 16; j++) {
+			w[j] = LoadWords(blocks, 4 * j);
+		}
+		for (int j = 16; j < 68; j++) {
+			__m256i x = XOR3X8(w[j - 16], w[j - 9], ROTL32X8(w[j - 3], 15));
+			x = XOR3X8(x, ROTL32X8(x, 15), ROTL32X8(x, 23));
+			w[j] = XOR3X8(x, ROTL32X8(w[j - 13], 7), w[j - 6]);
+		}
+
+		__m256i a = _mm256_loadu_si256((const __m256i *)state[0]);
+		__m256i b = _mm256_loadu_si256((const __m256i *)state[1]);
+		__m256i c = _mm256_loadu_si256((const __m256i *)state[2]);
+		__m256i d = _mm256_loadu_si256((const __m256i *)state[3]);
+		__m256i e = _mm256_loadu_si256((const __m256i *)state[4]);
+		__m256i f = _mm256_loadu_si256((const __m256i *)state[5]);
+		__m256i g = _mm256_loadu_si256((const __m256i *)state[6]);
+		__m256i h = _mm256_loadu_si256((const __m256i *)state[7]);
+
+		for (int j = 0; j < 64; j++) {
+			uint32_t t = Rotl32(j < 16 ? 0x79CC4519 : 0x7A879D8A, j % 32);
+			__m256i a12 = ROTL32X8(a, 12);
+			__m256i ss1 = ROTL32X8(ADD3X8(a12, e, _mm256_set1_epi32((int)t)), 7);
+			__m256i ss2 = _mm256_xor_si256(ss1, a12);
+			__m256i ff, gg;
+			if (j < 16) {
+				ff = XOR3X8(a, b, c);
+				gg = XOR3X8(e, f, g);
+			}
+			else {
+				ff = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+				gg = _mm256_or_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+			}
+			__m256i tt1 = _mm256_add_epi32(ADD3X8(ff, d, ss2), _mm256_xor_si256(w[j], w[j + 4]));
+			__m256i tt2 = _mm256_add_epi32(ADD3X8(gg, h, ss1), w[j]);
+			d = c;
+			c = ROTL32X8(b, 9);
+			b = a;
+			a = tt1;
+			h = g;
+			g = ROTL32X8(f, 19);
+			f = e;
+			e = XOR3X8(tt2, ROTL32X8(tt2, 9), ROTL32X8(tt2, 17));
+		}
+
+		__m256i *rows = (__m256i *)state;
+		_mm256_storeu_si256(rows + 0, _mm256_xor_si256(_mm256_loadu_si256(rows + 0), a));
+		_mm256_storeu_si256(rows + 1, _mm256_xor_si256(_mm256_loadu_si256(rows + 1), b));
+		_mm256_storeu_si256(rows + 2, _mm256_xor_si256(_mm256_loadu_si256(rows + 2), c));
+		_mm256_storeu_si256(rows + 3, _mm256_xor_si256(_mm256_loadu_si256(rows + 3), d));
+		_mm256_storeu_si256(rows + 4, _mm256_xor_si256(_mm256_loadu_si256(rows + 4), e));
+		_mm256_storeu_si256(rows + 5, _mm256_xor_si256(_mm256_loadu_si256(rows + 5), f));
+		_mm256_storeu_si256(rows + 6, _mm256_xor_si256(_mm256_loadu_si256(rows + 6), g));
+		_mm256_storeu_si256(rows + 7, _mm256_xor_si256(_mm256_loadu_si256(rows + 7), h));
+	}
+
+	HASH_BATCH_AVX2 static void Sha256CompressX8(LaneState &state, const unsigned char *blocks[kLanes]) {
+		__m256i w[64];
+		for (int j = 0; j < 16; j++) {
+			w[j] = LoadWords(blocks, 4 * j);
+		}
+		for (int j = 16; j < 64; j++) {
+			__m256i s0 = XOR3X8(ROTR32X8(w[j - 15], 7), ROTR32X8(w[j - 15], 18), _mm256_srli_epi32(w[j - 15], 3));
+			__m256i s1 = XOR3X8(ROTR32X8(w[j - 2], 17), ROTR32X8(w[j - 2], 19), _mm256_srli_epi32(w[j - 2], 10));
+			w[j] = _mm256_add_epi32(ADD3X8(w[j - 16], s0, w[j - 7]), s1);
+		}
+
+		__m256i a = _mm256_loadu_si256((const __m256i *)state[0]);
+		__m256i b = _mm256_loadu_si256((const __m256i *)state[1]);
+		__m256i c = _mm256_loadu_si256((const __m256i *)state[2]);
+		__m256i d = _mm256_loadu_si256((const __m256i *)state[3]);
+		__m256i e = _mm256_loadu_si256((const __m256i *)state[4]);
+		__m256i f = _mm256_loadu_si256((const __m256i *)state[5]);
+		__m256i g = _mm256_loadu_si256((const __m256i *)state[6]);
+		__m256i h = _mm256_loadu_si256((const __m256i *)state[7]);
+
+		for (int j = 0; j < 64; j++) {
+			__m256i s1 = XOR3X8(ROTR32X8(e, 6), ROTR32X8(e, 11), ROTR32X8(e, 25));
+			__m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+			__m256i t1 = _mm256_add_epi32(ADD3X8(h, s1, ch), _mm256_add_epi32(_mm256_set1_epi32((int)kSha256K[j]), w[j]));
+			__m256i s0 = XOR3X8(ROTR32X8(a, 2), ROTR32X8(a, 13), ROTR32X8(a, 22));
+			__m256i maj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+			h = g;
+			g = f;
+			f = e;
+			e = _mm256_add_epi32(d, t1);
+			d = c;
+			c = b;
+			b = a;
+			a = ADD3X8(t1, s0, maj);
+		}
+
+		__m256i *rows = (__m256i *)state;
+		_mm256_storeu_si256(rows + 0, _mm256_add_epi32(_mm256_loadu_si256(rows + 0), a));
+		_mm256_storeu_si256(rows + 1, _mm256_add_epi32(_mm256_loadu_si256(rows + 1), b));
+		_mm256_storeu_si256(rows + 2, _mm256_add_epi32(_mm256_loadu_si256(rows + 2), c));
+		_mm256_storeu_si256(rows + 3, _mm256_add_epi32(_mm256_loadu_si256(rows + 3), d));
+		_mm256_storeu_si256(rows + 4, _mm256_add_epi32(_mm256_loadu_si256(rows + 4), e));
+		_mm256_storeu_si256(rows + 5, _mm256_add_epi32(_mm256_loadu_si256(rows + 5), f));
+		_mm256_storeu_si256(rows + 6, _mm256_add_epi32(_mm256_loadu_si256(rows + 6), g));
+		_mm256_storeu_si256(rows + 7, _mm256_add_epi32(_mm256_loadu_si256(rows + 7), h));
+	}
+#endif
+
+	static CompressX8 GetCompress(HashBatch::Algorithm algorithm) {
+#if defined(HASH_BATCH_X86)
+		const CpuFeatures &features = GetCpuFeatures();
+		if (!features.avx2_) {
+			return NULL;
+		}
+		if (algorithm == HashBatch::ALGORITHM_SM3) {
+			return Sm3CompressX8;
+		}
+		//OpenSSL hashes a single stream with the SHA extensions faster than eight lanes do
+		return features.sha_ ? NULL : Sha256CompressX8;
+#else
+		return NULL;
+#endif
+	}
+
+	bool HashBatch::MultiBuffer(Algorithm algorithm) {
+		return GetCompress(algorithm) != NULL;
+	}
+
+	void HashBatch::Crypto(Algorithm algorithm, const std::vector<const std::string *> &inputs, std::vector<std::string> &outputs) {
+		outputs.resize(inputs.size());
+		CompressX8 compress = GetCompress(algorithm);
+		if (compress == NULL || inputs.size() < kMinGroupSize) {
+			for (size_t i = 0; i < inputs.size(); i++) {
+				ScalarCrypto(algorithm, *inputs[i], outputs[i]);
+			}
+			return;
+		}
+
+		std::vector<BatchMessage> messages(inputs.size());
+		std::vector<const BatchMessage *> order(inputs.size());
+		for (size_t i = 0; i < inputs.size(); i++) {
+			messages[i].Init(i, *inputs[i]);
+			order[i] = &messages[i];
+		}
+		//Longest first, so the lanes of a group run for about the same number of blocks
+		std::stable_sort(order.begin(), order.end(), [](const BatchMessage *a, const BatchMessage *b) {
+			return a->blocks_ > b->blocks_;
+		});
+
+		const uint32_t *init = (algorithm == HashBatch::ALGORITHM_SM3) ? kSm3Init : kSha256Init;
+		for (size_t begin = 0; begin < order.size(); begin += kLanes) {
+			size_t count = std::min(kLanes, order.size() - begin);
+			if (count < kMinGroupSize) {
+				for (size_t l = 0; l < count; l++) {
+					ScalarCrypto(algorithm, *inputs[order[begin + l]->index_], outputs[order[begin + l]->index_]);
+				}
+				continue;
+			}
+
+			LaneState state;
+			for (size_t i = 0; i < 8; i++) {
+				for (size_t l = 0; l < kLanes; l++) {
+					state[i][l] = init[i];
+				}
+			}
+
+			//The first message is the longest, its blocks fill the lanes that are done or unused
+			const BatchMessage *longest = order[begin];
+			const unsigned char *blocks[kLanes];
+			for (size_t b = 0; b < longest->blocks_; b++) {
+				for (size_t l = 0; l < kLanes; l++) {
+					const BatchMessage *message = (l < count) ? order[begin + l] : longest;
+					blocks[l] = (b < message->blocks_) ? message->Block(b) : longest->Block(b);
+				}
+				compress(state, blocks);
+				for (size_t l = 0; l < count; l++) {
+					const BatchMessage *message = order[begin + l];
+					if (b + 1 == message->blocks_) {
+						StoreDigest(state, l, outputs[message->index_]);
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,44 @@
+/*
+	bumo is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	bumo is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with bumo.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef HASH_BATCH_H
+#define HASH_BATCH_H
+
+#include <vector>
+#include <string>
+
+namespace utils {
+
+	//Hashes many independent messages in one call. On CPUs with AVX2 the compression function runs
+	//on eight messages side by side, one per 32-bit lane; messages are grouped by block count so that
+	//the lanes of a group finish together. SHA-256 stays on OpenSSL when the CPU has the SHA extensions,
+	//which hash a single stream faster than the lanes do. Every other case falls back to the scalar code.
+	class HashBatch {
+	public:
+		enum Algorithm {
+			ALGORITHM_SHA256 = 0,
+			ALGORITHM_SM3 = 1
+		};
+
+		//outputs[i] is the 32-byte digest of *inputs[i]
+		static void Crypto(Algorithm algorithm, const std::vector<const std::string *> &inputs, std::vector<std::string> &outputs);
+
+		//Whether the eight-lane kernel is used for the algorithm on this CPU
+		static bool MultiBuffer(Algorithm algorithm);
+	};
+}
+
+#endif
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "utils/crypto.h"
+#include "utils/strings.h"
+#include "utils/timestamp.h"
+
+class base58_utest : public testing::Test{
+protected:
+
+	// Sets up the test fixture.
+	virtual void SetUp(){
+	}
+
+	// Tears down the test fixture.
+	virtual void TearDown(){
+	}
+
+protected:
+	void UT_Address_Vectors();
+	void UT_Leading_Zeros();
+	void UT_Round_Trip();
+	void UT_Benchmark(uint32_t rounds);
+};
+
+TEST_F(base58_utest, UT_Address_Vectors){ UT_Address_Vectors(); }
+void base58_utest::UT_Address_Vectors(){
+	const char *vectors[][2] = {
+		{ "buQBEoVrVjdHmUc97EA7nChJhAMD3UoXW5uk", "0156013cf43a1bd7b4dc962fbc8a4b515596aaaf8401e38de9fe01" },
+		{ "buQjSCRX5rwBzKmhyry4qAFnLDubY3R5y83V", "01560196dcf22573af13f88d3aa1e963dea9315bde76a81f5e628c" },
+		{ "buQdE6YSqWu61JdUh6zkcPW1aPHYQX3X4Scj", "01560152c24a70de2fdc2ba97d07db5c3d0ce66296533298e73e34" }
+	};
+	for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++){
+		std::string raw = utils::String::HexStringToBin(vectors[i][1]);
+		EXPECT_EQ(utils::Base58::Encode(raw), vectors[i][0]);
+		EXPECT_EQ(utils::Base58::Decode(vectors[i][0]), raw);
+	}
+	EXPECT_EQ(utils::Base58::Encode("hello world"), "StV1DL6CwTryKyV");
+}
+
+TEST_F(base58_utest, UT_Leading_Zeros){ UT_Leading_Zeros(); }
+void base58_utest::UT_Leading_Zeros(){
+	EXPECT_EQ(utils::Base58::Encode(""), "");
+	EXPECT_EQ(utils::Base58::Encode(std::string(3, '\0')), "111");
+	EXPECT_EQ(utils::Base58::Encode(std::string("\0\0\x01\xff", 4)), "119p");
+	EXPECT_EQ(utils::Base58::Decode("119p"), std::string("\0\0\x01\xff", 4));
+	EXPECT_EQ(utils::Base58::Decode("111"), std::string(3, '\0'));
+}
+
+TEST_F(base58_utest, UT_Round_Trip){ UT_Round_Trip(); }
+void base58_utest::UT_Round_Trip(){
+	std::mt19937 rng(58);
+	for (uint32_t i = 0; i < 10000; i++){
+		//Cover the stack limbs and the heap fallback
+		std::string raw(rng() % 200, '\0');
+		for (size_t j = rng() % 4; j < raw.size(); j++){
+			raw[j] = (char)rng();
+		}
+		std::string encoded = utils::Base58::Encode(raw);
+		std::string decoded;
+		EXPECT_EQ(utils::Base58::Decode(encoded, decoded), (int)raw.size());
+		EXPECT_EQ(decoded, raw);
+	}
+}
+
+void base58_utest::UT_Benchmark(uint32_t rounds){
+	std::string raw = utils::String::HexStringToBin("0156013cf43a1bd7b4dc962fbc8a4b515596aaaf8401e38de9fe01");
+	std::string encoded = utils::Base58::Encode(raw);
+	std::string decoded;
+
+	int64_t begin = utils::Timestamp::HighResolution();
+	for (uint32_t i = 0; i < rounds; i++){
+		encoded = utils::Base58::Encode(raw);
+	}
+	int64_t encoded_time = utils::Timestamp::HighResolution();
+	for (uint32_t i = 0; i < rounds; i++){
+		utils::Base58::Decode(encoded, decoded);
+	}
+	int64_t decoded_time = utils::Timestamp::HighResolution();
+
+	EXPECT_EQ(decoded, raw);
+	printf("address rounds(%u): encode " FMT_I64 "us, decode " FMT_I64 "us\n",
+		rounds, encoded_time - begin, decoded_time - encoded_time);
+}
+
+//Benchmarks, run them with --gtest_also_run_disabled_tests
+TEST_F(base58_utest, DISABLED_UT_Benchmark_1M){ UT_Benchmark(1000000); }
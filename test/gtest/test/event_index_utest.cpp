@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include "api/event_index.h"
+
+class event_index_utest : public testing::Test{
+protected:
+
+	// Sets up the test fixture.
+	virtual void SetUp(){
+	}
+
+	// Tears down the test fixture.
+	virtual void TearDown(){
+	}
+
+protected:
+	static protocol::TransactionEnvStore NewTx(const std::string &source, const std::string &dest, const std::string &topic);
+	void UT_Match_Transaction();
+	void UT_Remove_Subscription();
+};
+
+protocol::TransactionEnvStore event_index_utest::NewTx(const std::string &source, const std::string &dest, const std::string &topic){
+	protocol::TransactionEnvStore tx_store;
+	protocol::Transaction *tran = tx_store.mutable_transaction_env()->mutable_transaction();
+	tran->set_source_address(source);
+	protocol::Operation *ope = tran->add_operations();
+	if (topic.empty()){
+		ope->set_type(protocol::Operation_Type_PAY_COIN);
+		ope->mutable_pay_coin()->set_dest_address(dest);
+	}
+	else{
+		ope->set_type(protocol::Operation_Type_LOG);
+		ope->mutable_log()->set_topic(topic);
+	}
+	return tx_store;
+}
+
+TEST_F(event_index_utest, UT_Match_Transaction){ UT_Match_Transaction(); }
+void event_index_utest::UT_Match_Transaction(){
+	bumo::EventIndex index;
+
+	//1 receives everything, 2 account a, 3 contract c, 4 topic t and the ledger close
+	bumo::EventIndex::Filter filter;
+	filter.all_txs_ = true;
+	index.Set(1, filter);
+	filter = bumo::EventIndex::Filter();
+	filter.accounts_.insert("a");
+	index.Set(2, filter);
+	filter = bumo::EventIndex::Filter();
+	filter.contracts_.insert("c");
+	index.Set(3, filter);
+	filter = bumo::EventIndex::Filter();
+	filter.topics_.insert("t");
+	filter.ledger_close_ = true;
+	index.Set(4, filter);
+
+	std::set<int64_t> conn_ids;
+	index.MatchTransaction(NewTx("a", "b", ""), conn_ids);
+	EXPECT_EQ(conn_ids, std::set<int64_t>({ 1, 2 }));
+
+	//Calling the contract
+	conn_ids.clear();
+	index.MatchTransaction(NewTx("b", "c", ""), conn_ids);
+	EXPECT_EQ(conn_ids, std::set<int64_t>({ 1, 3 }));
+
+	//The log emitted by the contract
+	conn_ids.clear();
+	index.MatchTransaction(NewTx("c", "", "t"), conn_ids);
+	EXPECT_EQ(conn_ids, std::set<int64_t>({ 1, 3, 4 }));
+
+	conn_ids.clear();
+	index.MatchAccount("a", conn_ids);
+	EXPECT_EQ(conn_ids, std::set<int64_t>({ 1, 2 }));
+
+	EXPECT_EQ(index.GetLedgerCloseSubscribers(), std::set<int64_t>({ 4 }));
+}
+
+TEST_F(event_index_utest, UT_Remove_Subscription){ UT_Remove_Subscription(); }
+void event_index_utest::UT_Remove_Subscription(){
+	bumo::EventIndex index;
+	bumo::EventIndex::Filter filter;
+	filter.accounts_.insert("a");
+	filter.ledger_close_ = true;
+	index.Set(1, filter);
+
+	//Setting again replaces the filter
+	filter = bumo::EventIndex::Filter();
+	filter.accounts_.insert("b");
+	index.Set(1, filter);
+
+	std::set<int64_t> conn_ids;
+	index.MatchTransaction(NewTx("a", "x", ""), conn_ids);
+	EXPECT_TRUE(conn_ids.empty());
+	index.MatchTransaction(NewTx("b", "x", ""), conn_ids);
+	EXPECT_EQ(conn_ids, std::set<int64_t>({ 1 }));
+	EXPECT_TRUE(index.GetLedgerCloseSubscribers().empty());
+
+	index.Remove(1);
+	conn_ids.clear();
+	index.MatchTransaction(NewTx("b", "x", ""), conn_ids);
+	EXPECT_TRUE(conn_ids.empty());
+
+	Json::Value status;
+	index.GetModuleStatus(status);
+	EXPECT_EQ(status["subscriptions"].asUInt64(), 0);
+	EXPECT_EQ(status["accounts"].asUInt64(), 0);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "utils/hash_batch.h"
+#include "utils/sm3.h"
+#include "utils/strings.h"
+#include "utils/timestamp.h"
+
+class hash_batch_utest : public testing::Test{
+protected:
+
+	// Sets up the test fixture.
+	virtual void SetUp(){
+	}
+
+	// Tears down the test fixture.
+	virtual void TearDown(){
+	}
+
+protected:
+	static std::string Scalar(utils::HashBatch::Algorithm algorithm, const std::string &input);
+	void UT_Known_Answer();
+	void UT_Match_Scalar();
+	void UT_Benchmark(utils::HashBatch::Algorithm algorithm, uint32_t count, size_t size);
+};
+
+std::string hash_batch_utest::Scalar(utils::HashBatch::Algorithm algorithm, const std::string &input){
+	return algorithm == utils::HashBatch::ALGORITHM_SM3 ? utils::Sm3::Crypto(input) : utils::Sha256::Crypto(input);
+}
+
+TEST_F(hash_batch_utest, UT_Known_Answer){ UT_Known_Answer(); }
+void hash_batch_utest::UT_Known_Answer(){
+	//Sample messages of GB/T 32905 and FIPS 180-2, repeated so that the eight lanes are used
+	std::string abc = "abc";
+	std::string sm3_long;
+	for (int i = 0; i < 16; i++){
+		sm3_long += "abcd";
+	}
+	std::string sha_long = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+
+	std::vector<const std::string *> inputs;
+	for (int i = 0; i < 8; i++){
+		inputs.push_back(&abc);
+		inputs.push_back(&sm3_long);
+		inputs.push_back(&sha_long);
+	}
+
+	std::vector<std::string> outputs;
+	utils::HashBatch::Crypto(utils::HashBatch::ALGORITHM_SM3, inputs, outputs);
+	ASSERT_EQ(outputs.size(), inputs.size());
+	for (size_t i = 0; i < inputs.size(); i += 3){
+		EXPECT_EQ(utils::String::BinToHexString(outputs[i]), "66c7f0f462eeedd9d1f2d46bdc10e4e24167c4875cf2f7a2297da02b8f4ba8e0");
+		EXPECT_EQ(utils::String::BinToHexString(outputs[i + 1]), "debe9ff92275b8a138604889c18e5a4d6fdb70e5387e5765293dcba39c0c5732");
+	}
+
+	utils::HashBatch::Crypto(utils::HashBatch::ALGORITHM_SHA256, inputs, outputs);
+	ASSERT_EQ(outputs.size(), inputs.size());
+	for (size_t i = 0; i < inputs.size(); i += 3){
+		EXPECT_EQ(utils::String::BinToHexString(outputs[i]), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+		EXPECT_EQ(utils::String::BinToHexString(outputs[i + 2]), "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+	}
+}
+
+TEST_F(hash_batch_utest, UT_Match_Scalar){ UT_Match_Scalar(); }
+void hash_batch_utest::UT_Match_Scalar(){
+	std::mt19937 rng(32);
+	for (uint32_t round = 0; round < 200; round++){
+		//Lengths around the block and padding boundaries, and batches that leave a lane group short
+		std::vector<std::string> data(rng() % 40);
+		std::vector<const std::string *> inputs;
+		for (size_t i = 0; i < data.size(); i++){
+			data[i].resize(rng() % (round % 2 == 0 ? 130 : 1000));
+			for (size_t j = 0; j < data[i].size(); j++){
+				data[i][j] = (char)rng();
+			}
+			inputs.push_back(&data[i]);
+		}
+
+		for (int algorithm = utils::HashBatch::ALGORITHM_SHA256; algorithm <= utils::HashBatch::ALGORITHM_SM3; algorithm++){
+			std::vector<std::string> outputs;
+			utils::HashBatch::Crypto((utils::HashBatch::Algorithm)algorithm, inputs, outputs);
+			ASSERT_EQ(outputs.size(), data.size());
+			for (size_t i = 0; i < data.size(); i++){
+				EXPECT_EQ(outputs[i], Scalar((utils::HashBatch::Algorithm)algorithm, data[i]));
+			}
+		}
+	}
+}
+
+void hash_batch_utest::UT_Benchmark(utils::HashBatch::Algorithm algorithm, uint32_t count, size_t size){
+	std::mt19937 rng(64);
+	std::vector<std::string> data(count);
+	std::vector<const std::string *> inputs;
+	for (size_t i = 0; i < data.size(); i++){
+		data[i].resize(size);
+		for (size_t j = 0; j < size; j++){
+			data[i][j] = (char)rng();
+		}
+		inputs.push_back(&data[i]);
+	}
+
+	std::vector<std::string> outputs;
+	int64_t begin = utils::Timestamp::HighResolution();
+	utils::HashBatch::Crypto(algorithm, inputs, outputs);
+	int64_t batched = utils::Timestamp::HighResolution();
+	std::string output;
+	for (size_t i = 0; i < data.size(); i++){
+		output = Scalar(algorithm, data[i]);
+	}
+	int64_t scalar = utils::Timestamp::HighResolution();
+
+	printf("%s %u x %u bytes (multi-buffer %s): batch " FMT_I64 "us, scalar " FMT_I64 "us\n",
+		algorithm == utils::HashBatch::ALGORITHM_SM3 ? "sm3" : "sha256", count, (uint32_t)size,
+		utils::HashBatch::MultiBuffer(algorithm) ? "on" : "off", batched - begin, scalar - batched);
+}
+
+//Benchmarks, run them with --gtest_also_run_disabled_tests
+TEST_F(hash_batch_utest, DISABLED_UT_Benchmark_Sm3){ UT_Benchmark(utils::HashBatch::ALGORITHM_SM3, 100000, 200); }
+TEST_F(hash_batch_utest, DISABLED_UT_Benchmark_Sha256){ UT_Benchmark(utils::HashBatch::ALGORITHM_SHA256, 100000, 200); }
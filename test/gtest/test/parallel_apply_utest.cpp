@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include "utils/strings.h"
+#include "common/general.h"
+#include "common/private_key.h"
+#include "common/storage.h"
+#include "main/configure.h"
+#include "ledger/ledger_manager.h"
+#include "ledger/ledgercontext_manager.h"
+#include "ledger/kv_trie.h"
+
+//Applies the same txset in order and ahead on worker threads over a genesis ledger, the results must be the same
+class parallel_apply_utest : public testing::Test{
+protected:
+
+	// Sets up the test case.
+	static void SetUpTestCase(){
+		bumo::Configure::InitInstance();
+		bumo::Storage::InitInstance();
+		bumo::Global::InitInstance();
+		bumo::ParallelWorker::InitInstance();
+		bumo::LedgerManager::InitInstance();
+
+		bumo::Configure &config = bumo::Configure::Instance();
+		config.db_configure_.keyvalue_db_path_ = "parallel_apply_utest/keyvalue.db";
+		config.db_configure_.ledger_db_path_ = "parallel_apply_utest/ledger.db";
+		config.db_configure_.account_db_path_ = "parallel_apply_utest/account.db";
+		config.ledger_configure_.async_commit_enabled_ = false;
+		config.genesis_configure_.account_ = NewAddress();
+		config.genesis_configure_.validators_.push_back(NewAddress());
+		config.genesis_configure_.chain_id_ = 0;
+		config.genesis_configure_.fees_.gas_price_ = 1000;
+		config.genesis_configure_.fees_.base_reserve_ = 10000000;
+
+		bumo::Storage::Instance().Initialize(config.db_configure_, true);
+		ASSERT_TRUE(bumo::Storage::Instance().Initialize(config.db_configure_, false));
+		ASSERT_TRUE(bumo::ParallelWorker::Instance().Initialize(4));
+		ASSERT_TRUE(bumo::LedgerManager::Instance().Initialize());
+	}
+
+	// Tears down the test case.
+	static void TearDownTestCase(){
+		bumo::LedgerManager::Instance().Exit();
+		bumo::ParallelWorker::Instance().Exit();
+		bumo::Storage::Instance().Exit();
+		bumo::Storage::Instance().Initialize(bumo::Configure::Instance().db_configure_, true);
+
+		bumo::LedgerManager::ExitInstance();
+		bumo::ParallelWorker::ExitInstance();
+		bumo::Global::ExitInstance();
+		bumo::Storage::ExitInstance();
+		bumo::Configure::ExitInstance();
+	}
+
+protected:
+	struct Outcome{
+		std::vector<std::string> tx_results_;
+		std::string validation_;
+		std::string account_tree_hash_;
+		std::string ledger_hash_;
+	};
+
+	static std::string NewAddress();
+	static protocol::Transaction *AddTx(protocol::ConsensusValue &value, const std::string &source, int64_t nonce);
+	static void AddPayCoin(protocol::ConsensusValue &value, const std::string &source, int64_t nonce, const std::string &dest, int64_t amount);
+	static Outcome Apply(const protocol::ConsensusValue &value, bool parallel);
+	void UT_Serial_Parallel_Same();
+};
+
+std::string parallel_apply_utest::NewAddress(){
+	bumo::PrivateKey priv_key(bumo::SIGNTYPE_ED25519);
+	return priv_key.GetEncAddress();
+}
+
+protocol::Transaction *parallel_apply_utest::AddTx(protocol::ConsensusValue &value, const std::string &source, int64_t nonce){
+	protocol::Transaction *tran = value.mutable_txset()->add_txs()->mutable_transaction();
+	tran->set_source_address(source);
+	tran->set_nonce(nonce);
+	tran->set_fee_limit(10000000);
+	tran->set_gas_price(1000);
+	return tran;
+}
+
+void parallel_apply_utest::AddPayCoin(protocol::ConsensusValue &value, const std::string &source, int64_t nonce, const std::string &dest, int64_t amount){
+	protocol::Operation *ope = AddTx(value, source, nonce)->add_operations();
+	ope->set_type(protocol::Operation_Type_PAY_COIN);
+	ope->mutable_pay_coin()->set_dest_address(dest);
+	ope->mutable_pay_coin()->set_amount(amount);
+}
+
+parallel_apply_utest::Outcome parallel_apply_utest::Apply(const protocol::ConsensusValue &value, bool parallel){
+	bumo::Configure::Instance().ledger_configure_.parallel_apply_enabled_ = parallel;
+
+	//Signatures are not checked in the test mode
+	bumo::LedgerContext context("", value);
+	bumo::LedgerFrm::pointer ledger = context.closing_ledger_;
+	ledger->SetTestMode(true);
+	bumo::ProposeTxsResult result;
+	EXPECT_TRUE(ledger->ApplyPropose(value, &context, result));
+
+	Outcome outcome;
+	for (size_t i = 0; i < ledger->apply_tx_frms_.size(); i++){
+		const bumo::TransactionFrm::pointer &tx = ledger->apply_tx_frms_[i];
+		outcome.tx_results_.push_back(utils::String::Format("%s %d %s " FMT_I64, utils::String::BinToHexString(tx->GetContentHash()).c_str(),
+			tx->GetResult().code(), tx->GetResult().desc().c_str(), tx->GetActualGas()));
+	}
+	for (auto iter = result.need_dropped_tx_.begin(); iter != result.need_dropped_tx_.end(); iter++){
+		outcome.tx_results_.push_back(utils::String::Format("dropped %d", *iter));
+	}
+	outcome.validation_ = result.cons_validation_.SerializeAsString();
+
+	//A trie over the last closed ledger, the changes stay in its batch
+	bumo::KVTrie trie;
+	std::shared_ptr<WRITE_BATCH> batch = std::make_shared<WRITE_BATCH>();
+	trie.Init(bumo::Storage::Instance().account_db(), batch, bumo::General::ACCOUNT_PREFIX, 4);
+	int64_t new_count = 0, change_count = 0;
+	EXPECT_TRUE(ledger->Commit(&trie, new_count, change_count));
+	trie.UpdateHash();
+	outcome.account_tree_hash_ = trie.GetRootHash();
+
+	protocol::LedgerHeader *header = ledger->ProtoLedger().mutable_header();
+	header->set_seq(value.ledger_seq());
+	header->set_close_time(value.close_time());
+	header->set_account_tree_hash(outcome.account_tree_hash_);
+	header->set_tx_count(ledger->GetTxCount());
+	header->set_hash("");
+	outcome.ledger_hash_ = bumo::HashWrapper::Crypto(ledger->ProtoLedger().SerializeAsString());
+	return outcome;
+}
+
+TEST_F(parallel_apply_utest, UT_Serial_Parallel_Same){ UT_Serial_Parallel_Same(); }
+void parallel_apply_utest::UT_Serial_Parallel_Same(){
+	const protocol::LedgerHeader lcl = bumo::LedgerManager::Instance().GetLastClosedLedger();
+	const std::string genesis = bumo::Configure::Instance().genesis_configure_.account_;
+	protocol::ConsensusValue value;
+	value.set_ledger_seq(lcl.seq() + 1);
+	value.set_close_time(lcl.close_time() + 10 * utils::MICRO_UNITS_PER_SEC);
+	value.set_previous_ledger_hash(lcl.hash());
+
+	//The genesis account creates the accounts in order, the later transactions depend on them
+	std::vector<std::string> accounts;
+	for (int64_t i = 0; i < 6; i++){
+		accounts.push_back(NewAddress());
+		protocol::Operation *ope = AddTx(value, genesis, i + 1)->add_operations();
+		ope->set_type(protocol::Operation_Type_CREATE_ACCOUNT);
+		protocol::OperationCreateAccount *create_account = ope->mutable_create_account();
+		create_account->set_dest_address(accounts[i]);
+		create_account->set_init_balance(100000000);
+		create_account->mutable_priv()->set_master_weight(1);
+		create_account->mutable_priv()->mutable_thresholds()->set_tx_threshold(1);
+	}
+
+	//Disjoint and overlapping footprints
+	AddPayCoin(value, accounts[0], 1, accounts[1], 1000);
+	AddPayCoin(value, accounts[2], 1, accounts[3], 1000);
+	AddPayCoin(value, accounts[0], 2, accounts[2], 1000);
+	AddPayCoin(value, accounts[1], 1, genesis, 1000);
+	AddPayCoin(value, genesis, 7, accounts[0], 1000);
+	AddPayCoin(value, accounts[2], 2, NewAddress(), 20000000);
+
+	//Failed: low balance, bad nonce and a missing source account
+	AddPayCoin(value, accounts[4], 1, accounts[5], 200000000);
+	AddPayCoin(value, accounts[5], 5, accounts[4], 1000);
+	AddPayCoin(value, NewAddress(), 1, accounts[4], 1000);
+
+	//Not a payment
+	protocol::Operation *ope = AddTx(value, accounts[3], 1)->add_operations();
+	ope->set_type(protocol::Operation_Type_SET_METADATA);
+	ope->mutable_set_metadata()->set_key("key");
+	ope->mutable_set_metadata()->set_value("value");
+
+	Outcome serial = Apply(value, false);
+	Outcome parallel = Apply(value, true);
+	EXPECT_EQ(serial.tx_results_.size(), (size_t)value.txset().txs_size());
+	EXPECT_EQ(serial.tx_results_, parallel.tx_results_);
+	EXPECT_EQ(serial.validation_, parallel.validation_);
+	EXPECT_EQ(serial.account_tree_hash_, parallel.account_tree_hash_);
+	EXPECT_EQ(serial.ledger_hash_, parallel.ledger_hash_);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <proto/cpp/chain.pb.h>
+#include "common/pb2json.h"
+#include "utils/timestamp.h"
+
+class pb2json_utest : public testing::Test{
+protected:
+
+	// Sets up the test fixture.
+	virtual void SetUp(){
+	}
+
+	// Tears down the test fixture.
+	virtual void TearDown(){
+	}
+
+protected:
+	static std::string RandomString(std::mt19937 &rng, bool binary);
+	static void NewTx(std::mt19937 &rng, protocol::TransactionEnv &env);
+	void UT_Match_Tree();
+	void UT_Benchmark(uint32_t tx_count);
+};
+
+std::string pb2json_utest::RandomString(std::mt19937 &rng, bool binary){
+	//Text strings also get control characters, quotes and backslashes to escape
+	std::string value(rng() % 20, '\0');
+	for (size_t i = 0; i < value.size(); i++){
+		value[i] = binary ? (char)rng() : (char)(rng() % 4 == 0 ? rng() % 128 : 'a' + rng() % 26);
+	}
+	return value;
+}
+
+void pb2json_utest::NewTx(std::mt19937 &rng, protocol::TransactionEnv &env){
+	protocol::Transaction *tran = env.mutable_transaction();
+	if (rng() % 5 != 0) tran->set_source_address(RandomString(rng, false));
+	tran->set_nonce((int64_t)rng() * (rng() % 2 == 0 ? -100000 : 100000));
+	tran->set_fee_limit(rng());
+	tran->set_gas_price(rng() % 3);
+	tran->set_metadata(RandomString(rng, true));
+	for (uint32_t i = rng() % 4; i > 0; i--){
+		protocol::Operation *ope = tran->add_operations();
+		ope->set_type((protocol::Operation_Type)(rng() % 10));
+		if (rng() % 2 == 0) ope->set_source_address(RandomString(rng, false));
+		if (rng() % 3 == 0) ope->mutable_pay_coin();
+		if (rng() % 2 == 0){
+			protocol::AccountPrivilege *priv = ope->mutable_create_account()->mutable_priv();
+			priv->set_master_weight(rng());
+			protocol::Signer *signer = priv->add_signers();
+			signer->set_address(RandomString(rng, false));
+			signer->set_weight(rng() % 100);
+		}
+	}
+	for (uint32_t i = rng() % 3; i > 0; i--){
+		protocol::Signature *signature = env.add_signatures();
+		signature->set_public_key(RandomString(rng, false));
+		signature->set_sign_data(RandomString(rng, true));
+	}
+}
+
+TEST_F(pb2json_utest, UT_Match_Tree){ UT_Match_Tree(); }
+void pb2json_utest::UT_Match_Tree(){
+	std::mt19937 rng(45);
+	for (uint32_t round = 0; round < 2000; round++){
+		//Empty transactions and messages give null members
+		protocol::ConsensusValue value;
+		for (uint32_t i = rng() % 4; i > 0; i--){
+			protocol::TransactionEnv *env = value.mutable_txset()->add_txs();
+			if (rng() % 6 != 0) NewTx(rng, *env);
+		}
+		if (rng() % 2 == 0) value.set_close_time(rng());
+		if (rng() % 2 == 0) value.set_previous_proof(RandomString(rng, true));
+		if (rng() % 2 == 0) value.set_ledger_seq(-(int64_t)rng());
+		if (rng() % 3 == 0){
+			value.mutable_validation()->add_expire_tx_ids(-(int32_t)(rng() % 5));
+			value.mutable_validation()->add_error_tx_ids(rng() % 9);
+		}
+
+		std::string streamed;
+		bumo::Proto2JsonWrite(value, streamed);
+		EXPECT_EQ(streamed, bumo::Proto2Json(value).toFastString());
+	}
+}
+
+void pb2json_utest::UT_Benchmark(uint32_t tx_count){
+	std::mt19937 rng(46);
+	protocol::ConsensusValue value;
+	for (uint32_t i = 0; i < tx_count; i++){
+		NewTx(rng, *value.mutable_txset()->add_txs());
+	}
+
+	int64_t begin = utils::Timestamp::HighResolution();
+	std::string tree = bumo::Proto2Json(value).toFastString();
+	int64_t tree_time = utils::Timestamp::HighResolution();
+	std::string streamed;
+	bumo::Proto2JsonWrite(value, streamed);
+	int64_t streamed_time = utils::Timestamp::HighResolution();
+
+	EXPECT_EQ(streamed, tree);
+	printf("txset(%u): tree " FMT_I64 "us, stream " FMT_I64 "us, " FMT_SIZE " bytes\n",
+		tx_count, tree_time - begin, streamed_time - tree_time, streamed.size());
+}
+
+//Benchmark, run it with --gtest_also_run_disabled_tests
+TEST_F(pb2json_utest, DISABLED_UT_Benchmark_10K){ UT_Benchmark(10000); }
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include "api/response_cache.h"
+
+class response_cache_utest : public testing::Test{
+protected:
+
+	// Sets up the test fixture.
+	virtual void SetUp(){
+	}
+
+	// Tears down the test fixture.
+	virtual void TearDown(){
+	}
+
+protected:
+	static Json::Value Status(bumo::ResponseCache &cache);
+	void UT_Eviction_Order();
+	void UT_Replace_Bytes();
+	void UT_Match_ETag();
+};
+
+Json::Value response_cache_utest::Status(bumo::ResponseCache &cache){
+	Json::Value status;
+	cache.GetModuleStatus(status);
+	return status;
+}
+
+TEST_F(response_cache_utest, UT_Eviction_Order){ UT_Eviction_Order(); }
+void response_cache_utest::UT_Eviction_Order(){
+	//Each entry takes 10 bytes, the key and the content
+	bumo::ResponseCache cache(30);
+	cache.Put("a", "123456789");
+	cache.Put("b", "123456789");
+	cache.Put("c", "123456789");
+	EXPECT_EQ(Status(cache)["bytes"].asUInt64(), 30);
+
+	//Reading a makes b the least recently used one
+	EXPECT_TRUE(cache.Get("a") != NULL);
+	cache.Put("d", "123456789");
+	EXPECT_TRUE(cache.Get("b") == NULL);
+	EXPECT_TRUE(cache.Get("a") != NULL);
+	EXPECT_TRUE(cache.Get("c") != NULL);
+	EXPECT_TRUE(cache.Get("d") != NULL);
+
+	//A bigger entry evicts as many as needed, least recently used first
+	cache.Put("e", "1234567890123456789");
+	EXPECT_TRUE(cache.Get("a") == NULL);
+	EXPECT_TRUE(cache.Get("c") == NULL);
+	EXPECT_TRUE(cache.Get("d") != NULL);
+	EXPECT_TRUE(cache.Get("e") != NULL);
+	EXPECT_EQ(Status(cache)["bytes"].asUInt64(), 30);
+
+	//An entry over the limit is returned but not kept
+	bumo::ResponseCache::EntryPointer entry = cache.Put("f", std::string(40, 'x'));
+	EXPECT_EQ(entry->content, std::string(40, 'x'));
+	EXPECT_FALSE(entry->etag.empty());
+	EXPECT_TRUE(cache.Get("f") == NULL);
+	EXPECT_TRUE(cache.Get("d") != NULL);
+	EXPECT_EQ(Status(cache)["count"].asUInt64(), 2);
+}
+
+TEST_F(response_cache_utest, UT_Replace_Bytes){ UT_Replace_Bytes(); }
+void response_cache_utest::UT_Replace_Bytes(){
+	bumo::ResponseCache cache(30);
+	cache.Put("a", "123456789");
+	cache.Put("b", "123456789");
+	EXPECT_EQ(Status(cache)["bytes"].asUInt64(), 20);
+
+	//Replacing counts only the new content
+	cache.Put("a", "1234");
+	EXPECT_EQ(Status(cache)["bytes"].asUInt64(), 15);
+	EXPECT_EQ(Status(cache)["count"].asUInt64(), 2);
+	EXPECT_EQ(cache.Get("a")->content, "1234");
+
+	cache.Put("a", "1234567890123456789");
+	EXPECT_EQ(Status(cache)["bytes"].asUInt64(), 30);
+
+	//The replaced entry is the most recently used one
+	cache.Put("c", "1234");
+	EXPECT_TRUE(cache.Get("b") == NULL);
+	EXPECT_TRUE(cache.Get("a") != NULL);
+	EXPECT_EQ(Status(cache)["bytes"].asUInt64(), 25);
+}
+
+TEST_F(response_cache_utest, UT_Match_ETag){ UT_Match_ETag(); }
+void response_cache_utest::UT_Match_ETag(){
+	bumo::ResponseCache cache(1024);
+	std::string etag = cache.Put("a", "content")->etag;
+	EXPECT_EQ(etag, cache.Put("b", "content")->etag);
+	EXPECT_NE(etag, cache.Put("c", "other")->etag);
+	EXPECT_EQ(etag.front(), '"');
+	EXPECT_EQ(etag.back(), '"');
+
+	EXPECT_TRUE(bumo::ResponseCache::MatchETag(etag, etag));
+	EXPECT_TRUE(bumo::ResponseCache::MatchETag("*", etag));
+	EXPECT_TRUE(bumo::ResponseCache::MatchETag("W/" + etag, etag));
+	EXPECT_TRUE(bumo::ResponseCache::MatchETag("\"0000\", " + etag, etag));
+	EXPECT_TRUE(bumo::ResponseCache::MatchETag("\"0000\",W/" + etag + " ,\"1111\"", etag));
+
+	EXPECT_FALSE(bumo::ResponseCache::MatchETag("", etag));
+	EXPECT_FALSE(bumo::ResponseCache::MatchETag("\"0000\", W/\"1111\"", etag));
+	EXPECT_FALSE(bumo::ResponseCache::MatchETag(etag.substr(1, etag.size() - 2), etag));
+}
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <unordered_map>
+#include <thread>
+#include "utils/timestamp.h"
+#include "glue/transaction_queue.h"
+
+class transaction_queue_utest : public testing::Test{
+protected:
+
+	// Sets up the test fixture.
+	virtual void SetUp(){
+	}
+
+	// Tears down the test fixture.
+	virtual void TearDown(){
+	}
+
+protected:
+	static bumo::TransactionFrm::pointer NewTx(const std::string &source, int64_t nonce, int64_t gas_price);
+	void UT_Top_Transaction_Order();
+	void UT_Concurrent_Import();
+	void UT_Batch_Import();
+	void UT_Benchmark(uint32_t queue_size);
+};
+
+bumo::TransactionFrm::pointer transaction_queue_utest::NewTx(const std::string &source, int64_t nonce, int64_t gas_price){
+	protocol::TransactionEnv env;
+	protocol::Transaction *tran = env.mutable_transaction();
+	tran->set_source_address(source);
+	tran->set_nonce(nonce);
+	tran->set_gas_price(gas_price);
+	tran->set_fee_limit(gas_price * 1000);
+	return std::make_shared<bumo::TransactionFrm>(env);
+}
+
+TEST_F(transaction_queue_utest, UT_Top_Transaction_Order){ UT_Top_Transaction_Order(); }
+void transaction_queue_utest::UT_Top_Transaction_Order(){
+	bumo::TransactionQueue queue(100, 10);
+	bumo::Result result;
+
+	//a: 1(p10) 2(p30); b: 1(p20); c: 3(p50) has a nonce gap
+	EXPECT_TRUE(queue.Import(NewTx("a", 2, 30), 0, result));
+	EXPECT_TRUE(queue.Import(NewTx("a", 1, 10), 0, result));
+	EXPECT_TRUE(queue.Import(NewTx("b", 1, 20), 0, result));
+	EXPECT_TRUE(queue.Import(NewTx("c", 3, 50), 0, result));
+	EXPECT_EQ(queue.Size(), 4);
+
+	protocol::TransactionEnvSet set = queue.TopTransaction(10);
+	ASSERT_EQ(set.txs_size(), 3);
+	EXPECT_EQ(set.txs(0).transaction().source_address(), "b");
+	EXPECT_EQ(set.txs(1).transaction().source_address(), "a");
+	EXPECT_EQ(set.txs(1).transaction().nonce(), 1);
+	EXPECT_EQ(set.txs(2).transaction().source_address(), "a");
+	EXPECT_EQ(set.txs(2).transaction().nonce(), 2);
+
+	//Replacing needs at least 10% more gas price
+	EXPECT_FALSE(queue.Import(NewTx("a", 1, 10), 0, result));
+	EXPECT_TRUE(queue.Import(NewTx("a", 1, 40), 0, result));
+	set = queue.TopTransaction(1);
+	ASSERT_EQ(set.txs_size(), 1);
+	EXPECT_EQ(set.txs(0).transaction().source_address(), "a");
+	EXPECT_EQ(queue.Size(), 4);
+}
+
+TEST_F(transaction_queue_utest, UT_Concurrent_Import){ UT_Concurrent_Import(); }
+void transaction_queue_utest::UT_Concurrent_Import(){
+	const uint32_t thread_count = 4;
+	const uint32_t account_count = 1000;
+	const uint32_t nonce_count = 10;
+	bumo::TransactionQueue queue(thread_count * account_count * nonce_count, nonce_count);
+
+	//Threads import for different accounts while the proposal is being selected
+	std::vector<std::thread> threads;
+	for (uint32_t t = 0; t < thread_count; t++){
+		threads.push_back(std::thread([&queue, t, account_count, nonce_count](){
+			for (uint32_t i = 0; i < account_count * nonce_count; i++){
+				bumo::Result result;
+				std::string source = "thread" + std::to_string(t) + "account" + std::to_string(i % account_count);
+				queue.Import(NewTx(source, i / account_count + 1, 1000), 0, result);
+			}
+		}));
+	}
+	for (uint32_t i = 0; i < 10; i++){
+		queue.TopTransaction(1000);
+	}
+	for (size_t t = 0; t < threads.size(); t++){
+		threads[t].join();
+	}
+
+	EXPECT_EQ(queue.Size(), thread_count * account_count * nonce_count);
+	protocol::TransactionEnvSet set = queue.TopTransaction(thread_count * account_count * nonce_count);
+	EXPECT_EQ(set.txs_size(), thread_count * account_count * nonce_count);
+}
+
+TEST_F(transaction_queue_utest, UT_Batch_Import){ UT_Batch_Import(); }
+void transaction_queue_utest::UT_Batch_Import(){
+	bumo::TransactionQueue queue(3, 10);
+
+	//a:1(p11) does not pay enough to replace a:1(p10), a:1(p10) is evicted once the batch overflows the queue
+	std::vector<bumo::TransactionFrm::pointer> txs;
+	txs.push_back(NewTx("a", 1, 10));
+	txs.push_back(NewTx("b", 1, 20));
+	txs.push_back(NewTx("c", 1, 30));
+	txs.push_back(NewTx("a", 1, 11));
+	txs.push_back(NewTx("d", 1, 40));
+	std::vector<int64_t> nonces(txs.size(), 0);
+	std::vector<bumo::Result> results(txs.size());
+
+	EXPECT_EQ(queue.Import(txs, nonces, results), 3);
+	EXPECT_EQ(queue.Size(), 3);
+	EXPECT_EQ(results[0].code(), protocol::ERRCODE_TX_INSERT_QUEUE_FAIL);
+	EXPECT_EQ(results[1].code(), protocol::ERRCODE_SUCCESS);
+	EXPECT_EQ(results[2].code(), protocol::ERRCODE_SUCCESS);
+	EXPECT_EQ(results[3].code(), protocol::ERRCODE_TX_INSERT_QUEUE_FAIL);
+	EXPECT_EQ(results[4].code(), protocol::ERRCODE_SUCCESS);
+
+	protocol::TransactionEnvSet set = queue.TopTransaction(10);
+	ASSERT_EQ(set.txs_size(), 3);
+	EXPECT_EQ(set.txs(0).transaction().source_address(), "d");
+	EXPECT_EQ(set.txs(2).transaction().source_address(), "b");
+}
+
+void transaction_queue_utest::UT_Benchmark(uint32_t queue_size){
+	const uint32_t account_txs_limit = 64;
+	const uint32_t top_limit = 5000;
+	bumo::TransactionQueue queue(queue_size, account_txs_limit);
+
+	std::vector<bumo::TransactionFrm::pointer> txs;
+	txs.reserve(queue_size);
+	uint32_t accounts = queue_size / account_txs_limit + 1;
+	for (uint32_t i = 0; i < queue_size; i++){
+		//Only one account in ten is executable, the others wait behind a nonce gap
+		uint32_t account = i % accounts;
+		int64_t first_nonce = (account % 10 == 0) ? 1 : 2;
+		txs.push_back(NewTx("account" + std::to_string(account), i / accounts + first_nonce, 1000 + (i * 7919) % 1000));
+	}
+
+	int64_t begin = utils::Timestamp::HighResolution();
+	for (size_t i = 0; i < txs.size(); i++){
+		bumo::Result result;
+		queue.Import(txs[i], 0, result);
+	}
+	int64_t imported = utils::Timestamp::HighResolution();
+	protocol::TransactionEnvSet set = queue.TopTransaction(top_limit);
+	int64_t topped = utils::Timestamp::HighResolution();
+
+	EXPECT_EQ(queue.Size(), queue_size);
+	EXPECT_EQ(set.txs_size(), top_limit);
+
+	//Every account must appear in nonce order without gaps
+	std::unordered_map<std::string, int64_t> last_nonce;
+	for (int i = 0; i < set.txs_size(); i++){
+		const protocol::Transaction &tran = set.txs(i).transaction();
+		EXPECT_EQ(tran.nonce(), last_nonce[tran.source_address()] + 1);
+		last_nonce[tran.source_address()] = tran.nonce();
+	}
+
+	printf("queue size(%u): import " FMT_I64 "us, top(%u) " FMT_I64 "us\n",
+		queue_size, imported - begin, top_limit, topped - imported);
+}
+
+//Benchmarks, run them with --gtest_also_run_disabled_tests
+TEST_F(transaction_queue_utest, DISABLED_UT_Benchmark_100K){ UT_Benchmark(100000); }
+TEST_F(transaction_queue_utest, DISABLED_UT_Benchmark_1M){ UT_Benchmark(1000000); }
@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+#include "common/private_key.h"
+
+class verify_key_utest : public testing::Test{
+protected:
+
+	// Sets up the test fixture.
+	virtual void SetUp(){
+	}
+
+	// Tears down the test fixture.
+	virtual void TearDown(){
+	}
+
+protected:
+	void UT_Verify(bumo::SignatureType type);
+};
+
+void verify_key_utest::UT_Verify(bumo::SignatureType type){
+	bumo::PrivateKey key(type);
+	bumo::PrivateKey other(type);
+	ASSERT_TRUE(key.IsValid());
+	ASSERT_TRUE(other.IsValid());
+
+	std::string data = "hello bumo";
+	std::string signature = key.Sign(data);
+	std::string tampered = signature;
+	tampered[10] ^= 0x01;
+
+	//The second round runs on the cached key
+	for (int round = 0; round < 2; round++){
+		EXPECT_TRUE(bumo::PublicKey::Verify(data, signature, key.GetEncPublicKey()));
+		EXPECT_FALSE(bumo::PublicKey::Verify(data + "1", signature, key.GetEncPublicKey()));
+		EXPECT_FALSE(bumo::PublicKey::Verify(data, tampered, key.GetEncPublicKey()));
+		EXPECT_FALSE(bumo::PublicKey::Verify(data, signature + "1", key.GetEncPublicKey()));
+		EXPECT_FALSE(bumo::PublicKey::Verify(data, signature, other.GetEncPublicKey()));
+		EXPECT_FALSE(bumo::PublicKey::Verify(data, signature, "invalid public key"));
+	}
+
+	if (type == bumo::SIGNTYPE_CFCASM2){
+		//The prepared key gives the same answers as the one-shot verify
+		utils::EccSm2::VerifyKey sm2_key(utils::EccSm2::GetCFCAGroup(), key.GetRawPublicKey(), "1234567812345678");
+		EXPECT_EQ(sm2_key.Verify(data, signature), utils::EccSm2::verify(utils::EccSm2::GetCFCAGroup(), key.GetRawPublicKey(), "1234567812345678", data, signature));
+		EXPECT_EQ(sm2_key.Verify(data, tampered), utils::EccSm2::verify(utils::EccSm2::GetCFCAGroup(), key.GetRawPublicKey(), "1234567812345678", data, tampered));
+	}
+}
+
+TEST_F(verify_key_utest, UT_Verify_Ed25519){ UT_Verify(bumo::SIGNTYPE_ED25519); }
+TEST_F(verify_key_utest, UT_Verify_Sm2){ UT_Verify(bumo::SIGNTYPE_CFCASM2); }